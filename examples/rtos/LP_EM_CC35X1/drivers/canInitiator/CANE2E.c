@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANE2E.c ========
+ */
+
+#include <string.h>
+
+#include "CANE2E.h"
+
+/* Slicing-by-4 tables. Entry [k][x] is the CRC of byte x followed by k zero bytes. */
+static uint8_t crc8Table[4][256];
+static uint16_t crc16Table[4][256];
+
+static uint8_t crcSize(const CANE2E_Config *config);
+static bool isValidLength(const CANE2E_Config *config, size_t length);
+static uint16_t computeCrc(const CANE2E_Config *config, const uint8_t *data, size_t length);
+
+/*
+ *  ======== CANE2E_init ========
+ */
+void CANE2E_init(void)
+{
+    uint32_t x;
+    uint32_t k;
+    uint32_t bit;
+    uint8_t crc8;
+    uint16_t crc16;
+
+    for (x = 0U; x < 256U; x++)
+    {
+        crc8  = (uint8_t)x;
+        crc16 = (uint16_t)(x << 8);
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc8  = ((crc8 & 0x80U) != 0U) ? (uint8_t)((crc8 << 1) ^ 0x1DU) : (uint8_t)(crc8 << 1);
+            crc16 = ((crc16 & 0x8000U) != 0U) ? (uint16_t)((crc16 << 1) ^ 0x1021U) : (uint16_t)(crc16 << 1);
+        }
+
+        crc8Table[0][x]  = crc8;
+        crc16Table[0][x] = crc16;
+    }
+
+    for (k = 1U; k < 4U; k++)
+    {
+        for (x = 0U; x < 256U; x++)
+        {
+            crc8Table[k][x]  = crc8Table[0][crc8Table[k - 1U][x]];
+            crc16Table[k][x] = (uint16_t)(crc16Table[k - 1U][x] << 8) ^ crc16Table[0][crc16Table[k - 1U][x] >> 8];
+        }
+    }
+}
+
+/*
+ *  ======== CANE2E_construct ========
+ */
+void CANE2E_construct(CANE2E_Object *obj, const CANE2E_Config *config)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->config = *config;
+}
+
+/*
+ *  ======== CANE2E_protect ========
+ */
+bool CANE2E_protect(CANE2E_Object *obj, uint8_t *data, size_t length)
+{
+    uint16_t crc;
+
+    if (!isValidLength(&obj->config, length))
+    {
+        return false;
+    }
+
+    data[obj->config.counterOffset] = obj->counter;
+    obj->counter++;
+
+    crc = computeCrc(&obj->config, data, length);
+
+    if (obj->config.crcType == CANE2E_CRC8)
+    {
+        data[obj->config.crcOffset] = (uint8_t)crc;
+    }
+    else
+    {
+        data[obj->config.crcOffset]      = (uint8_t)(crc >> 8);
+        data[obj->config.crcOffset + 1U] = (uint8_t)crc;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== CANE2E_check ========
+ */
+CANE2E_Status CANE2E_check(CANE2E_Object *obj, const uint8_t *data, size_t length)
+{
+    uint16_t rxCrc;
+    uint8_t counter;
+    uint8_t delta;
+    CANE2E_Status status;
+
+    obj->stats.checkCnt++;
+
+    if (!isValidLength(&obj->config, length))
+    {
+        obj->stats.errorCnt++;
+        return CANE2E_ERROR;
+    }
+
+    if (obj->config.crcType == CANE2E_CRC8)
+    {
+        rxCrc = data[obj->config.crcOffset];
+    }
+    else
+    {
+        rxCrc = (uint16_t)((uint16_t)data[obj->config.crcOffset] << 8) | data[obj->config.crcOffset + 1U];
+    }
+
+    if (rxCrc != computeCrc(&obj->config, data, length))
+    {
+        obj->stats.errorCnt++;
+        return CANE2E_ERROR;
+    }
+
+    counter = data[obj->config.counterOffset];
+    delta   = (uint8_t)(counter - obj->counter);
+
+    if (!obj->synced)
+    {
+        obj->synced = true;
+        status      = CANE2E_INITIAL;
+    }
+    else if (delta == 0U)
+    {
+        obj->stats.repeatedCnt++;
+        return CANE2E_REPEATED;
+    }
+    else if (delta == 1U)
+    {
+        obj->stats.okCnt++;
+        status = CANE2E_OK;
+    }
+    else if (delta <= obj->config.maxDeltaCounter)
+    {
+        obj->stats.okCnt++;
+        obj->stats.lostCnt += (uint32_t)delta - 1U;
+        status = CANE2E_OK_SOME_LOST;
+    }
+    else
+    {
+        obj->stats.wrongSequenceCnt++;
+        status = CANE2E_WRONG_SEQUENCE;
+    }
+
+    obj->counter = counter;
+
+    return status;
+}
+
+/*
+ *  ======== CANE2E_crc8 ========
+ */
+uint8_t CANE2E_crc8(uint8_t crc, const uint8_t *data, size_t length)
+{
+    while (length >= 4U)
+    {
+        crc = crc8Table[3][crc ^ data[0]] ^ crc8Table[2][data[1]] ^ crc8Table[1][data[2]] ^ crc8Table[0][data[3]];
+        data += 4;
+        length -= 4U;
+    }
+
+    while (length > 0U)
+    {
+        crc = crc8Table[0][crc ^ *data];
+        data++;
+        length--;
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== CANE2E_crc16 ========
+ */
+uint16_t CANE2E_crc16(uint16_t crc, const uint8_t *data, size_t length)
+{
+    while (length >= 4U)
+    {
+        crc = crc16Table[3][(crc >> 8) ^ data[0]] ^ crc16Table[2][(crc & 0xFFU) ^ data[1]] ^
+              crc16Table[1][data[2]] ^ crc16Table[0][data[3]];
+        data += 4;
+        length -= 4U;
+    }
+
+    while (length > 0U)
+    {
+        crc = (uint16_t)(crc << 8) ^ crc16Table[0][(crc >> 8) ^ *data];
+        data++;
+        length--;
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== crcSize ========
+ */
+static uint8_t crcSize(const CANE2E_Config *config)
+{
+    return (config->crcType == CANE2E_CRC8) ? 1U : 2U;
+}
+
+/*
+ *  ======== isValidLength ========
+ *  Returns true if the CRC and the counter fit in a payload of length bytes
+ *  without overlapping.
+ */
+static bool isValidLength(const CANE2E_Config *config, size_t length)
+{
+    size_t crcEnd = (size_t)config->crcOffset + crcSize(config);
+
+    return (crcEnd <= length) && (config->counterOffset < length) &&
+           ((config->counterOffset < config->crcOffset) || (config->counterOffset >= crcEnd));
+}
+
+/*
+ *  ======== computeCrc ========
+ *  Computes the CRC over the data ID, least significant byte first, and the
+ *  payload bytes before and after the CRC.
+ */
+static uint16_t computeCrc(const CANE2E_Config *config, const uint8_t *data, size_t length)
+{
+    uint8_t dataId[2];
+    size_t crcEnd = (size_t)config->crcOffset + crcSize(config);
+    uint8_t crc8;
+    uint16_t crc16;
+
+    dataId[0] = (uint8_t)config->dataId;
+    dataId[1] = (uint8_t)(config->dataId >> 8);
+
+    if (config->crcType == CANE2E_CRC8)
+    {
+        crc8 = CANE2E_crc8(CANE2E_CRC8_INIT, dataId, sizeof(dataId));
+        crc8 = CANE2E_crc8(crc8, data, config->crcOffset);
+        crc8 = CANE2E_crc8(crc8, &data[crcEnd], length - crcEnd);
+
+        return (uint8_t)(crc8 ^ CANE2E_CRC8_XOR_OUT);
+    }
+
+    crc16 = CANE2E_crc16(CANE2E_CRC16_INIT, dataId, sizeof(dataId));
+    crc16 = CANE2E_crc16(crc16, data, config->crcOffset);
+    crc16 = CANE2E_crc16(crc16, &data[crcEnd], length - crcEnd);
+
+    return (uint16_t)(crc16 ^ CANE2E_CRC16_XOR_OUT);
+}
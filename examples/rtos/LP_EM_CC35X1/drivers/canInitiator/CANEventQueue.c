@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANEventQueue.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "CANEventQueue.h"
+
+#define CANEventQueue_INDEX_MASK (CANEventQueue_SIZE - 1U)
+
+/*
+ *  ======== CANEventQueue_init ========
+ */
+void CANEventQueue_init(CANEventQueue_Object *queue)
+{
+    queue->head          = 0U;
+    queue->tail          = 0U;
+    queue->overflowCnt   = 0U;
+    queue->lastLostEvent = 0U;
+    queue->highWaterMark = 0U;
+}
+
+/*
+ *  ======== CANEventQueue_put ========
+ */
+bool CANEventQueue_put(CANEventQueue_Object *queue, uint32_t event, uint32_t data)
+{
+    uint32_t head  = queue->head;
+    uint32_t count = head - queue->tail;
+
+    if (count >= CANEventQueue_SIZE)
+    {
+        queue->overflowCnt++;
+        queue->lastLostEvent = event;
+        return false;
+    }
+
+    queue->entries[head & CANEventQueue_INDEX_MASK].event = event;
+    queue->entries[head & CANEventQueue_INDEX_MASK].data  = data;
+
+    /* Publish the entry only after it has been written */
+    queue->head = head + 1U;
+
+    if (count >= queue->highWaterMark)
+    {
+        queue->highWaterMark = count + 1U;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== CANEventQueue_get ========
+ */
+bool CANEventQueue_get(CANEventQueue_Object *queue, uint32_t *event, uint32_t *data)
+{
+    uint32_t tail = queue->tail;
+
+    if (queue->head == tail)
+    {
+        return false;
+    }
+
+    *event = queue->entries[tail & CANEventQueue_INDEX_MASK].event;
+    *data  = queue->entries[tail & CANEventQueue_INDEX_MASK].data;
+
+    /* Release the entry only after it has been read */
+    queue->tail = tail + 1U;
+
+    return true;
+}
+
+/*
+ *  ======== CANEventQueue_getCount ========
+ */
+uint32_t CANEventQueue_getCount(const CANEventQueue_Object *queue)
+{
+    return (queue->head - queue->tail);
+}
@@ -0,0 +1,554 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANIsoTp.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "CANIsoTp.h"
+
+/* Protocol control information: frame type in the upper nibble of byte 0 */
+#define PCI_TYPE_MASK 0xF0U
+#define PCI_SF        0x00U /* Single frame, lower nibble is the length */
+#define PCI_FF        0x10U /* First frame, lower nibble and byte 1 are the length */
+#define PCI_CF        0x20U /* Consecutive frame, lower nibble is the sequence number */
+#define PCI_FC        0x30U /* Flow control, lower nibble is the flow status */
+
+/* Flow status */
+#define FS_CTS      0U /* Continue to send */
+#define FS_WAIT     1U
+#define FS_OVERFLOW 2U
+
+/* Payload bytes in each frame type */
+#define SF_DATA_MAX (CANIsoTp_FRAME_SIZE - 1U)
+#define FF_DATA     (CANIsoTp_FRAME_SIZE - 2U)
+#define CF_DATA_MAX (CANIsoTp_FRAME_SIZE - 1U)
+
+#define TIMEOUT_TICKS (CANIsoTp_TIMEOUT_MS * 1000U * CANIsoTp_TICKS_PER_USEC)
+
+/* Reassembly buffer pool shared by all links */
+static uint8_t poolBuffers[CANIsoTp_POOL_SIZE][CANIsoTp_BUFFER_SIZE];
+static bool poolBusy[CANIsoTp_POOL_SIZE];
+
+/*
+ *  ======== allocBuffer ========
+ *  Returns a free reassembly buffer, or NULL if all are in use.
+ */
+static uint8_t *allocBuffer(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CANIsoTp_POOL_SIZE; i++)
+    {
+        if (!poolBusy[i])
+        {
+            poolBusy[i] = true;
+            return poolBuffers[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ *  ======== freeBuffer ========
+ */
+static void freeBuffer(uint8_t *buf)
+{
+    uint32_t i;
+
+    for (i = 0U; i < CANIsoTp_POOL_SIZE; i++)
+    {
+        if (poolBuffers[i] == buf)
+        {
+            poolBusy[i] = false;
+        }
+    }
+}
+
+/*
+ *  ======== stMinToTicks ========
+ *  Decodes an STmin byte. Reserved values are treated as the longest valid
+ *  STmin of 127ms, as required by ISO 15765-2.
+ */
+static uint32_t stMinToTicks(uint8_t stMin)
+{
+    if (stMin <= 0x7FU)
+    {
+        /* 0 to 127ms */
+        return (uint32_t)stMin * 1000U * CANIsoTp_TICKS_PER_USEC;
+    }
+    else if ((stMin >= 0xF1U) && (stMin <= 0xF9U))
+    {
+        /* 100 to 900us */
+        return (uint32_t)(stMin - 0xF0U) * 100U * CANIsoTp_TICKS_PER_USEC;
+    }
+    else
+    {
+        return 127U * 1000U * CANIsoTp_TICKS_PER_USEC;
+    }
+}
+
+/*
+ *  ======== sendFrame ========
+ */
+static bool sendFrame(CANIsoTp_Object *link, const uint8_t *frame)
+{
+    if (!link->params.sendFxn(link->params.arg, link->params.txId, frame))
+    {
+        return false;
+    }
+
+    link->stats.txFrameCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== endTx ========
+ */
+static void endTx(CANIsoTp_Object *link, CANIsoTp_TxStatus status)
+{
+    link->txStatus = status;
+    link->txData   = NULL;
+
+    if (status == CANIsoTp_TX_DONE)
+    {
+        link->stats.txMsgCnt++;
+    }
+    else
+    {
+        link->stats.txErrorCnt++;
+    }
+}
+
+/*
+ *  ======== processTx ========
+ *  Sends the single frame, the first frame or the consecutive frames that are
+ *  due, until the message is sent, a flow control frame is needed, STmin has
+ *  not elapsed or the frame cannot be queued.
+ */
+static void processTx(CANIsoTp_Object *link, uint32_t now)
+{
+    uint8_t frame[CANIsoTp_FRAME_SIZE];
+    uint32_t length;
+
+    while (link->txStatus == CANIsoTp_TX_BUSY)
+    {
+        if (link->txWaitFlowControl)
+        {
+            if ((int32_t)(now - link->txDeadline) >= 0)
+            {
+                endTx(link, CANIsoTp_TX_TIMEOUT);
+            }
+            break;
+        }
+
+        memset(frame, CANIsoTp_PAD_BYTE, sizeof(frame));
+
+        if (link->txOffset == 0U)
+        {
+            if (link->txLength <= SF_DATA_MAX)
+            {
+                length   = link->txLength;
+                frame[0] = PCI_SF | (uint8_t)length;
+                memcpy(&frame[1], link->txData, length);
+            }
+            else
+            {
+                length   = FF_DATA;
+                frame[0] = PCI_FF | (uint8_t)(link->txLength >> 8);
+                frame[1] = (uint8_t)link->txLength;
+                memcpy(&frame[2], link->txData, length);
+            }
+        }
+        else
+        {
+            if ((link->txStMin != 0U) && ((int32_t)(now - link->txNextTime) < 0))
+            {
+                break;
+            }
+
+            length = link->txLength - link->txOffset;
+            if (length > CF_DATA_MAX)
+            {
+                length = CF_DATA_MAX;
+            }
+
+            frame[0] = PCI_CF | link->txSeq;
+            memcpy(&frame[1], &link->txData[link->txOffset], length);
+        }
+
+        if (!sendFrame(link, frame))
+        {
+            /* Retried when a Tx buffer is freed */
+            break;
+        }
+
+        if (link->txOffset == 0U)
+        {
+            if (link->txLength > SF_DATA_MAX)
+            {
+                /* The receiver answers the first frame with a flow control frame */
+                link->txWaitFlowControl = true;
+                link->txDeadline        = now + TIMEOUT_TICKS;
+            }
+        }
+        else
+        {
+            link->txSeq      = (link->txSeq + 1U) & 0x0FU;
+            link->txNextTime = now + link->txStMin;
+
+            if ((link->txBlockSize != 0U) && (++link->txBlockCnt == link->txBlockSize))
+            {
+                link->txWaitFlowControl = true;
+                link->txDeadline        = now + TIMEOUT_TICKS;
+            }
+        }
+
+        link->txOffset += length;
+
+        if (link->txOffset == link->txLength)
+        {
+            endTx(link, CANIsoTp_TX_DONE);
+        }
+    }
+}
+
+/*
+ *  ======== handleFlowControl ========
+ */
+static void handleFlowControl(CANIsoTp_Object *link, const uint8_t *data, uint32_t length, uint32_t now)
+{
+    if ((link->txStatus != CANIsoTp_TX_BUSY) || !link->txWaitFlowControl || (length < 3U))
+    {
+        link->stats.rxInvalidCnt++;
+        return;
+    }
+
+    switch (data[0] & 0x0FU)
+    {
+        case FS_CTS:
+            link->txWaitFlowControl = false;
+            link->txWaitCnt         = 0U;
+            link->txBlockCnt        = 0U;
+            link->txBlockSize       = data[1];
+            link->txStMin           = stMinToTicks(data[2]);
+            link->txNextTime        = now;
+
+            /* Resume sending right away to keep the bus busy */
+            processTx(link, now);
+            break;
+
+        case FS_WAIT:
+            if (++link->txWaitCnt > CANIsoTp_WAIT_MAX)
+            {
+                endTx(link, CANIsoTp_TX_PROTOCOL_ERROR);
+            }
+            else
+            {
+                link->txDeadline = now + TIMEOUT_TICKS;
+            }
+            break;
+
+        case FS_OVERFLOW:
+            endTx(link, CANIsoTp_TX_OVERFLOW);
+            break;
+
+        default:
+            endTx(link, CANIsoTp_TX_PROTOCOL_ERROR);
+            break;
+    }
+}
+
+/*
+ *  ======== sendFlowControl ========
+ *  Sends the pending flow control frame, if any.
+ */
+static void sendFlowControl(CANIsoTp_Object *link)
+{
+    uint8_t frame[CANIsoTp_FRAME_SIZE];
+
+    if (!link->rxFlowControlPending)
+    {
+        return;
+    }
+
+    memset(frame, CANIsoTp_PAD_BYTE, sizeof(frame));
+
+    frame[0] = PCI_FC | link->rxFlowStatus;
+    frame[1] = link->params.blockSize;
+    frame[2] = link->params.stMin;
+
+    if (sendFrame(link, frame))
+    {
+        link->rxFlowControlPending = false;
+    }
+}
+
+/*
+ *  ======== abortRx ========
+ *  Drops the message being reassembled and returns its buffer to the pool.
+ */
+static void abortRx(CANIsoTp_Object *link)
+{
+    if (link->rxBuf != NULL)
+    {
+        freeBuffer(link->rxBuf);
+        link->rxBuf = NULL;
+    }
+}
+
+/*
+ *  ======== handleSingleFrame ========
+ */
+static void handleSingleFrame(CANIsoTp_Object *link, const uint8_t *data, uint32_t length)
+{
+    uint32_t msgLength = data[0] & 0x0FU;
+
+    if ((msgLength == 0U) || (msgLength > SF_DATA_MAX) || (msgLength >= length))
+    {
+        link->stats.rxInvalidCnt++;
+        return;
+    }
+
+    /* A new message ends the reception in progress */
+    abortRx(link);
+
+    link->stats.rxMsgCnt++;
+    link->params.receiveFxn(link->params.arg, &data[1], msgLength);
+}
+
+/*
+ *  ======== handleFirstFrame ========
+ */
+static void handleFirstFrame(CANIsoTp_Object *link, const uint8_t *data, uint32_t length, uint32_t now)
+{
+    uint32_t msgLength = ((uint32_t)(data[0] & 0x0FU) << 8) | data[1];
+
+    if ((length < CANIsoTp_FRAME_SIZE) || (msgLength <= SF_DATA_MAX))
+    {
+        link->stats.rxInvalidCnt++;
+        return;
+    }
+
+    /* A new message ends the reception in progress */
+    abortRx(link);
+
+    if (msgLength <= CANIsoTp_BUFFER_SIZE)
+    {
+        link->rxBuf = allocBuffer();
+    }
+
+    if (link->rxBuf == NULL)
+    {
+        link->stats.rxOverflowCnt++;
+        link->rxFlowStatus = FS_OVERFLOW;
+    }
+    else
+    {
+        memcpy(link->rxBuf, &data[2], FF_DATA);
+
+        link->rxLength     = msgLength;
+        link->rxOffset     = FF_DATA;
+        link->rxSeq        = 1U;
+        link->rxBlockCnt   = 0U;
+        link->rxDeadline   = now + TIMEOUT_TICKS;
+        link->rxFlowStatus = FS_CTS;
+    }
+
+    link->rxFlowControlPending = true;
+    sendFlowControl(link);
+}
+
+/*
+ *  ======== handleConsecutiveFrame ========
+ */
+static void handleConsecutiveFrame(CANIsoTp_Object *link, const uint8_t *data, uint32_t length, uint32_t now)
+{
+    uint32_t count;
+
+    if (link->rxBuf == NULL)
+    {
+        link->stats.rxInvalidCnt++;
+        return;
+    }
+
+    if ((data[0] & 0x0FU) != link->rxSeq)
+    {
+        /* A consecutive frame was lost */
+        link->stats.rxSeqErrorCnt++;
+        abortRx(link);
+        return;
+    }
+
+    count = link->rxLength - link->rxOffset;
+    if (count > CF_DATA_MAX)
+    {
+        count = CF_DATA_MAX;
+    }
+
+    if (length < (count + 1U))
+    {
+        link->stats.rxInvalidCnt++;
+        abortRx(link);
+        return;
+    }
+
+    memcpy(&link->rxBuf[link->rxOffset], &data[1], count);
+
+    link->rxOffset += count;
+    link->rxSeq     = (link->rxSeq + 1U) & 0x0FU;
+
+    if (link->rxOffset == link->rxLength)
+    {
+        link->stats.rxMsgCnt++;
+        link->params.receiveFxn(link->params.arg, link->rxBuf, link->rxLength);
+        abortRx(link);
+    }
+    else
+    {
+        link->rxDeadline = now + TIMEOUT_TICKS;
+
+        if ((link->params.blockSize != 0U) && (++link->rxBlockCnt == link->params.blockSize))
+        {
+            link->rxBlockCnt           = 0U;
+            link->rxFlowControlPending = true;
+            sendFlowControl(link);
+        }
+    }
+}
+
+/*
+ *  ======== CANIsoTp_init ========
+ */
+void CANIsoTp_init(CANIsoTp_Object *link, const CANIsoTp_Params *params)
+{
+    memset(link, 0, sizeof(*link));
+
+    link->params   = *params;
+    link->txStatus = CANIsoTp_TX_IDLE;
+}
+
+/*
+ *  ======== CANIsoTp_send ========
+ */
+bool CANIsoTp_send(CANIsoTp_Object *link, const uint8_t *data, uint32_t length, uint32_t now)
+{
+    if ((link->txStatus == CANIsoTp_TX_BUSY) || (length == 0U) || (length > CANIsoTp_MSG_SIZE_MAX))
+    {
+        return false;
+    }
+
+    link->txStatus          = CANIsoTp_TX_BUSY;
+    link->txWaitFlowControl = false;
+    link->txData            = data;
+    link->txLength          = length;
+    link->txOffset          = 0U;
+    link->txSeq             = 1U;
+    link->txWaitCnt         = 0U;
+
+    processTx(link, now);
+
+    return true;
+}
+
+/*
+ *  ======== CANIsoTp_getTxStatus ========
+ */
+CANIsoTp_TxStatus CANIsoTp_getTxStatus(const CANIsoTp_Object *link)
+{
+    return link->txStatus;
+}
+
+/*
+ *  ======== CANIsoTp_receiveFrame ========
+ */
+bool CANIsoTp_receiveFrame(CANIsoTp_Object *link, uint32_t id, const uint8_t *data, uint32_t length, uint32_t now)
+{
+    if (id != link->params.rxId)
+    {
+        return false;
+    }
+
+    link->stats.rxFrameCnt++;
+
+    if (length == 0U)
+    {
+        link->stats.rxInvalidCnt++;
+        return true;
+    }
+
+    switch (data[0] & PCI_TYPE_MASK)
+    {
+        case PCI_SF:
+            handleSingleFrame(link, data, length);
+            break;
+
+        case PCI_FF:
+            handleFirstFrame(link, data, length, now);
+            break;
+
+        case PCI_CF:
+            handleConsecutiveFrame(link, data, length, now);
+            break;
+
+        case PCI_FC:
+            handleFlowControl(link, data, length, now);
+            break;
+
+        default:
+            link->stats.rxInvalidCnt++;
+            break;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== CANIsoTp_process ========
+ */
+void CANIsoTp_process(CANIsoTp_Object *link, uint32_t now)
+{
+    sendFlowControl(link);
+
+    if ((link->rxBuf != NULL) && ((int32_t)(now - link->rxDeadline) >= 0))
+    {
+        link->stats.rxTimeoutCnt++;
+        abortRx(link);
+    }
+
+    processTx(link, now);
+}
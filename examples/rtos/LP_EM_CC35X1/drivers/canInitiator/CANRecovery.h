@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANRecovery.h ========
+ *  Bus off recovery with exponential backoff.
+ *
+ *  Frames are written through CANRecovery_write() instead of CAN_write().
+ *  While the bus is on, frames are passed to the driver and are only queued
+ *  when its Tx buffers are full. After a bus off event, frames are queued
+ *  until the bus is recovered. When the backoff time has elapsed, the bus is
+ *  considered recovered if the driver reported bus on in the meantime, or the
+ *  restart function supplied by the application is called otherwise. The
+ *  queued frames are then passed to the driver in order. When the queue is
+ *  full, the new frame is refused, or the oldest queued frame is dropped if
+ *  dropOldest is set.
+ *
+ *  The backoff starts at minBackoffMs and doubles with each bus off that
+ *  follows a recovery by less than stableTimeMs, up to maxBackoffMs. Frames
+ *  already accepted by the driver when the bus went off are not queued, so
+ *  they are lost if the restart function reopens the driver.
+ *
+ *  The module does not depend on a particular driver instance. The caller
+ *  supplies functions that write a frame and restart the driver, passes every
+ *  driver event to CANRecovery_event(), and calls CANRecovery_process()
+ *  whenever a Tx buffer is freed and periodically while CANRecovery_isPending()
+ *  returns true. CANRecovery_event() may be called from any context. The other
+ *  functions must not be called concurrently. Times are 64-bit values in 250ns
+ *  ticks.
+ */
+
+#ifndef CANRECOVERY_H_
+#define CANRECOVERY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of frames the Tx queue can hold. Must be a power of two. */
+#ifndef CANRecovery_QUEUE_SIZE
+    #define CANRecovery_QUEUE_SIZE 8U
+#endif
+
+#if (CANRecovery_QUEUE_SIZE & (CANRecovery_QUEUE_SIZE - 1U)) != 0U
+    #error "CANRecovery_QUEUE_SIZE must be a power of two"
+#endif
+
+/* Time ticks per millisecond */
+#define CANRecovery_TICKS_PER_MSEC 4000U
+
+/* Writes a frame to the driver. Returns CAN_STATUS_TX_BUF_FULL if the driver
+ * Tx buffers are full, in which case the frame is queued and retried.
+ */
+typedef int_fast16_t (*CANRecovery_WriteFxn)(void *arg, const CAN_TxBufElement *elem);
+
+/* Restarts the driver after bus off, e.g. by closing and reopening it.
+ * Returns false if the driver could not be restarted, in which case the
+ * restart is retried after the next backoff time.
+ */
+typedef bool (*CANRecovery_RestartFxn)(void *arg);
+
+/* Recovery parameters */
+typedef struct
+{
+    uint32_t minBackoffMs;         /* Backoff time after the first bus off */
+    uint32_t maxBackoffMs;         /* Upper limit of the backoff time */
+    uint32_t stableTimeMs;         /* Bus on time after which the backoff time is reset */
+    bool dropOldest;               /* Drop the oldest queued frame when the queue is full */
+    CANRecovery_WriteFxn writeFxn;
+    CANRecovery_RestartFxn restartFxn;
+    void *arg;                     /* Passed to writeFxn and restartFxn */
+} CANRecovery_Params;
+
+/* Recovery statistics */
+typedef struct
+{
+    uint32_t busOffCnt;       /* Bus off events */
+    uint32_t restartCnt;      /* Driver restarts */
+    uint32_t restartFailCnt;  /* Driver restarts that failed */
+    uint32_t queuedCnt;       /* Frames queued */
+    uint32_t droppedCnt;      /* Frames refused or dropped because the queue was full */
+    uint32_t queueHighWaterMark;
+    uint64_t downTime;        /* Total time from bus off to recovery */
+    uint64_t lastDownTime;
+    uint64_t maxDownTime;
+} CANRecovery_Stats;
+
+/* Recovery state */
+typedef enum
+{
+    CANRecovery_BUS_ON, /* Frames are passed to the driver */
+    CANRecovery_BACKOFF /* Frames are queued until the bus is recovered */
+} CANRecovery_State;
+
+/* Recovery object. The fields are private, except for stats. */
+typedef struct
+{
+    CANRecovery_Params params;
+    CANRecovery_Stats stats;
+    volatile CANRecovery_State state;
+    volatile bool driverBusOn;     /* Last bus state reported by the driver */
+    volatile uint64_t busOffTime;  /* Time of the bus off that started the backoff */
+    volatile uint64_t restartTime; /* End of the backoff */
+    uint64_t busOnTime;            /* Time of the last recovery */
+    uint32_t backoffMs;            /* Backoff time of the next bus off */
+    uint32_t queueHead;            /* Free-running queue indices */
+    uint32_t queueTail;
+    CAN_TxBufElement queue[CANRecovery_QUEUE_SIZE];
+} CANRecovery_Object;
+
+/*
+ *  ======== CANRecovery_init ========
+ */
+extern void CANRecovery_init(CANRecovery_Object *obj, const CANRecovery_Params *params);
+
+/*
+ *  ======== CANRecovery_event ========
+ *  Handles the bus off and bus on driver events. Other events are ignored.
+ */
+extern void CANRecovery_event(CANRecovery_Object *obj, uint32_t event, uint64_t now);
+
+/*
+ *  ======== CANRecovery_write ========
+ *  Writes or queues a frame. Returns CAN_STATUS_SUCCESS if the frame was
+ *  written or queued, CAN_STATUS_TX_BUF_FULL if the queue was full, or the
+ *  error returned by the write function.
+ */
+extern int_fast16_t CANRecovery_write(CANRecovery_Object *obj, const CAN_TxBufElement *elem);
+
+/*
+ *  ======== CANRecovery_process ========
+ *  Recovers the bus once the backoff time has elapsed and writes the queued
+ *  frames the driver can accept.
+ */
+extern void CANRecovery_process(CANRecovery_Object *obj, uint64_t now);
+
+/*
+ *  ======== CANRecovery_isBusOff ========
+ *  Returns true from a bus off event until the bus is recovered. Frames must
+ *  not be written to the driver directly while it returns true, as the
+ *  driver may be restarted.
+ */
+extern bool CANRecovery_isBusOff(const CANRecovery_Object *obj);
+
+/*
+ *  ======== CANRecovery_isPending ========
+ *  Returns true while the bus is being recovered or frames are queued.
+ */
+extern bool CANRecovery_isPending(const CANRecovery_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANRECOVERY_H_ */
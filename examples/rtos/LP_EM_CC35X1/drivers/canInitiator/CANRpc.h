@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANRpc.h ========
+ *  Pipelined request/response calls over CAN.
+ *
+ *  Each call sends a request frame whose payload starts with a 16-bit
+ *  correlation ID, little endian, followed by the caller's data. The peer
+ *  answers with a response frame carrying the same correlation ID. Up to
+ *  window calls can be in flight at a time. They are kept in a fixed-size
+ *  pending table indexed by the low bits of the correlation ID, so a response
+ *  is matched with a single lookup. A call that is not answered within
+ *  timeoutUs is sent again with the same correlation ID, up to maxRetries
+ *  times, and then completes with CANRpc_TIMEOUT. Responses that match no
+ *  pending call, such as the late response to a retried request, are counted
+ *  and dropped.
+ *
+ *  How the payload is carried in a frame is defined by a binding: a function
+ *  that builds the request frame and a function that extracts the payload
+ *  from a response frame. CANRpc_encodeEcho() and CANRpc_decodeEcho() bind
+ *  the calls to the canResponder echo convention, where the response has all
+ *  ID and data bits of the request flipped.
+ *
+ *  The caller supplies a function that transmits a frame, passes every
+ *  received frame to CANRpc_receive(), and calls CANRpc_process() whenever a
+ *  Tx buffer is freed and at least once per millisecond while calls are in
+ *  flight. The completion function of a call is called from CANRpc_receive()
+ *  or CANRpc_process(). Times are 32-bit values in 250ns ticks. All functions
+ *  must be called from the same thread.
+ */
+
+#ifndef CANRPC_H_
+#define CANRPC_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of pending table entries, the largest window. Must be a power of two. */
+#ifndef CANRpc_PENDING_SIZE
+    #define CANRpc_PENDING_SIZE 16U
+#endif
+
+#if (CANRpc_PENDING_SIZE & (CANRpc_PENDING_SIZE - 1U)) != 0U
+    #error "CANRpc_PENDING_SIZE must be a power of two"
+#endif
+
+/* Size of the correlation ID at the start of each payload */
+#define CANRpc_HEADER_SIZE 2U
+
+/* Largest payload, including the correlation ID */
+#define CANRpc_PAYLOAD_MAX 64U
+
+/* Time ticks per microsecond */
+#define CANRpc_TICKS_PER_USEC 4U
+
+/* Completion status of a call */
+typedef enum
+{
+    CANRpc_SUCCESS, /* Response received */
+    CANRpc_TIMEOUT  /* No response after maxRetries retries */
+} CANRpc_Status;
+
+/* Completes a call. data and length are the response data after the
+ * correlation ID, only valid during the call. arg is the value passed to
+ * CANRpc_call().
+ */
+typedef void (*CANRpc_DoneFxn)(void *arg, CANRpc_Status status, const uint8_t *data, size_t length);
+
+/* Transmits a frame. Returns false if the frame could not be queued, in which
+ * case it is retried by CANRpc_process().
+ */
+typedef bool (*CANRpc_SendFxn)(void *arg, const CAN_TxBufElement *elem);
+
+/* Builds the request frame for a payload of length bytes */
+typedef void (*CANRpc_EncodeFxn)(void *arg, const uint8_t *payload, size_t length, CAN_TxBufElement *elem);
+
+/* Copies the payload of a response frame to payload, which holds
+ * CANRpc_PAYLOAD_MAX bytes. Returns the payload length, or 0 if the frame is
+ * not a response.
+ */
+typedef size_t (*CANRpc_DecodeFxn)(void *arg, const CAN_RxBufElement *elem, uint8_t *payload);
+
+/* Frame format of the calls */
+typedef struct
+{
+    CANRpc_EncodeFxn encodeFxn;
+    CANRpc_DecodeFxn decodeFxn;
+    void *arg; /* Passed to encodeFxn and decodeFxn */
+} CANRpc_Binding;
+
+/* Echo binding configuration, passed as the binding arg */
+typedef struct
+{
+    uint32_t id; /* Request ID */
+    bool xtd;    /* 29-bit ID */
+    bool fd;     /* CAN FD frames with bit rate switching, or classic frames of up to 8 bytes */
+} CANRpc_EchoConfig;
+
+/* Call parameters */
+typedef struct
+{
+    uint32_t window;     /* Calls in flight, 1 to CANRpc_PENDING_SIZE */
+    uint32_t timeoutUs;  /* Time to wait for each response */
+    uint32_t maxRetries; /* Retries before a call times out */
+    CANRpc_Binding binding;
+    CANRpc_SendFxn sendFxn;
+    void *arg;           /* Passed to sendFxn */
+} CANRpc_Params;
+
+/* Call statistics */
+typedef struct
+{
+    uint32_t callCnt;      /* Calls accepted */
+    uint32_t completedCnt; /* Calls completed with a response */
+    uint32_t timeoutCnt;   /* Calls completed with CANRpc_TIMEOUT */
+    uint32_t retryCnt;     /* Requests sent again after a timeout */
+    uint32_t sendFailCnt;  /* Requests refused by the send function */
+    uint32_t unmatchedCnt; /* Responses without a pending call */
+    uint32_t maxInFlight;  /* Largest number of calls in flight */
+} CANRpc_Stats;
+
+/* Pending call */
+typedef struct
+{
+    bool busy;
+    bool sent;         /* Request accepted by the send function */
+    uint16_t corrId;
+    uint8_t retries;
+    uint8_t length;    /* Payload length */
+    uint32_t deadline; /* Time to give up waiting for the response */
+    CANRpc_DoneFxn doneFxn;
+    void *doneArg;
+    uint8_t payload[CANRpc_PAYLOAD_MAX];
+} CANRpc_Pending;
+
+/* Call object, one per peer. The fields are private, except for stats. */
+typedef struct
+{
+    CANRpc_Params params;
+    CANRpc_Stats stats;
+    uint32_t inFlight; /* Busy pending table entries */
+    uint16_t nextCorrId;
+    CANRpc_Pending pending[CANRpc_PENDING_SIZE];
+} CANRpc_Object;
+
+/*
+ *  ======== CANRpc_init ========
+ */
+extern void CANRpc_init(CANRpc_Object *obj, const CANRpc_Params *params);
+
+/*
+ *  ======== CANRpc_setWindow ========
+ *  Changes the number of calls in flight, limited to CANRpc_PENDING_SIZE.
+ *  Calls in flight are kept and correlation IDs continue, so a late response
+ *  to an earlier call never completes a newer one.
+ */
+extern void CANRpc_setWindow(CANRpc_Object *obj, uint32_t window);
+
+/*
+ *  ======== CANRpc_call ========
+ *  Sends a request with length bytes of data, at most CANRpc_PAYLOAD_MAX
+ *  minus CANRpc_HEADER_SIZE. doneFxn is called with doneArg when the call
+ *  completes. Returns false if the window is full or the data is too long.
+ */
+extern bool CANRpc_call(CANRpc_Object *obj,
+                        const uint8_t *data,
+                        size_t length,
+                        CANRpc_DoneFxn doneFxn,
+                        void *doneArg,
+                        uint32_t now);
+
+/*
+ *  ======== CANRpc_receive ========
+ *  Completes the call answered by a received frame. Returns false if the
+ *  frame is not a response to a pending call.
+ */
+extern bool CANRpc_receive(CANRpc_Object *obj, const CAN_RxBufElement *elem);
+
+/*
+ *  ======== CANRpc_process ========
+ *  Sends the requests refused earlier by the send function, and retries or
+ *  times out the calls whose response is overdue.
+ */
+extern void CANRpc_process(CANRpc_Object *obj, uint32_t now);
+
+/*
+ *  ======== CANRpc_getInFlight ========
+ *  Returns the number of calls in flight.
+ */
+extern uint32_t CANRpc_getInFlight(const CANRpc_Object *obj);
+
+/*
+ *  ======== CANRpc_encodeEcho ========
+ *  Echo binding encode function. arg is a CANRpc_EchoConfig.
+ */
+extern void CANRpc_encodeEcho(void *arg, const uint8_t *payload, size_t length, CAN_TxBufElement *elem);
+
+/*
+ *  ======== CANRpc_decodeEcho ========
+ *  Echo binding decode function. Accepts frames with all bits of the request
+ *  ID flipped and flips the payload bits back. arg is a CANRpc_EchoConfig.
+ */
+extern size_t CANRpc_decodeEcho(void *arg, const CAN_RxBufElement *elem, uint8_t *payload);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANRPC_H_ */
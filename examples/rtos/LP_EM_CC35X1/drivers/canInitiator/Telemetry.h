@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== Telemetry.h ========
+ *  Binary telemetry records framed for a byte stream such as a UART.
+ *
+ *  Each record is sent as one frame. Before framing, a frame holds:
+ *
+ *    Offset  Size  Field
+ *    0       1     Record type, Telemetry_TYPE_*
+ *    1       1     Record ID, chosen by the application
+ *    2       2     Sequence number, incremented for every record
+ *    4       n     Payload, up to Telemetry_PAYLOAD_MAX bytes
+ *    4 + n   2     CRC-16 CCITT of all previous bytes
+ *
+ *  The frame is encoded with Consistent Overhead Byte Stuffing (COBS), which
+ *  removes all zero bytes at the cost of one byte for frames of up to 254
+ *  bytes, and is followed by a zero byte. A receiver can therefore start
+ *  decoding at any zero byte and resynchronizes after a corrupted frame. The
+ *  CRC uses polynomial 0x1021 and init 0xFFFF, and is sent most significant
+ *  byte first. All other multi-byte fields are little-endian.
+ *
+ *  The payload depends on the record type:
+ *
+ *    Telemetry_TYPE_TEXT       Characters, without terminating null
+ *    Telemetry_TYPE_COUNTERS   uint32_t values
+ *    Telemetry_TYPE_HISTOGRAM  uint16_t index of the first bin, uint16_t
+ *                              total number of bins, uint32_t bin width and
+ *                              uint32_t bin counts
+ *    Telemetry_TYPE_SAMPLE     uint32_t time and int32_t values
+ *
+ *  Records that do not fit in the Tx ring are dropped. Their sequence number
+ *  is still used, so the receiver counts them as lost along with the frames
+ *  lost or corrupted on the way.
+ *
+ *  The records are queued in the Tx ring and written in batches through a
+ *  function supplied by the application, which takes as many bytes as it can
+ *  without blocking. A batch is written once Telemetry_Params.flushThreshold
+ *  bytes are pending, or when Telemetry_flush() is called. The functions are
+ *  not reentrant. The application serializes calls made for one object from
+ *  several threads.
+ *
+ *  The module only depends on the C library.
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Tx ring size in bytes. Must be a power of two. */
+#ifndef Telemetry_RING_SIZE
+    #define Telemetry_RING_SIZE 2048U
+#endif
+
+#if (Telemetry_RING_SIZE & (Telemetry_RING_SIZE - 1U)) != 0U
+    #error "Telemetry_RING_SIZE must be a power of two"
+#endif
+
+/* Largest payload, keeping frames within a single COBS block */
+#define Telemetry_PAYLOAD_MAX 248U
+
+/* Largest number of values of a counters or sample record */
+#define Telemetry_COUNTERS_MAX (Telemetry_PAYLOAD_MAX / 4U)
+#define Telemetry_SAMPLE_MAX   ((Telemetry_PAYLOAD_MAX - 4U) / 4U)
+
+/* Largest number of bins of a histogram record. Longer histograms are split. */
+#define Telemetry_HISTOGRAM_BINS_MAX ((Telemetry_PAYLOAD_MAX - 8U) / 4U)
+
+/* Record types */
+#define Telemetry_TYPE_TEXT      0U
+#define Telemetry_TYPE_COUNTERS  1U
+#define Telemetry_TYPE_HISTOGRAM 2U
+#define Telemetry_TYPE_SAMPLE    3U
+
+/* Writes up to length bytes without blocking and returns the number written */
+typedef size_t (*Telemetry_WriteFxn)(void *arg, const uint8_t *data, size_t length);
+
+/* Telemetry parameters */
+typedef struct
+{
+    Telemetry_WriteFxn writeFxn;
+    void *arg;             /* Passed to writeFxn */
+    size_t flushThreshold; /* Pending bytes after which a record is written at once, 0 for every record */
+} Telemetry_Params;
+
+/* Telemetry statistics */
+typedef struct
+{
+    uint32_t recordCnt;    /* Records queued */
+    uint32_t droppedCnt;   /* Records dropped because the Tx ring was full */
+    uint32_t bytesQueued;  /* Framed bytes queued */
+    uint32_t bytesWritten; /* Framed bytes taken by writeFxn */
+    uint32_t writeCnt;     /* Calls to writeFxn that took data */
+    uint32_t maxPending;   /* Largest number of bytes pending in the Tx ring */
+} Telemetry_Stats;
+
+/* Telemetry object. The fields are private, except for stats. */
+typedef struct
+{
+    Telemetry_Params params;
+    uint8_t ring[Telemetry_RING_SIZE];
+    uint32_t head;    /* Bytes queued, free-running */
+    uint32_t tail;    /* Bytes written, free-running */
+    uint32_t codePos; /* Ring position of the pending COBS code byte */
+    uint8_t code;     /* Value of the pending COBS code byte */
+    uint16_t crc;     /* CRC of the frame being queued */
+    uint16_t seq;     /* Sequence number of the next record */
+    Telemetry_Stats stats;
+} Telemetry_Object;
+
+/*
+ *  ======== Telemetry_init ========
+ *  Initializes an object with an empty Tx ring.
+ */
+extern void Telemetry_init(Telemetry_Object *obj, const Telemetry_Params *params);
+
+/*
+ *  ======== Telemetry_writeText ========
+ *  Queues length characters of text. Text longer than Telemetry_PAYLOAD_MAX
+ *  is split into several records. Returns false if a record was dropped.
+ */
+extern bool Telemetry_writeText(Telemetry_Object *obj, uint8_t id, const char *text, size_t length);
+
+/*
+ *  ======== Telemetry_writeCounters ========
+ *  Queues count counter values. Returns false if the record was dropped or
+ *  count is larger than Telemetry_COUNTERS_MAX.
+ */
+extern bool Telemetry_writeCounters(Telemetry_Object *obj, uint8_t id, const uint32_t *values, size_t count);
+
+/*
+ *  ======== Telemetry_writeHistogram ========
+ *  Queues a histogram of binCount bins of binWidth each. Histograms with more
+ *  than Telemetry_HISTOGRAM_BINS_MAX bins are split into several records.
+ *  Returns false if a record was dropped.
+ */
+extern bool Telemetry_writeHistogram(Telemetry_Object *obj,
+                                     uint8_t id,
+                                     const uint32_t *bins,
+                                     size_t binCount,
+                                     uint32_t binWidth);
+
+/*
+ *  ======== Telemetry_writeSample ========
+ *  Queues count values sampled at the given time. Returns false if the record
+ *  was dropped or count is larger than Telemetry_SAMPLE_MAX.
+ */
+extern bool Telemetry_writeSample(Telemetry_Object *obj,
+                                  uint8_t id,
+                                  uint32_t time,
+                                  const int32_t *values,
+                                  size_t count);
+
+/*
+ *  ======== Telemetry_flush ========
+ *  Writes the pending bytes until writeFxn takes fewer bytes than offered.
+ */
+extern void Telemetry_flush(Telemetry_Object *obj);
+
+/*
+ *  ======== Telemetry_getPending ========
+ *  Returns the number of bytes pending in the Tx ring.
+ */
+extern size_t Telemetry_getPending(const Telemetry_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H_ */
@@ -37,6 +37,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 /* POSIX Header files */
 #include <pthread.h>
@@ -47,24 +48,180 @@
 #include <ti/drivers/GPIO.h>
 #include <ti/drivers/UART2.h>
 #include <ti/drivers/apps/Button.h>
+#include <ti/drivers/dpl/HwiP.h>
 
 /* Driver configuration */
 #include "ti_drivers_config.h"
 
+#include "CANBenchmark.h"
+#include "CANCodec.h"
+#include "CANDispatch.h"
+#include "CANE2E.h"
+#include "CANEventQueue.h"
+#include "CANIsoTp.h"
+#include "CANRecovery.h"
+#include "CANRpc.h"
+#include "CANStats.h"
+#include "CANTimestamp.h"
+#include "Telemetry.h"
+
 #define THREAD_STACK_SIZE 1024
 
 /* Defines */
 #define MAX_MSG_LENGTH 512
-#define DLC_TABLE_SIZE 16
+
+/* External timestamp counter rate is the Host System Clock (96 MHz) divided by
+ * the timestamp prescaler. A timestamp prescaler of 24 was chosen to match the
+ * system timer resolution of 250ns.
+ */
+#define CANCC27XX_EXT_TIMESTAMP_PRESCALER 24U
+
+/* Test message IDs. The responder answers with all ID bits flipped. */
+#define TEST_MSG_ID         0x5AA
+#define TEST_FD_MSG_ID      0x12345678
+#define TEST_RESPONSE_ID    (~TEST_MSG_ID & 0x7FF)
+#define TEST_FD_RESPONSE_ID (~TEST_FD_MSG_ID & 0x1FFFFFFF)
+
+/* Message RAM element counts used with the acceptance filters built from the
+ * dispatch table on devices with an MCAN peripheral.
+ */
+#define MSG_RAM_RX_FIFO_NUM       8U
+#define MSG_RAM_TX_FIFO_Q_NUM     6U
+#define MSG_RAM_TX_EVENT_FIFO_NUM 0U
+
+/* Set to 1 to run a round-trip latency and throughput benchmark against the
+ * canResponder example on each button press, instead of sending a single test
+ * message.
+ */
+#ifndef CAN_INITIATOR_BENCHMARK_MODE
+    #define CAN_INITIATOR_BENCHMARK_MODE 0
+#endif
+
+/* Benchmark configuration. The request ID differs from the test message IDs,
+ * so a late test response is never taken for a benchmark response.
+ */
+#define BENCH_MSG_ID              0x5A0
+#define BENCH_RESPONSE_ID         (~BENCH_MSG_ID & 0x7FF)
+#define BENCH_FRAME_COUNT         1000U
+#define BENCH_WINDOW              8U          /* Maximum outstanding requests */
+#define BENCH_DLC                 CAN_DLC_8B  /* Classic CAN request DLC */
+#define BENCH_FD_DLC              CAN_DLC_64B /* CAN FD request DLC */
+#define BENCH_FRAME_INTERVAL_USEC 0U          /* Minimum time between requests, 0 for no limit */
+#define BENCH_RESPONSE_TIMEOUT_MS 100U
+
+/* Set to 1 to run an ISO-TP throughput benchmark against the canResponder
+ * example built with CAN_RESPONDER_ISOTP_MODE on each button press. Each
+ * message is segmented into classic CAN frames and acknowledged by the
+ * responder once it was reassembled and verified.
+ */
+#ifndef CAN_INITIATOR_ISOTP_MODE
+    #define CAN_INITIATOR_ISOTP_MODE 0
+#endif
+
+#if CAN_INITIATOR_BENCHMARK_MODE && CAN_INITIATOR_ISOTP_MODE
+    #error "CAN_INITIATOR_BENCHMARK_MODE and CAN_INITIATOR_ISOTP_MODE cannot both be enabled"
+#endif
+
+/* ISO-TP configuration */
+#define ISOTP_TX_ID          0x7E0                 /* Initiator to responder */
+#define ISOTP_RX_ID          0x7E8                 /* Responder to initiator */
+#define ISOTP_BLOCK_SIZE     0U                    /* Block size requested from the responder */
+#define ISOTP_ST_MIN         0U                    /* STmin requested from the responder */
+#define ISOTP_MSG_SIZE       CANIsoTp_MSG_SIZE_MAX /* Benchmark message size */
+#define ISOTP_MSG_COUNT      10U                   /* Benchmark messages per button press */
+#define ISOTP_ACK_SIZE       4U                    /* Sequence number, status and 16-bit length */
+#define ISOTP_ACK_TIMEOUT_MS 2000U
+
+/* Set to 1 to measure the throughput of pipelined calls to the canResponder
+ * example on each button press. The calls are made through the CANRpc module
+ * with the echo binding, for windows of 1 to CANRpc_PENDING_SIZE calls in
+ * flight.
+ */
+#ifndef CAN_INITIATOR_RPC_MODE
+    #define CAN_INITIATOR_RPC_MODE 0
+#endif
+
+#if CAN_INITIATOR_RPC_MODE && (CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE)
+    #error "CAN_INITIATOR_RPC_MODE cannot be used with CAN_INITIATOR_BENCHMARK_MODE or CAN_INITIATOR_ISOTP_MODE"
+#endif
+
+/* RPC configuration */
+#define RPC_MSG_ID         0x3A0
+#define RPC_CALL_COUNT     1000U /* Calls per window size */
+#define RPC_DATA_SIZE      6U    /* Classic CAN call data, 8-byte frames with the correlation ID */
+#define RPC_FD_DATA_SIZE   62U   /* CAN FD call data, 64-byte frames with the correlation ID */
+#define RPC_TIMEOUT_USEC   20000U
+#define RPC_MAX_RETRIES    2U
+
+/* Set to 1 to protect the test messages end to end with a CRC and an alive
+ * counter. The canResponder example returns the protected payload with all
+ * bits flipped, so the response is checked once the bits are flipped back.
+ */
+#ifndef CAN_INITIATOR_E2E_MODE
+    #define CAN_INITIATOR_E2E_MODE 0
+#endif
+
+#if CAN_INITIATOR_E2E_MODE && (CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE)
+    #error "CAN_INITIATOR_E2E_MODE cannot be used with the benchmark, ISO-TP or RPC modes"
+#endif
+
+/* E2E configuration. Classic CAN messages carry a CRC-8 and CAN FD messages a
+ * CRC-16, both at the start of the payload and followed by the counter.
+ */
+#define E2E_CRC_OFFSET        0U
+#define E2E_COUNTER_OFFSET    1U
+#define E2E_FD_COUNTER_OFFSET 2U
+#define E2E_MAX_DELTA_COUNTER 3U    /* Up to 2 lost responses are accepted */
+#define E2E_BENCH_COUNT       1000U /* Checks timed at startup per message format */
+
+/* Set to 1 to send all output as binary telemetry records through the
+ * Telemetry module instead of text. Statistics, benchmark results and
+ * responses are sent as counter, histogram and sample records, and the other
+ * messages as text records. Can be combined with any other mode.
+ */
+#ifndef CAN_INITIATOR_TELEMETRY_MODE
+    #define CAN_INITIATOR_TELEMETRY_MODE 0
+#endif
+
+/* Telemetry record IDs */
+#define TELEMETRY_ID_TEXT          0U /* Text messages */
+#define TELEMETRY_ID_BUS_STATS     1U /* Counters of the bus statistics report */
+#define TELEMETRY_ID_RECOVERY      2U /* Counters of the bus off recovery */
+#define TELEMETRY_ID_E2E           3U /* Counters of the E2E checks */
+#define TELEMETRY_ID_TELEMETRY     4U /* Counters of the Telemetry module */
+#define TELEMETRY_ID_BENCH_RESULT  5U /* Counters of the benchmark results */
+#define TELEMETRY_ID_BENCH_LATENCY 6U /* Histogram of the benchmark round-trip latency */
+#define TELEMETRY_ID_RESPONSE      7U /* Sample taken for each response to a test message */
+
+/* Telemetry configuration */
+#define TELEMETRY_FLUSH_THRESHOLD   512U /* Pending bytes written at once while records are queued */
+#define TELEMETRY_FLUSH_INTERVAL_MS 10U  /* Maximum time between writes while bytes are pending */
+
+/* Interval between the bus statistics reports in milliseconds. The reports
+ * are held back while a benchmark is running.
+ */
+#define STATS_REPORT_INTERVAL_MS 10000U
+
+/* Time to wait for the response to a test message */
+#define TEST_RESPONSE_TIMEOUT_MS 1000U
+
+/* Bus off recovery configuration. Test messages queued while the bus is off
+ * are sent once it is recovered, new messages being refused if the queue is
+ * full.
+ */
+#define RECOVERY_MIN_BACKOFF_MS   100U   /* Backoff time after the first bus off */
+#define RECOVERY_MAX_BACKOFF_MS   5000U  /* Backoff time limit for repeated bus offs */
+#define RECOVERY_STABLE_TIME_MS   10000U /* Bus on time after which the backoff time is reset */
+#define RECOVERY_POLL_INTERVAL_MS 10U    /* Maximum time between recovery checks */
+
+/* 250ns system timer ticks per microsecond */
+#define SYSTIM_TICKS_PER_USEC 4U
 
 #define CAN_EVENT_MASK                                                                                               \
     (CAN_EVENT_RX_DATA_AVAIL | CAN_EVENT_TX_FINISHED | CAN_EVENT_BUS_ON | CAN_EVENT_BUS_OFF | CAN_EVENT_ERR_ACTIVE | \
      CAN_EVENT_ERR_PASSIVE | CAN_EVENT_RX_FIFO_MSG_LOST | CAN_EVENT_RX_RING_BUFFER_FULL |                            \
      CAN_EVENT_BIT_ERR_UNCORRECTED | CAN_EVENT_SPI_XFER_ERROR)
 
-/* Payload bytes indexed by Data Length Code (DLC) field. */
-static const uint32_t dlcToDataSize[DLC_TABLE_SIZE] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
-
 /* The following globals are not designated as 'static' to allow CCS IDE access */
 
 /* CAN handle */
@@ -73,8 +230,11 @@ CAN_Handle canHandle;
 /* UART2 handle */
 UART2_Handle uart2Handle;
 
-/* Formatted message buffer */
+/* Formatted message buffers of mainThread and of initiatorThread. Each thread
+ * formats its messages into its own buffer, as the threads preempt each other.
+ */
 char formattedMsg[MAX_MSG_LENGTH];
+char initiatorMsg[MAX_MSG_LENGTH];
 
 /* Rx and Tx buffer elements */
 CAN_RxBufElement rxElem;
@@ -83,15 +243,29 @@ CAN_TxBufElement txElem;
 /* Received msg count */
 uint32_t rxMsgCnt = 0U;
 
+/* Start Of Frame time of the last received message in system time (250ns ticks) */
+uint64_t rxSofTime;
+
+/* Handlers for the received message IDs */
+CANDispatch_Object canDispatch;
+
+#ifndef CAN_SUPPORTS_DCAN
+
+/* Message RAM configuration with the acceptance filters built from canDispatch */
+CANDispatch_Filters canFilters;
+CAN_MsgRAMConfig msgRAMConfig;
+
+#endif /* CAN_SUPPORTS_DCAN */
+
 /* Event callback count */
 volatile uint32_t rxEventCnt = 0U;
 volatile uint32_t txEventCnt = 0U;
 
-/* Current event */
-volatile uint32_t curEvent;
+/* Queue of CAN events posted by the event callback */
+CANEventQueue_Object eventQueue;
 
-/* Current event data */
-volatile uint32_t curEventData;
+/* Event queue overflow count last reported */
+uint32_t eventQueueOverflowCnt = 0U;
 
 /* CAN event semaphore */
 sem_t eventSem;
@@ -102,6 +276,18 @@ sem_t rxSem;
 /* Button press semaphore */
 sem_t buttonSem;
 
+#if CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+
+/* Rx ownership handover. The initiator thread counts its requests to become
+ * the only reader of CAN_read(), and the main thread posts rxOwnerSem once it
+ * has seen a request and is no longer reading.
+ */
+sem_t rxOwnerSem;
+volatile uint32_t rxOwnerReqCnt = 0U;
+uint32_t rxOwnerAckCnt          = 0U;
+
+#endif /* CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+
 /* Button driver parameters. */
 Button_Params button0Params;
 Button_Params button1Params;
@@ -113,262 +299,1477 @@ Button_Handle button1Handle;
 /* Flag to Tx CAN FD message with BRS */
 volatile bool sendCANFD;
 
-/* Forward declarations */
-static void processRxMsg(void);
-static void printRxMsg(void);
-static void handleEvent(void);
-static void verifyMsg(void);
-static void txTestMsg(uint32_t id, uint32_t extID, uint32_t dlc, uint32_t fdFormat, uint32_t brsEnable);
+/* Set while a benchmark is running */
+volatile bool benchRunning = false;
+
+/* Set while the ISO-TP benchmark is running */
+volatile bool isoTpRunning = false;
+
+/* CAN driver parameters, kept to reopen the driver after bus off */
+CAN_Params canParams;
+
+/* Bus off recovery and Tx queue */
+CANRecovery_Object canRecovery;
+
+/* Held by the initiator thread while it uses the driver, so the driver is not
+ * restarted by the main thread meanwhile.
+ */
+sem_t canLock;
+
+/* Bus statistics at the last and the current report */
+CANStats_Snapshot prevStats;
+CANStats_Snapshot curStats;
+
+#if CAN_INITIATOR_ISOTP_MODE
+
+/* ISO-TP link to the responder */
+CANIsoTp_Object isoTpLink;
+
+/* Message sent by the ISO-TP benchmark */
+uint8_t isoTpMsg[ISOTP_MSG_SIZE];
+
+/* Last acknowledgement received from the responder */
+uint8_t isoTpAck[ISOTP_ACK_SIZE];
+bool isoTpAckReceived;
+
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+
+/* Set while the RPC benchmark is running */
+volatile bool rpcRunning = false;
+
+#if CAN_INITIATOR_RPC_MODE
+
+/* Calls to the responder and their frame format */
+CANRpc_Object rpcLink;
+CANRpc_EchoConfig rpcEcho;
+
+/* Data of the calls and completed calls with the expected data */
+uint8_t rpcData[CANRpc_PAYLOAD_MAX];
+uint32_t rpcDataSize;
+uint32_t rpcMatchCnt;
+
+#endif /* CAN_INITIATOR_RPC_MODE */
+
+#if CAN_INITIATOR_E2E_MODE
+
+/* Protection of the classic CAN and CAN FD test messages and their responses */
+CANE2E_Object e2eTx;
+CANE2E_Object e2eFdTx;
+CANE2E_Object e2eRx;
+CANE2E_Object e2eFdRx;
+
+#endif /* CAN_INITIATOR_E2E_MODE */
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+
+/* Telemetry records sent on the UART */
+Telemetry_Object telemetry;
+
+/* Held while telemetry records are queued or written */
+sem_t telemetryLock;
+
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+/* Forward declarations */
+static void printMsg(const char *msg, size_t length);
+static void processRxMsg(uint32_t eventTime);
+static void printRxMsg(void);
+static void handleEvent(uint32_t curEvent, uint32_t curEventData);
+static void reportEventQueueOverflow(void);
+static void reportStats(void);
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem);
+static bool restartDriver(void *arg);
+static void processRecovery(void);
+static bool waitForSem(sem_t *sem, uint32_t timeoutMs);
+#if CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+static void waitForRx(void);
+#endif /* CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+static void verifyMsg(void);
+#if CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+static void takeRxOwnership(volatile bool *running);
+static void ackRxOwnership(void);
+#endif /* CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+#if CAN_INITIATOR_E2E_MODE
+static void initE2E(void);
+static void benchmarkE2E(void);
+static void checkE2E(void);
+#endif /* CAN_INITIATOR_E2E_MODE */
+static void handleResponse(const CAN_RxBufElement *elem, void *arg);
+static void initDispatch(CAN_Params *canParams);
+#if !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE
+static int_fast16_t txTestMsg(uint32_t id, uint32_t extID, uint32_t dlc, uint32_t fdFormat, uint32_t brsEnable);
+#endif /* !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE */
+#if CAN_INITIATOR_BENCHMARK_MODE
+static void handleBenchResponse(const CAN_RxBufElement *elem, void *arg);
+static bool sendBenchRequest(uint32_t seq, uint32_t dlc, bool canFD);
+static void runBenchmark(bool canFD);
+#endif /* CAN_INITIATOR_BENCHMARK_MODE */
+#if CAN_INITIATOR_ISOTP_MODE
+static void handleIsoTpFrame(const CAN_RxBufElement *elem, void *arg);
+static bool sendIsoTpFrame(void *arg, uint32_t id, const uint8_t *data);
+static void receiveIsoTpMsg(void *arg, const uint8_t *data, uint32_t length);
+static void pollIsoTp(void);
+static void runIsoTpBenchmark(void);
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+#if CAN_INITIATOR_RPC_MODE
+static void handleRpcFrame(const CAN_RxBufElement *elem, void *arg);
+static bool sendRpcFrame(void *arg, const CAN_TxBufElement *elem);
+static void completeRpcCall(void *arg, CANRpc_Status status, const uint8_t *data, size_t length);
+static void pollRpc(void);
+static void runRpcWindow(uint32_t window);
+static void runRpcBenchmark(bool canFD);
+#endif /* CAN_INITIATOR_RPC_MODE */
+#if CAN_INITIATOR_TELEMETRY_MODE
+static size_t writeUart(void *arg, const uint8_t *data, size_t length);
+static void initTelemetry(void);
+static void flushTelemetry(void);
+static void sendStats(void);
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+/*
+ *  ======== printMsg ========
+ *  Writes a message to the UART, or queues it as a telemetry text record.
+ */
+static void printMsg(const char *msg, size_t length)
+{
+#if CAN_INITIATOR_TELEMETRY_MODE
+    sem_wait(&telemetryLock);
+    Telemetry_writeText(&telemetry, TELEMETRY_ID_TEXT, msg, length);
+    Telemetry_flush(&telemetry);
+    sem_post(&telemetryLock);
+#else
+    UART2_write(uart2Handle, msg, length, NULL);
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+}
+
+/*
+ *  ======== handleEvent ========
+ */
+static void handleEvent(uint32_t curEvent, uint32_t curEventData)
+{
+    CANCodec_Cursor cursor;
+
+#if CAN_INITIATOR_ISOTP_MODE
+    if (isoTpRunning && ((curEvent == CAN_EVENT_RX_DATA_AVAIL) || (curEvent == CAN_EVENT_TX_FINISHED)))
+    {
+        /* The initiator thread reads the frames and refills the Tx buffers */
+        sem_post(&rxSem);
+        return;
+    }
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+
+#if CAN_INITIATOR_RPC_MODE
+    if (rpcRunning && ((curEvent == CAN_EVENT_RX_DATA_AVAIL) || (curEvent == CAN_EVENT_TX_FINISHED)))
+    {
+        /* The initiator thread reads the frames and resends the refused requests */
+        sem_post(&rxSem);
+        return;
+    }
+#endif /* CAN_INITIATOR_RPC_MODE */
+
+    if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
+    {
+        rxEventCnt++;
+        processRxMsg(curEventData);
+
+#ifdef CONFIG_GPIO_LED_1
+        /* Turn off LED1, indicating response was received */
+        GPIO_write(CONFIG_GPIO_LED_1, CONFIG_GPIO_LED_OFF);
+#endif /* CONFIG_GPIO_LED_1*/
+    }
+    else
+    {
+        CANCodec_init(&cursor, formattedMsg, sizeof(formattedMsg));
+
+        if (curEvent == CAN_EVENT_TX_FINISHED)
+        {
+            txEventCnt++;
+
+            if (benchRunning)
+            {
+                /* Tx completions are not printed during a benchmark */
+                return;
+            }
+
+            CANCodec_putStr(&cursor, "> Tx Finished. Cnt = ");
+            CANCodec_putUint(&cursor, txEventCnt);
+            CANCodec_putStr(&cursor, "\r\n\n");
+        }
+        else
+        {
+            CANCodec_putEvent(&cursor, curEvent, curEventData);
+        }
+
+        printMsg(formattedMsg, CANCodec_finish(&cursor));
+    }
+}
+
+/*
+ *  ======== printRxMsg ========
+ */
+static void printRxMsg(void)
+{
+    CANCodec_Cursor cursor;
+    size_t length;
+
+    CANCodec_init(&cursor, formattedMsg, sizeof(formattedMsg));
+    CANCodec_putRxElem(&cursor, &rxElem, rxSofTime);
+    length = CANCodec_finish(&cursor);
+
+    printMsg(formattedMsg, length);
+}
+
+/*
+ *  ======== verifyMsg ========
+ *  Verifies the Rx'ed message is the same as the Tx'ed message except with the
+ *  ID and data bits flipped.
+ */
+static void verifyMsg(void)
+{
+    bool verifyErr = false;
+    size_t dataLen;
+    size_t i;
+    uint32_t expectedID;
+
+    /* Flip transmitted ID bits */
+    expectedID = ~txElem.id;
+    if (txElem.xtd == 0)
+    {
+        /* 11-bit standard ID */
+        expectedID &= 0x7FF;
+    }
+    else
+    {
+        /* 29-bit standard ID */
+        expectedID &= 0x1FFFFFFF;
+    }
+
+    if (rxElem.id != expectedID)
+    {
+        sprintf(formattedMsg,
+                "=> FAIL: Received ID: 0x%x does not match expected ID: 0x%x!\r\n\n",
+                (unsigned int)rxElem.id,
+                (unsigned int)expectedID);
+        verifyErr = true;
+    }
+#ifndef CAN_SUPPORTS_DCAN
+    else if (rxElem.fdf != txElem.fdf)
+    {
+        sprintf(formattedMsg,
+                "=> FAIL: Received FDF: %u does not match transmitted FDF: %u!\r\n\n",
+                (unsigned int)rxElem.fdf,
+                (unsigned int)txElem.fdf);
+        verifyErr = true;
+    }
+#endif /* CAN_SUPPORTS_DCAN */
+    else if (rxElem.dlc != txElem.dlc)
+    {
+        sprintf(formattedMsg,
+                "=> FAIL: Received DLC: %u does not match transmitted DLC: %u!\r\n\n",
+                (unsigned int)rxElem.dlc,
+                (unsigned int)txElem.dlc);
+        verifyErr = true;
+    }
+    else
+    {
+        dataLen = CANCodec_dlcToLength(rxElem.dlc);
+
+        i = CANCodec_findInvertedMismatch(rxElem.data, txElem.data, dataLen);
+        if (i < dataLen)
+        {
+            sprintf(formattedMsg,
+                    "=> FAIL: Received data[%u]: 0x%02x does not match expected data: 0x%02x!\r\n\n",
+                    (unsigned int)i,
+                    rxElem.data[i],
+                    (uint8_t)~txElem.data[i]);
+            verifyErr = true;
+        }
+    }
+
+    if (!verifyErr)
+    {
+        sprintf(formattedMsg, "=> PASS: Received message matches expected.\r\n\n");
+    }
+
+    printMsg(formattedMsg, strlen(formattedMsg));
+}
+
+#if CAN_INITIATOR_E2E_MODE
+
+/*
+ *  ======== initE2E ========
+ *  Builds the CRC tables and the protection of the test messages. The data
+ *  IDs are the low 16 bits of the test message IDs.
+ */
+static void initE2E(void)
+{
+    CANE2E_Config config;
+
+    CANE2E_init();
+
+    config.dataId          = (uint16_t)TEST_MSG_ID;
+    config.crcType         = CANE2E_CRC8;
+    config.crcOffset       = E2E_CRC_OFFSET;
+    config.counterOffset   = E2E_COUNTER_OFFSET;
+    config.maxDeltaCounter = E2E_MAX_DELTA_COUNTER;
+
+    CANE2E_construct(&e2eTx, &config);
+    CANE2E_construct(&e2eRx, &config);
+
+    config.dataId        = (uint16_t)TEST_FD_MSG_ID;
+    config.crcType       = CANE2E_CRC16;
+    config.counterOffset = E2E_FD_COUNTER_OFFSET;
+
+    CANE2E_construct(&e2eFdTx, &config);
+    CANE2E_construct(&e2eFdRx, &config);
+}
+
+/*
+ *  ======== benchmarkE2E ========
+ *  Prints the time taken to check a classic CAN and a CAN FD test message,
+ *  averaged over E2E_BENCH_COUNT checks. Each check is made on a fresh copy
+ *  of the receiver state, so all checks take the same path.
+ */
+static void benchmarkE2E(void)
+{
+    uint8_t data[CANCodec_MAX_DATA_LENGTH];
+    CANE2E_Object tx;
+    CANE2E_Object rx;
+    size_t length;
+    uint64_t startTime;
+    uint32_t checkTime[2];
+    uint32_t errorCnt = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    for (j = 0U; j < 2U; j++)
+    {
+        tx     = (j == 0U) ? e2eTx : e2eFdTx;
+        length = (j == 0U) ? CANCodec_MAX_CLASSIC_DATA_LENGTH : CANCodec_MAX_DATA_LENGTH;
+
+        for (i = 0U; i < sizeof(data); i++)
+        {
+            data[i] = (uint8_t)i;
+        }
+
+        (void)CANE2E_protect(&tx, data, length);
+
+        startTime = CANTimestamp_getTime();
+
+        for (i = 0U; i < E2E_BENCH_COUNT; i++)
+        {
+            rx = (j == 0U) ? e2eRx : e2eFdRx;
+
+            if (CANE2E_check(&rx, data, length) != CANE2E_INITIAL)
+            {
+                errorCnt++;
+            }
+        }
+
+        /* Nanoseconds per check */
+        checkTime[j] = (uint32_t)(((CANTimestamp_getTime() - startTime) * 1000U) /
+                                  ((uint64_t)E2E_BENCH_COUNT * SYSTIM_TICKS_PER_USEC));
+    }
+
+    sprintf(initiatorMsg,
+            "> E2E check: %u ns for 8 bytes with CRC-8, %u ns for 64 bytes with CRC-16, errors %u\r\n\n",
+            (unsigned int)checkTime[0],
+            (unsigned int)checkTime[1],
+            (unsigned int)errorCnt);
+    printMsg(initiatorMsg, strlen(initiatorMsg));
+}
+
+/*
+ *  ======== checkE2E ========
+ *  Checks the protection of the response to a test message, which is the
+ *  global rxElem.
+ */
+static void checkE2E(void)
+{
+    static const char *const statusText[] = {
+        "OK",
+        "OK, messages lost",
+        "first message",
+        "repeated message",
+        "wrong sequence",
+        "length or CRC error",
+    };
+    uint8_t data[CANCodec_MAX_DATA_LENGTH];
+    size_t dataLen;
+    CANE2E_Object *obj;
+    CANE2E_Status status;
+
+    obj     = (rxElem.id == TEST_FD_RESPONSE_ID) ? &e2eFdRx : &e2eRx;
+    dataLen = CANCodec_dlcToLength(rxElem.dlc);
+
+    CANCodec_copyInverted(data, rxElem.data, dataLen);
+    status = CANE2E_check(obj, data, dataLen);
+
+    /* The counter is only read from a message whose length was checked */
+    if (status == CANE2E_ERROR)
+    {
+        sprintf(formattedMsg, "=> E2E: %s\r\n\n", statusText[status]);
+    }
+    else
+    {
+        sprintf(formattedMsg,
+                "=> E2E: %s, counter %u\r\n\n",
+                statusText[status],
+                (unsigned int)data[obj->config.counterOffset]);
+    }
+    printMsg(formattedMsg, strlen(formattedMsg));
+}
+
+#endif /* CAN_INITIATOR_E2E_MODE */
+
+/*
+ *  ======== processRxMsg ========
+ *  eventTime is the system time at which the event callback reported the
+ *  messages.
+ */
+static void processRxMsg(uint32_t eventTime)
+{
+    CANTimestamp_Ref ref;
+    uint32_t count = 0U;
+
+    /* Read all available CAN messages */
+    while (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS)
+    {
+        CANTimestamp_capture(&ref);
+        rxSofTime = CANTimestamp_toRxSofTime(&ref, rxElem.rxts, eventTime);
+
+        rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
+
+        /* Messages with an unregistered ID are dropped */
+        CANDispatch_dispatch(&canDispatch, &rxElem);
+    }
+
+    CANStats_rxBurst(count);
+}
+
+/*
+ *  ======== handleResponse ========
+ *  Handles a response to a test message. The message is the global rxElem.
+ */
+static void handleResponse(const CAN_RxBufElement *elem, void *arg)
+{
+#if CAN_INITIATOR_TELEMETRY_MODE
+    int32_t sample[3];
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+    /* Sampled at the SOF time of the response */
+    sample[0] = (int32_t)rxMsgCnt;
+    sample[1] = (int32_t)rxEventCnt;
+    sample[2] = (int32_t)elem->id;
+
+    sem_wait(&telemetryLock);
+    Telemetry_writeSample(&telemetry, TELEMETRY_ID_RESPONSE, (uint32_t)rxSofTime, sample, 3U);
+    sem_post(&telemetryLock);
+#else
+    sprintf(formattedMsg, "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n", (unsigned int)rxMsgCnt, (unsigned int)rxEventCnt);
+    printMsg(formattedMsg, strlen(formattedMsg));
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+    printRxMsg();
+    verifyMsg();
+#if CAN_INITIATOR_E2E_MODE
+    checkE2E();
+#endif /* CAN_INITIATOR_E2E_MODE */
+    sem_post(&rxSem);
+}
+
+/*
+ *  ======== initDispatch ========
+ *  Registers the handlers for the received message IDs. On devices with an
+ *  MCAN peripheral the acceptance filters are built from the registered IDs,
+ *  so other messages are rejected by the hardware.
+ */
+static void initDispatch(CAN_Params *canParams)
+{
+    CANDispatch_init(&canDispatch);
+
+    CANDispatch_registerId(&canDispatch, TEST_RESPONSE_ID, false, handleResponse, NULL);
+    CANDispatch_registerId(&canDispatch, TEST_FD_RESPONSE_ID, true, handleResponse, NULL);
+
+#if CAN_INITIATOR_BENCHMARK_MODE
+    CANDispatch_registerId(&canDispatch, BENCH_RESPONSE_ID, false, handleBenchResponse, NULL);
+#endif /* CAN_INITIATOR_BENCHMARK_MODE */
+
+#if CAN_INITIATOR_ISOTP_MODE
+    CANDispatch_registerId(&canDispatch, ISOTP_RX_ID, false, handleIsoTpFrame, NULL);
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+
+#if CAN_INITIATOR_RPC_MODE
+    CANDispatch_registerId(&canDispatch, ~RPC_MSG_ID & 0x7FF, false, handleRpcFrame, NULL);
+#endif /* CAN_INITIATOR_RPC_MODE */
+
+#ifndef CAN_SUPPORTS_DCAN
+
+    CANDispatch_buildFilters(&canDispatch, &canFilters, &msgRAMConfig);
+
+    msgRAMConfig.rxFIFONum[0]   = MSG_RAM_RX_FIFO_NUM;
+    msgRAMConfig.rxFIFONum[1]   = 0U;
+    msgRAMConfig.rxBufNum       = 0U;
+    msgRAMConfig.txBufNum       = 0U;
+    msgRAMConfig.txFIFOQNum     = MSG_RAM_TX_FIFO_Q_NUM;
+    msgRAMConfig.txFIFOQMode    = 0U;
+    msgRAMConfig.txEventFIFONum = MSG_RAM_TX_EVENT_FIFO_NUM;
+
+    canParams->msgRAMConfig = &msgRAMConfig;
+
+#endif /* CAN_SUPPORTS_DCAN */
+}
+
+/*
+ *  ======== reportEventQueueOverflow ========
+ *  Reports events dropped by the event callback because the event queue was
+ *  full. CANEventQueue_SIZE should be increased if this is ever printed.
+ */
+static void reportEventQueueOverflow(void)
+{
+    uint32_t overflowCnt = eventQueue.overflowCnt;
+
+    if (overflowCnt != eventQueueOverflowCnt)
+    {
+        eventQueueOverflowCnt = overflowCnt;
+
+        sprintf(formattedMsg,
+                "> Event queue overflow: Cnt = %u, last lost event = 0x%x\r\n\n",
+                (unsigned int)overflowCnt,
+                (unsigned int)eventQueue.lastLostEvent);
+        printMsg(formattedMsg, strlen(formattedMsg));
+    }
+}
+
+/*
+ *  ======== reportStats ========
+ *  Prints the bus statistics once every STATS_REPORT_INTERVAL_MS, with the bus
+ *  load since the last report.
+ */
+static void reportStats(void)
+{
+    uint64_t now = CANTimestamp_getTime();
+
+    if ((now - prevStats.time) < ((uint64_t)STATS_REPORT_INTERVAL_MS * 1000U * SYSTIM_TICKS_PER_USEC))
+    {
+        return;
+    }
+
+    CANStats_getSnapshot(&curStats, now);
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+    sendStats();
+#else
+    CANStats_formatReport(&prevStats, &curStats, formattedMsg, sizeof(formattedMsg));
+    printMsg(formattedMsg, strlen(formattedMsg));
+
+    sprintf(formattedMsg,
+            "> Recovery: bus off %u, restarts %u (%u failed), down %ums (max %ums), queued %u, dropped %u\r\n",
+            (unsigned int)canRecovery.stats.busOffCnt,
+            (unsigned int)canRecovery.stats.restartCnt,
+            (unsigned int)canRecovery.stats.restartFailCnt,
+            (unsigned int)(canRecovery.stats.downTime / CANRecovery_TICKS_PER_MSEC),
+            (unsigned int)(canRecovery.stats.maxDownTime / CANRecovery_TICKS_PER_MSEC),
+            (unsigned int)canRecovery.stats.queuedCnt,
+            (unsigned int)canRecovery.stats.droppedCnt);
+    printMsg(formattedMsg, strlen(formattedMsg));
+
+#if CAN_INITIATOR_E2E_MODE
+    sprintf(formattedMsg,
+            "> E2E: checked %u, ok %u, lost %u, repeated %u, wrong sequence %u, errors %u\r\n",
+            (unsigned int)(e2eRx.stats.checkCnt + e2eFdRx.stats.checkCnt),
+            (unsigned int)(e2eRx.stats.okCnt + e2eFdRx.stats.okCnt),
+            (unsigned int)(e2eRx.stats.lostCnt + e2eFdRx.stats.lostCnt),
+            (unsigned int)(e2eRx.stats.repeatedCnt + e2eFdRx.stats.repeatedCnt),
+            (unsigned int)(e2eRx.stats.wrongSequenceCnt + e2eFdRx.stats.wrongSequenceCnt),
+            (unsigned int)(e2eRx.stats.errorCnt + e2eFdRx.stats.errorCnt));
+    printMsg(formattedMsg, strlen(formattedMsg));
+#endif /* CAN_INITIATOR_E2E_MODE */
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+    prevStats = curStats;
+}
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+
+/*
+ *  ======== writeUart ========
+ *  Telemetry write function. The UART is opened in nonblocking write mode,
+ *  so only the bytes that fit in its Tx ring buffer are taken.
+ */
+static size_t writeUart(void *arg, const uint8_t *data, size_t length)
+{
+    size_t bytesWritten = 0U;
+
+    UART2_write(uart2Handle, data, length, &bytesWritten);
+
+    return bytesWritten;
+}
+
+/*
+ *  ======== initTelemetry ========
+ */
+static void initTelemetry(void)
+{
+    Telemetry_Params telemetryParams;
+    int retc;
+
+    telemetryParams.writeFxn       = writeUart;
+    telemetryParams.arg            = NULL;
+    telemetryParams.flushThreshold = TELEMETRY_FLUSH_THRESHOLD;
+
+    Telemetry_init(&telemetry, &telemetryParams);
+
+    retc = sem_init(&telemetryLock, 0, 1);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+}
+
+/*
+ *  ======== flushTelemetry ========
+ *  Writes the telemetry bytes the UART could not take so far.
+ */
+static void flushTelemetry(void)
+{
+    sem_wait(&telemetryLock);
+    Telemetry_flush(&telemetry);
+    sem_post(&telemetryLock);
+}
+
+/*
+ *  ======== sendStats ========
+ *  Sends the bus statistics, the bus off recovery and E2E statistics and the
+ *  telemetry statistics as counter records. Times are in milliseconds and the
+ *  bus load since the last report in tenths of a percent.
+ */
+static void sendStats(void)
+{
+    uint32_t counters[14];
+
+    sem_wait(&telemetryLock);
+
+    /* The values of the text report, in the same order */
+    counters[0]  = CANStats_getBusLoad(&prevStats, &curStats);
+    counters[1]  = curStats.rxFrameCnt;
+    counters[2]  = curStats.rxByteCnt;
+    counters[3]  = curStats.txFrameCnt;
+    counters[4]  = curStats.txByteCnt;
+    counters[5]  = curStats.rxBurstMax;
+    counters[6]  = curStats.txFullCnt;
+    counters[7]  = CANStats_getEventCnt(&curStats, CAN_EVENT_BUS_OFF);
+    counters[8]  = (uint32_t)(curStats.busOffTime / (1000U * CANStats_TICKS_PER_USEC));
+    counters[9]  = CANStats_getEventCnt(&curStats, CAN_EVENT_ERR_PASSIVE);
+    counters[10] = (uint32_t)(curStats.errPassiveTime / (1000U * CANStats_TICKS_PER_USEC));
+    counters[11] = CANStats_getEventCnt(&curStats, CAN_EVENT_RX_FIFO_MSG_LOST);
+    counters[12] = CANStats_getEventCnt(&curStats, CAN_EVENT_RX_RING_BUFFER_FULL);
+    counters[13] = CANStats_getEventCnt(&curStats, CAN_EVENT_BIT_ERR_UNCORRECTED);
+    Telemetry_writeCounters(&telemetry, TELEMETRY_ID_BUS_STATS, counters, 14U);
+
+    counters[0] = canRecovery.stats.busOffCnt;
+    counters[1] = canRecovery.stats.restartCnt;
+    counters[2] = canRecovery.stats.restartFailCnt;
+    counters[3] = (uint32_t)(canRecovery.stats.downTime / CANRecovery_TICKS_PER_MSEC);
+    counters[4] = (uint32_t)(canRecovery.stats.maxDownTime / CANRecovery_TICKS_PER_MSEC);
+    counters[5] = canRecovery.stats.queuedCnt;
+    counters[6] = canRecovery.stats.droppedCnt;
+    Telemetry_writeCounters(&telemetry, TELEMETRY_ID_RECOVERY, counters, 7U);
+
+#if CAN_INITIATOR_E2E_MODE
+    counters[0] = e2eRx.stats.checkCnt + e2eFdRx.stats.checkCnt;
+    counters[1] = e2eRx.stats.okCnt + e2eFdRx.stats.okCnt;
+    counters[2] = e2eRx.stats.lostCnt + e2eFdRx.stats.lostCnt;
+    counters[3] = e2eRx.stats.repeatedCnt + e2eFdRx.stats.repeatedCnt;
+    counters[4] = e2eRx.stats.wrongSequenceCnt + e2eFdRx.stats.wrongSequenceCnt;
+    counters[5] = e2eRx.stats.errorCnt + e2eFdRx.stats.errorCnt;
+    Telemetry_writeCounters(&telemetry, TELEMETRY_ID_E2E, counters, 6U);
+#endif /* CAN_INITIATOR_E2E_MODE */
+
+    counters[0] = telemetry.stats.recordCnt;
+    counters[1] = telemetry.stats.droppedCnt;
+    counters[2] = telemetry.stats.bytesWritten;
+    counters[3] = telemetry.stats.writeCnt;
+    counters[4] = telemetry.stats.maxPending;
+    Telemetry_writeCounters(&telemetry, TELEMETRY_ID_TELEMETRY, counters, 5U);
+
+    Telemetry_flush(&telemetry);
+
+    sem_post(&telemetryLock);
+}
+
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+/*
+ *  ======== writeFrame ========
+ *  Bus off recovery write function.
+ */
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem)
+{
+    int_fast16_t status;
+
+    status = CAN_write(canHandle, elem);
+    if (status == CAN_STATUS_SUCCESS)
+    {
+        CANStats_txFrame(elem);
+    }
+    else
+    {
+        CANStats_txFull();
+    }
+
+    return status;
+}
+
+/*
+ *  ======== restartDriver ========
+ *  Bus off recovery restart function. Reopening the driver resets the
+ *  controller, which then rejoins the bus.
+ */
+static bool restartDriver(void *arg)
+{
+    if (canHandle != NULL)
+    {
+        CAN_close(canHandle);
+    }
+
+    canHandle = CAN_open(CONFIG_CAN_0, &canParams);
+
+    return (canHandle != NULL);
+}
+
+/*
+ *  ======== processRecovery ========
+ *  Recovers from bus off and writes the queued frames. Skipped while the
+ *  initiator thread uses the driver, in which case it is retried on the next
+ *  call.
+ */
+static void processRecovery(void)
+{
+    if (sem_trywait(&canLock) == 0)
+    {
+        CANRecovery_process(&canRecovery, CANTimestamp_getTime());
+        sem_post(&canLock);
+    }
+}
+
+/*
+ *  ======== eventCallback ========
+ */
+static void eventCallback(CAN_Handle handle, uint32_t event, uint32_t data, void *userArg)
+{
+    CANStats_event(event, CANTimestamp_getTime());
+    CANRecovery_event(&canRecovery, event, CANTimestamp_getTime());
+
+    /* Rx events carry the system time they were reported at */
+    if (event == CAN_EVENT_RX_DATA_AVAIL)
+    {
+        data = (uint32_t)CANTimestamp_getTime();
+    }
+
+    /* Queue the event so back-to-back events are not overwritten before they
+     * are handled. The semaphore is only posted for queued events so its count
+     * always matches the number of queue entries.
+     */
+    if (CANEventQueue_put(&eventQueue, event, data))
+    {
+        sem_post(&eventSem);
+    }
+}
+
+#if !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE
+
+/*
+ *  ======== txTestMsg ========
+ *  Returns CAN_STATUS_SUCCESS if the message was written or queued until the
+ *  bus is recovered.
+ */
+static int_fast16_t txTestMsg(uint32_t id, uint32_t extID, uint32_t dlc, uint32_t fdFormat, uint32_t brsEnable)
+{
+    uint_fast8_t i;
+
+    txElem.id  = id;
+    txElem.rtr = 0U;
+    txElem.xtd = extID;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.esi = 0U;
+    txElem.brs = brsEnable;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.dlc = dlc;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.fdf = fdFormat;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.efc = 0U;
+    txElem.mm  = 1U;
+
+    for (i = 0U; i < CANCodec_dlcToLength(txElem.dlc); i++)
+    {
+        txElem.data[i] = i;
+    }
+
+#if CAN_INITIATOR_E2E_MODE
+    /* The counter advances even if the message is refused, which the
+     * receiver sees as a lost message.
+     */
+    (void)CANE2E_protect((txElem.xtd != 0U) ? &e2eFdTx : &e2eTx, txElem.data, CANCodec_dlcToLength(txElem.dlc));
+#endif /* CAN_INITIATOR_E2E_MODE */
+
+    return CANRecovery_write(&canRecovery, &txElem);
+}
+
+#endif /* !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE */
+
+#if CAN_INITIATOR_BENCHMARK_MODE
+
+/*
+ *  ======== handleBenchResponse ========
+ *  Passes a benchmark response to the benchmark. The benchmark state is shared
+ *  with the initiator thread, so it is only accessed with interrupts disabled.
+ *  Responses that arrive after the benchmark ended are dropped.
+ */
+static void handleBenchResponse(const CAN_RxBufElement *elem, void *arg)
+{
+    uint8_t data[CANBenchmark_PAYLOAD_MIN];
+    uint32_t sendTime;
+    uint32_t seq;
+    uintptr_t hwiKey;
+
+    if (!benchRunning)
+    {
+        return;
+    }
+
+    if (CANCodec_dlcToLength(elem->dlc) < CANBenchmark_PAYLOAD_MIN)
+    {
+        /* Not a response to a benchmark request, count it as unexpected */
+        seq      = UINT32_MAX;
+        sendTime = 0U;
+    }
+    else
+    {
+        /* The responder flips all data bits */
+        CANCodec_copyInverted(data, elem->data, CANBenchmark_PAYLOAD_MIN);
+
+        CANBenchmark_decode(data, &seq, &sendTime);
+    }
+
+    hwiKey = HwiP_disable();
+    CANBenchmark_responseReceived(seq, sendTime, (uint32_t)rxSofTime);
+    HwiP_restore(hwiKey);
+
+    sem_post(&rxSem);
+}
+
+/*
+ *  ======== sendBenchRequest ========
+ *  Returns false if the driver could not accept the request.
+ */
+static bool sendBenchRequest(uint32_t seq, uint32_t dlc, bool canFD)
+{
+    uint32_t sendTime;
+    uintptr_t hwiKey;
+
+    txElem.id  = BENCH_MSG_ID;
+    txElem.rtr = 0U;
+    txElem.xtd = 0U;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.esi = 0U;
+    txElem.brs = canFD;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.dlc = dlc;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.fdf = canFD;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.efc = 0U;
+    txElem.mm  = 1U;
+
+    sendTime = (uint32_t)CANTimestamp_getTime();
+
+    CANBenchmark_encode(txElem.data, CANCodec_dlcToLength(dlc), seq, sendTime);
+
+    hwiKey = HwiP_disable();
+    CANBenchmark_requestSent(seq, sendTime);
+    HwiP_restore(hwiKey);
+
+    /* Requests are not written while the driver may be restarted */
+    if (CANRecovery_isBusOff(&canRecovery) || (CAN_write(canHandle, &txElem) != CAN_STATUS_SUCCESS))
+    {
+        hwiKey = HwiP_disable();
+        CANBenchmark_requestFailed(seq);
+        HwiP_restore(hwiKey);
+
+        CANStats_txFull();
+
+        return false;
+    }
+
+    CANStats_txFrame(&txElem);
+
+    return true;
+}
+
+/*
+ *  ======== runBenchmark ========
+ *  Streams BENCH_FRAME_COUNT requests to the responder, keeping up to
+ *  BENCH_WINDOW requests outstanding, and prints the results as JSON.
+ */
+static void runBenchmark(bool canFD)
+{
+    CANBenchmark_Params benchParams;
+    CANBenchmark_Result result;
+#if CAN_INITIATOR_TELEMETRY_MODE
+    uint32_t counters[14];
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+    bool done;
+    uint32_t dlc;
+    uint32_t nextSendTime;
+    uint32_t now;
+    uint32_t seq;
+    uintptr_t hwiKey;
+
+    dlc = canFD ? BENCH_FD_DLC : BENCH_DLC;
+
+    benchParams.frameCount  = BENCH_FRAME_COUNT;
+    benchParams.window      = BENCH_WINDOW;
+    benchParams.payloadSize = CANCodec_dlcToLength(dlc);
+    benchParams.timeout     = BENCH_RESPONSE_TIMEOUT_MS * 1000U * SYSTIM_TICKS_PER_USEC;
+
+    sprintf(initiatorMsg,
+            "Running benchmark: %u frames, %u payload bytes, window %u...\r\n",
+            (unsigned int)benchParams.frameCount,
+            (unsigned int)benchParams.payloadSize,
+            (unsigned int)benchParams.window);
+    printMsg(initiatorMsg, strlen(initiatorMsg));
+
+    now          = (uint32_t)CANTimestamp_getTime();
+    nextSendTime = now;
+
+    hwiKey = HwiP_disable();
+    CANBenchmark_start(&benchParams, now);
+    HwiP_restore(hwiKey);
+
+    benchRunning = true;
+    done         = false;
+
+    while (!done)
+    {
+        now = (uint32_t)CANTimestamp_getTime();
+
+        hwiKey = HwiP_disable();
+        CANBenchmark_expire(now);
+        HwiP_restore(hwiKey);
+
+        /* Send all requests that are due and fit in the window */
+        while ((BENCH_FRAME_INTERVAL_USEC == 0U) || ((int32_t)(now - nextSendTime) >= 0))
+        {
+            hwiKey = HwiP_disable();
+            done   = !CANBenchmark_nextRequest(&seq);
+            HwiP_restore(hwiKey);
+
+            if (done || !sendBenchRequest(seq, dlc, canFD))
+            {
+                break;
+            }
+
+            nextSendTime += BENCH_FRAME_INTERVAL_USEC * SYSTIM_TICKS_PER_USEC;
+        }
+
+        hwiKey = HwiP_disable();
+        done   = CANBenchmark_isDone();
+        HwiP_restore(hwiKey);
+
+        if (!done)
+        {
+            waitForRx();
+        }
+    }
+
+    benchRunning = false;
+
+    /* Discard the response notifications that were not waited for */
+    while (sem_trywait(&rxSem) == 0) {}
+
+    CANBenchmark_getResult(&result);
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+    /* The values of the JSON result, in the same order */
+    counters[0]  = result.frameCount;
+    counters[1]  = result.payloadSize;
+    counters[2]  = result.window;
+    counters[3]  = result.sent;
+    counters[4]  = result.received;
+    counters[5]  = result.lost;
+    counters[6]  = result.reordered;
+    counters[7]  = result.unexpected;
+    counters[8]  = result.latencyP50Usec;
+    counters[9]  = result.latencyP99Usec;
+    counters[10] = result.latencyMaxUsec;
+    counters[11] = result.elapsedUsec;
+    counters[12] = result.framesPerSec;
+    counters[13] = result.payloadBitsPerSec;
+
+    sem_wait(&telemetryLock);
+    Telemetry_writeCounters(&telemetry, TELEMETRY_ID_BENCH_RESULT, counters, 14U);
+    Telemetry_writeHistogram(&telemetry,
+                             TELEMETRY_ID_BENCH_LATENCY,
+                             CANBenchmark_getHistogram(),
+                             CANBenchmark_HIST_BINS,
+                             CANBenchmark_HIST_BIN_USEC);
+    Telemetry_flush(&telemetry);
+    sem_post(&telemetryLock);
+#else
+    CANBenchmark_formatResult(&result, initiatorMsg, sizeof(initiatorMsg));
+    printMsg(initiatorMsg, strlen(initiatorMsg));
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+}
+
+#endif /* CAN_INITIATOR_BENCHMARK_MODE */
+
+#if CAN_INITIATOR_ISOTP_MODE
+
+/*
+ *  ======== handleIsoTpFrame ========
+ *  Passes a frame received on the ISO-TP link ID to the link.
+ */
+static void handleIsoTpFrame(const CAN_RxBufElement *elem, void *arg)
+{
+    CANIsoTp_receiveFrame(&isoTpLink,
+                          elem->id,
+                          elem->data,
+                          CANCodec_dlcToLength(elem->dlc),
+                          (uint32_t)CANTimestamp_getTime());
+}
+
+/*
+ *  ======== sendIsoTpFrame ========
+ *  ISO-TP frame transmit function. Returns false if the driver could not
+ *  accept the frame.
+ */
+static bool sendIsoTpFrame(void *arg, uint32_t id, const uint8_t *data)
+{
+    /* The frame is retried once the bus is recovered */
+    if (CANRecovery_isBusOff(&canRecovery))
+    {
+        return false;
+    }
+
+    txElem.id  = id;
+    txElem.rtr = 0U;
+    txElem.xtd = 0U;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.esi = 0U;
+    txElem.brs = 0U;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.dlc = CAN_DLC_8B;
+#ifndef CAN_SUPPORTS_DCAN
+    txElem.fdf = 0U;
+#endif /* CAN_SUPPORTS_DCAN */
+    txElem.efc = 0U;
+    txElem.mm  = 1U;
+
+    memcpy(txElem.data, data, CANIsoTp_FRAME_SIZE);
+
+    if (CAN_write(canHandle, &txElem) != CAN_STATUS_SUCCESS)
+    {
+        CANStats_txFull();
+
+        return false;
+    }
+
+    CANStats_txFrame(&txElem);
+
+    return true;
+}
 
 /*
- *  ======== handleEvent ========
+ *  ======== receiveIsoTpMsg ========
+ *  ISO-TP message receive function. The responder only sends
+ *  acknowledgements.
  */
-static void handleEvent(void)
+static void receiveIsoTpMsg(void *arg, const uint8_t *data, uint32_t length)
 {
-    if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
+    if (length >= ISOTP_ACK_SIZE)
     {
-        rxEventCnt++;
-        processRxMsg();
-
-#ifdef CONFIG_GPIO_LED_1
-        /* Turn off LED1, indicating response was received */
-        GPIO_write(CONFIG_GPIO_LED_1, CONFIG_GPIO_LED_OFF);
-#endif /* CONFIG_GPIO_LED_1*/
+        memcpy(isoTpAck, data, ISOTP_ACK_SIZE);
+        isoTpAckReceived = true;
     }
-    else
-    {
-        if (curEvent == CAN_EVENT_TX_FINISHED)
-        {
-            txEventCnt++;
-            sprintf(formattedMsg, "> Tx Finished. Cnt = %u\r\n\n", (unsigned int)txEventCnt);
-        }
-        else if (curEvent == CAN_EVENT_BUS_ON)
-        {
-            sprintf(formattedMsg, "> Bus On\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_BUS_OFF)
-        {
-            sprintf(formattedMsg, "> Bus Off\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_ACTIVE)
-        {
-            sprintf(formattedMsg, "> Error Active\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_PASSIVE)
-        {
-            sprintf(formattedMsg, "> Error Passive\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_RX_FIFO_MSG_LOST)
-        {
-            sprintf(formattedMsg, "> Rx FIFO %u message lost\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL)
-        {
-            sprintf(formattedMsg, "> Rx ring buffer full: Cnt = %u\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_BIT_ERR_UNCORRECTED)
-        {
-            sprintf(formattedMsg, "> Uncorrected bit error\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_SPI_XFER_ERROR)
-        {
-            sprintf(formattedMsg, "> SPI transfer error: status = 0x%x\r\n\n", (unsigned int)curEventData);
-        }
-        else
-        {
-            sprintf(formattedMsg, "> Undefined event\r\n\n");
-        }
+}
+
+/*
+ *  ======== pollIsoTp ========
+ *  Dispatches all received frames, then lets the ISO-TP link send the frames
+ *  that are due.
+ */
+static void pollIsoTp(void)
+{
+    uint32_t count = 0U;
 
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    /* The driver may be restarted */
+    while (!CANRecovery_isBusOff(&canRecovery) && (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS))
+    {
+        rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
+        CANDispatch_dispatch(&canDispatch, &rxElem);
     }
+
+    CANStats_rxBurst(count);
+
+    CANIsoTp_process(&isoTpLink, (uint32_t)CANTimestamp_getTime());
 }
 
 /*
- *  ======== printRxMsg ========
+ *  ======== runIsoTpBenchmark ========
+ *  Sends ISOTP_MSG_COUNT messages of ISOTP_MSG_SIZE bytes to the responder,
+ *  waiting for each to be acknowledged, and prints the throughput.
  */
-static void printRxMsg(void)
+static void runIsoTpBenchmark(void)
 {
-    uint_fast8_t dataLen;
-    uint_fast8_t i;
+    CANIsoTp_Stats startStats;
+    CANIsoTp_TxStatus txStatus;
+    uint32_t ackCnt;
+    uint32_t ackDeadline;
+    uint32_t elapsedUsec;
+    uint32_t frameCnt;
+    uint32_t i;
+    uint32_t msgNum;
+    uint32_t startTime;
+    uint32_t now;
+
+    sprintf(initiatorMsg,
+            "Running ISO-TP benchmark: %u messages of %u bytes...\r\n",
+            (unsigned int)ISOTP_MSG_COUNT,
+            (unsigned int)ISOTP_MSG_SIZE);
+    printMsg(initiatorMsg, strlen(initiatorMsg));
+
+    startStats = isoTpLink.stats;
+    ackCnt     = 0U;
+    txStatus   = CANIsoTp_TX_DONE;
+
+    takeRxOwnership(&isoTpRunning);
+
+    startTime = (uint32_t)CANTimestamp_getTime();
+    now       = startTime;
+
+    for (msgNum = 0U; (msgNum < ISOTP_MSG_COUNT) && (txStatus == CANIsoTp_TX_DONE); msgNum++)
+    {
+        /* The first byte numbers the message, the rest is a pattern the
+         * responder can verify.
+         */
+        for (i = 0U; i < ISOTP_MSG_SIZE; i++)
+        {
+            isoTpMsg[i] = (uint8_t)(msgNum + i);
+        }
 
-    sprintf(formattedMsg, "Msg ID: 0x%x\r\n", (unsigned int)rxElem.id);
+        isoTpAckReceived = false;
 
-    sprintf(formattedMsg + strlen(formattedMsg), "TS: 0x%04x\r\n", rxElem.rxts);
+        CANIsoTp_send(&isoTpLink, isoTpMsg, ISOTP_MSG_SIZE, now);
 
-#ifndef CAN_SUPPORTS_DCAN
+        while (CANIsoTp_getTxStatus(&isoTpLink) == CANIsoTp_TX_BUSY)
+        {
+            waitForRx();
+            pollIsoTp();
+        }
 
-    sprintf(formattedMsg + strlen(formattedMsg), "CAN FD: %u\r\n", rxElem.fdf);
+        txStatus = CANIsoTp_getTxStatus(&isoTpLink);
 
-#endif /* CAN_SUPPORTS_DCAN */
+        /* Wait for the responder to acknowledge the message */
+        now         = (uint32_t)CANTimestamp_getTime();
+        ackDeadline = now + (ISOTP_ACK_TIMEOUT_MS * 1000U * SYSTIM_TICKS_PER_USEC);
 
-    sprintf(formattedMsg + strlen(formattedMsg), "DLC: %u\r\n", rxElem.dlc);
+        while ((txStatus == CANIsoTp_TX_DONE) && !isoTpAckReceived && ((int32_t)(now - ackDeadline) < 0))
+        {
+            waitForRx();
+            pollIsoTp();
+            now = (uint32_t)CANTimestamp_getTime();
+        }
 
-#ifndef CAN_SUPPORTS_DCAN
+        if (isoTpAckReceived && (isoTpAck[0] == (uint8_t)msgNum) && (isoTpAck[1] == 0U))
+        {
+            ackCnt++;
+        }
+    }
 
-    sprintf(formattedMsg + strlen(formattedMsg), "BRS: %u\r\n", rxElem.brs);
+    elapsedUsec = ((uint32_t)CANTimestamp_getTime() - startTime) / SYSTIM_TICKS_PER_USEC;
 
-#endif /* CAN_SUPPORTS_DCAN */
+    isoTpRunning = false;
+
+    /* Discard the notifications that were not waited for */
+    while (sem_trywait(&rxSem) == 0) {}
 
-    sprintf(formattedMsg + strlen(formattedMsg), "ESI: %u\r\n", rxElem.esi);
+    frameCnt = (isoTpLink.stats.txFrameCnt - startStats.txFrameCnt) +
+               (isoTpLink.stats.rxFrameCnt - startStats.rxFrameCnt);
 
-    if (rxElem.dlc < DLC_TABLE_SIZE)
+    if (elapsedUsec == 0U)
     {
-        dataLen = dlcToDataSize[rxElem.dlc];
+        elapsedUsec = 1U;
+    }
 
-        sprintf(formattedMsg + strlen(formattedMsg), "Data[%lu]: ", (unsigned long)dataLen);
+    sprintf(initiatorMsg,
+            "> ISO-TP: %u of %u messages acknowledged in %u us, %u bytes/s, %u frames/s, Tx status = %u\r\n\n",
+            (unsigned int)ackCnt,
+            (unsigned int)ISOTP_MSG_COUNT,
+            (unsigned int)elapsedUsec,
+            (unsigned int)(((uint64_t)ackCnt * ISOTP_MSG_SIZE * 1000000U) / elapsedUsec),
+            (unsigned int)(((uint64_t)frameCnt * 1000000U) / elapsedUsec),
+            (unsigned int)txStatus);
+    printMsg(initiatorMsg, strlen(initiatorMsg));
+}
 
-        /* Format the message as printable hex */
-        for (i = 0U; i < dataLen; i++)
-        {
-            sprintf(formattedMsg + strlen(formattedMsg), "%02X ", rxElem.data[i]);
-        }
+#endif /* CAN_INITIATOR_ISOTP_MODE */
 
-        sprintf(formattedMsg + strlen(formattedMsg), "\r\n\n");
-    }
+#if CAN_INITIATOR_RPC_MODE
 
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+/*
+ *  ======== handleRpcFrame ========
+ *  Passes a frame received on the RPC response ID to the calls.
+ */
+static void handleRpcFrame(const CAN_RxBufElement *elem, void *arg)
+{
+    CANRpc_receive(&rpcLink, elem);
 }
 
 /*
- *  ======== verifyMsg ========
- *  Verifies the Rx'ed message is the same as the Tx'ed message except with the
- *  ID and data bits flipped.
+ *  ======== sendRpcFrame ========
+ *  RPC frame transmit function. Returns false if the driver could not accept
+ *  the frame.
  */
-static void verifyMsg(void)
+static bool sendRpcFrame(void *arg, const CAN_TxBufElement *elem)
 {
-    bool verifyErr = false;
-    uint_fast8_t dataLen;
-    uint_fast8_t i;
-    uint32_t expectedID;
-
-    /* Flip transmitted ID bits */
-    expectedID = ~txElem.id;
-    if (txElem.xtd == 0)
-    {
-        /* 11-bit standard ID */
-        expectedID &= 0x7FF;
-    }
-    else
+    /* The frame is retried once the bus is recovered */
+    if (CANRecovery_isBusOff(&canRecovery))
     {
-        /* 29-bit standard ID */
-        expectedID &= 0x1FFFFFFF;
+        return false;
     }
 
-    if (rxElem.id != expectedID)
+    if (CAN_write(canHandle, elem) != CAN_STATUS_SUCCESS)
     {
-        sprintf(formattedMsg,
-                "=> FAIL: Received ID: 0x%x does not match expected ID: 0x%x!\r\n\n",
-                (unsigned int)rxElem.id,
-                (unsigned int)expectedID);
-        verifyErr = true;
+        CANStats_txFull();
+
+        return false;
     }
-#ifndef CAN_SUPPORTS_DCAN
-    else if (rxElem.fdf != txElem.fdf)
+
+    CANStats_txFrame(elem);
+
+    return true;
+}
+
+/*
+ *  ======== completeRpcCall ========
+ *  RPC completion function. Counts the calls answered with the expected data.
+ *  The call data and the frame padding are echoed with all bits flipped,
+ *  which the echo binding flips back.
+ */
+static void completeRpcCall(void *arg, CANRpc_Status status, const uint8_t *data, size_t length)
+{
+    if ((status == CANRpc_SUCCESS) && (length >= rpcDataSize) && (memcmp(data, rpcData, rpcDataSize) == 0))
     {
-        sprintf(formattedMsg,
-                "=> FAIL: Received FDF: %u does not match transmitted FDF: %u!\r\n\n",
-                (unsigned int)rxElem.fdf,
-                (unsigned int)txElem.fdf);
-        verifyErr = true;
+        rpcMatchCnt++;
     }
-#endif /* CAN_SUPPORTS_DCAN */
-    else if (rxElem.dlc != txElem.dlc)
+}
+
+/*
+ *  ======== pollRpc ========
+ *  Dispatches all received frames, then lets the calls resend the requests
+ *  that were refused or not answered in time.
+ */
+static void pollRpc(void)
+{
+    uint32_t count = 0U;
+
+    /* The driver may be restarted */
+    while (!CANRecovery_isBusOff(&canRecovery) && (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS))
     {
-        sprintf(formattedMsg,
-                "=> FAIL: Received DLC: %u does not match transmitted DLC: %u!\r\n\n",
-                (unsigned int)rxElem.dlc,
-                (unsigned int)txElem.dlc);
-        verifyErr = true;
+        rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
+        CANDispatch_dispatch(&canDispatch, &rxElem);
     }
-    else if (rxElem.dlc < DLC_TABLE_SIZE)
+
+    CANStats_rxBurst(count);
+
+    CANRpc_process(&rpcLink, (uint32_t)CANTimestamp_getTime());
+}
+
+/*
+ *  ======== runRpcWindow ========
+ *  Makes RPC_CALL_COUNT calls with up to window calls in flight, and prints
+ *  the results as JSON.
+ */
+static void runRpcWindow(uint32_t window)
+{
+    CANRpc_Stats startStats;
+    uint32_t callCnt;
+    uint32_t elapsedUsec;
+    uint32_t startTime;
+    uint32_t now;
+
+    /* The link is not initialized again, so the correlation IDs continue and
+     * a late response to a call of an earlier window counts as unmatched.
+     */
+    CANRpc_setWindow(&rpcLink, window);
+
+    startStats  = rpcLink.stats;
+    rpcMatchCnt = 0U;
+    callCnt     = 0U;
+    startTime   = (uint32_t)CANTimestamp_getTime();
+
+    while ((callCnt < RPC_CALL_COUNT) || (CANRpc_getInFlight(&rpcLink) > 0U))
     {
-        dataLen = dlcToDataSize[rxElem.dlc];
+        /* Fill the window */
+        now = (uint32_t)CANTimestamp_getTime();
 
-        for (i = 0U; i < dataLen; i++)
+        while ((callCnt < RPC_CALL_COUNT) && CANRpc_call(&rpcLink, rpcData, rpcDataSize, completeRpcCall, NULL, now))
         {
-            if (rxElem.data[i] != (uint8_t)~txElem.data[i])
-            {
-                sprintf(formattedMsg,
-                        "=> FAIL: Received data[%u]: 0x%02x does not match expected data: 0x%02x!\r\n\n",
-                        i,
-                        rxElem.data[i],
-                        (uint8_t)~txElem.data[i]);
-                verifyErr = true;
-                break;
-            }
+            callCnt++;
         }
+
+        waitForRx();
+        pollRpc();
     }
 
-    if (!verifyErr)
+    elapsedUsec = ((uint32_t)CANTimestamp_getTime() - startTime) / SYSTIM_TICKS_PER_USEC;
+
+    if (elapsedUsec == 0U)
     {
-        sprintf(formattedMsg, "=> PASS: Received message matches expected.\r\n\n");
+        elapsedUsec = 1U;
     }
 
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    sprintf(initiatorMsg,
+            "{\"window\":%u,\"calls\":%u,\"completed\":%u,\"matched\":%u,\"timeouts\":%u,\"retries\":%u,"
+            "\"unmatched\":%u,\"elapsed_us\":%u,\"calls_per_s\":%u}\r\n",
+            (unsigned int)window,
+            (unsigned int)(rpcLink.stats.callCnt - startStats.callCnt),
+            (unsigned int)(rpcLink.stats.completedCnt - startStats.completedCnt),
+            (unsigned int)rpcMatchCnt,
+            (unsigned int)(rpcLink.stats.timeoutCnt - startStats.timeoutCnt),
+            (unsigned int)(rpcLink.stats.retryCnt - startStats.retryCnt),
+            (unsigned int)(rpcLink.stats.unmatchedCnt - startStats.unmatchedCnt),
+            (unsigned int)elapsedUsec,
+            (unsigned int)(((uint64_t)(rpcLink.stats.completedCnt - startStats.completedCnt) * 1000000U) /
+                           elapsedUsec));
+    printMsg(initiatorMsg, strlen(initiatorMsg));
 }
 
 /*
- *  ======== processRxMsg ========
+ *  ======== runRpcBenchmark ========
+ *  Runs RPC_CALL_COUNT calls for each window size from 1 to
+ *  CANRpc_PENDING_SIZE, doubling the window each time.
  */
-static void processRxMsg(void)
+static void runRpcBenchmark(bool canFD)
 {
-    /* Read all available CAN messages */
-    while (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS)
+    uint32_t i;
+    uint32_t window;
+
+    rpcEcho.id  = RPC_MSG_ID;
+    rpcEcho.xtd = false;
+    rpcEcho.fd  = canFD;
+
+    rpcDataSize = canFD ? RPC_FD_DATA_SIZE : RPC_DATA_SIZE;
+
+    for (i = 0U; i < rpcDataSize; i++)
     {
-        rxMsgCnt++;
+        rpcData[i] = (uint8_t)i;
+    }
 
-        sprintf(formattedMsg, "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n", (unsigned int)rxMsgCnt, (unsigned int)rxEventCnt);
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    sprintf(initiatorMsg,
+            "Running RPC benchmark: %u calls of %u bytes per window...\r\n",
+            (unsigned int)RPC_CALL_COUNT,
+            (unsigned int)rpcDataSize);
+    printMsg(initiatorMsg, strlen(initiatorMsg));
 
-        printRxMsg();
-        verifyMsg();
-        sem_post(&rxSem);
+    takeRxOwnership(&rpcRunning);
+
+    for (window = 1U; window <= CANRpc_PENDING_SIZE; window *= 2U)
+    {
+        runRpcWindow(window);
     }
+
+    rpcRunning = false;
+
+    /* Discard the notifications that were not waited for */
+    while (sem_trywait(&rxSem) == 0) {}
 }
 
+#endif /* CAN_INITIATOR_RPC_MODE */
+
+#if CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+
 /*
- *  ======== eventCallback ========
+ *  ======== takeRxOwnership ========
+ *  Sets running, which stops the main thread from reading CAN messages, and
+ *  waits until the main thread has acknowledged it. The main thread may be
+ *  inside processRxMsg() when running is set, so the initiator thread must
+ *  not call CAN_read() before the acknowledgement.
  */
-static void eventCallback(CAN_Handle handle, uint32_t event, uint32_t data, void *userArg)
+static void takeRxOwnership(volatile bool *running)
 {
-    curEvent     = event;
-    curEventData = data;
+    *running = true;
+    rxOwnerReqCnt++;
+
+    /* Wake the main thread. A post without a queued event is ignored. */
     sem_post(&eventSem);
+    sem_wait(&rxOwnerSem);
 }
 
 /*
- *  ======== txTestMsg ========
+ *  ======== ackRxOwnership ========
+ *  Called by the main thread outside of handleEvent(), when it is not reading
+ *  CAN messages.
  */
-static void txTestMsg(uint32_t id, uint32_t extID, uint32_t dlc, uint32_t fdFormat, uint32_t brsEnable)
+static void ackRxOwnership(void)
 {
-    uint_fast8_t i;
-    int_fast16_t status;
+    uint32_t reqCnt = rxOwnerReqCnt;
 
-    txElem.id  = id;
-    txElem.rtr = 0U;
-    txElem.xtd = extID;
-#ifndef CAN_SUPPORTS_DCAN
-    txElem.esi = 0U;
-    txElem.brs = brsEnable;
-#endif /* CAN_SUPPORTS_DCAN */
-    txElem.dlc = dlc;
-#ifndef CAN_SUPPORTS_DCAN
-    txElem.fdf = fdFormat;
-#endif /* CAN_SUPPORTS_DCAN */
-    txElem.efc = 0U;
-    txElem.mm  = 1U;
-
-    for (i = 0U; i < dlcToDataSize[txElem.dlc]; i++)
+    if (reqCnt != rxOwnerAckCnt)
     {
-        txElem.data[i] = i;
+        rxOwnerAckCnt = reqCnt;
+        sem_post(&rxOwnerSem);
     }
+}
 
-    status = CAN_write(canHandle, &txElem);
-    if (status != CAN_STATUS_SUCCESS)
+#endif /* CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+
+#if CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+
+/*
+ *  ======== waitForRx ========
+ *  Waits up to 1ms for rxSem to be posted. The driver lock is released
+ *  meanwhile, so the main thread can recover from bus off during a benchmark.
+ */
+static void waitForRx(void)
+{
+    sem_post(&canLock);
+    waitForSem(&rxSem, 1U);
+    sem_wait(&canLock);
+}
+
+#endif /* CAN_INITIATOR_BENCHMARK_MODE || CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+
+/*
+ *  ======== waitForSem ========
+ *  Returns true if sem was posted, or false if timeoutMs elapsed first.
+ */
+static bool waitForSem(sem_t *sem, uint32_t timeoutMs)
+{
+    struct timespec timeout;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec += timeoutMs / 1000U;
+    timeout.tv_nsec += (long)(timeoutMs % 1000U) * 1000000L;
+
+    if (timeout.tv_nsec >= 1000000000L)
     {
-        /* CAN_write() failed */
-        while (1) {}
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
     }
+
+    return (sem_timedwait(sem, &timeout) == 0);
 }
 
 /*
@@ -407,7 +1808,16 @@ static void buttonPressedCallback(Button_Handle buttonHandle, Button_EventMask b
  */
 void *initiatorThread(void *arg0)
 {
-    CAN_Params canParams;
+    CANRecovery_Params recoveryParams;
+#if CAN_INITIATOR_ISOTP_MODE
+    CANIsoTp_Params isoTpParams;
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+#if CAN_INITIATOR_RPC_MODE
+    CANRpc_Params rpcParams;
+#endif /* CAN_INITIATOR_RPC_MODE */
+#if !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE
+    int_fast16_t status;
+#endif /* !CAN_INITIATOR_BENCHMARK_MODE && !CAN_INITIATOR_ISOTP_MODE && !CAN_INITIATOR_RPC_MODE */
     int retc;
 
     retc = sem_init(&buttonSem, 0, 0);
@@ -424,25 +1834,82 @@ void *initiatorThread(void *arg0)
         while (1) {}
     }
 
-    /* Open CAN driver with default configuration */
+    /* Open CAN driver with default configuration and 250ns timestamp resolution */
     CAN_Params_init(&canParams);
-    canParams.eventCbk  = eventCallback;
-    canParams.eventMask = CAN_EVENT_MASK;
+    canParams.eventCbk    = eventCallback;
+    canParams.eventMask   = CAN_EVENT_MASK;
+    canParams.tsPrescaler = CANCC27XX_EXT_TIMESTAMP_PRESCALER;
+
+    /* Dispatch the received messages by ID */
+    initDispatch(&canParams);
+
+    /* Recover from bus off with exponential backoff */
+    recoveryParams.minBackoffMs = RECOVERY_MIN_BACKOFF_MS;
+    recoveryParams.maxBackoffMs = RECOVERY_MAX_BACKOFF_MS;
+    recoveryParams.stableTimeMs = RECOVERY_STABLE_TIME_MS;
+    recoveryParams.dropOldest   = false;
+    recoveryParams.writeFxn     = writeFrame;
+    recoveryParams.restartFxn   = restartDriver;
+    recoveryParams.arg          = NULL;
+
+    CANRecovery_init(&canRecovery, &recoveryParams);
 
     canHandle = CAN_open(CONFIG_CAN_0, &canParams);
     if (canHandle == NULL)
     {
         /* CAN_open() failed */
-        sprintf(formattedMsg, "\r\nError opening CAN driver!\r\n");
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        sprintf(initiatorMsg, "\r\nError opening CAN driver!\r\n");
+        printMsg(initiatorMsg, strlen(initiatorMsg));
         while (1) {}
     }
     else
     {
-        sprintf(formattedMsg, "\r\nCAN Initiator ready. Waiting for button press...\r\n\n");
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        sprintf(initiatorMsg, "\r\nCAN Initiator ready. Waiting for button press...\r\n\n");
+        printMsg(initiatorMsg, strlen(initiatorMsg));
     }
 
+    /* Convert Rx timestamps to SOF times in the system time domain */
+    CANTimestamp_init(canHandle, CANCC27XX_EXT_TIMESTAMP_PRESCALER);
+
+    /* Collect bus statistics from now on */
+    CANStats_init(canHandle, CANTimestamp_getTime());
+    CANStats_getSnapshot(&prevStats, CANTimestamp_getTime());
+
+#if CAN_INITIATOR_E2E_MODE
+    initE2E();
+    benchmarkE2E();
+#endif /* CAN_INITIATOR_E2E_MODE */
+
+#if CAN_INITIATOR_ISOTP_MODE
+
+    isoTpParams.txId       = ISOTP_TX_ID;
+    isoTpParams.rxId       = ISOTP_RX_ID;
+    isoTpParams.blockSize  = ISOTP_BLOCK_SIZE;
+    isoTpParams.stMin      = ISOTP_ST_MIN;
+    isoTpParams.sendFxn    = sendIsoTpFrame;
+    isoTpParams.receiveFxn = receiveIsoTpMsg;
+    isoTpParams.arg        = NULL;
+
+    CANIsoTp_init(&isoTpLink, &isoTpParams);
+
+#endif /* CAN_INITIATOR_ISOTP_MODE */
+
+#if CAN_INITIATOR_RPC_MODE
+
+    /* The window is set for each run */
+    rpcParams.window            = 1U;
+    rpcParams.timeoutUs         = RPC_TIMEOUT_USEC;
+    rpcParams.maxRetries        = RPC_MAX_RETRIES;
+    rpcParams.binding.encodeFxn = CANRpc_encodeEcho;
+    rpcParams.binding.decodeFxn = CANRpc_decodeEcho;
+    rpcParams.binding.arg       = &rpcEcho;
+    rpcParams.sendFxn           = sendRpcFrame;
+    rpcParams.arg               = NULL;
+
+    CANRpc_init(&rpcLink, &rpcParams);
+
+#endif /* CAN_INITIATOR_RPC_MODE */
+
 #ifdef CONFIG_BUTTON_0
     Button_Params_init(&button0Params);
 #endif
@@ -486,19 +1953,55 @@ void *initiatorThread(void *arg0)
         /* Wait until button press callback semaphore is posted */
         sem_wait(&buttonSem);
 
+        /* Keep the driver from being restarted while it is used */
+        sem_wait(&canLock);
+
+#if CAN_INITIATOR_BENCHMARK_MODE
+
+        runBenchmark(sendCANFD);
+        sem_post(&canLock);
+
+#elif CAN_INITIATOR_ISOTP_MODE
+
+        runIsoTpBenchmark();
+        sem_post(&canLock);
+
+#elif CAN_INITIATOR_RPC_MODE
+
+        runRpcBenchmark(sendCANFD);
+        sem_post(&canLock);
+
+#else
+
+        /* Discard responses that arrived after their wait timed out */
+        while (sem_trywait(&rxSem) == 0) {}
+
         if (sendCANFD)
         {
             /* Tx CAN FD message with bit rate switching */
-            txTestMsg(0x12345678, 1U, CAN_DLC_64B, 1U, 1U);
+            status = txTestMsg(TEST_FD_MSG_ID, 1U, CAN_DLC_64B, 1U, 1U);
         }
         else
         {
             /* Tx classic CAN message */
-            txTestMsg(0x5AA, 0U, CAN_DLC_8B, 0U, 0U);
+            status = txTestMsg(TEST_MSG_ID, 0U, CAN_DLC_8B, 0U, 0U);
         }
 
-        /* Wait until response is received */
-        sem_wait(&rxSem);
+        sem_post(&canLock);
+
+        if (status != CAN_STATUS_SUCCESS)
+        {
+            sprintf(initiatorMsg, "> Test message dropped: status = %d\r\n\n", (int)status);
+            printMsg(initiatorMsg, strlen(initiatorMsg));
+        }
+        else if (!waitForSem(&rxSem, TEST_RESPONSE_TIMEOUT_MS))
+        {
+            /* The response may still arrive if the bus is being recovered */
+            sprintf(initiatorMsg, "> No response\r\n\n");
+            printMsg(initiatorMsg, strlen(initiatorMsg));
+        }
+
+#endif /* CAN_INITIATOR_BENCHMARK_MODE */
     }
 }
 
@@ -508,6 +2011,9 @@ void *initiatorThread(void *arg0)
 void *mainThread(void *arg0)
 {
     int retc;
+    uint32_t event;
+    uint32_t eventData;
+    uint32_t timeoutMs;
     pthread_attr_t attrs;
     pthread_t thread0;
     struct sched_param priParam;
@@ -524,6 +2030,10 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
+#if CAN_INITIATOR_TELEMETRY_MODE
+    initTelemetry();
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
     /* Set priority and stack size attributes */
     priParam.sched_priority = 1;
 
@@ -537,28 +2047,79 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
-    /* Create CAN initiator thread */
-    retc = pthread_create(&thread0, &attrs, initiatorThread, NULL);
+    /* The event queue and semaphore must be ready before the initiator thread
+     * opens the CAN driver, as events may be posted immediately.
+     */
+    CANEventQueue_init(&eventQueue);
+
+    retc = sem_init(&eventSem, 0, 0);
     if (retc != 0)
     {
-        /* pthread_create() failed */
+        /* sem_init() failed */
         while (1) {}
     }
 
-    retc = sem_init(&eventSem, 0, 0);
+    retc = sem_init(&canLock, 0, 1);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+#if CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+    retc = sem_init(&rxOwnerSem, 0, 0);
     if (retc != 0)
     {
         /* sem_init() failed */
         while (1) {}
     }
+#endif /* CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+
+    /* Create CAN initiator thread */
+    retc = pthread_create(&thread0, &attrs, initiatorThread, NULL);
+    if (retc != 0)
+    {
+        /* pthread_create() failed */
+        while (1) {}
+    }
 
     /* Loop forever */
     while (1)
     {
-        /* Wait until event callback semaphore is posted */
-        sem_wait(&eventSem);
+        /* Check the bus off recovery often while it is pending */
+        timeoutMs = CANRecovery_isPending(&canRecovery) ? RECOVERY_POLL_INTERVAL_MS : STATS_REPORT_INTERVAL_MS;
+
+#if CAN_INITIATOR_TELEMETRY_MODE
+        /* Retry the telemetry bytes the UART could not take */
+        if (Telemetry_getPending(&telemetry) != 0U)
+        {
+            timeoutMs = TELEMETRY_FLUSH_INTERVAL_MS;
+        }
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
+
+        /* Wait until event callback semaphore is posted or a timeout check is due */
+        if (waitForSem(&eventSem, timeoutMs) && CANEventQueue_get(&eventQueue, &event, &eventData))
+        {
+            handleEvent(event, eventData);
+        }
+
+#if CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE
+        /* Hand the CAN messages over to the initiator thread */
+        ackRxOwnership();
+#endif /* CAN_INITIATOR_ISOTP_MODE || CAN_INITIATOR_RPC_MODE */
+
+        /* Recover from bus off and send the queued test messages */
+        processRecovery();
+
+        reportEventQueueOverflow();
+
+        if (!benchRunning && !isoTpRunning && !rpcRunning)
+        {
+            reportStats();
+        }
 
-        /* Process the event */
-        handleEvent();
+#if CAN_INITIATOR_TELEMETRY_MODE
+        flushTelemetry();
+#endif /* CAN_INITIATOR_TELEMETRY_MODE */
     }
 }
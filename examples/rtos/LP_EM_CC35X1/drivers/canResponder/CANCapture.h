@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCapture.h ========
+ *  Compact binary capture of CAN frames.
+ *
+ *  Each frame is encoded as a record of 12 to 76 bytes, all fields being
+ *  little endian:
+ *
+ *    Offset  Size  Field
+ *    0       1     CANCapture_SYNC
+ *    1       1     Flags, CANCapture_FLAG_*
+ *    2       1     Data Length Code (DLC)
+ *    3       4     ID, 11 or 29 bits
+ *    7       4     Time in 250ns ticks, modulo 2^32
+ *    11      n     Payload, n being the length given by the DLC, or 0 for
+ *                  remote frames
+ *    11 + n  1     Checksum, such that the sum of all record bytes is 0
+ *                  modulo 256
+ *
+ *  Records are stored back to back in a byte ring. The ring is either
+ *  drained by the application, e.g. to a UART, in which case records that
+ *  do not fit are refused, or kept as a flight recorder of the most recent
+ *  frames, in which case the oldest records are overwritten. After records
+ *  were refused or overwritten, the next record stored carries
+ *  CANCapture_FLAG_LOST. A stream of records can be resynchronized by
+ *  searching for a sync byte that starts a record with a valid checksum.
+ *
+ *  The module only depends on the C library, CANCodec and the frame types of
+ *  the driver, so CANCapture_decode() can also be built on a host to read a
+ *  capture. The ring is a single-producer/single-consumer queue and needs
+ *  no locking as long as only one context stores records and one context
+ *  reads them. A flight recorder ring is only read once capturing stopped.
+ */
+
+#ifndef CANCAPTURE_H_
+#define CANCAPTURE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of bytes the ring can hold. Must be a power of two. */
+#ifndef CANCapture_RING_SIZE
+    #define CANCapture_RING_SIZE 4096U
+#endif
+
+#if (CANCapture_RING_SIZE & (CANCapture_RING_SIZE - 1U)) != 0U
+    #error "CANCapture_RING_SIZE must be a power of two"
+#endif
+
+/* First byte of each record */
+#define CANCapture_SYNC 0xA5U
+
+/* Record size without the payload and the checksum */
+#define CANCapture_HEADER_SIZE 11U
+
+/* Size of a record with a 64-byte payload */
+#define CANCapture_MAX_RECORD_SIZE (CANCapture_HEADER_SIZE + 64U + 1U)
+
+/* CANCapture_decode() return values other than a record size */
+#define CANCapture_INCOMPLETE 0
+#define CANCapture_INVALID    (-1)
+
+/* Record flags */
+#define CANCapture_FLAG_XTD  0x01U /* 29-bit ID */
+#define CANCapture_FLAG_RTR  0x02U /* Remote frame */
+#define CANCapture_FLAG_FDF  0x04U /* CAN FD frame */
+#define CANCapture_FLAG_BRS  0x08U /* Bit rate switching */
+#define CANCapture_FLAG_ESI  0x10U /* Error state indicator */
+#define CANCapture_FLAG_TX   0x20U /* Frame written by the device, not received */
+#define CANCapture_FLAG_LOST 0x40U /* Records were lost before this one */
+
+/* Decoded record */
+typedef struct
+{
+    uint32_t time;
+    uint32_t id;
+    uint8_t flags;
+    uint8_t dlc;
+    uint8_t dataLen;
+    uint8_t data[64];
+} CANCapture_Record;
+
+/* Capture statistics */
+typedef struct
+{
+    uint32_t recordCnt;      /* Records stored */
+    uint32_t lostCnt;        /* Records refused or overwritten */
+    uint32_t highWaterMark;  /* Largest number of bytes held by the ring */
+} CANCapture_Stats;
+
+/* Capture object. The fields are private, except for stats. */
+typedef struct
+{
+    CANCapture_Stats stats;
+    bool overwrite;         /* Flight recorder: overwrite the oldest records */
+    bool lost;              /* Records were lost since the last record stored */
+    volatile uint32_t head; /* Free-running ring indices */
+    volatile uint32_t tail;
+    uint8_t ring[CANCapture_RING_SIZE];
+} CANCapture_Object;
+
+/*
+ *  ======== CANCapture_init ========
+ *  Empties the ring. If overwrite is true, the ring keeps the most recent
+ *  records and must not be drained while records are stored.
+ */
+extern void CANCapture_init(CANCapture_Object *obj, bool overwrite);
+
+/*
+ *  ======== CANCapture_rxFrame ========
+ *  Stores a received frame. Returns false if the record was refused.
+ */
+extern bool CANCapture_rxFrame(CANCapture_Object *obj, const CAN_RxBufElement *elem, uint32_t time);
+
+/*
+ *  ======== CANCapture_txFrame ========
+ *  Stores a frame written to the driver. Returns false if the record was
+ *  refused.
+ */
+extern bool CANCapture_txFrame(CANCapture_Object *obj, const CAN_TxBufElement *elem, uint32_t time);
+
+/*
+ *  ======== CANCapture_peek ========
+ *  Returns the number of contiguous bytes at the start of the ring and sets
+ *  *data to the first of them. The bytes stay in the ring until
+ *  CANCapture_consume() is called, and may end within a record.
+ */
+extern size_t CANCapture_peek(const CANCapture_Object *obj, const uint8_t **data);
+
+/*
+ *  ======== CANCapture_consume ========
+ *  Removes count bytes returned by CANCapture_peek() from the ring.
+ */
+extern void CANCapture_consume(CANCapture_Object *obj, size_t count);
+
+/*
+ *  ======== CANCapture_getCount ========
+ *  Returns the number of bytes held by the ring.
+ */
+extern size_t CANCapture_getCount(const CANCapture_Object *obj);
+
+/*
+ *  ======== CANCapture_decode ========
+ *  Decodes the record at the start of buf, which holds size bytes. Returns
+ *  the size of the record, CANCapture_INCOMPLETE if buf ends before the end
+ *  of the record, or CANCapture_INVALID if buf does not start with a valid
+ *  record, in which case a reader resynchronizes by skipping one byte.
+ */
+extern int_fast16_t CANCapture_decode(const uint8_t *buf, size_t size, CANCapture_Record *record);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANCAPTURE_H_ */
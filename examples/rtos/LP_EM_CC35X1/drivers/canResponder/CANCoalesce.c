@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCoalesce.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/ClockP.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include "CANCoalesce.h"
+#include "CANTimestamp.h"
+
+#define RING_MASK (CANCoalesce_RING_SIZE - 1U)
+
+/* Set in a bypass ID for 29-bit IDs */
+#define XTD_FLAG 0x80000000U
+
+/*
+ *  ======== isBypassId ========
+ */
+static bool isBypassId(const CANCoalesce_Object *obj, const CAN_RxBufElement *elem)
+{
+    uint32_t key = elem->id | ((elem->xtd != 0U) ? XTD_FLAG : 0U);
+    uint32_t i;
+
+    for (i = 0U; i < obj->bypassCnt; i++)
+    {
+        if (obj->bypassIds[i] == key)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ *  ======== endHold ========
+ *  Counts a wake-up and its cause, and clears the pending frames. Must be
+ *  called from the event callback or with interrupts disabled. Returns the
+ *  time the first pending frame was received.
+ */
+static uint64_t endHold(CANCoalesce_Object *obj, uint32_t *causeCnt, uint64_t now)
+{
+    uint64_t holdTime = now - obj->firstTime;
+
+    obj->pendingCnt = 0U;
+
+    obj->stats.wakeCnt++;
+    (*causeCnt)++;
+    obj->stats.holdTime += holdTime;
+
+    if (holdTime > obj->stats.maxHoldTime)
+    {
+        obj->stats.maxHoldTime = holdTime;
+    }
+
+    return obj->firstTime;
+}
+
+/*
+ *  ======== timeoutFxn ========
+ *  Wakes the application thread once the first pending frame has been held
+ *  for timeoutUs.
+ */
+static void timeoutFxn(uintptr_t arg)
+{
+    CANCoalesce_Object *obj = (CANCoalesce_Object *)arg;
+    uint64_t firstTime      = 0U;
+    bool wake               = false;
+    uintptr_t hwiKey;
+
+    /* The pending frames may have been handed over by the event callback
+     * since the clock expired.
+     */
+    hwiKey = HwiP_disable();
+
+    if (obj->pendingCnt > 0U)
+    {
+        firstTime = endHold(obj, &obj->stats.timeoutWakeCnt, CANTimestamp_getTime());
+        wake      = true;
+    }
+
+    HwiP_restore(hwiKey);
+
+    if (wake)
+    {
+        obj->params.wakeFxn(obj->params.arg, firstTime);
+    }
+}
+
+/*
+ *  ======== CANCoalesce_init ========
+ */
+void CANCoalesce_init(CANCoalesce_Object *obj, const CANCoalesce_Params *params)
+{
+    ClockP_Params clockParams;
+    uint32_t tickPeriod = ClockP_getSystemTickPeriod();
+
+    memset(obj, 0, sizeof(*obj));
+
+    obj->params = *params;
+
+    /* The clock is started part way through a tick, so one tick is added to
+     * hold the frames for at least timeoutUs.
+     */
+    ClockP_Params_init(&clockParams);
+    clockParams.period    = 0U;
+    clockParams.startFlag = false;
+    clockParams.arg       = (uintptr_t)obj;
+
+    ClockP_construct(&obj->clock, timeoutFxn, ((params->timeoutUs + tickPeriod - 1U) / tickPeriod) + 1U, &clockParams);
+}
+
+/*
+ *  ======== CANCoalesce_addBypassId ========
+ */
+bool CANCoalesce_addBypassId(CANCoalesce_Object *obj, uint32_t id, bool xtd)
+{
+    if (obj->bypassCnt == CANCoalesce_BYPASS_MAX)
+    {
+        return false;
+    }
+
+    obj->bypassIds[obj->bypassCnt] = id | (xtd ? XTD_FLAG : 0U);
+    obj->bypassCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== CANCoalesce_rxEvent ========
+ */
+void CANCoalesce_rxEvent(CANCoalesce_Object *obj, CAN_Handle handle)
+{
+    CAN_RxBufElement *elem;
+    uint32_t *causeCnt;
+    uint64_t now;
+    uint32_t count = 0U;
+    bool bypass    = false;
+    bool full;
+
+    now = CANTimestamp_getTime();
+
+    while ((obj->head - obj->tail) < CANCoalesce_RING_SIZE)
+    {
+        elem = &obj->ring[obj->head & RING_MASK];
+
+        if (CAN_read(handle, elem) != CAN_STATUS_SUCCESS)
+        {
+            break;
+        }
+
+        if (isBypassId(obj, elem))
+        {
+            bypass = true;
+        }
+
+        obj->head++;
+        count++;
+    }
+
+    obj->stats.frameCnt += count;
+
+    /* Frames that do not fit are left in the driver until the ring is read */
+    full = ((obj->head - obj->tail) == CANCoalesce_RING_SIZE);
+    if (full)
+    {
+        obj->stats.ringFullCnt++;
+    }
+
+    if (count > 0U)
+    {
+        if (obj->pendingCnt == 0U)
+        {
+            obj->firstTime = now;
+        }
+
+        obj->pendingCnt += count;
+    }
+
+    if (obj->pendingCnt == 0U)
+    {
+        return;
+    }
+
+    if (bypass)
+    {
+        causeCnt = &obj->stats.bypassWakeCnt;
+    }
+    else if (full || (obj->pendingCnt >= obj->params.frameThreshold))
+    {
+        causeCnt = &obj->stats.thresholdWakeCnt;
+    }
+    else
+    {
+        /* Start the timeout with the first pending frame */
+        if (obj->pendingCnt == count)
+        {
+            ClockP_start(&obj->clock);
+        }
+
+        return;
+    }
+
+    ClockP_stop(&obj->clock);
+
+    obj->params.wakeFxn(obj->params.arg, endHold(obj, causeCnt, now));
+}
+
+/*
+ *  ======== CANCoalesce_read ========
+ */
+bool CANCoalesce_read(CANCoalesce_Object *obj, CAN_Handle handle, CAN_RxBufElement *elem)
+{
+    int_fast16_t status;
+    uintptr_t hwiKey;
+
+    /* Frames left in the driver are older than any frame the event callback
+     * can add to the ring, so they are only read from the driver while the
+     * ring is empty and the event callback cannot run.
+     */
+    hwiKey = HwiP_disable();
+
+    if (obj->head == obj->tail)
+    {
+        status = CAN_read(handle, elem);
+
+        HwiP_restore(hwiKey);
+
+        return (status == CAN_STATUS_SUCCESS);
+    }
+
+    HwiP_restore(hwiKey);
+
+    *elem = obj->ring[obj->tail & RING_MASK];
+    obj->tail++;
+
+    return true;
+}
+
+/*
+ *  ======== CANCoalesce_getStats ========
+ */
+void CANCoalesce_getStats(const CANCoalesce_Object *obj, CANCoalesce_Stats *stats)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    *stats = obj->stats;
+
+    HwiP_restore(hwiKey);
+}
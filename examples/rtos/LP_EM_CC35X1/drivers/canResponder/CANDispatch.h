@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANDispatch.h ========
+ *  CAN message ID dispatch table.
+ *
+ *  Handlers are registered for exact 11-bit or 29-bit IDs, or for an ID and
+ *  mask covering a range of IDs. Exact IDs are kept in an open-addressing hash
+ *  table, so they are found with a single probe in the common case. Masks are
+ *  kept in a short list sorted from the most to the least specific mask, and
+ *  are only searched when no exact ID matches. Messages matching neither are
+ *  counted and dropped.
+ *
+ *  On devices with an MCAN peripheral the registered IDs and masks can also be
+ *  turned into message RAM acceptance filters, so that unwanted messages are
+ *  rejected by the hardware and never reach the CPU.
+ */
+
+#ifndef CANDISPATCH_H_
+#define CANDISPATCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of exact IDs. The hash table has twice as many slots. */
+#ifndef CANDispatch_EXACT_MAX
+    #define CANDispatch_EXACT_MAX 16U
+#endif
+
+/* Maximum number of ID and mask pairs */
+#ifndef CANDispatch_MASK_MAX
+    #define CANDispatch_MASK_MAX 4U
+#endif
+
+/* Hash table slots. Must be a power of two. */
+#define CANDispatch_HASH_SIZE (2U * CANDispatch_EXACT_MAX)
+
+#if (CANDispatch_HASH_SIZE & (CANDispatch_HASH_SIZE - 1U)) != 0U
+    #error "CANDispatch_EXACT_MAX must be a power of two"
+#endif
+
+/* Largest number of acceptance filters built for either ID type: exact IDs
+ * take one filter per pair, masks one filter each.
+ */
+#define CANDispatch_FILTER_MAX (((CANDispatch_EXACT_MAX + 1U) / 2U) + CANDispatch_MASK_MAX)
+
+/* Handles a received message. arg is the value passed at registration. */
+typedef void (*CANDispatch_HandlerFxn)(const CAN_RxBufElement *elem, void *arg);
+
+/* Registered handler */
+typedef struct
+{
+    uint32_t key;  /* ID, with bit 31 set for 29-bit IDs */
+    uint32_t mask; /* Mask applied to the ID and key, with bit 31 always set */
+    CANDispatch_HandlerFxn fxn;
+    void *arg;
+} CANDispatch_Entry;
+
+/* Dispatch table object */
+typedef struct
+{
+    CANDispatch_Entry exact[CANDispatch_HASH_SIZE]; /* Unused slots have a zero mask */
+    CANDispatch_Entry masks[CANDispatch_MASK_MAX];  /* Sorted from the most to the least specific */
+    uint32_t exactCnt;
+    uint32_t maskCnt;
+    uint32_t unmatchedCnt; /* Messages dropped because no handler matched */
+} CANDispatch_Object;
+
+/*
+ *  ======== CANDispatch_init ========
+ *  Initializes an empty dispatch table.
+ */
+extern void CANDispatch_init(CANDispatch_Object *dispatch);
+
+/*
+ *  ======== CANDispatch_registerId ========
+ *  Registers a handler for an exact ID. xtd is true for a 29-bit ID. fxn may be
+ *  NULL to accept the ID without handling it. Registering an ID again replaces
+ *  its handler. Returns false if the table is full.
+ */
+extern bool CANDispatch_registerId(CANDispatch_Object *dispatch,
+                                   uint32_t id,
+                                   bool xtd,
+                                   CANDispatch_HandlerFxn fxn,
+                                   void *arg);
+
+/*
+ *  ======== CANDispatch_registerMask ========
+ *  Registers a handler for all IDs whose bits selected by mask equal those of
+ *  id. A mask of 0 matches every ID of the given type. When several masks
+ *  match, the handler with the most mask bits set is called. Returns false if
+ *  the mask list is full.
+ */
+extern bool CANDispatch_registerMask(CANDispatch_Object *dispatch,
+                                     uint32_t id,
+                                     uint32_t mask,
+                                     bool xtd,
+                                     CANDispatch_HandlerFxn fxn,
+                                     void *arg);
+
+/*
+ *  ======== CANDispatch_dispatch ========
+ *  Calls the handler registered for the message ID. Returns false and counts
+ *  the message if no handler matches.
+ */
+extern bool CANDispatch_dispatch(CANDispatch_Object *dispatch, const CAN_RxBufElement *elem);
+
+#ifndef CAN_SUPPORTS_DCAN
+
+/* Acceptance filter lists */
+typedef struct
+{
+    MCAN_StdMsgIDFilterElement std[CANDispatch_FILTER_MAX];
+    MCAN_ExtMsgIDFilterElement ext[CANDispatch_FILTER_MAX];
+} CANDispatch_Filters;
+
+/*
+ *  ======== CANDispatch_buildFilters ========
+ *  Builds acceptance filters storing the registered IDs in Rx FIFO 0 and sets
+ *  the filter lists of config. The other message RAM fields are left to the
+ *  caller. Exact IDs are paired into dual ID filters and masks become classic
+ *  filters. The filters and config must stay valid while the driver is open.
+ */
+extern void CANDispatch_buildFilters(const CANDispatch_Object *dispatch,
+                                     CANDispatch_Filters *filters,
+                                     CAN_MsgRAMConfig *config);
+
+#endif /* CAN_SUPPORTS_DCAN */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANDISPATCH_H_ */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANSlcan.h ========
+ *  SLCAN (Lawicel) protocol for a CAN to serial line gateway.
+ *
+ *  Commands received from the host are passed to CANSlcan_input() in chunks
+ *  of any size. Each command ends with a carriage return. The supported
+ *  commands are:
+ *
+ *    Sn            Select bit rate n: 0 = 10k, 1 = 20k, 2 = 50k, 3 = 100k,
+ *                  4 = 125k, 5 = 250k, 6 = 500k, 7 = 800k, 8 = 1M
+ *    O / C         Open / close the channel
+ *    tiiildd..     Transmit a data frame with an 11-bit ID, DLC l and
+ *                  payload dd..
+ *    Tiiiiiiiildd. Transmit a data frame with a 29-bit ID
+ *    riiil         Transmit a remote frame with an 11-bit ID
+ *    Riiiiiiiil    Transmit a remote frame with a 29-bit ID
+ *    d / D         Transmit a CAN FD frame with an 11-bit / 29-bit ID
+ *    b / B         Transmit a CAN FD frame with bit rate switching
+ *    F             Read and clear the status flags
+ *    Zn            Disable (0) or enable (1) Rx timestamps
+ *    V / N         Read the version / serial number
+ *
+ *  A command is acknowledged with a carriage return, or "z" / "Z" for
+ *  transmitted frames, and refused with a bell character. While the channel
+ *  is open, each received frame is reported in the transmit command format,
+ *  followed by a 4 hex digit timestamp in milliseconds modulo 60000 if
+ *  timestamps are enabled.
+ *
+ *  The replies and received frames are stored in an output ring, which the
+ *  application writes to the serial line with CANSlcan_peek() and
+ *  CANSlcan_consume(). Frames that do not fit in the ring are dropped and
+ *  counted, and the data overrun status flag is set.
+ *
+ *  The module only depends on the C library, CANCodec and the frame types of
+ *  the driver, so it can also be built on a host and fed a captured byte
+ *  stream. Frames are transmitted and bit rates checked by functions
+ *  supplied by the application. The functions must not be called
+ *  concurrently.
+ */
+
+#ifndef CANSLCAN_H_
+#define CANSLCAN_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of bytes the output ring can hold. Must be a power of two. */
+#ifndef CANSlcan_OUTPUT_SIZE
+    #define CANSlcan_OUTPUT_SIZE 8192U
+#endif
+
+#if (CANSlcan_OUTPUT_SIZE & (CANSlcan_OUTPUT_SIZE - 1U)) != 0U
+    #error "CANSlcan_OUTPUT_SIZE must be a power of two"
+#endif
+
+/* Longest command without the carriage return: a 64-byte CAN FD frame with a 29-bit ID */
+#define CANSlcan_MAX_CMD_LENGTH (1U + 8U + 1U + 128U)
+
+/* Status flags read with the F command */
+#define CANSlcan_STATUS_RX_FULL     0x01U /* Rx FIFO or ring buffer of the driver full */
+#define CANSlcan_STATUS_TX_FULL     0x02U /* Transmit command refused */
+#define CANSlcan_STATUS_ERR_WARNING 0x04U /* Bus off */
+#define CANSlcan_STATUS_OVERRUN     0x08U /* Received frames dropped */
+#define CANSlcan_STATUS_ERR_PASSIVE 0x20U /* Error passive */
+#define CANSlcan_STATUS_BUS_ERROR   0x80U /* Uncorrected bit error */
+
+/* Transmits a frame. Returns false if the frame could not be accepted. */
+typedef bool (*CANSlcan_WriteFxn)(void *arg, const CAN_TxBufElement *elem);
+
+/* Returns true if the nominal bit rate in bit/s can be used */
+typedef bool (*CANSlcan_BitRateFxn)(void *arg, uint32_t bitRate);
+
+/* Gateway parameters */
+typedef struct
+{
+    CANSlcan_WriteFxn writeFxn;
+    CANSlcan_BitRateFxn bitRateFxn;
+    void *arg; /* Passed to writeFxn and bitRateFxn */
+} CANSlcan_Params;
+
+/* Gateway statistics */
+typedef struct
+{
+    uint32_t cmdCnt;          /* Commands received */
+    uint32_t cmdErrCnt;       /* Commands refused */
+    uint32_t txCnt;           /* Frames transmitted */
+    uint32_t txRefusedCnt;    /* Transmit commands refused by the write function */
+    uint32_t rxCnt;           /* Received frames stored in the output ring */
+    uint32_t rxDroppedCnt;    /* Received frames dropped because the output ring was full */
+    uint32_t replyDroppedCnt; /* Replies dropped because the output ring was full */
+    uint32_t highWaterMark;   /* Largest number of bytes held by the output ring */
+} CANSlcan_Stats;
+
+/* Gateway object. The fields are private, except for stats. */
+typedef struct
+{
+    CANSlcan_Params params;
+    CANSlcan_Stats stats;
+    bool open;
+    bool timestamps;
+    bool discard;     /* Discard the rest of a command that was too long */
+    uint8_t status;   /* CANSlcan_STATUS_* flags since the last F command */
+    uint32_t cmdLength;
+    char cmd[CANSlcan_MAX_CMD_LENGTH];
+    uint32_t head;    /* Free-running output ring indices */
+    uint32_t tail;
+    char output[CANSlcan_OUTPUT_SIZE];
+} CANSlcan_Object;
+
+/*
+ *  ======== CANSlcan_init ========
+ *  Initializes the gateway with the channel closed and timestamps disabled.
+ */
+extern void CANSlcan_init(CANSlcan_Object *obj, const CANSlcan_Params *params);
+
+/*
+ *  ======== CANSlcan_input ========
+ *  Handles size bytes received from the host.
+ */
+extern void CANSlcan_input(CANSlcan_Object *obj, const uint8_t *data, size_t size);
+
+/*
+ *  ======== CANSlcan_rxFrame ========
+ *  Reports a received frame to the host. timeMs is the receive time in
+ *  milliseconds. Returns false if the channel is closed or the frame was
+ *  dropped.
+ */
+extern bool CANSlcan_rxFrame(CANSlcan_Object *obj, const CAN_RxBufElement *elem, uint32_t timeMs);
+
+/*
+ *  ======== CANSlcan_setStatus ========
+ *  Sets CANSlcan_STATUS_* flags, which are reported and cleared by the next
+ *  F command whose reply fits in the output ring.
+ */
+extern void CANSlcan_setStatus(CANSlcan_Object *obj, uint32_t flags);
+
+/*
+ *  ======== CANSlcan_isOpen ========
+ */
+extern bool CANSlcan_isOpen(const CANSlcan_Object *obj);
+
+/*
+ *  ======== CANSlcan_peek ========
+ *  Returns the number of contiguous bytes at the start of the output ring and
+ *  sets *data to the first of them. The bytes stay in the ring until
+ *  CANSlcan_consume() is called.
+ */
+extern size_t CANSlcan_peek(const CANSlcan_Object *obj, const char **data);
+
+/*
+ *  ======== CANSlcan_consume ========
+ *  Removes count bytes returned by CANSlcan_peek() from the output ring.
+ */
+extern void CANSlcan_consume(CANSlcan_Object *obj, size_t count);
+
+/*
+ *  ======== CANSlcan_getCount ========
+ *  Returns the number of bytes held by the output ring.
+ */
+extern size_t CANSlcan_getCount(const CANSlcan_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANSLCAN_H_ */
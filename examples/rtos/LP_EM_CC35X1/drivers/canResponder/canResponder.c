@@ -33,9 +33,11 @@
 /*
  *  ======== canResponder.c ========
  */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 /* POSIX Header files */
 #include <pthread.h>
@@ -46,24 +48,169 @@
 #include <ti/drivers/CAN.h>
 #include <ti/drivers/GPIO.h>
 #include <ti/drivers/UART2.h>
+#include <ti/drivers/dpl/HwiP.h>
 
 /* Driver configuration */
 #include "ti_drivers_config.h"
 
+#include "CANCapture.h"
+#include "CANCoalesce.h"
+#include "CANCodec.h"
+#include "CANDispatch.h"
+#include "CANEventQueue.h"
+#include "CANIsoTp.h"
+#include "CANRecovery.h"
+#include "CANSlcan.h"
+#include "CANStats.h"
+#include "CANTimestamp.h"
+
 #define THREAD_STACK_SIZE 1024
 
 /* Defines */
 #define MAX_MSG_LENGTH 512
-#define DLC_TABLE_SIZE 16
+
+/* External timestamp counter rate is the Host System Clock (96 MHz) divided by
+ * the timestamp prescaler. A timestamp prescaler of 24 was chosen to match the
+ * system timer resolution of 250ns.
+ */
+#define CANCC27XX_EXT_TIMESTAMP_PRESCALER 24U
+
+/* Message RAM element counts used with the acceptance filters built from the
+ * dispatch table on devices with an MCAN peripheral.
+ */
+#define MSG_RAM_RX_FIFO_NUM       8U
+#define MSG_RAM_TX_FIFO_Q_NUM     6U
+#define MSG_RAM_TX_EVENT_FIFO_NUM 0U
+
+/* Set to 1 to build the responder in performance mode. In performance mode
+ * received messages are not printed. Each response is built directly from the
+ * Rx element into a Tx ring sized for bursts, the responses are written to the
+ * driver in batches, and only aggregate counters are printed periodically.
+ */
+#ifndef CAN_RESPONDER_PERF_MODE
+    #define CAN_RESPONDER_PERF_MODE 0
+#endif
+
+/* Number of responses the performance mode Tx ring can hold. Must be a power of two. */
+#define TX_RING_SIZE 32U
+
+/* Number of queued responses written to the driver at once while a burst is read */
+#define TX_BATCH_SIZE 4U
+
+/* Interval between performance reports in milliseconds */
+#define PERF_REPORT_INTERVAL_MS 1000U
+
+/* 250ns system timer ticks per millisecond */
+#define SYSTIM_TICKS_PER_MSEC 4000U
+
+/* Interval between bus statistics reports in milliseconds */
+#define STATS_REPORT_INTERVAL_MS 10000U
+
+/* Bus off recovery configuration. Responses queued while the bus is off are
+ * sent once it is recovered, the oldest being dropped if the queue is full.
+ */
+#define RECOVERY_MIN_BACKOFF_MS   100U   /* Backoff time after the first bus off */
+#define RECOVERY_MAX_BACKOFF_MS   5000U  /* Backoff time limit for repeated bus offs */
+#define RECOVERY_STABLE_TIME_MS   10000U /* Bus on time after which the backoff time is reset */
+#define RECOVERY_POLL_INTERVAL_MS 10U    /* Maximum time between recovery checks */
+
+/* Set to 1 to build the responder as the ISO-TP receiver for the canInitiator
+ * example built with CAN_INITIATOR_ISOTP_MODE. Each message is reassembled,
+ * its pattern verified and an acknowledgement sent back. Other messages are
+ * ignored.
+ */
+#ifndef CAN_RESPONDER_ISOTP_MODE
+    #define CAN_RESPONDER_ISOTP_MODE 0
+#endif
+
+#if CAN_RESPONDER_PERF_MODE && CAN_RESPONDER_ISOTP_MODE
+    #error "CAN_RESPONDER_PERF_MODE and CAN_RESPONDER_ISOTP_MODE cannot both be enabled"
+#endif
+
+/* Frame capture modes. In CAPTURE_MODE_RAM, the received messages and the
+ * responses are kept in canCapture, the oldest records being overwritten, to
+ * be read with a debugger. In CAPTURE_MODE_UART, the records are streamed over
+ * the UART at CAPTURE_UART_BAUD_RATE instead of printing the received
+ * messages, and records that do not fit in canCapture are counted as lost.
+ */
+#define CAPTURE_MODE_OFF  0
+#define CAPTURE_MODE_RAM  1
+#define CAPTURE_MODE_UART 2
+
+#ifndef CAN_RESPONDER_CAPTURE_MODE
+    #define CAN_RESPONDER_CAPTURE_MODE CAPTURE_MODE_OFF
+#endif
+
+#if (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF) && (CAN_RESPONDER_PERF_MODE || CAN_RESPONDER_ISOTP_MODE)
+    #error "CAN_RESPONDER_CAPTURE_MODE cannot be used with CAN_RESPONDER_PERF_MODE or CAN_RESPONDER_ISOTP_MODE"
+#endif
+
+#define CAPTURE_UART_BAUD_RATE   921600U
+#define CAPTURE_POLL_INTERVAL_MS 10U /* Maximum time between UART writes while records are left */
+
+/* Set to 1 to build the responder as an SLCAN (Lawicel) gateway between the
+ * CAN bus and the UART, so the LaunchPad can be used as a CAN adapter by host
+ * tools. Received messages are reported to the host instead of being
+ * answered, frames are transmitted on request of the host and nothing else is
+ * written to the UART.
+ */
+#ifndef CAN_RESPONDER_SLCAN_MODE
+    #define CAN_RESPONDER_SLCAN_MODE 0
+#endif
+
+#if CAN_RESPONDER_SLCAN_MODE && \
+    (CAN_RESPONDER_PERF_MODE || CAN_RESPONDER_ISOTP_MODE || (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF))
+    #error "CAN_RESPONDER_SLCAN_MODE cannot be used with the other responder modes"
+#endif
+
+/* SLCAN gateway configuration. A 500 kbit/s bus fully loaded with 8-byte
+ * frames carries about 4500 frames/s, each reported as a line of up to 26
+ * characters with an 11-bit ID and the timestamp. This is 1.2 Mbaud on the
+ * UART, so the UART runs at 2 Mbaud. The UART is polled for commands at least
+ * every SLCAN_POLL_INTERVAL_MS, which the 512-byte UART Rx ring buffer set in
+ * SysConfig covers.
+ */
+#define SLCAN_UART_BAUD_RATE   2000000U
+#define SLCAN_POLL_INTERVAL_MS 1U
+#define SLCAN_READ_SIZE        64U /* Bytes read from the UART at once */
+
+/* Set to 1 to coalesce the Rx events. The event callback then moves the
+ * received messages to canCoalesce and only wakes the responder thread once
+ * COALESCE_FRAME_THRESHOLD messages are pending, COALESCE_TIMEOUT_USEC has
+ * elapsed since the first of them was received, or a message with
+ * COALESCE_BYPASS_ID is received. Fewer wake-ups lower the CPU load at high
+ * frame rates, at the cost of a longer response time at low frame rates.
+ * Coalescing can be combined with the other responder modes.
+ */
+#ifndef CAN_RESPONDER_COALESCE_MODE
+    #define CAN_RESPONDER_COALESCE_MODE 0
+#endif
+
+#define COALESCE_FRAME_THRESHOLD 8U
+#define COALESCE_TIMEOUT_USEC    1000U
+#define COALESCE_BYPASS_ID       0x2U /* Time sync messages of the canTimeSync example */
+
+/* The SOF times of the messages are resolved relative to the time the first
+ * pending message was received, which only works for messages received
+ * within half a 16.384ms timestamp counter period of it.
+ */
+#if COALESCE_TIMEOUT_USEC > 4000U
+    #error "COALESCE_TIMEOUT_USEC must not exceed 4000"
+#endif
+
+/* ISO-TP configuration */
+#define ISOTP_TX_ID             0x7E8 /* Responder to initiator */
+#define ISOTP_RX_ID             0x7E0 /* Initiator to responder */
+#define ISOTP_BLOCK_SIZE        16U   /* Consecutive frames between flow control frames, 0 for no limit */
+#define ISOTP_ST_MIN            0U    /* Minimum time between consecutive frames, ISO 15765-2 encoding */
+#define ISOTP_ACK_SIZE          4U    /* Sequence number, status and 16-bit length */
+#define ISOTP_POLL_INTERVAL_MS  10U   /* Maximum time between ISO-TP timeout checks */
 
 #define CAN_EVENT_MASK                                                                                               \
     (CAN_EVENT_RX_DATA_AVAIL | CAN_EVENT_TX_FINISHED | CAN_EVENT_BUS_ON | CAN_EVENT_BUS_OFF | CAN_EVENT_ERR_ACTIVE | \
      CAN_EVENT_ERR_PASSIVE | CAN_EVENT_RX_FIFO_MSG_LOST | CAN_EVENT_RX_RING_BUFFER_FULL |                            \
      CAN_EVENT_BIT_ERR_UNCORRECTED | CAN_EVENT_SPI_XFER_ERROR)
 
-/* Payload bytes indexed by Data Length Code (DLC) field. */
-static const uint32_t dlcToDataSize[DLC_TABLE_SIZE] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
-
 /* The following globals are not designated as 'static' to allow CCS IDE access */
 
 /* CAN handle */
@@ -82,29 +229,184 @@ CAN_TxBufElement txElem;
 /* Received msg count */
 uint32_t rxMsgCnt = 0U;
 
+/* Start Of Frame time of the last received message in system time (250ns ticks) */
+uint64_t rxSofTime;
+
+/* Handlers for the received message IDs */
+CANDispatch_Object canDispatch;
+
+#ifndef CAN_SUPPORTS_DCAN
+
+/* Message RAM configuration with the acceptance filters built from canDispatch */
+CANDispatch_Filters canFilters;
+CAN_MsgRAMConfig msgRAMConfig;
+
+#endif /* CAN_SUPPORTS_DCAN */
+
 /* Event callback count */
 volatile uint32_t rxEventCnt = 0U;
 
-/* Current event */
-volatile uint32_t curEvent;
+/* Queue of CAN events posted by the event callback */
+CANEventQueue_Object eventQueue;
 
-/* Current event data */
-volatile uint32_t curEventData;
+/* Event queue overflow count last reported */
+uint32_t eventQueueOverflowCnt = 0U;
 
 /* CAN event semaphore */
 sem_t eventSem;
 
+/* CAN driver parameters, kept to reopen the driver after bus off */
+CAN_Params canParams;
+
+/* Bus off recovery and Tx queue */
+CANRecovery_Object canRecovery;
+
+/* Bus statistics at the last and the current report */
+CANStats_Snapshot prevStats;
+CANStats_Snapshot curStats;
+
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF
+
+/* Captured received messages and responses */
+CANCapture_Object canCapture;
+
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF */
+
+#if CAN_RESPONDER_PERF_MODE
+
+/* Performance mode counters */
+typedef struct
+{
+    uint32_t rxCnt;         /* Messages received */
+    uint32_t txCnt;         /* Responses written to the driver */
+    uint32_t txRingFullCnt; /* Responses dropped because the Tx ring was full */
+    uint32_t rxFifoLostCnt; /* Rx FIFO message lost events */
+    uint32_t rxRingFullCnt; /* Rx ring buffer full count reported by the driver */
+} PerfStats;
+
+PerfStats perfStats;
+
+/* Responses waiting to be written to the driver. The ring is only accessed by
+ * the responder thread. The indices are free-running.
+ */
+CAN_TxBufElement txRing[TX_RING_SIZE];
+uint32_t txRingHead = 0U;
+uint32_t txRingTail = 0U;
+
+/* Time and Rx count of the last performance report */
+uint64_t lastReportTime;
+uint32_t lastReportRxCnt = 0U;
+
+#endif /* CAN_RESPONDER_PERF_MODE */
+
+#if CAN_RESPONDER_ISOTP_MODE
+
+/* ISO-TP link to the initiator */
+CANIsoTp_Object isoTpLink;
+
+/* Acknowledgement of the last message received */
+uint8_t isoTpAck[ISOTP_ACK_SIZE];
+
+#endif /* CAN_RESPONDER_ISOTP_MODE */
+
+#if CAN_RESPONDER_COALESCE_MODE
+
+/* Rx messages held until the responder thread is woken */
+CANCoalesce_Object canCoalesce;
+
+/* Coalescing statistics at the current report */
+CANCoalesce_Stats coalesceStats;
+
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+
+#if CAN_RESPONDER_SLCAN_MODE
+
+/* SLCAN protocol state and output ring */
+CANSlcan_Object slcan;
+
+/* Commands read from the UART */
+uint8_t slcanReadBuf[SLCAN_READ_SIZE];
+
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+
 /* Forward declarations */
-static void processRxMsg(void);
+static bool readRxMsg(CAN_RxBufElement *elem);
+#if CAN_RESPONDER_COALESCE_MODE
+static void wakeResponder(void *arg, uint64_t firstTime);
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+static void processRxMsg(uint32_t eventTime);
+#if !CAN_RESPONDER_ISOTP_MODE
 static void sendResponse(void);
+#endif /* !CAN_RESPONDER_ISOTP_MODE */
+#if (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART) && !CAN_RESPONDER_ISOTP_MODE
 static void printRxMsg(void);
-static void handleEvent(void);
+#endif /* (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART) && !CAN_RESPONDER_ISOTP_MODE */
+static void handleEvent(uint32_t curEvent, uint32_t curEventData);
+#if !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_SLCAN_MODE
+static void reportEventQueueOverflow(void);
+#endif /* !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_SLCAN_MODE */
+#if !CAN_RESPONDER_ISOTP_MODE
+static void buildResponse(const CAN_RxBufElement *rx, CAN_TxBufElement *tx);
+static void handleEchoMsg(const CAN_RxBufElement *elem, void *arg);
+#endif /* !CAN_RESPONDER_ISOTP_MODE */
+static void initDispatch(CAN_Params *canParams);
+#if CAN_RESPONDER_PERF_MODE
+static bool handlePerfEvent(uint32_t curEvent, uint32_t curEventData);
+static void processRxBurst(void);
+static void flushTxRing(void);
+static void reportPerfStats(void);
+#endif /* CAN_RESPONDER_PERF_MODE */
+#if CAN_RESPONDER_ISOTP_MODE
+static bool handleIsoTpEvent(uint32_t curEvent);
+static void handleIsoTpFrame(const CAN_RxBufElement *elem, void *arg);
+static bool sendIsoTpFrame(void *arg, uint32_t id, const uint8_t *data);
+static void receiveIsoTpMsg(void *arg, const uint8_t *data, uint32_t length);
+#endif /* CAN_RESPONDER_ISOTP_MODE */
+#if CAN_RESPONDER_SLCAN_MODE
+static void handleSlcanEvent(uint32_t curEvent, uint32_t curEventData);
+static void processSlcanRx(uint32_t eventTime);
+static bool writeSlcanFrame(void *arg, const CAN_TxBufElement *elem);
+static bool checkSlcanBitRate(void *arg, uint32_t bitRate);
+static void readSlcanCommands(void);
+static void writeSlcanOutput(void);
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem);
+static bool restartDriver(void *arg);
+#if !CAN_RESPONDER_SLCAN_MODE
+static void reportStats(void);
+#endif /* !CAN_RESPONDER_SLCAN_MODE */
+static bool waitForEvent(uint32_t timeoutMs);
+#if CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART
+static void writeCapture(void);
+#endif /* CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART */
 
 /*
  *  ======== handleEvent ========
  */
-static void handleEvent(void)
+static void handleEvent(uint32_t curEvent, uint32_t curEventData)
 {
+    CANCodec_Cursor cursor;
+
+#if CAN_RESPONDER_PERF_MODE
+    if (handlePerfEvent(curEvent, curEventData))
+    {
+        return;
+    }
+#endif /* CAN_RESPONDER_PERF_MODE */
+
+#if CAN_RESPONDER_ISOTP_MODE
+    if (handleIsoTpEvent(curEvent))
+    {
+        return;
+    }
+#endif /* CAN_RESPONDER_ISOTP_MODE */
+
+#if CAN_RESPONDER_SLCAN_MODE
+    /* Nothing but the SLCAN protocol is written to the UART */
+    handleSlcanEvent(curEvent, curEventData);
+    return;
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+
     if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
     {
 
@@ -114,13 +416,15 @@ static void handleEvent(void)
 #endif /* CONFIG_GPIO_LED_1 */
 
         rxEventCnt++;
-        processRxMsg();
+        processRxMsg(curEventData);
     }
     else
     {
+        CANCodec_init(&cursor, formattedMsg, sizeof(formattedMsg));
+
         if (curEvent == CAN_EVENT_TX_FINISHED)
         {
-            sprintf(formattedMsg, "> Response sent.\r\n\n");
+            CANCodec_putStr(&cursor, "> Response sent.\r\n\n");
 
 #ifdef CONFIG_GPIO_LED_1
 
@@ -132,171 +436,848 @@ static void handleEvent(void)
 
 #endif /* CONFIG_GPIO_LED_1 */
         }
-        else if (curEvent == CAN_EVENT_BUS_ON)
-        {
-            sprintf(formattedMsg, "> Bus On\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_BUS_OFF)
-        {
-            sprintf(formattedMsg, "> Bus Off\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_ACTIVE)
-        {
-            sprintf(formattedMsg, "> Error Active\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_PASSIVE)
-        {
-            sprintf(formattedMsg, "> Error Passive\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_RX_FIFO_MSG_LOST)
-        {
-            sprintf(formattedMsg, "> Rx FIFO %u message lost\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL)
-        {
-            sprintf(formattedMsg, "> Rx ring buffer full: Cnt = %u\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_BIT_ERR_UNCORRECTED)
-        {
-            sprintf(formattedMsg, "> Uncorrected bit error\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_SPI_XFER_ERROR)
-        {
-            sprintf(formattedMsg, "> SPI transfer error: status = 0x%x\r\n\n", (unsigned int)curEventData);
-        }
         else
         {
-            sprintf(formattedMsg, "> Undefined event\r\n\n");
+            CANCodec_putEvent(&cursor, curEvent, curEventData);
         }
 
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        UART2_write(uart2Handle, formattedMsg, CANCodec_finish(&cursor), NULL);
     }
 }
 
+#if (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART) && !CAN_RESPONDER_ISOTP_MODE
+
 /*
  *  ======== printRxMsg ========
  */
 static void printRxMsg(void)
 {
-    uint_fast8_t dataLen;
-    uint_fast8_t i;
+    CANCodec_Cursor cursor;
+    size_t length;
 
-    sprintf(formattedMsg, "Msg ID: 0x%x\r\n", (unsigned int)rxElem.id);
+    CANCodec_init(&cursor, formattedMsg, sizeof(formattedMsg));
+    CANCodec_putRxElem(&cursor, &rxElem, rxSofTime);
+    length = CANCodec_finish(&cursor);
 
-    sprintf(formattedMsg + strlen(formattedMsg), "TS: 0x%04x\r\n", rxElem.rxts);
+    UART2_write(uart2Handle, formattedMsg, length, NULL);
+}
 
-#ifndef CAN_SUPPORTS_DCAN
+#endif /* (CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART) && !CAN_RESPONDER_ISOTP_MODE */
 
-    sprintf(formattedMsg + strlen(formattedMsg), "CAN FD: %u\r\n", rxElem.fdf);
+#if !CAN_RESPONDER_ISOTP_MODE
 
+/*
+ *  ======== buildResponse ========
+ *  Builds the response to a received message: the received ID and data with
+ *  all bits flipped.
+ */
+static void buildResponse(const CAN_RxBufElement *rx, CAN_TxBufElement *tx)
+{
+    /* Flip received ID bits */
+    tx->id = ~rx->id;
+    if (rx->xtd == 0)
+    {
+        /* 11-bit standard ID */
+        tx->id &= 0x7FF;
+    }
+    else
+    {
+        /* 29-bit standard ID */
+        tx->id &= 0x1FFFFFFF;
+    }
+
+    tx->rtr = rx->rtr;
+    tx->xtd = rx->xtd;
+#ifndef CAN_SUPPORTS_DCAN
+    tx->esi = rx->esi;
+    tx->brs = rx->brs;
 #endif /* CAN_SUPPORTS_DCAN */
+    tx->dlc = rx->dlc;
+#ifndef CAN_SUPPORTS_DCAN
+    tx->fdf = rx->fdf;
+#endif /* CAN_SUPPORTS_DCAN */
+    tx->efc = 0U;
+    tx->mm  = 2U;
+
+    /* Flip received data bits */
+    CANCodec_copyInverted(tx->data, rx->data, CANCodec_dlcToLength(rx->dlc));
+}
+
+/*
+ *  ======== sendResponse ========
+ */
+static void sendResponse(void)
+{
+    int_fast16_t status;
+
+    buildResponse(&rxElem, &txElem);
+
+    /* The response is queued if the bus is off */
+    status = CANRecovery_write(&canRecovery, &txElem);
+    if (status != CAN_STATUS_SUCCESS)
+    {
+        sprintf(formattedMsg, "> Response dropped: status = %d\r\n\n", (int)status);
+        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    }
+}
+
+#endif /* !CAN_RESPONDER_ISOTP_MODE */
+
+/*
+ *  ======== writeFrame ========
+ *  Bus off recovery write function.
+ */
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem)
+{
+    int_fast16_t status;
+
+    status = CAN_write(canHandle, elem);
+    if (status == CAN_STATUS_SUCCESS)
+    {
+        CANStats_txFrame(elem);
+
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF
+        /* Responses are captured with the time they are written */
+        CANCapture_txFrame(&canCapture, elem, (uint32_t)CANTimestamp_getTime());
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF */
+    }
+    else
+    {
+        CANStats_txFull();
+    }
+
+    return status;
+}
+
+/*
+ *  ======== restartDriver ========
+ *  Bus off recovery restart function. Reopening the driver resets the
+ *  controller, which then rejoins the bus.
+ */
+static bool restartDriver(void *arg)
+{
+    if (canHandle != NULL)
+    {
+        CAN_close(canHandle);
+    }
+
+    canHandle = CAN_open(CONFIG_CAN_0, &canParams);
+
+    return (canHandle != NULL);
+}
+
+/*
+ *  ======== readRxMsg ========
+ *  Reads the oldest received message. Returns false if no message is
+ *  available.
+ */
+static bool readRxMsg(CAN_RxBufElement *elem)
+{
+#if CAN_RESPONDER_COALESCE_MODE
+    return CANCoalesce_read(&canCoalesce, canHandle, elem);
+#else
+    return (CAN_read(canHandle, elem) == CAN_STATUS_SUCCESS);
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+}
+
+#if CAN_RESPONDER_COALESCE_MODE
+
+/*
+ *  ======== wakeResponder ========
+ *  Queues an Rx event carrying the time the first pending message was
+ *  received. Called from the event callback or from the coalescing clock
+ *  function, so interrupts are disabled while the event is queued to keep a
+ *  single producer.
+ */
+static void wakeResponder(void *arg, uint64_t firstTime)
+{
+    uintptr_t hwiKey;
+    bool queued;
 
-    sprintf(formattedMsg + strlen(formattedMsg), "DLC: %u\r\n", rxElem.dlc);
+    hwiKey = HwiP_disable();
+    queued = CANEventQueue_put(&eventQueue, CAN_EVENT_RX_DATA_AVAIL, (uint32_t)firstTime);
+    HwiP_restore(hwiKey);
+
+    if (queued)
+    {
+        sem_post(&eventSem);
+    }
+}
+
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+
+/*
+ *  ======== processRxMsg ========
+ *  eventTime is the system time at which the event callback reported the
+ *  messages, or at which the first of them was received with coalescing.
+ */
+static void processRxMsg(uint32_t eventTime)
+{
+    CANTimestamp_Ref ref;
+    uint32_t count = 0U;
+
+    /* Read all available CAN messages */
+    while (readRxMsg(&rxElem))
+    {
+        CANTimestamp_capture(&ref);
+        rxSofTime = CANTimestamp_toRxSofTime(&ref, rxElem.rxts, eventTime);
+
+        rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
+
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF
+        CANCapture_rxFrame(&canCapture, &rxElem, (uint32_t)rxSofTime);
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF */
+
+        /* Messages with an unregistered ID are dropped */
+        CANDispatch_dispatch(&canDispatch, &rxElem);
+    }
+
+    CANStats_rxBurst(count);
+}
+
+#if !CAN_RESPONDER_ISOTP_MODE
+
+/*
+ *  ======== handleEchoMsg ========
+ *  Prints a received message, unless it is streamed by the capture, and sends
+ *  the response. The message is the global rxElem.
+ */
+static void handleEchoMsg(const CAN_RxBufElement *elem, void *arg)
+{
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART
+    sprintf(formattedMsg, "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n", (unsigned int)rxMsgCnt, (unsigned int)rxEventCnt);
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+
+    printRxMsg();
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_UART */
+
+    sendResponse();
+}
+
+#endif /* !CAN_RESPONDER_ISOTP_MODE */
+
+/*
+ *  ======== initDispatch ========
+ *  Registers the handlers for the received message IDs. On devices with an
+ *  MCAN peripheral the acceptance filters are built from the registered IDs,
+ *  so other messages are rejected by the hardware.
+ */
+static void initDispatch(CAN_Params *canParams)
+{
+    CANDispatch_init(&canDispatch);
+
+#if CAN_RESPONDER_ISOTP_MODE
+    /* Only the ISO-TP link ID is handled. Other messages are ignored. */
+    CANDispatch_registerId(&canDispatch, ISOTP_RX_ID, false, handleIsoTpFrame, NULL);
+#else
+    /* Respond to all 11-bit and 29-bit IDs without a more specific handler */
+    CANDispatch_registerMask(&canDispatch, 0U, 0U, false, handleEchoMsg, NULL);
+    CANDispatch_registerMask(&canDispatch, 0U, 0U, true, handleEchoMsg, NULL);
+#endif /* CAN_RESPONDER_ISOTP_MODE */
 
 #ifndef CAN_SUPPORTS_DCAN
 
-    sprintf(formattedMsg + strlen(formattedMsg), "BRS: %u\r\n", rxElem.brs);
+    CANDispatch_buildFilters(&canDispatch, &canFilters, &msgRAMConfig);
+
+    msgRAMConfig.rxFIFONum[0]   = MSG_RAM_RX_FIFO_NUM;
+    msgRAMConfig.rxFIFONum[1]   = 0U;
+    msgRAMConfig.rxBufNum       = 0U;
+    msgRAMConfig.txBufNum       = 0U;
+    msgRAMConfig.txFIFOQNum     = MSG_RAM_TX_FIFO_Q_NUM;
+    msgRAMConfig.txFIFOQMode    = 0U;
+    msgRAMConfig.txEventFIFONum = MSG_RAM_TX_EVENT_FIFO_NUM;
+
+    canParams->msgRAMConfig = &msgRAMConfig;
 
 #endif /* CAN_SUPPORTS_DCAN */
+}
+
+#if !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_SLCAN_MODE
+
+/*
+ *  ======== reportEventQueueOverflow ========
+ *  Reports events dropped by the event callback because the event queue was
+ *  full. CANEventQueue_SIZE should be increased if this is ever printed.
+ */
+static void reportEventQueueOverflow(void)
+{
+    uint32_t overflowCnt = eventQueue.overflowCnt;
+
+    if (overflowCnt != eventQueueOverflowCnt)
+    {
+        eventQueueOverflowCnt = overflowCnt;
+
+        sprintf(formattedMsg,
+                "> Event queue overflow: Cnt = %u, last lost event = 0x%x\r\n\n",
+                (unsigned int)overflowCnt,
+                (unsigned int)eventQueue.lastLostEvent);
+        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    }
+}
+
+#endif /* !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_SLCAN_MODE */
+
+/*
+ *  ======== eventCallback ========
+ */
+static void eventCallback(CAN_Handle handle, uint32_t event, uint32_t data, void *userArg)
+{
+    CANStats_event(event, CANTimestamp_getTime());
+    CANRecovery_event(&canRecovery, event, CANTimestamp_getTime());
+
+    /* Rx events carry the system time they were reported at */
+    if (event == CAN_EVENT_RX_DATA_AVAIL)
+    {
+#if CAN_RESPONDER_COALESCE_MODE
+        /* The responder thread is woken by wakeResponder() */
+        CANCoalesce_rxEvent(&canCoalesce, handle);
+        return;
+#else
+        data = (uint32_t)CANTimestamp_getTime();
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+    }
+
+    /* Queue the event so back-to-back events are not overwritten before they
+     * are handled. The semaphore is only posted for queued events so its count
+     * always matches the number of queue entries.
+     */
+    if (CANEventQueue_put(&eventQueue, event, data))
+    {
+        sem_post(&eventSem);
+    }
+}
+
+#if CAN_RESPONDER_PERF_MODE
+
+/*
+ *  ======== handlePerfEvent ========
+ *  Handles the events on the echo path without printing. Returns false for
+ *  events that are handled by handleEvent().
+ */
+static bool handlePerfEvent(uint32_t curEvent, uint32_t curEventData)
+{
+    if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
+    {
+        rxEventCnt++;
+        processRxBurst();
+    }
+    else if (curEvent == CAN_EVENT_TX_FINISHED)
+    {
+        /* Driver Tx buffers were freed, write the remaining responses */
+        flushTxRing();
+    }
+    else if (curEvent == CAN_EVENT_RX_FIFO_MSG_LOST)
+    {
+        perfStats.rxFifoLostCnt++;
+    }
+    else if (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL)
+    {
+        perfStats.rxRingFullCnt = curEventData;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
 
-    sprintf(formattedMsg + strlen(formattedMsg), "ESI: %u\r\n", rxElem.esi);
+/*
+ *  ======== processRxBurst ========
+ *  Reads all available messages and queues a response for each one.
+ */
+static void processRxBurst(void)
+{
+    uint32_t count = 0U;
 
-    if (rxElem.dlc < DLC_TABLE_SIZE)
+    while (readRxMsg(&rxElem))
     {
-        dataLen = dlcToDataSize[rxElem.dlc];
+        perfStats.rxCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
 
-        sprintf(formattedMsg + strlen(formattedMsg), "Data[%lu]: ", (unsigned long)dataLen);
+        if ((txRingHead - txRingTail) == TX_RING_SIZE)
+        {
+            perfStats.txRingFullCnt++;
+            continue;
+        }
+
+        buildResponse(&rxElem, &txRing[txRingHead & (TX_RING_SIZE - 1U)]);
+        txRingHead++;
 
-        /* Format the message as printable hex */
-        for (i = 0U; i < dataLen; i++)
+        /* Keep the bus busy while the rest of the burst is read */
+        if ((txRingHead - txRingTail) >= TX_BATCH_SIZE)
         {
-            sprintf(formattedMsg + strlen(formattedMsg), "%02X ", rxElem.data[i]);
+            flushTxRing();
         }
+    }
+
+    CANStats_rxBurst(count);
+
+    flushTxRing();
+}
+
+/*
+ *  ======== flushTxRing ========
+ *  Writes queued responses until the driver Tx buffers are full. The rest are
+ *  written when the driver reports CAN_EVENT_TX_FINISHED.
+ */
+static void flushTxRing(void)
+{
+    /* The responses are kept until the bus is recovered */
+    if (CANRecovery_isBusOff(&canRecovery))
+    {
+        return;
+    }
+
+    while (txRingTail != txRingHead)
+    {
+        if (CAN_write(canHandle, &txRing[txRingTail & (TX_RING_SIZE - 1U)]) != CAN_STATUS_SUCCESS)
+        {
+            CANStats_txFull();
+            break;
+        }
+
+        CANStats_txFrame(&txRing[txRingTail & (TX_RING_SIZE - 1U)]);
+        txRingTail++;
+        perfStats.txCnt++;
+    }
+}
+
+/*
+ *  ======== reportPerfStats ========
+ *  Prints the aggregate counters once every PERF_REPORT_INTERVAL_MS.
+ */
+static void reportPerfStats(void)
+{
+    uint32_t dropped;
+    uint32_t framesPerSec;
+    uint64_t elapsed;
+    uint64_t now;
 
-        sprintf(formattedMsg + strlen(formattedMsg), "\r\n\n");
+    now     = CANTimestamp_getTime();
+    elapsed = now - lastReportTime;
+
+    if (elapsed < ((uint64_t)PERF_REPORT_INTERVAL_MS * SYSTIM_TICKS_PER_MSEC))
+    {
+        return;
     }
 
+    framesPerSec = (uint32_t)(((uint64_t)(perfStats.rxCnt - lastReportRxCnt) * SYSTIM_TICKS_PER_MSEC * 1000U) /
+                              elapsed);
+
+    lastReportTime  = now;
+    lastReportRxCnt = perfStats.rxCnt;
+
+    dropped = perfStats.txRingFullCnt + perfStats.rxFifoLostCnt + perfStats.rxRingFullCnt + eventQueue.overflowCnt;
+
+    sprintf(formattedMsg,
+            "> Perf: %u frames/s, Rx = %u, Tx = %u, dropped = %u "
+            "(Tx ring %u, Rx FIFO %u, Rx ring %u, event queue %u)\r\n",
+            (unsigned int)framesPerSec,
+            (unsigned int)perfStats.rxCnt,
+            (unsigned int)perfStats.txCnt,
+            (unsigned int)dropped,
+            (unsigned int)perfStats.txRingFullCnt,
+            (unsigned int)perfStats.rxFifoLostCnt,
+            (unsigned int)perfStats.rxRingFullCnt,
+            (unsigned int)eventQueue.overflowCnt);
     UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+
+#ifdef CONFIG_GPIO_LED_1
+    /* Blink LED1 as a heartbeat */
+    GPIO_toggle(CONFIG_GPIO_LED_1);
+#endif /* CONFIG_GPIO_LED_1 */
 }
 
+#endif /* CAN_RESPONDER_PERF_MODE */
+
+#if CAN_RESPONDER_ISOTP_MODE
+
 /*
- *  ======== sendResponse ========
+ *  ======== handleIsoTpEvent ========
+ *  Dispatches the received frames and lets the ISO-TP link send the frames
+ *  that are due. Returns false for events that are handled by handleEvent().
  */
-static void sendResponse(void)
+static bool handleIsoTpEvent(uint32_t curEvent)
 {
-    uint_fast8_t i;
-    int_fast16_t status;
+    uint32_t count = 0U;
 
-    /* Flip received ID bits */
-    txElem.id = ~rxElem.id;
-    if (rxElem.xtd == 0)
+    if ((curEvent != CAN_EVENT_RX_DATA_AVAIL) && (curEvent != CAN_EVENT_TX_FINISHED))
     {
-        /* 11-bit standard ID */
-        txElem.id &= 0x7FF;
+        return false;
     }
-    else
+
+    while (readRxMsg(&rxElem))
     {
-        /* 29-bit standard ID */
-        txElem.id &= 0x1FFFFFFF;
+        rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
+        CANDispatch_dispatch(&canDispatch, &rxElem);
     }
 
-    txElem.rtr = rxElem.rtr;
-    txElem.xtd = rxElem.xtd;
+    CANStats_rxBurst(count);
+
+    CANIsoTp_process(&isoTpLink, (uint32_t)CANTimestamp_getTime());
+
+    return true;
+}
+
+/*
+ *  ======== handleIsoTpFrame ========
+ *  Passes a frame received on the ISO-TP link ID to the link.
+ */
+static void handleIsoTpFrame(const CAN_RxBufElement *elem, void *arg)
+{
+    CANIsoTp_receiveFrame(&isoTpLink,
+                          elem->id,
+                          elem->data,
+                          CANCodec_dlcToLength(elem->dlc),
+                          (uint32_t)CANTimestamp_getTime());
+}
+
+/*
+ *  ======== sendIsoTpFrame ========
+ *  ISO-TP frame transmit function. Returns false if the driver could not
+ *  accept the frame.
+ */
+static bool sendIsoTpFrame(void *arg, uint32_t id, const uint8_t *data)
+{
+    /* The frame is retried once the bus is recovered */
+    if (CANRecovery_isBusOff(&canRecovery))
+    {
+        return false;
+    }
+
+    txElem.id  = id;
+    txElem.rtr = 0U;
+    txElem.xtd = 0U;
 #ifndef CAN_SUPPORTS_DCAN
-    txElem.esi = rxElem.esi;
-    txElem.brs = rxElem.brs;
+    txElem.esi = 0U;
+    txElem.brs = 0U;
 #endif /* CAN_SUPPORTS_DCAN */
-    txElem.dlc = rxElem.dlc;
+    txElem.dlc = CAN_DLC_8B;
 #ifndef CAN_SUPPORTS_DCAN
-    txElem.fdf = rxElem.fdf;
+    txElem.fdf = 0U;
 #endif /* CAN_SUPPORTS_DCAN */
     txElem.efc = 0U;
     txElem.mm  = 2U;
 
-    /* Flip received data bits */
-    for (i = 0U; i < dlcToDataSize[rxElem.dlc]; i++)
+    memcpy(txElem.data, data, CANIsoTp_FRAME_SIZE);
+
+    if (CAN_write(canHandle, &txElem) != CAN_STATUS_SUCCESS)
     {
-        txElem.data[i] = ~rxElem.data[i];
+        CANStats_txFull();
+
+        return false;
     }
 
-    status = CAN_write(canHandle, &txElem);
-    if (status != CAN_STATUS_SUCCESS)
+    CANStats_txFrame(&txElem);
+
+    return true;
+}
+
+/*
+ *  ======== receiveIsoTpMsg ========
+ *  ISO-TP message receive function. Verifies the pattern sent by the
+ *  initiator, where each byte is the message number plus the byte index, and
+ *  acknowledges the message.
+ */
+static void receiveIsoTpMsg(void *arg, const uint8_t *data, uint32_t length)
+{
+    uint32_t i;
+    uint8_t status = 0U;
+
+    for (i = 1U; i < length; i++)
     {
-        /* CAN_write() failed */
-        sprintf(formattedMsg, "CAN write failed!\r\n\n");
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
-        while (1) {}
+        if (data[i] != (uint8_t)(data[0] + i))
+        {
+            status = 1U;
+            break;
+        }
     }
+
+    isoTpAck[0] = data[0];
+    isoTpAck[1] = status;
+    isoTpAck[2] = (uint8_t)length;
+    isoTpAck[3] = (uint8_t)(length >> 8);
+
+    CANIsoTp_send(&isoTpLink, isoTpAck, ISOTP_ACK_SIZE, (uint32_t)CANTimestamp_getTime());
+
+    sprintf(formattedMsg,
+            "ISO-TP msg %u: %u bytes, %s (Rx msgs = %u, seq errors = %u, timeouts = %u, overflows = %u)\r\n",
+            (unsigned int)data[0],
+            (unsigned int)length,
+            (status == 0U) ? "PASS" : "FAIL",
+            (unsigned int)isoTpLink.stats.rxMsgCnt,
+            (unsigned int)isoTpLink.stats.rxSeqErrorCnt,
+            (unsigned int)isoTpLink.stats.rxTimeoutCnt,
+            (unsigned int)isoTpLink.stats.rxOverflowCnt);
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
 }
 
+#endif /* CAN_RESPONDER_ISOTP_MODE */
+
+#if !CAN_RESPONDER_SLCAN_MODE
+
 /*
- *  ======== processRxMsg ========
+ *  ======== reportStats ========
+ *  Prints the bus statistics once every STATS_REPORT_INTERVAL_MS, with the bus
+ *  load since the last report.
  */
-static void processRxMsg(void)
+static void reportStats(void)
 {
-    /* Read all available CAN messages */
-    while (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS)
+    uint64_t now = CANTimestamp_getTime();
+#if CAN_RESPONDER_COALESCE_MODE
+    uint32_t framesPerWake;
+    uint32_t avgHoldUs;
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+
+    if ((now - prevStats.time) < ((uint64_t)STATS_REPORT_INTERVAL_MS * SYSTIM_TICKS_PER_MSEC))
+    {
+        return;
+    }
+
+    CANStats_getSnapshot(&curStats, now);
+    CANStats_formatReport(&prevStats, &curStats, formattedMsg, sizeof(formattedMsg));
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+
+    prevStats = curStats;
+
+    sprintf(formattedMsg,
+            "> Recovery: bus off %u, restarts %u (%u failed), down %ums (max %ums), queued %u, dropped %u\r\n",
+            (unsigned int)canRecovery.stats.busOffCnt,
+            (unsigned int)canRecovery.stats.restartCnt,
+            (unsigned int)canRecovery.stats.restartFailCnt,
+            (unsigned int)(canRecovery.stats.downTime / CANRecovery_TICKS_PER_MSEC),
+            (unsigned int)(canRecovery.stats.maxDownTime / CANRecovery_TICKS_PER_MSEC),
+            (unsigned int)canRecovery.stats.queuedCnt,
+            (unsigned int)canRecovery.stats.droppedCnt);
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF
+    sprintf(formattedMsg,
+            "> Capture: records %u, lost %u, ring max %u/%u B\r\n",
+            (unsigned int)canCapture.stats.recordCnt,
+            (unsigned int)canCapture.stats.lostCnt,
+            (unsigned int)canCapture.stats.highWaterMark,
+            (unsigned int)CANCapture_RING_SIZE);
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF */
+
+#if CAN_RESPONDER_COALESCE_MODE
+    CANCoalesce_getStats(&canCoalesce, &coalesceStats);
+
+    /* Frames per wake-up in hundredths and average hold time of the first pending frame */
+    framesPerWake = 0U;
+    avgHoldUs     = 0U;
+
+    if (coalesceStats.wakeCnt > 0U)
+    {
+        framesPerWake = (uint32_t)(((uint64_t)coalesceStats.frameCnt * 100U) / coalesceStats.wakeCnt);
+        avgHoldUs     = (uint32_t)((coalesceStats.holdTime / coalesceStats.wakeCnt) / CANCoalesce_TICKS_PER_USEC);
+    }
+
+    sprintf(formattedMsg,
+            "> Coalesce: frames %u, wakes %u (threshold %u, timeout %u, bypass %u), %u.%02u frames/wake, "
+            "hold avg %uus max %uus, ring full %u\r\n",
+            (unsigned int)coalesceStats.frameCnt,
+            (unsigned int)coalesceStats.wakeCnt,
+            (unsigned int)coalesceStats.thresholdWakeCnt,
+            (unsigned int)coalesceStats.timeoutWakeCnt,
+            (unsigned int)coalesceStats.bypassWakeCnt,
+            (unsigned int)(framesPerWake / 100U),
+            (unsigned int)(framesPerWake % 100U),
+            (unsigned int)avgHoldUs,
+            (unsigned int)(coalesceStats.maxHoldTime / CANCoalesce_TICKS_PER_USEC),
+            (unsigned int)coalesceStats.ringFullCnt);
+    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+}
+
+#endif /* !CAN_RESPONDER_SLCAN_MODE */
+
+/*
+ *  ======== waitForEvent ========
+ *  Returns true if the event semaphore was posted, or false if timeoutMs
+ *  elapsed without an event.
+ */
+static bool waitForEvent(uint32_t timeoutMs)
+{
+    struct timespec timeout;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec += timeoutMs / 1000U;
+    timeout.tv_nsec += (long)(timeoutMs % 1000U) * 1000000L;
+
+    if (timeout.tv_nsec >= 1000000000L)
+    {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
+    }
+
+    return (sem_timedwait(&eventSem, &timeout) == 0);
+}
+
+#if CAN_RESPONDER_SLCAN_MODE
+
+/*
+ *  ======== handleSlcanEvent ========
+ *  Reports the received messages to the host and records the bus errors in
+ *  the status flags read with the F command.
+ */
+static void handleSlcanEvent(uint32_t curEvent, uint32_t curEventData)
+{
+    if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
+    {
+        rxEventCnt++;
+        processSlcanRx(curEventData);
+    }
+    else if ((curEvent == CAN_EVENT_RX_FIFO_MSG_LOST) || (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL))
+    {
+        CANSlcan_setStatus(&slcan, CANSlcan_STATUS_RX_FULL);
+    }
+    else if (curEvent == CAN_EVENT_BUS_OFF)
     {
+        CANSlcan_setStatus(&slcan, CANSlcan_STATUS_ERR_WARNING);
+    }
+    else if (curEvent == CAN_EVENT_ERR_PASSIVE)
+    {
+        CANSlcan_setStatus(&slcan, CANSlcan_STATUS_ERR_PASSIVE);
+    }
+    else if (curEvent == CAN_EVENT_BIT_ERR_UNCORRECTED)
+    {
+        CANSlcan_setStatus(&slcan, CANSlcan_STATUS_BUS_ERROR);
+    }
+}
+
+/*
+ *  ======== processSlcanRx ========
+ *  Reads all available messages and reports them to the host with their SOF
+ *  time in milliseconds. Messages received while the channel is closed are
+ *  dropped. eventTime is the system time at which the event callback reported
+ *  the messages.
+ */
+static void processSlcanRx(uint32_t eventTime)
+{
+    CANTimestamp_Ref ref;
+    uint32_t count = 0U;
+
+    while (readRxMsg(&rxElem))
+    {
+        CANTimestamp_capture(&ref);
+        rxSofTime = CANTimestamp_toRxSofTime(&ref, rxElem.rxts, eventTime);
+
         rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
 
-        sprintf(formattedMsg, "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n", (unsigned int)rxMsgCnt, (unsigned int)rxEventCnt);
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        CANSlcan_rxFrame(&slcan, &rxElem, (uint32_t)(rxSofTime / SYSTIM_TICKS_PER_MSEC));
+    }
+
+    CANStats_rxBurst(count);
+}
+
+/*
+ *  ======== writeSlcanFrame ========
+ *  Transmits a frame for the host. Frames are queued while the bus is off and
+ *  refused once the queue is full.
+ */
+static bool writeSlcanFrame(void *arg, const CAN_TxBufElement *elem)
+{
+    return (CANRecovery_write(&canRecovery, elem) == CAN_STATUS_SUCCESS);
+}
+
+/*
+ *  ======== checkSlcanBitRate ========
+ *  The bit rate is set in the SysConfig CAN module, so only the configured
+ *  nominal bit rate is accepted. The bit rate computed from the bit timing is
+ *  allowed to be off by 1%.
+ */
+static bool checkSlcanBitRate(void *arg, uint32_t bitRate)
+{
+    uint32_t nomBitRate;
+    uint32_t dataBitRate;
+
+    CANStats_getBitRates(&nomBitRate, &dataBitRate);
+
+    return ((bitRate >= (nomBitRate - (nomBitRate / 100U))) && (bitRate <= (nomBitRate + (nomBitRate / 100U))));
+}
+
+/*
+ *  ======== readSlcanCommands ========
+ *  Passes the bytes received on the UART to the SLCAN protocol.
+ */
+static void readSlcanCommands(void)
+{
+    size_t bytesRead;
+
+    do
+    {
+        bytesRead = 0U;
+        UART2_read(uart2Handle, slcanReadBuf, sizeof(slcanReadBuf), &bytesRead);
+        CANSlcan_input(&slcan, slcanReadBuf, bytesRead);
+    } while (bytesRead == sizeof(slcanReadBuf));
+}
 
-        printRxMsg();
-        sendResponse();
+/*
+ *  ======== writeSlcanOutput ========
+ *  Writes the SLCAN output ring to the UART until its Tx ring buffer is full.
+ *  All lines stored since the last call are written with one or two
+ *  UART2_write() calls. The bytes left are written on a later call.
+ */
+static void writeSlcanOutput(void)
+{
+    const char *data;
+    size_t count;
+    size_t written;
+
+    while ((count = CANSlcan_peek(&slcan, &data)) > 0U)
+    {
+        written = 0U;
+        UART2_write(uart2Handle, data, count, &written);
+        CANSlcan_consume(&slcan, written);
+
+        if (written < count)
+        {
+            break;
+        }
     }
 }
 
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+
+#if CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART
+
 /*
- *  ======== eventCallback ========
+ *  ======== writeCapture ========
+ *  Writes the captured records to the UART until its Tx ring buffer is full.
+ *  The records left are written on a later call.
  */
-static void eventCallback(CAN_Handle handle, uint32_t event, uint32_t data, void *userArg)
+static void writeCapture(void)
 {
-    curEvent     = event;
-    curEventData = data;
-    sem_post(&eventSem);
+    const uint8_t *data;
+    size_t count;
+    size_t written;
+
+    while ((count = CANCapture_peek(&canCapture, &data)) > 0U)
+    {
+        written = 0U;
+        UART2_write(uart2Handle, data, count, &written);
+        CANCapture_consume(&canCapture, written);
+
+        if (written < count)
+        {
+            break;
+        }
+    }
 }
 
+#endif /* CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART */
+
 /*
  *  ======== responderThread ========
  * The responder thread receives CAN messages and transmits a response message
@@ -305,8 +1286,24 @@ static void eventCallback(CAN_Handle handle, uint32_t event, uint32_t data, void
  */
 void *responderThread(void *arg0)
 {
-    CAN_Params canParams;
+    CANRecovery_Params recoveryParams;
+#if CAN_RESPONDER_COALESCE_MODE
+    CANCoalesce_Params coalesceParams;
+#endif /* CAN_RESPONDER_COALESCE_MODE */
+#if CAN_RESPONDER_SLCAN_MODE
+    CANSlcan_Params slcanParams;
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+#if CAN_RESPONDER_ISOTP_MODE
+    CANIsoTp_Params isoTpParams;
+#endif /* CAN_RESPONDER_ISOTP_MODE */
     int retc;
+    uint32_t event;
+    uint32_t eventData;
+#if !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_ISOTP_MODE && !CAN_RESPONDER_SLCAN_MODE
+    uint32_t timeoutMs;
+#endif /* !CAN_RESPONDER_PERF_MODE && !CAN_RESPONDER_ISOTP_MODE && !CAN_RESPONDER_SLCAN_MODE */
+
+    CANEventQueue_init(&eventQueue);
 
     retc = sem_init(&eventSem, 0, 0);
     if (retc != 0)
@@ -315,10 +1312,39 @@ void *responderThread(void *arg0)
         while (1) {}
     }
 
-    /* Open CAN driver with default configuration */
+    /* Open CAN driver with default configuration and 250ns timestamp resolution */
     CAN_Params_init(&canParams);
-    canParams.eventCbk  = eventCallback;
-    canParams.eventMask = CAN_EVENT_MASK;
+    canParams.eventCbk    = eventCallback;
+    canParams.eventMask   = CAN_EVENT_MASK;
+    canParams.tsPrescaler = CANCC27XX_EXT_TIMESTAMP_PRESCALER;
+
+    /* Dispatch the received messages by ID */
+    initDispatch(&canParams);
+
+    /* Recover from bus off with exponential backoff */
+    recoveryParams.minBackoffMs = RECOVERY_MIN_BACKOFF_MS;
+    recoveryParams.maxBackoffMs = RECOVERY_MAX_BACKOFF_MS;
+    recoveryParams.stableTimeMs = RECOVERY_STABLE_TIME_MS;
+    recoveryParams.dropOldest   = !CAN_RESPONDER_SLCAN_MODE; /* The SLCAN host is told of refused frames */
+    recoveryParams.writeFxn     = writeFrame;
+    recoveryParams.restartFxn   = restartDriver;
+    recoveryParams.arg          = NULL;
+
+    CANRecovery_init(&canRecovery, &recoveryParams);
+
+#if CAN_RESPONDER_COALESCE_MODE
+    /* Wake the responder thread for batches of messages */
+    coalesceParams.frameThreshold = COALESCE_FRAME_THRESHOLD;
+    coalesceParams.timeoutUs      = COALESCE_TIMEOUT_USEC;
+    coalesceParams.wakeFxn        = wakeResponder;
+    coalesceParams.arg            = NULL;
+
+    CANCoalesce_init(&canCoalesce, &coalesceParams);
+    CANCoalesce_addBypassId(&canCoalesce, COALESCE_BYPASS_ID, false);
+#if CAN_RESPONDER_ISOTP_MODE
+    CANCoalesce_addBypassId(&canCoalesce, ISOTP_RX_ID, false);
+#endif /* CAN_RESPONDER_ISOTP_MODE */
+#endif /* CAN_RESPONDER_COALESCE_MODE */
 
     canHandle = CAN_open(CONFIG_CAN_0, &canParams);
     if (canHandle == NULL)
@@ -328,11 +1354,46 @@ void *responderThread(void *arg0)
         UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
         while (1) {}
     }
+#if !CAN_RESPONDER_SLCAN_MODE
     else
     {
         sprintf(formattedMsg, "\r\nCAN Responder ready. Waiting for CAN messages...\r\n\n");
         UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
     }
+#endif /* !CAN_RESPONDER_SLCAN_MODE */
+
+    /* Convert Rx timestamps to SOF times in the system time domain */
+    CANTimestamp_init(canHandle, CANCC27XX_EXT_TIMESTAMP_PRESCALER);
+
+    /* Collect bus statistics from now on */
+    CANStats_init(canHandle, CANTimestamp_getTime());
+    CANStats_getSnapshot(&prevStats, CANTimestamp_getTime());
+
+#if CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF
+    CANCapture_init(&canCapture, (CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_RAM));
+#endif /* CAN_RESPONDER_CAPTURE_MODE != CAPTURE_MODE_OFF */
+
+#if CAN_RESPONDER_SLCAN_MODE
+    slcanParams.writeFxn   = writeSlcanFrame;
+    slcanParams.bitRateFxn = checkSlcanBitRate;
+    slcanParams.arg        = NULL;
+
+    CANSlcan_init(&slcan, &slcanParams);
+#endif /* CAN_RESPONDER_SLCAN_MODE */
+
+#if CAN_RESPONDER_ISOTP_MODE
+
+    isoTpParams.txId       = ISOTP_TX_ID;
+    isoTpParams.rxId       = ISOTP_RX_ID;
+    isoTpParams.blockSize  = ISOTP_BLOCK_SIZE;
+    isoTpParams.stMin      = ISOTP_ST_MIN;
+    isoTpParams.sendFxn    = sendIsoTpFrame;
+    isoTpParams.receiveFxn = receiveIsoTpMsg;
+    isoTpParams.arg        = NULL;
+
+    CANIsoTp_init(&isoTpLink, &isoTpParams);
+
+#endif /* CAN_RESPONDER_ISOTP_MODE */
 
 #ifdef CONFIG_GPIO_LED_0
 
@@ -341,15 +1402,101 @@ void *responderThread(void *arg0)
 
 #endif /* CONFIG_GPIO_LED_0 */
 
+#if CAN_RESPONDER_PERF_MODE
+
+    lastReportTime = CANTimestamp_getTime();
+
     /* Loop forever */
     while (1)
     {
-        /* Wait until event callback semaphore is posted */
-        sem_wait(&eventSem);
+        /* Wait until event callback semaphore is posted or a report is due */
+        if (waitForEvent(CANRecovery_isPending(&canRecovery) ? RECOVERY_POLL_INTERVAL_MS : PERF_REPORT_INTERVAL_MS) &&
+            CANEventQueue_get(&eventQueue, &event, &eventData))
+        {
+            handleEvent(event, eventData);
+        }
 
-        /* Process the event */
-        handleEvent();
+        CANRecovery_process(&canRecovery, CANTimestamp_getTime());
+
+        /* Write responses left over if a Tx finished event was lost */
+        flushTxRing();
+
+        reportPerfStats();
+        reportStats();
     }
+
+#elif CAN_RESPONDER_SLCAN_MODE
+
+    /* Loop forever */
+    while (1)
+    {
+        /* Wait until event callback semaphore is posted or the UART is due to be polled */
+        if (waitForEvent(SLCAN_POLL_INTERVAL_MS) && CANEventQueue_get(&eventQueue, &event, &eventData))
+        {
+            handleEvent(event, eventData);
+        }
+
+        /* Recover from bus off and send the queued frames */
+        CANRecovery_process(&canRecovery, CANTimestamp_getTime());
+
+        readSlcanCommands();
+        writeSlcanOutput();
+    }
+
+#elif CAN_RESPONDER_ISOTP_MODE
+
+    /* Loop forever */
+    while (1)
+    {
+        /* Wait until event callback semaphore is posted or a timeout check is due */
+        if (waitForEvent(ISOTP_POLL_INTERVAL_MS) && CANEventQueue_get(&eventQueue, &event, &eventData))
+        {
+            handleEvent(event, eventData);
+        }
+
+        /* Handle the ISO-TP timeouts and resend frames left over if a Tx
+         * finished event was lost.
+         */
+        CANRecovery_process(&canRecovery, CANTimestamp_getTime());
+        CANIsoTp_process(&isoTpLink, (uint32_t)CANTimestamp_getTime());
+
+        reportEventQueueOverflow();
+        reportStats();
+    }
+
+#else
+
+    /* Loop forever */
+    while (1)
+    {
+        timeoutMs = CANRecovery_isPending(&canRecovery) ? RECOVERY_POLL_INTERVAL_MS : STATS_REPORT_INTERVAL_MS;
+
+#if CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART
+        /* Retry the records left once the UART has sent some of its Tx ring buffer */
+        if (CANCapture_getCount(&canCapture) > 0U)
+        {
+            timeoutMs = CAPTURE_POLL_INTERVAL_MS;
+        }
+#endif /* CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART */
+
+        /* Wait until event callback semaphore is posted or a report is due */
+        if (waitForEvent(timeoutMs) && CANEventQueue_get(&eventQueue, &event, &eventData))
+        {
+            handleEvent(event, eventData);
+        }
+
+        /* Recover from bus off and send the queued responses */
+        CANRecovery_process(&canRecovery, CANTimestamp_getTime());
+
+#if CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART
+        writeCapture();
+#endif /* CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART */
+
+        reportEventQueueOverflow();
+        reportStats();
+    }
+
+#endif /* CAN_RESPONDER_PERF_MODE */
 }
 
 /*
@@ -365,6 +1512,14 @@ void *mainThread(void *arg0)
 
     UART2_Params_init(&uart2Params);
     uart2Params.writeMode = UART2_Mode_NONBLOCKING;
+#if CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART
+    uart2Params.baudRate = CAPTURE_UART_BAUD_RATE;
+#endif /* CAN_RESPONDER_CAPTURE_MODE == CAPTURE_MODE_UART */
+#if CAN_RESPONDER_SLCAN_MODE
+    uart2Params.baudRate       = SLCAN_UART_BAUD_RATE;
+    uart2Params.readMode       = UART2_Mode_NONBLOCKING;
+    uart2Params.readReturnMode = UART2_ReadReturnMode_PARTIAL;
+#endif /* CAN_RESPONDER_SLCAN_MODE */
 
     uart2Handle = UART2_open(CONFIG_UART2_0, &uart2Params);
 
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANSchedule.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "CANSchedule.h"
+#include "CANStats.h"
+
+/* Network time wrap period */
+#define EPOCH_TICKS  0x100000000ULL
+#define EPOCH_MASK   0xFFFFFFFF00000000ULL
+
+/* Standard and extended identifier fields */
+#define STD_ID_MASK  0x7FFU
+#define EXT_ID_SHIFT 18U
+
+/*
+ *  ======== firstReleaseAtOrAfter ========
+ *  Returns the first release time of entry that is not before time.
+ */
+static uint64_t firstReleaseAtOrAfter(const CANSchedule_Entry *entry, uint64_t time)
+{
+    uint64_t epoch  = time & EPOCH_MASK;
+    uint64_t offset = (uint64_t)entry->offsetUs * CANSchedule_TICKS_PER_USEC;
+    uint64_t period = (uint64_t)entry->periodUs * CANSchedule_TICKS_PER_USEC;
+    uint64_t release;
+
+    if ((time - epoch) <= offset)
+    {
+        return epoch + offset;
+    }
+
+    release = epoch + offset + ((((time - epoch) - offset + period - 1U) / period) * period);
+
+    /* The grid restarts at each network time wrap */
+    if (release >= (epoch + EPOCH_TICKS))
+    {
+        release = epoch + EPOCH_TICKS + offset;
+    }
+
+    return release;
+}
+
+/*
+ *  ======== releaseFrame ========
+ */
+static void releaseFrame(CANSchedule_Object *obj, uint32_t index, uint64_t releaseTime)
+{
+    const CANSchedule_Entry *entry = &obj->entries[index];
+    CANSchedule_Stats *stats       = &obj->slots[index].stats;
+    CAN_TxBufElement elem;
+
+    memset(&elem, 0, sizeof(elem));
+
+    elem.id  = entry->id;
+    elem.xtd = entry->xtd ? 1U : 0U;
+    elem.dlc = entry->dlc;
+#ifndef CAN_SUPPORTS_DCAN
+    elem.fdf = entry->fdf ? 1U : 0U;
+    elem.brs = entry->brs ? 1U : 0U;
+#endif /* CAN_SUPPORTS_DCAN */
+    elem.mm = index;
+
+    if ((entry->produceFxn != NULL) && !entry->produceFxn(entry->arg, &elem, releaseTime))
+    {
+        stats->skippedCnt++;
+        return;
+    }
+
+    if (obj->submitFxn(obj->arg, &elem) != CAN_STATUS_SUCCESS)
+    {
+        stats->failedCnt++;
+        return;
+    }
+
+    stats->releasedCnt++;
+}
+
+/*
+ *  ======== getFrameTimeNs ========
+ *  Returns the worst-case bus time of the frame of entry.
+ */
+static uint64_t getFrameTimeNs(const CANSchedule_Entry *entry, uint32_t nomBitRate, uint32_t dataBitRate)
+{
+    uint32_t nomBits;
+    uint32_t dataBits;
+
+#ifndef CAN_SUPPORTS_DCAN
+    CANStats_getFrameBits(entry->xtd, entry->fdf, entry->brs, CANCodec_dlcToLength(entry->dlc), &nomBits, &dataBits);
+#else
+    CANStats_getFrameBits(entry->xtd, false, false, CANCodec_dlcToLength(entry->dlc), &nomBits, &dataBits);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    return (((uint64_t)nomBits * 1000000000U) / nomBitRate) + (((uint64_t)dataBits * 1000000000U) / dataBitRate);
+}
+
+/*
+ *  ======== priorityKey ========
+ *  Returns a value that orders data frames as CAN arbitration does: the
+ *  lower value wins.
+ */
+static uint32_t priorityKey(const CANSchedule_Entry *entry)
+{
+    if (entry->xtd)
+    {
+        return (((entry->id >> EXT_ID_SHIFT) & STD_ID_MASK) << 20) | (1U << 19) | (entry->id & 0x3FFFFU);
+    }
+
+    return (entry->id & STD_ID_MASK) << 20;
+}
+
+/*
+ *  ======== CANSchedule_init ========
+ */
+void CANSchedule_init(CANSchedule_Object *obj,
+                      const CANSchedule_Entry *entries,
+                      CANSchedule_Slot *slots,
+                      uint32_t count,
+                      CANSchedule_SubmitFxn submitFxn,
+                      void *arg)
+{
+    memset(obj, 0, sizeof(*obj));
+    memset(slots, 0, count * sizeof(*slots));
+
+    obj->entries   = entries;
+    obj->slots     = slots;
+    obj->count     = count;
+    obj->submitFxn = submitFxn;
+    obj->arg       = arg;
+}
+
+/*
+ *  ======== CANSchedule_release ========
+ */
+uint32_t CANSchedule_release(CANSchedule_Object *obj, uint32_t networkTime)
+{
+    const CANSchedule_Entry *entry;
+    CANSchedule_Slot *slot;
+    uint64_t expected;
+    uint64_t period;
+    uint64_t delay;
+    uint64_t nextDelay = UINT32_MAX;
+    uint32_t jitter;
+    uint32_t i;
+
+    /* Extend the network time to 64 bits */
+    if (!obj->started)
+    {
+        obj->now     = networkTime;
+        obj->started = true;
+
+        for (i = 0U; i < obj->count; i++)
+        {
+            obj->slots[i].nextRelease = firstReleaseAtOrAfter(&obj->entries[i], obj->now);
+        }
+    }
+    else
+    {
+        obj->now += (uint64_t)(int64_t)(int32_t)(networkTime - (uint32_t)obj->now);
+    }
+
+    for (i = 0U; i < obj->count; i++)
+    {
+        entry  = &obj->entries[i];
+        slot   = &obj->slots[i];
+        period = (uint64_t)entry->periodUs * CANSchedule_TICKS_PER_USEC;
+
+        if (obj->now < slot->nextRelease)
+        {
+            /* Realign if the network time stepped back */
+            expected = firstReleaseAtOrAfter(entry, obj->now);
+
+            if (expected != slot->nextRelease)
+            {
+                slot->nextRelease = expected;
+                slot->stats.realignCnt++;
+            }
+        }
+        else
+        {
+            delay = obj->now - slot->nextRelease;
+
+            if (delay >= period)
+            {
+                /* Too late, or the network time stepped forward */
+                slot->stats.missedCnt += (uint32_t)(delay / period);
+                slot->stats.realignCnt++;
+            }
+            else
+            {
+                jitter = (uint32_t)delay;
+
+                if ((slot->stats.releasedCnt == 0U) || (jitter < slot->stats.minJitter))
+                {
+                    slot->stats.minJitter = jitter;
+                }
+
+                if (jitter > slot->stats.maxJitter)
+                {
+                    slot->stats.maxJitter = jitter;
+                }
+
+                slot->stats.sumJitter += jitter;
+
+                releaseFrame(obj, i, slot->nextRelease);
+            }
+
+            slot->nextRelease = firstReleaseAtOrAfter(entry, obj->now + 1U);
+        }
+
+        if ((slot->nextRelease - obj->now) < nextDelay)
+        {
+            nextDelay = slot->nextRelease - obj->now;
+        }
+    }
+
+    return (uint32_t)nextDelay;
+}
+
+/*
+ *  ======== CANSchedule_getLoad ========
+ */
+uint32_t CANSchedule_getLoad(const CANSchedule_Entry *entries,
+                             uint32_t count,
+                             uint32_t nomBitRate,
+                             uint32_t dataBitRate)
+{
+    uint64_t load = 0U;
+    uint32_t i;
+
+    /* Sum the fractions of each period taken by the frame, in millionths */
+    for (i = 0U; i < count; i++)
+    {
+        load += (getFrameTimeNs(&entries[i], nomBitRate, dataBitRate) * 1000U) / entries[i].periodUs;
+    }
+
+    return (uint32_t)(load / 1000U);
+}
+
+/*
+ *  ======== CANSchedule_analyze ========
+ *  Standard response time analysis for non-preemptive CAN frames: a frame
+ *  waits for at most one lower priority frame already being sent and for
+ *  every higher priority frame released before it wins arbitration.
+ */
+bool CANSchedule_analyze(const CANSchedule_Entry *entries,
+                         uint32_t count,
+                         uint32_t nomBitRate,
+                         uint32_t dataBitRate,
+                         uint32_t *responseTimeUs)
+{
+    uint64_t bitTimeNs = 1000000000U / nomBitRate;
+    uint64_t frameNs;
+    uint64_t periodNs;
+    uint64_t blockingNs;
+    uint64_t waitNs;
+    uint64_t nextWaitNs;
+    bool feasible = true;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < count; i++)
+    {
+        frameNs    = getFrameTimeNs(&entries[i], nomBitRate, dataBitRate);
+        periodNs   = (uint64_t)entries[i].periodUs * 1000U;
+        blockingNs = 0U;
+
+        for (j = 0U; j < count; j++)
+        {
+            if ((j != i) && (priorityKey(&entries[j]) > priorityKey(&entries[i])) &&
+                (getFrameTimeNs(&entries[j], nomBitRate, dataBitRate) > blockingNs))
+            {
+                blockingNs = getFrameTimeNs(&entries[j], nomBitRate, dataBitRate);
+            }
+        }
+
+        /* Iterate the queuing delay to a fixed point */
+        waitNs = blockingNs;
+
+        while ((waitNs + frameNs) <= periodNs)
+        {
+            nextWaitNs = blockingNs;
+
+            for (j = 0U; j < count; j++)
+            {
+                if ((j != i) && (priorityKey(&entries[j]) <= priorityKey(&entries[i])))
+                {
+                    nextWaitNs += ((waitNs + bitTimeNs + ((uint64_t)entries[j].periodUs * 1000U) - 1U) /
+                                   ((uint64_t)entries[j].periodUs * 1000U)) *
+                                  getFrameTimeNs(&entries[j], nomBitRate, dataBitRate);
+                }
+            }
+
+            if (nextWaitNs == waitNs)
+            {
+                break;
+            }
+
+            waitNs = nextWaitNs;
+        }
+
+        if ((waitNs + frameNs) <= periodNs)
+        {
+            responseTimeUs[i] = (uint32_t)((waitNs + frameNs + 999U) / 1000U);
+        }
+        else
+        {
+            responseTimeUs[i] = UINT32_MAX;
+            feasible          = false;
+        }
+    }
+
+    return feasible;
+}
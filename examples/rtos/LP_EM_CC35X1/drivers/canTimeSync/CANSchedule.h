@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANSchedule.h ========
+ *  Time-triggered cyclic CAN transmission schedule.
+ *
+ *  The schedule is a static table of entries. Each entry describes a frame
+ *  that is released every period at a fixed offset, and a function that
+ *  produces its payload. Release times are multiples of the period plus the
+ *  offset in network time, the 32-bit SYSTIM time base of the time sync
+ *  master, so the schedules of all synchronized nodes are aligned. The grid
+ *  restarts when the network time wraps (every ~17.9 minutes), which gives
+ *  one shortened cycle per wrap unless the period divides 2^32 ticks.
+ *
+ *  A single caller, typically one thread woken by a timer at the returned
+ *  time, calls CANSchedule_release() with the current network time. All due
+ *  frames are produced and submitted, so no thread per frame is needed. The
+ *  delay from the release time to the release, the release jitter, is
+ *  recorded per entry. Releases that are more than one period late are
+ *  counted as missed and skipped. When the network time steps, for example
+ *  when a follower locks to the master, the schedule is realigned.
+ *
+ *  CANSchedule_getLoad() and CANSchedule_analyze() only use the table and
+ *  the bit rates, so a table can also be checked on a host before it is
+ *  deployed. Times are in 250ns ticks unless noted otherwise.
+ */
+
+#ifndef CANSCHEDULE_H_
+#define CANSCHEDULE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Time ticks per microsecond */
+#define CANSchedule_TICKS_PER_USEC 4U
+
+/* Produces the payload of a frame released at releaseTime. The frame ID,
+ * format and DLC are already set. Returns false to skip this release.
+ */
+typedef bool (*CANSchedule_ProduceFxn)(void *arg, CAN_TxBufElement *elem, uint64_t releaseTime);
+
+/* Submits a released frame for transmission */
+typedef int_fast16_t (*CANSchedule_SubmitFxn)(void *arg, const CAN_TxBufElement *elem);
+
+/* Schedule table entry */
+typedef struct
+{
+    uint32_t id;
+    bool xtd;                          /* 29-bit ID */
+    bool fdf;                          /* CAN FD format, ignored with DCAN */
+    bool brs;                          /* Bit rate switch, ignored with DCAN */
+    uint32_t dlc;
+    uint32_t periodUs;                 /* Release period */
+    uint32_t offsetUs;                 /* Release offset, less than the period */
+    CANSchedule_ProduceFxn produceFxn; /* NULL to send the payload unchanged */
+    void *arg;                         /* Passed to produceFxn */
+} CANSchedule_Entry;
+
+/* Release statistics of an entry */
+typedef struct
+{
+    uint32_t releasedCnt; /* Frames submitted */
+    uint32_t skippedCnt;  /* Releases skipped by the produce function */
+    uint32_t failedCnt;   /* Frames the submit function refused */
+    uint32_t missedCnt;   /* Releases missed by more than one period */
+    uint32_t realignCnt;  /* Realignments after a network time step */
+    uint32_t minJitter;   /* Minimum delay from the release time to the release */
+    uint32_t maxJitter;   /* Maximum delay from the release time to the release */
+    uint64_t sumJitter;   /* Sum of all delays, for computing the mean */
+} CANSchedule_Stats;
+
+/* Entry state. The fields are private, except for stats. */
+typedef struct
+{
+    CANSchedule_Stats stats;
+    uint64_t nextRelease;
+} CANSchedule_Slot;
+
+/* Schedule object */
+typedef struct
+{
+    const CANSchedule_Entry *entries;
+    CANSchedule_Slot *slots;
+    uint32_t count;
+    CANSchedule_SubmitFxn submitFxn;
+    void *arg;        /* Passed to submitFxn */
+    bool started;
+    uint64_t now;     /* Network time extended to 64 bits */
+} CANSchedule_Object;
+
+/*
+ *  ======== CANSchedule_init ========
+ *  Initializes a schedule for count entries. slots must have count elements.
+ */
+extern void CANSchedule_init(CANSchedule_Object *obj,
+                             const CANSchedule_Entry *entries,
+                             CANSchedule_Slot *slots,
+                             uint32_t count,
+                             CANSchedule_SubmitFxn submitFxn,
+                             void *arg);
+
+/*
+ *  ======== CANSchedule_release ========
+ *  Releases the frames that are due at networkTime. Returns the time until
+ *  the next release.
+ */
+extern uint32_t CANSchedule_release(CANSchedule_Object *obj, uint32_t networkTime);
+
+/*
+ *  ======== CANSchedule_getLoad ========
+ *  Returns the bus load of the schedule in tenths of a percent, computed from
+ *  the worst-case length of each frame.
+ */
+extern uint32_t CANSchedule_getLoad(const CANSchedule_Entry *entries,
+                                    uint32_t count,
+                                    uint32_t nomBitRate,
+                                    uint32_t dataBitRate);
+
+/*
+ *  ======== CANSchedule_analyze ========
+ *  Computes the worst-case response time of each entry, from its release
+ *  until the end of its transmission, assuming all frames can be released at
+ *  the same time and higher priority IDs win arbitration. Offsets are not
+ *  taken into account, so the result is pessimistic. Returns true if every
+ *  frame is sent within its period. responseTimeUs must have count elements;
+ *  entries whose response time exceeds the period are set to UINT32_MAX.
+ */
+extern bool CANSchedule_analyze(const CANSchedule_Entry *entries,
+                                uint32_t count,
+                                uint32_t nomBitRate,
+                                uint32_t dataBitRate,
+                                uint32_t *responseTimeUs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANSCHEDULE_H_ */
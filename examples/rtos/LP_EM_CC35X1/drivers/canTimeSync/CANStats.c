@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANStats.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include "CANCodec.h"
+#include "CANStats.h"
+
+/* Bits from the CRC delimiter to the end of the interframe space: CRC
+ * delimiter, ACK slot, ACK delimiter, end of frame and intermission.
+ */
+#define FRAME_TAIL_BITS 13U
+
+static CANStats_Snapshot stats;
+
+/* Nominal and data phase bit times in picoseconds */
+static uint32_t nomBitTimePs;
+static uint32_t dataBitTimePs;
+
+/* Bus bits sent at the nominal and data bit rates */
+static uint64_t nomBitCnt;
+static uint64_t dataBitCnt;
+
+/* Time the driver was opened and the current error state was entered */
+static uint64_t startTime;
+static uint64_t stateTime;
+
+/*
+ *  ======== worstCaseStuffBits ========
+ *  A stuff bit is inserted after five equal bits, and at worst after every
+ *  four bits following the first stuff bit.
+ */
+static uint32_t worstCaseStuffBits(uint32_t bits)
+{
+    return (bits - 1U) / 4U;
+}
+
+/*
+ *  ======== countFrameBits ========
+ *  Adds the bits of a frame to the nominal and data bit rate bit counts. Must
+ *  be called with interrupts disabled.
+ */
+static void countFrameBits(bool xtd, bool fdf, bool brs, uint32_t dataLen)
+{
+    uint32_t nomBits;
+    uint32_t dataBits;
+
+    CANStats_getFrameBits(xtd, fdf, brs, dataLen, &nomBits, &dataBits);
+
+    nomBitCnt += nomBits;
+    dataBitCnt += dataBits;
+}
+
+/*
+ *  ======== updateErrorState ========
+ *  Adds the time spent in the current error state. Must be called with
+ *  interrupts disabled.
+ */
+static void updateErrorState(CANStats_ErrorState state, uint64_t now)
+{
+    if (stats.errorState == CANStats_ERR_PASSIVE)
+    {
+        stats.errPassiveTime += now - stateTime;
+    }
+    else if (stats.errorState == CANStats_BUS_OFF)
+    {
+        stats.busOffTime += now - stateTime;
+    }
+
+    stats.errorState = state;
+    stateTime        = now;
+}
+
+/*
+ *  ======== CANStats_init ========
+ */
+void CANStats_init(CAN_Handle handle, uint64_t now)
+{
+    CAN_BitTimingParams bitTiming;
+    uint32_t clkFreqKhz;
+    uint32_t clkPeriodPs;
+    uintptr_t hwiKey;
+
+    CAN_getBitTiming(handle, &bitTiming, &clkFreqKhz);
+
+    /* Functional values of the bit timing fields are one higher than the
+     * register values. A bit is the sync segment plus both time segments.
+     */
+    clkPeriodPs  = 1000000000U / clkFreqKhz;
+    nomBitTimePs = clkPeriodPs * (bitTiming.nomRatePrescaler + 1U) *
+                   (1U + (bitTiming.nomTimeSeg1 + 1U) + (bitTiming.nomTimeSeg2 + 1U));
+
+#ifndef CAN_SUPPORTS_DCAN
+    dataBitTimePs = clkPeriodPs * (bitTiming.dataRatePrescaler + 1U) *
+                    (1U + (bitTiming.dataTimeSeg1 + 1U) + (bitTiming.dataTimeSeg2 + 1U));
+#else
+    dataBitTimePs = nomBitTimePs;
+#endif /* CAN_SUPPORTS_DCAN */
+
+    /* Events may already be reported */
+    hwiKey = HwiP_disable();
+
+    memset(&stats, 0, sizeof(stats));
+
+    nomBitCnt        = 0U;
+    dataBitCnt       = 0U;
+    stats.errorState = CANStats_ERR_ACTIVE;
+    startTime        = now;
+    stateTime        = now;
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_getFrameBits ========
+ */
+void CANStats_getFrameBits(bool xtd, bool fdf, bool brs, uint32_t dataLen, uint32_t *nomBits, uint32_t *dataBits)
+{
+    uint32_t crcBits;
+
+    if (!fdf)
+    {
+        /* SOF to the end of the CRC field: 34 bits plus the data for an 11-bit
+         * ID, 54 bits plus the data for a 29-bit ID.
+         */
+        *nomBits  = (xtd ? 54U : 34U) + (8U * dataLen);
+        *nomBits += worstCaseStuffBits(*nomBits) + FRAME_TAIL_BITS;
+        *dataBits = 0U;
+
+        return;
+    }
+
+    /* Arbitration phase: SOF to BRS */
+    *nomBits = xtd ? 36U : 17U;
+
+    /* Data phase: ESI, DLC, data, stuff count and CRC, with the fixed stuff bits
+     * of the stuff count and CRC fields.
+     */
+    crcBits    = (dataLen <= 16U) ? 17U : 21U;
+    *dataBits  = 5U + (8U * dataLen);
+    *dataBits += worstCaseStuffBits(*nomBits + *dataBits) + 4U + crcBits + ((4U + crcBits + 3U) / 4U);
+
+    *nomBits += FRAME_TAIL_BITS;
+
+    if (!brs)
+    {
+        *nomBits += *dataBits;
+        *dataBits = 0U;
+    }
+}
+
+/*
+ *  ======== CANStats_getBitRates ========
+ */
+void CANStats_getBitRates(uint32_t *nomBitRate, uint32_t *dataBitRate)
+{
+    *nomBitRate  = (uint32_t)(1000000000000ULL / nomBitTimePs);
+    *dataBitRate = (uint32_t)(1000000000000ULL / dataBitTimePs);
+}
+
+/*
+ *  ======== CANStats_event ========
+ */
+void CANStats_event(uint32_t event, uint64_t now)
+{
+    uint32_t bits = event;
+    uint32_t i;
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    for (i = 0U; bits != 0U; i++)
+    {
+        if ((bits & 1U) != 0U)
+        {
+            stats.eventCnt[i]++;
+        }
+
+        bits >>= 1;
+    }
+
+    if (event == CAN_EVENT_BUS_OFF)
+    {
+        updateErrorState(CANStats_BUS_OFF, now);
+    }
+    else if (event == CAN_EVENT_ERR_PASSIVE)
+    {
+        updateErrorState(CANStats_ERR_PASSIVE, now);
+    }
+    else if ((event == CAN_EVENT_ERR_ACTIVE) || (event == CAN_EVENT_BUS_ON))
+    {
+        updateErrorState(CANStats_ERR_ACTIVE, now);
+    }
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_rxFrame ========
+ */
+void CANStats_rxFrame(const CAN_RxBufElement *elem)
+{
+    uint32_t dataLen = (elem->rtr != 0U) ? 0U : CANCodec_dlcToLength(elem->dlc);
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    stats.rxFrameCnt++;
+    stats.rxByteCnt += dataLen;
+
+#ifndef CAN_SUPPORTS_DCAN
+    countFrameBits(elem->xtd != 0U, elem->fdf != 0U, elem->brs != 0U, dataLen);
+#else
+    countFrameBits(elem->xtd != 0U, false, false, dataLen);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_rxBurst ========
+ */
+void CANStats_rxBurst(uint32_t count)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    if (count > stats.rxBurstMax)
+    {
+        stats.rxBurstMax = count;
+    }
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_txFrame ========
+ */
+void CANStats_txFrame(const CAN_TxBufElement *elem)
+{
+    uint32_t dataLen = (elem->rtr != 0U) ? 0U : CANCodec_dlcToLength(elem->dlc);
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    stats.txFrameCnt++;
+    stats.txByteCnt += dataLen;
+
+#ifndef CAN_SUPPORTS_DCAN
+    countFrameBits(elem->xtd != 0U, elem->fdf != 0U, elem->brs != 0U, dataLen);
+#else
+    countFrameBits(elem->xtd != 0U, false, false, dataLen);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_txFull ========
+ */
+void CANStats_txFull(void)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+    stats.txFullCnt++;
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANStats_getSnapshot ========
+ */
+void CANStats_getSnapshot(CANStats_Snapshot *snapshot, uint64_t now)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    /* Include the time spent in the current error state */
+    updateErrorState(stats.errorState, now);
+
+    *snapshot = stats;
+
+    snapshot->busTimeNs = ((nomBitCnt * nomBitTimePs) + (dataBitCnt * dataBitTimePs)) / 1000U;
+
+    HwiP_restore(hwiKey);
+
+    snapshot->time    = now;
+    snapshot->elapsed = now - startTime;
+}
+
+/*
+ *  ======== CANStats_getEventCnt ========
+ */
+uint32_t CANStats_getEventCnt(const CANStats_Snapshot *snapshot, uint32_t event)
+{
+    uint32_t i = 0U;
+
+    while ((i < (CANStats_EVENT_CNT - 1U)) && ((event & (1UL << i)) == 0U))
+    {
+        i++;
+    }
+
+    return snapshot->eventCnt[i];
+}
+
+/*
+ *  ======== CANStats_getBusLoad ========
+ */
+uint32_t CANStats_getBusLoad(const CANStats_Snapshot *prev, const CANStats_Snapshot *cur)
+{
+    uint64_t intervalNs = ((cur->time - prev->time) * 1000U) / CANStats_TICKS_PER_USEC;
+
+    if (intervalNs == 0U)
+    {
+        return 0U;
+    }
+
+    return (uint32_t)(((cur->busTimeNs - prev->busTimeNs) * 1000U) / intervalNs);
+}
+
+/*
+ *  ======== CANStats_formatReport ========
+ */
+int CANStats_formatReport(const CANStats_Snapshot *prev, const CANStats_Snapshot *cur, char *buf, size_t size)
+{
+    uint32_t load = CANStats_getBusLoad(prev, cur);
+
+    return snprintf(buf,
+                    size,
+                    "> CAN: load %u.%u%%, Rx %u/%uB, Tx %u/%uB, Rx burst max %u, Tx full %u, "
+                    "bus off %u (%ums), err passive %u (%ums), FIFO lost %u, ring full %u, bit err %u\r\n",
+                    (unsigned int)(load / 10U),
+                    (unsigned int)(load % 10U),
+                    (unsigned int)cur->rxFrameCnt,
+                    (unsigned int)cur->rxByteCnt,
+                    (unsigned int)cur->txFrameCnt,
+                    (unsigned int)cur->txByteCnt,
+                    (unsigned int)cur->rxBurstMax,
+                    (unsigned int)cur->txFullCnt,
+                    (unsigned int)CANStats_getEventCnt(cur, CAN_EVENT_BUS_OFF),
+                    (unsigned int)(cur->busOffTime / (1000U * CANStats_TICKS_PER_USEC)),
+                    (unsigned int)CANStats_getEventCnt(cur, CAN_EVENT_ERR_PASSIVE),
+                    (unsigned int)(cur->errPassiveTime / (1000U * CANStats_TICKS_PER_USEC)),
+                    (unsigned int)CANStats_getEventCnt(cur, CAN_EVENT_RX_FIFO_MSG_LOST),
+                    (unsigned int)CANStats_getEventCnt(cur, CAN_EVENT_RX_RING_BUFFER_FULL),
+                    (unsigned int)CANStats_getEventCnt(cur, CAN_EVENT_BIT_ERR_UNCORRECTED));
+}
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANTxSched.h ========
+ *  Priority-ordered CAN transmit scheduler.
+ *
+ *  Frames are submitted to one of several software queues, typically one per
+ *  class of CAN IDs, instead of being written to the driver directly. The
+ *  scheduler passes queued frames to the driver in CAN arbitration order: of
+ *  the frames at the front of the queues, the one with the highest priority
+ *  identifier is written first. A low priority bulk frame therefore never
+ *  holds up an urgent frame that is already queued. Frames of the same queue
+ *  are sent in submission order.
+ *
+ *  A frame can overtake only the frames the scheduler has not yet written to
+ *  the driver. The number of frames written since the driver last reported
+ *  CAN_EVENT_TX_FINISHED is limited to maxInFlight, which bounds the priority
+ *  inversion in the driver and the hardware. With maxInFlight set to 1, an
+ *  urgent frame waits for at most one frame already on the bus.
+ *
+ *  Each queue can be rate limited to rateHz frames per second with bursts of
+ *  up to burst frames. The time from submission until the frame is written to
+ *  the driver is recorded per queue.
+ *
+ *  CANTxSched_submit() and CANTxSched_txIdle() may be called from any
+ *  context. CANTxSched_process() must be called from a single thread, after
+ *  every submission and Tx finished event and when the time it returned is
+ *  reached. Times are 64-bit values in 250ns ticks.
+ */
+
+#ifndef CANTXSCHED_H_
+#define CANTXSCHED_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of queues */
+#ifndef CANTxSched_NUM_QUEUES
+    #define CANTxSched_NUM_QUEUES 4U
+#endif
+
+/* Number of frames each queue can hold. Must be a power of two. */
+#ifndef CANTxSched_QUEUE_SIZE
+    #define CANTxSched_QUEUE_SIZE 8U
+#endif
+
+#if (CANTxSched_QUEUE_SIZE & (CANTxSched_QUEUE_SIZE - 1U)) != 0U
+    #error "CANTxSched_QUEUE_SIZE must be a power of two"
+#endif
+
+/* Time ticks per second */
+#define CANTxSched_TICKS_PER_SEC 4000000U
+
+/* Returned by CANTxSched_process() when no frame is held by a rate limit */
+#define CANTxSched_NO_WAKEUP UINT64_MAX
+
+/* Writes a frame to the driver. Returns CAN_STATUS_TX_BUF_FULL if the driver
+ * cannot accept the frame, in which case it is retried after the next
+ * CANTxSched_txIdle() call.
+ */
+typedef int_fast16_t (*CANTxSched_WriteFxn)(void *arg, const CAN_TxBufElement *elem);
+
+/* Queue parameters */
+typedef struct
+{
+    uint32_t rateHz; /* Frames per second, 0 if not rate limited */
+    uint32_t burst;  /* Frames that may be sent back to back within the rate */
+} CANTxSched_QueueParams;
+
+/* Scheduler parameters */
+typedef struct
+{
+    CANTxSched_QueueParams queueParams[CANTxSched_NUM_QUEUES];
+    uint32_t maxInFlight; /* Frames written to the driver between Tx finished events */
+    CANTxSched_WriteFxn writeFxn;
+    void *arg;            /* Passed to writeFxn */
+} CANTxSched_Params;
+
+/* Queue statistics. Latencies are in 250ns ticks. */
+typedef struct
+{
+    uint32_t submittedCnt;  /* Frames queued */
+    uint32_t sentCnt;       /* Frames written to the driver */
+    uint32_t refusedCnt;    /* Frames refused because the queue was full */
+    uint32_t failedCnt;     /* Frames dropped because the driver returned an error */
+    uint32_t highWaterMark; /* Maximum number of queued frames */
+    uint32_t maxLatency;    /* Maximum time from submission to the driver */
+    uint64_t sumLatency;    /* Sum of all latencies, for computing the mean */
+} CANTxSched_QueueStats;
+
+/* Queue. The fields are private, except for stats. */
+typedef struct
+{
+    CANTxSched_QueueStats stats;
+    uint64_t interval;      /* Ticks per frame at the rate limit, 0 if not rate limited */
+    uint64_t burstTime;     /* Ticks a frame may be sent ahead of the rate */
+    uint64_t nextTime;      /* Time the rate allows the next frame at */
+    volatile uint32_t head; /* Free-running queue indices */
+    volatile uint32_t tail;
+    uint64_t submitTime[CANTxSched_QUEUE_SIZE];
+    CAN_TxBufElement elem[CANTxSched_QUEUE_SIZE];
+} CANTxSched_Queue;
+
+/* Scheduler object. The fields are private, except for the queue stats. */
+typedef struct
+{
+    CANTxSched_Queue queues[CANTxSched_NUM_QUEUES];
+    uint32_t maxInFlight;
+    volatile uint32_t inFlight; /* Frames written since the last Tx finished event */
+    CANTxSched_WriteFxn writeFxn;
+    void *arg;
+} CANTxSched_Object;
+
+/*
+ *  ======== CANTxSched_init ========
+ */
+extern void CANTxSched_init(CANTxSched_Object *obj, const CANTxSched_Params *params);
+
+/*
+ *  ======== CANTxSched_submit ========
+ *  Queues a frame on queue queueIdx. Returns CAN_STATUS_SUCCESS, or
+ *  CAN_STATUS_TX_BUF_FULL if the queue is full.
+ */
+extern int_fast16_t CANTxSched_submit(CANTxSched_Object *obj,
+                                      uint32_t queueIdx,
+                                      const CAN_TxBufElement *elem,
+                                      uint64_t now);
+
+/*
+ *  ======== CANTxSched_txIdle ========
+ *  Reports that the frames written to the driver have been transmitted, on
+ *  CAN_EVENT_TX_FINISHED or after the driver has been reopened.
+ */
+extern void CANTxSched_txIdle(CANTxSched_Object *obj);
+
+/*
+ *  ======== CANTxSched_process ========
+ *  Writes queued frames in priority order until maxInFlight frames are in
+ *  flight or the driver is full. Returns the time the next frame held by a
+ *  rate limit may be sent, or CANTxSched_NO_WAKEUP.
+ */
+extern uint64_t CANTxSched_process(CANTxSched_Object *obj, uint64_t now);
+
+/*
+ *  ======== CANTxSched_getCount ========
+ *  Returns the number of frames in queue queueIdx.
+ */
+extern uint32_t CANTxSched_getCount(const CANTxSched_Object *obj, uint32_t queueIdx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANTXSCHED_H_ */
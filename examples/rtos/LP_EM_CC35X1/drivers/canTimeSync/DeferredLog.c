@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== DeferredLog.c ========
+ */
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/* POSIX Header files */
+#include <semaphore.h>
+#include <unistd.h>
+
+/* Driver Header files */
+#include <ti/drivers/UART2.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include "DeferredLog.h"
+
+#define DeferredLog_INDEX_MASK (DeferredLog_SIZE - 1U)
+
+/* Time to wait for space in the UART2 Tx ring buffer */
+#define DeferredLog_UART_RETRY_USEC 1000U
+
+/* Cortex-M Data Watchpoint and Trace (DWT) cycle counter. A build without the
+ * Cortex-M registers, such as the host build, defines its own counter.
+ */
+#ifndef DWT_CYCCNT
+    #define DWT_CTRL           (*(volatile uint32_t *)0xE0001000U)
+    #define DWT_CYCCNT         (*(volatile uint32_t *)0xE0001004U)
+    #define DWT_CTRL_CYCCNTENA 0x00000001U
+    #define DEMCR              (*(volatile uint32_t *)0xE000EDFCU)
+    #define DEMCR_TRCENA       0x01000000U
+#endif
+
+/* Ring buffer of pending records */
+static DeferredLog_Record records[DeferredLog_SIZE];
+static volatile uint32_t head;
+static volatile uint32_t tail;
+
+static volatile DeferredLog_Stats stats;
+
+static UART2_Handle uart;
+static const char *const *formats;
+static uint32_t numFormats;
+
+/* Posted when a record is written to an empty ring buffer */
+static sem_t pendingSem;
+
+/* Rendered line buffer, only used by the formatter thread */
+static char line[DeferredLog_LINE_SIZE];
+
+/*
+ *  ======== DeferredLog_init ========
+ */
+void DeferredLog_init(UART2_Handle uart2Handle, const char *const *formatTable, uint32_t formatCount)
+{
+    uart       = uart2Handle;
+    formats    = formatTable;
+    numFormats = formatCount;
+    head       = 0U;
+    tail       = 0U;
+
+    stats.records        = 0U;
+    stats.dropped        = 0U;
+    stats.highWaterMark  = 0U;
+    stats.maxWriteCycles = 0U;
+
+    if (sem_init(&pendingSem, 0, 0) != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+    /* Enable the cycle counter used to measure DeferredLog_write() */
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+/*
+ *  ======== DeferredLog_write ========
+ */
+void DeferredLog_write(uint32_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3)
+{
+    DeferredLog_Record *record;
+    uint32_t startCycles;
+    uint32_t cycles;
+    uint32_t count;
+    uintptr_t hwiKey;
+
+    startCycles = DWT_CYCCNT;
+
+    /* Loggers may run in both task and interrupt context. The critical section
+     * only covers a handful of stores, so the interrupt latency it adds is
+     * bounded and much smaller than formatting a line.
+     */
+    hwiKey = HwiP_disable();
+
+    count = head - tail;
+
+    if (count >= DeferredLog_SIZE)
+    {
+        stats.dropped++;
+        HwiP_restore(hwiKey);
+        return;
+    }
+
+    record          = &records[head & DeferredLog_INDEX_MASK];
+    record->id      = id;
+    record->args[0] = arg0;
+    record->args[1] = arg1;
+    record->args[2] = arg2;
+    record->args[3] = arg3;
+
+    head = head + 1U;
+
+    stats.records++;
+    if (count >= stats.highWaterMark)
+    {
+        stats.highWaterMark = count + 1U;
+    }
+
+    cycles = DWT_CYCCNT - startCycles;
+    if (cycles > stats.maxWriteCycles)
+    {
+        stats.maxWriteCycles = cycles;
+    }
+
+    HwiP_restore(hwiKey);
+
+    /* The formatter drains the ring buffer completely before it blocks, so it
+     * only needs to be woken when the first record is added.
+     */
+    if (count == 0U)
+    {
+        sem_post(&pendingSem);
+    }
+}
+
+/*
+ *  ======== DeferredLog_getStats ========
+ */
+void DeferredLog_getStats(DeferredLog_Stats *snapshot)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    snapshot->records        = stats.records;
+    snapshot->dropped        = stats.dropped;
+    snapshot->highWaterMark  = stats.highWaterMark;
+    snapshot->maxWriteCycles = stats.maxWriteCycles;
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== writeLine ========
+ *  Writes the complete line to the UART, waiting for space in the UART2 Tx
+ *  ring buffer if necessary.
+ */
+static void writeLine(const char *buf, size_t len)
+{
+    size_t bytesWritten;
+
+    while (len > 0U)
+    {
+        bytesWritten = 0U;
+        UART2_write(uart, buf, len, &bytesWritten);
+
+        buf += bytesWritten;
+        len -= bytesWritten;
+
+        if (len > 0U)
+        {
+            usleep(DeferredLog_UART_RETRY_USEC);
+        }
+    }
+}
+
+/*
+ *  ======== DeferredLog_formatterThread ========
+ */
+void *DeferredLog_formatterThread(void *arg0)
+{
+    DeferredLog_Record record;
+    int len;
+    uintptr_t hwiKey;
+
+    while (1)
+    {
+        sem_wait(&pendingSem);
+
+        while (head != tail)
+        {
+            /* Release the slot only after the record has been copied */
+            hwiKey = HwiP_disable();
+            record = records[tail & DeferredLog_INDEX_MASK];
+            tail   = tail + 1U;
+            HwiP_restore(hwiKey);
+
+            if (record.id < numFormats)
+            {
+                len = snprintf(line,
+                               sizeof(line),
+                               formats[record.id],
+                               (unsigned int)record.args[0],
+                               (unsigned int)record.args[1],
+                               (unsigned int)record.args[2],
+                               (unsigned int)record.args[3]);
+            }
+            else
+            {
+                len = snprintf(line, sizeof(line), "> Unknown log record %u\r\n", (unsigned int)record.id);
+            }
+
+            if (len > 0)
+            {
+                if ((size_t)len >= sizeof(line))
+                {
+                    len = sizeof(line) - 1U;
+                }
+
+                writeLine(line, (size_t)len);
+            }
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== DeferredLog.h ========
+ *  Deferred binary logging.
+ *
+ *  Time-critical code (e.g. driver callbacks) logs a compact binary record
+ *  consisting of a message ID and up to DeferredLog_MAX_ARGS 32-bit arguments.
+ *  Records are stored in a ring buffer and rendered to text and written to the
+ *  UART later by a low-priority formatter thread, so the caller never pays for
+ *  sprintf() or UART2_write().
+ *
+ *  The message ID indexes a table of printf-style format strings supplied to
+ *  DeferredLog_init(). Every conversion in a format string must consume an
+ *  int-sized argument (e.g. %d, %u, %x, %08x).
+ */
+
+#ifndef DEFERREDLOG_H_
+#define DEFERREDLOG_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <ti/drivers/UART2.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of records in the ring buffer. Must be a power of two. */
+#ifndef DeferredLog_SIZE
+    #define DeferredLog_SIZE 64U
+#endif
+
+#if (DeferredLog_SIZE & (DeferredLog_SIZE - 1U)) != 0U
+    #error "DeferredLog_SIZE must be a power of two"
+#endif
+
+/* Maximum number of arguments per record */
+#define DeferredLog_MAX_ARGS 4U
+
+/* Size of the buffer a single record is rendered into */
+#define DeferredLog_LINE_SIZE 128U
+
+/* Binary log record */
+typedef struct
+{
+    uint32_t id;
+    uint32_t args[DeferredLog_MAX_ARGS];
+} DeferredLog_Record;
+
+/* Logging statistics */
+typedef struct
+{
+    uint32_t records;        /* Records written */
+    uint32_t dropped;        /* Records dropped because the ring buffer was full */
+    uint32_t highWaterMark;  /* Maximum number of records pending */
+    uint32_t maxWriteCycles; /* Maximum CPU cycles spent in DeferredLog_write() */
+} DeferredLog_Stats;
+
+/*
+ *  ======== DeferredLog_init ========
+ *  Initializes the log. Must be called before any other DeferredLog API.
+ *  The format table must remain valid for the lifetime of the application.
+ */
+extern void DeferredLog_init(UART2_Handle uart2Handle, const char *const *formatTable, uint32_t formatCount);
+
+/*
+ *  ======== DeferredLog_write ========
+ *  Appends a record to the ring buffer. May be called from any context,
+ *  including hardware interrupts. The execution time is bounded; if the ring
+ *  buffer is full, the record is dropped and counted.
+ */
+extern void DeferredLog_write(uint32_t id, uint32_t arg0, uint32_t arg1, uint32_t arg2, uint32_t arg3);
+
+/* Convenience macros for records with fewer arguments */
+#define DeferredLog_write0(id)             DeferredLog_write((id), 0U, 0U, 0U, 0U)
+#define DeferredLog_write1(id, a0)         DeferredLog_write((id), (uint32_t)(a0), 0U, 0U, 0U)
+#define DeferredLog_write2(id, a0, a1)     DeferredLog_write((id), (uint32_t)(a0), (uint32_t)(a1), 0U, 0U)
+#define DeferredLog_write3(id, a0, a1, a2) DeferredLog_write((id), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), 0U)
+#define DeferredLog_write4(id, a0, a1, a2, a3) \
+    DeferredLog_write((id), (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3))
+
+/*
+ *  ======== DeferredLog_getStats ========
+ *  Returns a snapshot of the logging statistics.
+ */
+extern void DeferredLog_getStats(DeferredLog_Stats *stats);
+
+/*
+ *  ======== DeferredLog_formatterThread ========
+ *  Thread function that renders pending records and writes them to the UART.
+ *  Should be created with a lower priority than any thread that logs.
+ */
+extern void *DeferredLog_formatterThread(void *arg0);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEFERREDLOG_H_ */
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== ScheduledAction.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/dpl/HwiP.h>
+
+#include <ti/devices/DeviceFamily.h>
+#include DeviceFamily_constructPath(inc/hw_evtsvt.h)
+#include DeviceFamily_constructPath(inc/hw_ints.h)
+#include DeviceFamily_constructPath(inc/hw_memmap.h)
+#include DeviceFamily_constructPath(inc/hw_systim.h)
+#include DeviceFamily_constructPath(inc/hw_types.h)
+
+#include "ScheduledAction.h"
+
+/*
+ * SYSTIM compare channel used by this module. Channel 0 is reserved for the
+ * kernel clock and the radio drivers use channels 2 to 4 on devices with a
+ * radio, so channel 1 is used by default. The channel event is routed to a
+ * CPU interrupt through the event fabric.
+ */
+#ifndef ScheduledAction_SYSTIM_CHANNEL_CC
+    #define ScheduledAction_SYSTIM_CHANNEL_CC SYSTIM_O_CH1CC
+    #define ScheduledAction_SYSTIM_EVENT      SYSTIM_IMASK_EV1
+    #define ScheduledAction_IRQ_SEL           EVTSVT_O_CPUIRQ1SEL
+    #define ScheduledAction_IRQ_PUBID         EVTSVT_CPUIRQ1SEL_PUBID_SYSTIM1
+    #define ScheduledAction_INT_NUM           INT_CPUIRQ1
+#endif
+
+#define SYSTIM_NOW() HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N)
+
+static HwiP_Struct hwiStruct;
+
+/* Pending action of a slot */
+typedef struct
+{
+    volatile bool pending;
+    volatile uint32_t target;
+    volatile bool late;
+    ScheduledAction_Fxn fxn;
+    uintptr_t arg;
+} Slot;
+
+static Slot slots[ScheduledAction_NUM_SLOTS];
+
+static volatile ScheduledAction_Stats stats[ScheduledAction_NUM_SLOTS];
+
+/*
+ *  ======== armCompare ========
+ *  Programs the compare channel with the earliest pending target time. Must
+ *  be called with interrupts disabled.
+ */
+static void armCompare(void)
+{
+    uint32_t target = 0U;
+    bool armed      = false;
+    uint32_t i;
+
+    for (i = 0U; i < ScheduledAction_NUM_SLOTS; i++)
+    {
+        if (slots[i].pending && (!armed || ((int32_t)(slots[i].target - target) < 0)))
+        {
+            target = slots[i].target;
+            armed  = true;
+        }
+    }
+
+    HWREG(SYSTIM_BASE + SYSTIM_O_ICLR) = ScheduledAction_SYSTIM_EVENT;
+
+    if (!armed)
+    {
+        HWREG(SYSTIM_BASE + SYSTIM_O_IMCLR) = ScheduledAction_SYSTIM_EVENT;
+        return;
+    }
+
+    HWREG(SYSTIM_BASE + ScheduledAction_SYSTIM_CHANNEL_CC) = target;
+    HWREG(SYSTIM_BASE + SYSTIM_O_IMSET)                    = ScheduledAction_SYSTIM_EVENT;
+
+    /* A compare only fires when the counter passes the compare value. If the
+     * target time was reached before the channel was armed, trigger the
+     * interrupt manually so the action still executes.
+     */
+    if (ScheduledAction_timeReached(SYSTIM_NOW(), target))
+    {
+        HwiP_post(ScheduledAction_INT_NUM);
+    }
+}
+
+/*
+ *  ======== ScheduledAction_hwiFxn ========
+ */
+static void ScheduledAction_hwiFxn(uintptr_t arg)
+{
+    volatile ScheduledAction_Stats *slotStats;
+    uint32_t now;
+    int32_t latency;
+    uint32_t i;
+
+    now = SYSTIM_NOW();
+
+    /* Disable and clear the compare event */
+    HWREG(SYSTIM_BASE + SYSTIM_O_IMCLR) = ScheduledAction_SYSTIM_EVENT;
+    HWREG(SYSTIM_BASE + SYSTIM_O_ICLR)  = ScheduledAction_SYSTIM_EVENT;
+
+    /* A stale compare event that arrives before any target time is ignored
+     * when the channel is armed again below.
+     */
+    for (i = 0U; i < ScheduledAction_NUM_SLOTS; i++)
+    {
+        if (!slots[i].pending || !ScheduledAction_timeReached(now, slots[i].target))
+        {
+            continue;
+        }
+
+        slots[i].pending = false;
+
+        latency   = (int32_t)(now - slots[i].target);
+        slotStats = &stats[i];
+
+        slotStats->count++;
+        if (slots[i].late)
+        {
+            slotStats->lateCount++;
+        }
+        slotStats->lastLatency = latency;
+        slotStats->sumLatency += latency;
+        if ((slotStats->count == 1U) || (latency < slotStats->minLatency))
+        {
+            slotStats->minLatency = latency;
+        }
+        if ((slotStats->count == 1U) || (latency > slotStats->maxLatency))
+        {
+            slotStats->maxLatency = latency;
+        }
+
+        slots[i].fxn(slots[i].arg);
+    }
+
+    armCompare();
+}
+
+/*
+ *  ======== ScheduledAction_init ========
+ */
+void ScheduledAction_init(void)
+{
+    HwiP_Params hwiParams;
+
+    memset(slots, 0, sizeof(slots));
+    memset((void *)stats, 0, sizeof(stats));
+
+    /* Route the SYSTIM channel event to the CPU interrupt */
+    HWREG(EVTSVT_BASE + ScheduledAction_IRQ_SEL) = ScheduledAction_IRQ_PUBID;
+
+    HWREG(SYSTIM_BASE + SYSTIM_O_IMCLR) = ScheduledAction_SYSTIM_EVENT;
+    HWREG(SYSTIM_BASE + SYSTIM_O_ICLR)  = ScheduledAction_SYSTIM_EVENT;
+
+    HwiP_Params_init(&hwiParams);
+    hwiParams.priority = ScheduledAction_INT_PRIORITY;
+    HwiP_construct(&hwiStruct, ScheduledAction_INT_NUM, ScheduledAction_hwiFxn, &hwiParams);
+}
+
+/*
+ *  ======== ScheduledAction_schedule ========
+ */
+int_fast16_t ScheduledAction_schedule(uint32_t targetTime, ScheduledAction_Fxn fxn, uintptr_t arg)
+{
+    return ScheduledAction_scheduleSlot(0U, targetTime, fxn, arg);
+}
+
+/*
+ *  ======== ScheduledAction_isPending ========
+ */
+bool ScheduledAction_isPending(void)
+{
+    return ScheduledAction_isSlotPending(0U);
+}
+
+/*
+ *  ======== ScheduledAction_getStats ========
+ */
+void ScheduledAction_getStats(ScheduledAction_Stats *snapshot)
+{
+    ScheduledAction_getSlotStats(0U, snapshot);
+}
+
+/*
+ *  ======== ScheduledAction_scheduleSlot ========
+ */
+int_fast16_t ScheduledAction_scheduleSlot(uint32_t slot, uint32_t targetTime, ScheduledAction_Fxn fxn, uintptr_t arg)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    if (slots[slot].pending)
+    {
+        HwiP_restore(hwiKey);
+        return ScheduledAction_STATUS_BUSY;
+    }
+
+    slots[slot].pending = true;
+    slots[slot].target  = targetTime;
+    slots[slot].fxn     = fxn;
+    slots[slot].arg     = arg;
+    slots[slot].late    = ScheduledAction_timeReached(SYSTIM_NOW(), targetTime);
+
+    armCompare();
+
+    HwiP_restore(hwiKey);
+
+    return ScheduledAction_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== ScheduledAction_advanceSlot ========
+ */
+void ScheduledAction_advanceSlot(uint32_t slot, uint32_t targetTime)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    if (slots[slot].pending && ((int32_t)(targetTime - slots[slot].target) < 0))
+    {
+        slots[slot].target = targetTime;
+        slots[slot].late   = ScheduledAction_timeReached(SYSTIM_NOW(), targetTime);
+
+        armCompare();
+    }
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== ScheduledAction_isSlotPending ========
+ */
+bool ScheduledAction_isSlotPending(uint32_t slot)
+{
+    return slots[slot].pending;
+}
+
+/*
+ *  ======== ScheduledAction_getSlotStats ========
+ */
+void ScheduledAction_getSlotStats(uint32_t slot, ScheduledAction_Stats *snapshot)
+{
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    snapshot->count       = stats[slot].count;
+    snapshot->lateCount   = stats[slot].lateCount;
+    snapshot->lastLatency = stats[slot].lastLatency;
+    snapshot->minLatency  = stats[slot].minLatency;
+    snapshot->maxLatency  = stats[slot].maxLatency;
+    snapshot->sumLatency  = stats[slot].sumLatency;
+
+    HwiP_restore(hwiKey);
+}
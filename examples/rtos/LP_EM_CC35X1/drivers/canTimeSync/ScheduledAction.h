@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== ScheduledAction.h ========
+ *  Executes a callback at an absolute system timer (SYSTIM) time.
+ *
+ *  The target time is programmed into a SYSTIM compare channel and the
+ *  callback is executed from the compare interrupt, so interrupts are not held
+ *  off while waiting for the target time. All time comparisons use the signed
+ *  difference of two 32-bit 250ns tick values, so scheduling keeps working
+ *  when the SYSTIM counter wraps (every ~17.9 minutes), provided the target is
+ *  less than 2^31 ticks (~8.9 minutes) away.
+ *
+ *  Actions are scheduled in slots, one pending action per slot. The compare
+ *  channel is programmed with the earliest target time of the pending
+ *  actions, so the slots share the channel and its interrupt. The functions
+ *  without a slot argument use slot 0.
+ */
+
+#ifndef SCHEDULEDACTION_H_
+#define SCHEDULEDACTION_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ScheduledAction_STATUS_SUCCESS 0
+#define ScheduledAction_STATUS_BUSY    (-1)
+
+/* Number of slots */
+#ifndef ScheduledAction_NUM_SLOTS
+    #define ScheduledAction_NUM_SLOTS 2U
+#endif
+
+/*
+ * Interrupt priority of the compare interrupt, where lower values are higher
+ * priorities. The callbacks run in this interrupt and may call kernel
+ * functions such as sem_post(), so the priority must not be higher than the
+ * kernel's configMAX_SYSCALL_INTERRUPT_PRIORITY. A higher priority would only
+ * lower the latency of the actions if the callbacks made no kernel calls. The
+ * example's main_freertos.c checks the priority against the kernel
+ * configuration.
+ */
+#ifndef ScheduledAction_INT_PRIORITY
+    #define ScheduledAction_INT_PRIORITY 0x20U
+#endif
+
+/* Callback executed in interrupt context when the target time is reached */
+typedef void (*ScheduledAction_Fxn)(uintptr_t arg);
+
+/*
+ * Scheduling statistics of a slot. Latency is the time from the target time until the
+ * compare interrupt executed the callback, in 250ns SYSTIM ticks.
+ */
+typedef struct
+{
+    uint32_t count;       /* Actions executed */
+    uint32_t lateCount;   /* Actions whose target time had passed when scheduled */
+    int32_t lastLatency;  /* Latency of the most recent action */
+    int32_t minLatency;   /* Minimum latency */
+    int32_t maxLatency;   /* Maximum latency */
+    int64_t sumLatency;   /* Sum of all latencies, for computing the mean */
+} ScheduledAction_Stats;
+
+/*
+ *  ======== ScheduledAction_init ========
+ *  Configures the SYSTIM compare channel and its interrupt.
+ */
+extern void ScheduledAction_init(void);
+
+/*
+ *  ======== ScheduledAction_schedule ========
+ *  Schedules fxn(arg) to execute at the SYSTIM 250ns tick value targetTime.
+ *  If the target time has already passed, the action executes as soon as
+ *  possible and is counted as late. Only one action may be pending at a time;
+ *  ScheduledAction_STATUS_BUSY is returned if an action is already pending.
+ */
+extern int_fast16_t ScheduledAction_schedule(uint32_t targetTime, ScheduledAction_Fxn fxn, uintptr_t arg);
+
+/*
+ *  ======== ScheduledAction_isPending ========
+ *  Returns true if an action is scheduled but has not executed yet.
+ */
+extern bool ScheduledAction_isPending(void);
+
+/*
+ *  ======== ScheduledAction_getStats ========
+ *  Returns a snapshot of the scheduling statistics.
+ */
+extern void ScheduledAction_getStats(ScheduledAction_Stats *stats);
+
+/*
+ *  ======== ScheduledAction_scheduleSlot ========
+ *  Same as ScheduledAction_schedule(), for the action in slot. The action may
+ *  schedule the next action of its slot.
+ */
+extern int_fast16_t ScheduledAction_scheduleSlot(uint32_t slot,
+                                                 uint32_t targetTime,
+                                                 ScheduledAction_Fxn fxn,
+                                                 uintptr_t arg);
+
+/*
+ *  ======== ScheduledAction_advanceSlot ========
+ *  Moves the pending action of slot to targetTime if that is earlier than its
+ *  current target time. Does nothing if the slot is not pending or the new
+ *  target time is later.
+ */
+extern void ScheduledAction_advanceSlot(uint32_t slot, uint32_t targetTime);
+
+/*
+ *  ======== ScheduledAction_isSlotPending ========
+ */
+extern bool ScheduledAction_isSlotPending(uint32_t slot);
+
+/*
+ *  ======== ScheduledAction_getSlotStats ========
+ */
+extern void ScheduledAction_getSlotStats(uint32_t slot, ScheduledAction_Stats *stats);
+
+/*
+ *  ======== ScheduledAction_timeReached ========
+ *  Wrap-safe check of whether SYSTIM time 'now' is at or after 'target'.
+ */
+static inline bool ScheduledAction_timeReached(uint32_t now, uint32_t target)
+{
+    return ((int32_t)(now - target) >= 0);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHEDULEDACTION_H_ */
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TimeSyncServo.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "TimeSyncServo.h"
+
+/* Nanoseconds per 250ns SYSTIM tick */
+#define NSEC_PER_TICK 250
+
+#define PPB 1000000000LL
+
+/*
+ *  ======== isqrt64 ========
+ *  Integer square root.
+ */
+static uint32_t isqrt64(uint64_t value)
+{
+    uint64_t root = 0U;
+    uint64_t bit  = 1ULL << 62;
+
+    while (bit > value)
+    {
+        bit >>= 2;
+    }
+
+    while (bit != 0U)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
+
+/*
+ *  ======== predict ========
+ *  Returns the network time for localTime using the current model.
+ */
+static uint32_t predict(const TimeSyncServo_Object *obj, uint32_t localTime)
+{
+    int32_t elapsed = (int32_t)(localTime - obj->localRef);
+
+    return obj->masterRef + (uint32_t)elapsed + (uint32_t)(((int64_t)elapsed * obj->freqPpb) / PPB);
+}
+
+/*
+ *  ======== TimeSyncServo_construct ========
+ */
+void TimeSyncServo_construct(TimeSyncServo_Object *obj)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->state = TimeSyncServo_State_UNLOCKED;
+}
+
+/*
+ *  ======== TimeSyncServo_reset ========
+ */
+void TimeSyncServo_reset(TimeSyncServo_Object *obj)
+{
+    obj->state            = TimeSyncServo_State_UNLOCKED;
+    obj->freqPpb          = 0;
+    obj->samples          = 0U;
+    obj->sumOffset        = 0;
+    obj->sumSquaredOffset = 0U;
+    obj->maxOffset        = 0U;
+}
+
+/*
+ *  ======== TimeSyncServo_update ========
+ */
+int32_t TimeSyncServo_update(TimeSyncServo_Object *obj, uint32_t localTime, uint32_t masterTime)
+{
+    int32_t offset;
+    int32_t interval;
+    uint32_t absOffset;
+    int64_t freqError;
+
+    if (obj->state == TimeSyncServo_State_UNLOCKED)
+    {
+        /* First sample: adopt the master offset */
+        offset    = 0;
+        obj->localRef  = localTime;
+        obj->masterRef = masterTime;
+        obj->freqPpb   = 0;
+        obj->state     = TimeSyncServo_State_LOCKING;
+    }
+    else if (obj->state == TimeSyncServo_State_LOCKING)
+    {
+        /* Second sample: estimate the frequency from the two samples */
+        offset   = (int32_t)(masterTime - predict(obj, localTime));
+        interval = (int32_t)(localTime - obj->prevLocalTime);
+
+        if (interval > 0)
+        {
+            obj->freqPpb = (int32_t)(((int64_t)(int32_t)((masterTime - obj->prevMasterTime) - (uint32_t)interval) *
+                                      PPB) /
+                                     interval);
+        }
+
+        obj->localRef  = localTime;
+        obj->masterRef = masterTime;
+        obj->state     = TimeSyncServo_State_LOCKED;
+    }
+    else
+    {
+        offset   = (int32_t)(masterTime - predict(obj, localTime));
+        interval = (int32_t)(localTime - obj->localRef);
+
+        if ((offset > TimeSyncServo_STEP_THRESHOLD) || (offset < -TimeSyncServo_STEP_THRESHOLD) || (interval <= 0))
+        {
+            /* The master time stepped or the sample is invalid. Start over
+             * from this sample.
+             */
+            obj->resets++;
+            TimeSyncServo_reset(obj);
+            return TimeSyncServo_update(obj, localTime, masterTime);
+        }
+
+        /* Statistics describe the offset before it is corrected */
+        absOffset = (offset < 0) ? (uint32_t)-offset : (uint32_t)offset;
+
+        obj->samples++;
+        obj->sumOffset += offset;
+        obj->sumSquaredOffset += (uint64_t)((int64_t)offset * offset);
+        if (absOffset > obj->maxOffset)
+        {
+            obj->maxOffset = absOffset;
+        }
+
+        /* Integral term: correct the frequency by a fraction of the frequency
+         * error seen over the interval since the last sample.
+         */
+        freqError = ((int64_t)offset * PPB) / interval;
+        obj->freqPpb += (int32_t)((freqError * TimeSyncServo_KI_NUM) / TimeSyncServo_KI_DEN);
+
+        /* Proportional term: remove a fraction of the offset */
+        obj->masterRef = predict(obj, localTime) + (uint32_t)((offset * TimeSyncServo_KP_NUM) / TimeSyncServo_KP_DEN);
+        obj->localRef  = localTime;
+    }
+
+    obj->prevLocalTime  = localTime;
+    obj->prevMasterTime = masterTime;
+
+    return offset;
+}
+
+/*
+ *  ======== TimeSyncServo_getNetworkTime ========
+ */
+uint32_t TimeSyncServo_getNetworkTime(const TimeSyncServo_Object *obj, uint32_t localTime)
+{
+    if (obj->state == TimeSyncServo_State_UNLOCKED)
+    {
+        return localTime;
+    }
+
+    return predict(obj, localTime);
+}
+
+/*
+ *  ======== TimeSyncServo_getState ========
+ */
+TimeSyncServo_State TimeSyncServo_getState(const TimeSyncServo_Object *obj)
+{
+    return obj->state;
+}
+
+/*
+ *  ======== TimeSyncServo_getStats ========
+ */
+void TimeSyncServo_getStats(const TimeSyncServo_Object *obj, TimeSyncServo_Stats *stats)
+{
+    int64_t meanNs        = 0;
+    int64_t meanSquaredNs = 0;
+    uint64_t varianceNs   = 0U;
+
+    if (obj->samples > 0U)
+    {
+        meanNs        = (obj->sumOffset * NSEC_PER_TICK) / (int64_t)obj->samples;
+        meanSquaredNs = (int64_t)((obj->sumSquaredOffset * NSEC_PER_TICK * NSEC_PER_TICK) / obj->samples);
+
+        /* Guard against rounding making the variance negative */
+        if (meanSquaredNs > meanNs * meanNs)
+        {
+            varianceNs = (uint64_t)(meanSquaredNs - (meanNs * meanNs));
+        }
+    }
+
+    stats->samples        = obj->samples;
+    stats->resets         = obj->resets;
+    stats->meanOffsetNs   = (int32_t)meanNs;
+    stats->maxOffsetNs    = obj->maxOffset * NSEC_PER_TICK;
+    stats->stddevOffsetNs = isqrt64(varianceNs);
+    stats->freqPpb        = obj->freqPpb;
+}
@@ -34,9 +34,10 @@
  *  ======== canTimeSync.c ========
  */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 /* POSIX Header files */
 #include <pthread.h>
@@ -47,18 +48,26 @@
 #include <ti/drivers/GPIO.h>
 #include <ti/drivers/UART2.h>
 #include <ti/drivers/apps/Button.h>
+#include <ti/drivers/dpl/HwiP.h>
 
 #include <ti/devices/DeviceFamily.h>
-#include DeviceFamily_constructPath(inc/hw_memmap.h)
-#include DeviceFamily_constructPath(inc/hw_systim.h)
-#include DeviceFamily_constructPath(inc/hw_types.h)
 
 /* Driver configuration */
 #include "ti_drivers_config.h"
 
+#include "CANCodec.h"
+#include "CANDispatch.h"
+#include "CANRecovery.h"
+#include "CANSchedule.h"
+#include "CANStats.h"
+#include "CANTimestamp.h"
+#include "CANTxSched.h"
+#include "DeferredLog.h"
+#include "ScheduledAction.h"
+#include "TimeSyncServo.h"
+
 /* Defines */
-#define THREAD_STACK_SIZE    1024U
-#define UART_MSG_BUFFER_SIZE 512U
+#define THREAD_STACK_SIZE 1024U
 
 /* Message ID for time sync messages */
 #define CAN_TIME_SYNC_MSG_ID 0x2
@@ -66,14 +75,104 @@
 /* Message ID for non-time sync messages */
 #define CAN_NON_TIME_SYNC_MSG_ID (CAN_TIME_SYNC_MSG_ID + 1U)
 
+/* Message ID for time sync follow-up messages. A follow-up carries the master's
+ * SOF time of the preceding time sync message (little-endian, bytes 0-3) and
+ * the sequence number of that time sync message (byte 4).
+ */
+#define CAN_TIME_SYNC_FOLLOW_UP_MSG_ID (CAN_TIME_SYNC_MSG_ID + 2U)
+
+/* Time sync message payload: sequence number */
+#define TIME_SYNC_MSG_DLC CAN_DLC_1B
+
+/* Follow-up message payload: SOF time and sequence number */
+#define TIME_SYNC_FOLLOW_UP_MSG_DLC CAN_DLC_5B
+
+/* Follow-up message payload position of the sequence number */
+#define TIME_SYNC_FOLLOW_UP_SEQ_IDX 4U
+
+/* Message RAM element counts used with the acceptance filters built from the
+ * dispatch table on devices with an MCAN peripheral.
+ */
+#define MSG_RAM_RX_FIFO_NUM       8U
+#define MSG_RAM_TX_FIFO_Q_NUM     6U
+#define MSG_RAM_TX_EVENT_FIFO_NUM 6U
+
+/* Interval between time sync messages sent without a button press, in
+ * milliseconds. Set to 0 to only send time sync messages when BTN-1 is pressed.
+ * Enable this on the master node only.
+ */
+#ifndef TIME_SYNC_INTERVAL_MS
+    #define TIME_SYNC_INTERVAL_MS 0U
+#endif
+
+/* Time to wait for the Tx Event of a time sync message, including bus off recovery */
+#define TX_TIMEOUT_MS 1000U
+
+/* Transmit scheduler queues. Frames are passed to the driver in CAN ID
+ * priority order, so time sync messages are not delayed by queued bulk data.
+ */
+#define TX_QUEUE_TIME_SYNC 0U /* Time sync and follow-up messages */
+#define TX_QUEUE_REGULAR   1U /* Regular messages */
+#define TX_QUEUE_BULK      2U /* Bulk data, rate limited */
+#define TX_QUEUE_CYCLIC    3U /* Cyclic messages released by the schedule */
+
+/* Frames written to the driver between Tx finished events. A time sync message
+ * waits for at most this many frames already passed to the driver.
+ */
+#define TX_SCHED_MAX_IN_FLIGHT 1U
+
+/* Transmit scheduler thread priority, above the main thread */
+#define TX_SCHED_THREAD_PRIORITY 2
+
+/* Message ID for bulk data messages, lower priority than the time sync messages */
+#define CAN_BULK_MSG_ID 0x100U
+
+/* Rate of the bulk data messages generated as background load, in messages
+ * per second, and the number of messages that may be sent back to back. Set
+ * the rate to 0 to disable the bulk data messages.
+ */
+#ifndef TX_BULK_RATE_HZ
+    #define TX_BULK_RATE_HZ 0U
+#endif
+#define TX_BULK_BURST 4U
+
+/* Set to 1 to send the messages of the cyclic schedule table, cyclicEntries.
+ * They are released at fixed offsets in network time, so the schedules of
+ * synchronized nodes are aligned. Enable this on one node only, as each
+ * message ID must be sent by a single node.
+ */
+#ifndef CYCLIC_SCHEDULE_ENABLE
+    #define CYCLIC_SCHEDULE_ENABLE 0
+#endif
+
+/* ScheduledAction slot that wakes the transmit scheduler thread for the next
+ * cyclic release. Slot 0 toggles the LED.
+ */
+#define CYCLIC_RELEASE_SLOT 1U
+
+/* Message IDs of the cyclic messages, between the time sync and the bulk data
+ * message IDs in priority.
+ */
+#define CAN_CYCLIC_1MS_MSG_ID   0x20U
+#define CAN_CYCLIC_10MS_MSG_ID  0x21U
+#define CAN_CYCLIC_100MS_MSG_ID 0x22U
+
+/* Bus off recovery configuration. Messages submitted while the bus is off are
+ * held in the transmit scheduler queues and sent once the bus is recovered.
+ */
+#define RECOVERY_MIN_BACKOFF_MS   100U   /* Backoff time after the first bus off */
+#define RECOVERY_MAX_BACKOFF_MS   5000U  /* Backoff time limit for repeated bus offs */
+#define RECOVERY_STABLE_TIME_MS   10000U /* Bus on time after which the backoff time is reset */
+#define RECOVERY_POLL_INTERVAL_MS 10U    /* Time between recovery checks while waiting */
+
 /* Number of microseconds after the time sync message Start Of Frame to toggle LED1 */
 #define SOF_TO_LED_TOGGLE_USEC 500U
 
 /* Microseconds to 250ns system timer tick conversion macro */
 #define USEC_TO_SYSTIM(usec) (usec * 4U) /* Four 250ns system timer ticks per 1us */
 
-/* Picoseconds to 250ns system timer tick conversion macro */
-#define PSEC_TO_SYSTIM(psec) ((psec * 4U) / 1000000U) /* Four 250ns system timer ticks per 1 million ps */
+/* 250ns system timer ticks to nanoseconds conversion macro */
+#define SYSTIM_TO_NSEC(ticks) ((ticks) * 250)
 
 /* External timestamp counter rate is the Host System Clock (96 MHz) divided by
  * the timestamp prescaler. A timestamp prescaler of 24 was chosen to match the
@@ -86,22 +185,255 @@
      CAN_EVENT_BUS_ON | CAN_EVENT_BUS_OFF | CAN_EVENT_ERR_ACTIVE | CAN_EVENT_ERR_PASSIVE |                  \
      CAN_EVENT_RX_FIFO_MSG_LOST | CAN_EVENT_RX_RING_BUFFER_FULL | CAN_EVENT_BIT_ERR_UNCORRECTED)
 
-#define DLC_TABLE_SIZE 16U
+/* Set to 1 to log through the ti/log framework instead of the deferred log
+ * formatter thread. Each log call then only emits a token and its raw
+ * argument words through the ITM log sink configured in
+ * canTimeSync_tokenized.syscfg, which must be used instead of
+ * canTimeSync.syscfg (make TOKENIZED_LOG=1 selects both). The token
+ * is the address of the format string in the .log_data section, which is
+ * placed off target by the linker, so the format strings take no flash. The
+ * messages are rebuilt on the host from the executable by the tilogger tool
+ * of the SDK. The UART is not used in this mode.
+ */
+#ifndef CAN_TIMESYNC_TOKENIZED_LOG
+    #define CAN_TIMESYNC_TOKENIZED_LOG 0
+#endif
+
+#if CAN_TIMESYNC_TOKENIZED_LOG
+    /* Log_printf() and Log_buf() are compiled out unless this is defined */
+    #define ti_log_Log_ENABLE
+    #include <ti/log/Log.h>
 
-/* Payload bytes indexed by Data Length Code (DLC) field. */
-static const uint32_t dlcToDataSize[DLC_TABLE_SIZE] =
-    {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 12U, 16U, 20U, 24U, 32U, 48U, 64U};
+Log_MODULE_USE(LogModule_App1);
+#endif /* CAN_TIMESYNC_TOKENIZED_LOG */
+
+/* Maximum number of payload bytes logged per deferred log record */
+#define LOG_DATA_BYTES_PER_RECORD 4U
+
+/* Deferred log message IDs. Each ID indexes logFormats[]. */
+enum LogId
+{
+    LOG_TX_FINISHED,
+    LOG_TX_EVENT_LOST,
+    LOG_BUS_ON,
+    LOG_BUS_OFF,
+    LOG_ERR_ACTIVE,
+    LOG_ERR_PASSIVE,
+    LOG_RX_FIFO_MSG_LOST,
+    LOG_RX_RING_BUFFER_FULL,
+    LOG_BIT_ERR_UNCORRECTED,
+    LOG_SPI_XFER_ERROR,
+    LOG_UNDEFINED_EVENT,
+    LOG_TX_EVENT_READ_FAILED,
+    LOG_UNEXPECTED_TX_EVENT_ID,
+    LOG_TX_EVENT,
+    LOG_TIME_SYNC_RX,
+    LOG_RX_MSG_CNT,
+    LOG_RX_MSG_HEADER,
+    LOG_RX_MSG_FLAGS,
+    LOG_RX_DATA_LEN,
+    LOG_RX_DATA_1B,
+    LOG_RX_DATA_2B,
+    LOG_RX_DATA_3B,
+    LOG_RX_DATA_4B,
+    LOG_RX_DATA_END,
+    LOG_CAN_OPEN_FAILED,
+    LOG_READY,
+    LOG_SENDING_TIME_SYNC,
+    LOG_SENDING_REGULAR,
+    LOG_STATS,
+    LOG_LED_TOGGLED,
+    LOG_LED_TOGGLE_BUSY,
+    LOG_FOLLOW_UP_SENT,
+    LOG_FOLLOW_UP_INVALID,
+    LOG_FOLLOW_UP_SEQ_MISMATCH,
+    LOG_SERVO_SAMPLE,
+    LOG_SERVO_STATS,
+    LOG_CAN_STATS,
+    LOG_CAN_ERRORS,
+    LOG_RECOVERY_STATS,
+    LOG_TX_FAILED,
+    LOG_TX_QUEUE_STATS,
+    LOG_CYCLIC_SCHEDULE,
+    LOG_CYCLIC_STATS,
+    LOG_ID_COUNT
+};
+
+/* Deferred log format strings, one per LogId */
+#define LOG_TX_FINISHED_FMT            "> Tx Finished. Cnt = %u\r\n\n"
+#define LOG_TX_EVENT_LOST_FMT          "> Tx Event Lost. Cnt = %u\r\n\n"
+#define LOG_BUS_ON_FMT                 "> Bus On\r\n\n"
+#define LOG_BUS_OFF_FMT                "> Bus Off\r\n\n"
+#define LOG_ERR_ACTIVE_FMT             "> Error Active\r\n\n"
+#define LOG_ERR_PASSIVE_FMT            "> Error Passive\r\n\n"
+#define LOG_RX_FIFO_MSG_LOST_FMT       "> Rx FIFO %u message lost\r\n\n"
+#define LOG_RX_RING_BUFFER_FULL_FMT    "> Rx ring buffer full: Cnt = %u\r\n\n"
+#define LOG_BIT_ERR_UNCORRECTED_FMT    "> Uncorrected bit error\r\n\n"
+#define LOG_SPI_XFER_ERROR_FMT         "> SPI transfer error: status = 0x%x\r\n\n"
+#define LOG_UNDEFINED_EVENT_FMT        "> Undefined event\r\n\n"
+#define LOG_TX_EVENT_READ_FAILED_FMT   "> Failed to read Tx Event\r\n\n"
+#define LOG_UNEXPECTED_TX_EVENT_ID_FMT "> Unexpected time sync msg ID: 0x%x\r\n\n"
+#define LOG_TX_EVENT_FMT               "> Tx Event. TXTS = 0x%04x, SOF time = 0x%08x\r\n\n"
+#define LOG_TIME_SYNC_RX_FMT           "> Time Sync msg Rx'ed. RXTS = 0x%04x, SOF time = 0x%08x\r\n\n"
+#define LOG_RX_MSG_CNT_FMT             "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n"
+#define LOG_RX_MSG_HEADER_FMT          "Msg ID: 0x%x\r\nTS: 0x%04x\r\n"
+#ifndef CAN_SUPPORTS_DCAN
+    #define LOG_RX_MSG_FLAGS_FMT       "CAN FD: %u\r\nDLC: %u\r\nBRS: %u\r\nESI: %u\r\n"
+#else
+    #define LOG_RX_MSG_FLAGS_FMT       "DLC: %u\r\nESI: %u\r\n"
+#endif /* CAN_SUPPORTS_DCAN */
+#define LOG_RX_DATA_LEN_FMT            "Data[%u]: "
+#define LOG_RX_DATA_1B_FMT             "%02X "
+#define LOG_RX_DATA_2B_FMT             "%02X %02X "
+#define LOG_RX_DATA_3B_FMT             "%02X %02X %02X "
+#define LOG_RX_DATA_4B_FMT             "%02X %02X %02X %02X "
+#define LOG_RX_DATA_END_FMT            "\r\n\n"
+#define LOG_CAN_OPEN_FAILED_FMT        "\r\nError opening CAN driver!\r\n"
+#define LOG_READY_FMT                  "\r\nCAN Time Sync ready.\r\n" \
+                                       "Press BTN-1 to send time sync msg or BTN-2 to send a regular msg...\r\n\n"
+#define LOG_SENDING_TIME_SYNC_FMT      "\r\nSending time sync message...\r\n\n"
+#define LOG_SENDING_REGULAR_FMT        "\r\nSending regular message...\r\n\n"
+#define LOG_STATS_FMT                  "> Log: %u records, %u dropped, %u max pending, %u max write cycles\r\n\n"
+#define LOG_LED_TOGGLED_FMT            "> LED toggle latency (250ns ticks): " \
+                                       "last = %d, min = %d, max = %d, late = %u\r\n\n"
+#define LOG_LED_TOGGLE_BUSY_FMT        "> LED toggle at 0x%08x skipped, previous toggle still pending\r\n\n"
+#define LOG_FOLLOW_UP_SENT_FMT         "> Follow-up sent. Seq = %u, SOF time = 0x%08x\r\n\n"
+#define LOG_FOLLOW_UP_INVALID_FMT      "> Follow-up for seq %u not sent, no Tx Event for the time sync msg\r\n\n"
+#define LOG_FOLLOW_UP_SEQ_MISMATCH_FMT "> Follow-up seq %u does not match time sync seq %u\r\n\n"
+#define LOG_SERVO_SAMPLE_FMT           "> Servo: offset = %d ns, freq = %d ppb, state = %u\r\n\n"
+#define LOG_SERVO_STATS_FMT            "> Sync accuracy over %u samples: " \
+                                       "mean = %d ns, max = %u ns, stddev = %u ns\r\n\n"
+#define LOG_CAN_STATS_FMT              "> CAN: load %u.%u%%, Rx %u frames, Tx %u frames\r\n"
+#define LOG_CAN_ERRORS_FMT             "> CAN errors: bus off %u (%u ms), err passive %u (%u ms)\r\n\n"
+#define LOG_RECOVERY_STATS_FMT         "> Recovery: restarts %u (%u failed), down %u ms, dropped %u\r\n\n"
+#define LOG_TX_FAILED_FMT              "> Msg ID 0x%x not sent: status = %d\r\n\n"
+#define LOG_TX_QUEUE_STATS_FMT         "> Tx queue %u: sent %u, latency avg %u us, max %u us\r\n"
+#define LOG_CYCLIC_SCHEDULE_FMT        "> Cyclic schedule: %u msgs, load %u.%u%%, feasible = %u\r\n\n"
+#define LOG_CYCLIC_STATS_FMT           "> Cyclic ID 0x%x: missed %u, release delay avg %u ns, max %u ns\r\n"
+
+/* Log calls. The ID selects the format string at compile time, so in
+ * tokenized mode the string is a literal that Log_printf() places in
+ * .log_data.
+ */
+#if CAN_TIMESYNC_TOKENIZED_LOG
+    #define LOG_WRITE0(id)             Log_printf(LogModule_App1, Log_INFO, id##_FMT)
+    #define LOG_WRITE1(id, a0)         Log_printf(LogModule_App1, Log_INFO, id##_FMT, (uint32_t)(a0))
+    #define LOG_WRITE2(id, a0, a1)     Log_printf(LogModule_App1, Log_INFO, id##_FMT, (uint32_t)(a0), (uint32_t)(a1))
+    #define LOG_WRITE3(id, a0, a1, a2) \
+        Log_printf(LogModule_App1, Log_INFO, id##_FMT, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2))
+    #define LOG_WRITE4(id, a0, a1, a2, a3) \
+        Log_printf(LogModule_App1, Log_INFO, id##_FMT, (uint32_t)(a0), (uint32_t)(a1), (uint32_t)(a2), (uint32_t)(a3))
+#else
+    #define LOG_WRITE0(id)                 DeferredLog_write0(id)
+    #define LOG_WRITE1(id, a0)             DeferredLog_write1(id, a0)
+    #define LOG_WRITE2(id, a0, a1)         DeferredLog_write2(id, a0, a1)
+    #define LOG_WRITE3(id, a0, a1, a2)     DeferredLog_write3(id, a0, a1, a2)
+    #define LOG_WRITE4(id, a0, a1, a2, a3) DeferredLog_write4(id, a0, a1, a2, a3)
+#endif /* CAN_TIMESYNC_TOKENIZED_LOG */
+
+#if !CAN_TIMESYNC_TOKENIZED_LOG
+
+/* Deferred log format strings, indexed by LogId */
+static const char *const logFormats[LOG_ID_COUNT] = {
+    [LOG_TX_FINISHED]            = LOG_TX_FINISHED_FMT,
+    [LOG_TX_EVENT_LOST]          = LOG_TX_EVENT_LOST_FMT,
+    [LOG_BUS_ON]                 = LOG_BUS_ON_FMT,
+    [LOG_BUS_OFF]                = LOG_BUS_OFF_FMT,
+    [LOG_ERR_ACTIVE]             = LOG_ERR_ACTIVE_FMT,
+    [LOG_ERR_PASSIVE]            = LOG_ERR_PASSIVE_FMT,
+    [LOG_RX_FIFO_MSG_LOST]       = LOG_RX_FIFO_MSG_LOST_FMT,
+    [LOG_RX_RING_BUFFER_FULL]    = LOG_RX_RING_BUFFER_FULL_FMT,
+    [LOG_BIT_ERR_UNCORRECTED]    = LOG_BIT_ERR_UNCORRECTED_FMT,
+    [LOG_SPI_XFER_ERROR]         = LOG_SPI_XFER_ERROR_FMT,
+    [LOG_UNDEFINED_EVENT]        = LOG_UNDEFINED_EVENT_FMT,
+    [LOG_TX_EVENT_READ_FAILED]   = LOG_TX_EVENT_READ_FAILED_FMT,
+    [LOG_UNEXPECTED_TX_EVENT_ID] = LOG_UNEXPECTED_TX_EVENT_ID_FMT,
+    [LOG_TX_EVENT]               = LOG_TX_EVENT_FMT,
+    [LOG_TIME_SYNC_RX]           = LOG_TIME_SYNC_RX_FMT,
+    [LOG_RX_MSG_CNT]             = LOG_RX_MSG_CNT_FMT,
+    [LOG_RX_MSG_HEADER]          = LOG_RX_MSG_HEADER_FMT,
+    [LOG_RX_MSG_FLAGS]           = LOG_RX_MSG_FLAGS_FMT,
+    [LOG_RX_DATA_LEN]            = LOG_RX_DATA_LEN_FMT,
+    [LOG_RX_DATA_1B]             = LOG_RX_DATA_1B_FMT,
+    [LOG_RX_DATA_2B]             = LOG_RX_DATA_2B_FMT,
+    [LOG_RX_DATA_3B]             = LOG_RX_DATA_3B_FMT,
+    [LOG_RX_DATA_4B]             = LOG_RX_DATA_4B_FMT,
+    [LOG_RX_DATA_END]            = LOG_RX_DATA_END_FMT,
+    [LOG_CAN_OPEN_FAILED]        = LOG_CAN_OPEN_FAILED_FMT,
+    [LOG_READY]                  = LOG_READY_FMT,
+    [LOG_SENDING_TIME_SYNC]      = LOG_SENDING_TIME_SYNC_FMT,
+    [LOG_SENDING_REGULAR]        = LOG_SENDING_REGULAR_FMT,
+    [LOG_STATS]                  = LOG_STATS_FMT,
+    [LOG_LED_TOGGLED]            = LOG_LED_TOGGLED_FMT,
+    [LOG_LED_TOGGLE_BUSY]        = LOG_LED_TOGGLE_BUSY_FMT,
+    [LOG_FOLLOW_UP_SENT]         = LOG_FOLLOW_UP_SENT_FMT,
+    [LOG_FOLLOW_UP_INVALID]      = LOG_FOLLOW_UP_INVALID_FMT,
+    [LOG_FOLLOW_UP_SEQ_MISMATCH] = LOG_FOLLOW_UP_SEQ_MISMATCH_FMT,
+    [LOG_SERVO_SAMPLE]           = LOG_SERVO_SAMPLE_FMT,
+    [LOG_SERVO_STATS]            = LOG_SERVO_STATS_FMT,
+    [LOG_CAN_STATS]              = LOG_CAN_STATS_FMT,
+    [LOG_CAN_ERRORS]             = LOG_CAN_ERRORS_FMT,
+    [LOG_RECOVERY_STATS]         = LOG_RECOVERY_STATS_FMT,
+    [LOG_TX_FAILED]              = LOG_TX_FAILED_FMT,
+    [LOG_TX_QUEUE_STATS]         = LOG_TX_QUEUE_STATS_FMT,
+    [LOG_CYCLIC_SCHEDULE]        = LOG_CYCLIC_SCHEDULE_FMT,
+    [LOG_CYCLIC_STATS]           = LOG_CYCLIC_STATS_FMT,
+};
+
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
 
 /* The following globals are not designated as 'static' to allow debug access */
 
 /* CAN handle */
 CAN_Handle canHandle;
 
+/* CAN driver parameters, kept to reopen the driver after bus off */
+CAN_Params canParams;
+
+/* Bus off recovery */
+CANRecovery_Object canRecovery;
+
+/* Transmit scheduler */
+CANTxSched_Object txSched;
+
+#if CYCLIC_SCHEDULE_ENABLE
+
+static bool produceCyclicMsg(void *arg, CAN_TxBufElement *elem, uint64_t releaseTime);
+
+/* Cyclic schedule table: 1 ms, 10 ms and 100 ms classes at different offsets */
+const CANSchedule_Entry cyclicEntries[] = {
+    {CAN_CYCLIC_1MS_MSG_ID, true, true, true, CAN_DLC_2B, 1000U, 200U, produceCyclicMsg, NULL},
+    {CAN_CYCLIC_10MS_MSG_ID, true, true, true, CAN_DLC_4B, 10000U, 500U, produceCyclicMsg, NULL},
+    {CAN_CYCLIC_100MS_MSG_ID, true, true, true, CAN_DLC_8B, 100000U, 700U, produceCyclicMsg, NULL},
+};
+
+#define CYCLIC_ENTRY_CNT (sizeof(cyclicEntries) / sizeof(cyclicEntries[0]))
+
+/* Cyclic schedule and the state of its entries */
+CANSchedule_Object cyclicSchedule;
+CANSchedule_Slot cyclicSlots[CYCLIC_ENTRY_CNT];
+
+/* Tx scheduler thread time of the current cyclic release */
+static uint64_t cyclicReleaseTime;
+
+/* Worst-case response time of each cyclic message, in microseconds */
+uint32_t cyclicResponseTimeUs[CYCLIC_ENTRY_CNT];
+
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+
+#if !CAN_TIMESYNC_TOKENIZED_LOG
+
 /* UART2 handle */
 UART2_Handle uart2Handle;
 
-/* Formatted message buffer */
-char formattedMsg[UART_MSG_BUFFER_SIZE];
+/* Deferred log statistics */
+DeferredLog_Stats logStats;
+
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
+
+/* Bus statistics at the last and the current report */
+CANStats_Snapshot prevStats;
+CANStats_Snapshot curStats;
 
 /* Rx and Tx buffer elements */
 CAN_RxBufElement rxElem;
@@ -110,6 +442,17 @@ CAN_TxBufElement txElem;
 /* Tx Event element */
 CAN_TxEventElement txEventelem;
 
+/* Handlers for the received message IDs */
+CANDispatch_Object canDispatch;
+
+#ifndef CAN_SUPPORTS_DCAN
+
+/* Message RAM configuration with the acceptance filters built from canDispatch */
+CANDispatch_Filters canFilters;
+CAN_MsgRAMConfig msgRAMConfig;
+
+#endif /* CAN_SUPPORTS_DCAN */
+
 /* Button driver parameters. */
 Button_Params button0Params;
 Button_Params button1Params;
@@ -126,31 +469,68 @@ volatile uint32_t rxEventCnt     = 0U;
 volatile uint32_t txEventCnt     = 0U;
 volatile uint32_t txEventLostCnt = 0U;
 
-/* Start Of Frame to Tx/Rx timestamp delay */
-uint32_t sofToTimestampDelay;
-
-/* Message transmit complete semaphore */
-sem_t txCompleteSem;
+/* Transmit scheduler semaphore, posted when a message is submitted or transmitted */
+sem_t txSchedSem;
 
 /* Button press semaphore */
 sem_t buttonSem;
 
+/* Time sync Tx Event handled semaphore, posted once per transmitted time sync message */
+sem_t followUpSem;
+
+/* Sequence number of the next time sync message sent by this node */
+uint8_t txSyncSeq = 0U;
+
+/* Master side: time the last time sync message was submitted */
+uint64_t txSyncWriteTime;
+
+/* Master side: SOF time of the last transmitted time sync message */
+uint32_t txSyncSofTime;
+volatile bool txSyncSofTimeValid;
+
+/* Follower side: sequence number and local SOF time of the last received time sync message */
+uint8_t rxSyncSeq;
+uint32_t rxSyncSofTime;
+bool rxSyncValid = false;
+
+/* Time sync clock servo and its statistics */
+TimeSyncServo_Object servo;
+TimeSyncServo_Stats servoStats;
+
 /* Flag to Tx CAN FD message with EFC (Event FIFO Control) */
 volatile bool efcEnable;
 
 /* Forward declarations */
 static void eventCallback(CAN_Handle handle, uint32_t curEvent, uint32_t curEventData, void *userArg);
-static void handleTimeSyncRx(void);
+static void handleTimeSyncRx(const CAN_RxBufElement *elem, void *arg);
+static void handleFollowUpRx(const CAN_RxBufElement *elem, void *arg);
+static void initDispatch(CAN_Params *canParams);
+static void sendTimeSync(void);
+static bool waitForButton(void);
+static void scheduleLedToggle(uint32_t targetTime);
+static void toggleLed(uintptr_t arg);
 static void handleTxEvent(void);
 static void printRxMsg(void);
 static void processRxMsg(void);
-static void txTestMsg(uint32_t id, uint32_t efc, uint32_t dlc, uint32_t brsEnable);
+static bool txTestMsg(uint32_t queueIdx,
+                      uint32_t id,
+                      uint32_t efc,
+                      uint32_t dlc,
+                      uint32_t brsEnable,
+                      const uint8_t *data);
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem);
+static bool restartDriver(void *arg);
+static bool waitForSem(sem_t *sem, uint32_t timeoutMs);
+static void reportStats(void);
 
 /*
  *  ======== eventCallback ========
  */
 static void eventCallback(CAN_Handle handle, uint32_t curEvent, uint32_t curEventData, void *userArg)
 {
+    CANStats_event(curEvent, CANTimestamp_getTime());
+    CANRecovery_event(&canRecovery, curEvent, CANTimestamp_getTime());
+
     if (curEvent == CAN_EVENT_RX_DATA_AVAIL)
     {
         rxEventCnt++;
@@ -160,57 +540,59 @@ static void eventCallback(CAN_Handle handle, uint32_t curEvent, uint32_t curEven
     {
         handleTxEvent();
     }
-    else
+    else if (curEvent == CAN_EVENT_TX_FINISHED)
     {
-        if (curEvent == CAN_EVENT_TX_FINISHED)
-        {
-            txEventCnt++;
-            sprintf(formattedMsg, "> Tx Finished. Cnt = %u\r\n\n", (unsigned int)txEventCnt);
-            sem_post(&txCompleteSem);
-        }
-        else if (curEvent == CAN_EVENT_TX_EVENT_LOST)
-        {
-            txEventLostCnt++;
-            sprintf(formattedMsg, "> Tx Event Lost. Cnt = %u\r\n\n", (unsigned int)txEventLostCnt);
-        }
-        else if (curEvent == CAN_EVENT_BUS_ON)
-        {
-            sprintf(formattedMsg, "> Bus On\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_BUS_OFF)
-        {
-            sprintf(formattedMsg, "> Bus Off\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_ACTIVE)
-        {
-            sprintf(formattedMsg, "> Error Active\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_ERR_PASSIVE)
-        {
-            sprintf(formattedMsg, "> Error Passive\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_RX_FIFO_MSG_LOST)
-        {
-            sprintf(formattedMsg, "> Rx FIFO %u message lost\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL)
-        {
-            sprintf(formattedMsg, "> Rx ring buffer full: Cnt = %u\r\n\n", (unsigned int)curEventData);
-        }
-        else if (curEvent == CAN_EVENT_BIT_ERR_UNCORRECTED)
-        {
-            sprintf(formattedMsg, "> Uncorrected bit error\r\n\n");
-        }
-        else if (curEvent == CAN_EVENT_SPI_XFER_ERROR)
-        {
-            sprintf(formattedMsg, "> SPI transfer error: status = 0x%x\r\n\n", (unsigned int)curEventData);
-        }
-        else
-        {
-            sprintf(formattedMsg, "> Undefined event\r\n\n");
-        }
+        txEventCnt++;
+        LOG_WRITE1(LOG_TX_FINISHED, txEventCnt);
+
+        /* Let the transmit scheduler pass the next message to the driver */
+        CANTxSched_txIdle(&txSched);
+        sem_post(&txSchedSem);
+    }
+    else if (curEvent == CAN_EVENT_TX_EVENT_LOST)
+    {
+        txEventLostCnt++;
+        LOG_WRITE1(LOG_TX_EVENT_LOST, txEventLostCnt);
 
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        /* The SOF time of the time sync message is unknown, skip the follow-up */
+        txSyncSofTimeValid = false;
+        sem_post(&followUpSem);
+    }
+    else if (curEvent == CAN_EVENT_BUS_ON)
+    {
+        LOG_WRITE0(LOG_BUS_ON);
+    }
+    else if (curEvent == CAN_EVENT_BUS_OFF)
+    {
+        LOG_WRITE0(LOG_BUS_OFF);
+    }
+    else if (curEvent == CAN_EVENT_ERR_ACTIVE)
+    {
+        LOG_WRITE0(LOG_ERR_ACTIVE);
+    }
+    else if (curEvent == CAN_EVENT_ERR_PASSIVE)
+    {
+        LOG_WRITE0(LOG_ERR_PASSIVE);
+    }
+    else if (curEvent == CAN_EVENT_RX_FIFO_MSG_LOST)
+    {
+        LOG_WRITE1(LOG_RX_FIFO_MSG_LOST, curEventData);
+    }
+    else if (curEvent == CAN_EVENT_RX_RING_BUFFER_FULL)
+    {
+        LOG_WRITE1(LOG_RX_RING_BUFFER_FULL, curEventData);
+    }
+    else if (curEvent == CAN_EVENT_BIT_ERR_UNCORRECTED)
+    {
+        LOG_WRITE0(LOG_BIT_ERR_UNCORRECTED);
+    }
+    else if (curEvent == CAN_EVENT_SPI_XFER_ERROR)
+    {
+        LOG_WRITE1(LOG_SPI_XFER_ERROR, curEventData);
+    }
+    else
+    {
+        LOG_WRITE0(LOG_UNDEFINED_EVENT);
     }
 }
 
@@ -220,44 +602,80 @@ static void eventCallback(CAN_Handle handle, uint32_t curEvent, uint32_t curEven
 static void printRxMsg(void)
 {
     uint_fast8_t dataLen;
+#if !CAN_TIMESYNC_TOKENIZED_LOG
     uint_fast8_t i;
+    uint_fast8_t n;
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
 
-    sprintf(formattedMsg, "Msg ID: 0x%x\r\n", (unsigned int)rxElem.id);
-
-    sprintf(formattedMsg + strlen(formattedMsg), "TS: 0x%04x\r\n", rxElem.rxts);
+    LOG_WRITE2(LOG_RX_MSG_HEADER, rxElem.id, rxElem.rxts);
 
 #ifndef CAN_SUPPORTS_DCAN
+    LOG_WRITE4(LOG_RX_MSG_FLAGS, rxElem.fdf, rxElem.dlc, rxElem.brs, rxElem.esi);
+#else
+    LOG_WRITE2(LOG_RX_MSG_FLAGS, rxElem.dlc, rxElem.esi);
+#endif /* CAN_SUPPORTS_DCAN */
 
-    sprintf(formattedMsg + strlen(formattedMsg), "CAN FD: %u\r\n", rxElem.fdf);
+    if (rxElem.dlc < CANCodec_DLC_COUNT)
+    {
+        dataLen = CANCodec_dlcToLength(rxElem.dlc);
 
-#endif /* CAN_SUPPORTS_DCAN */
+#if CAN_TIMESYNC_TOKENIZED_LOG
+        /* The payload is emitted as raw bytes */
+        Log_buf(LogModule_App1, Log_INFO, "Data:", rxElem.data, dataLen);
+#else
+        LOG_WRITE1(LOG_RX_DATA_LEN, dataLen);
 
-    sprintf(formattedMsg + strlen(formattedMsg), "DLC: %u\r\n", rxElem.dlc);
+        /* Log the payload in chunks of up to four bytes, one byte per argument */
+        for (i = 0U; i < dataLen; i += n)
+        {
+            n = dataLen - i;
+            if (n > LOG_DATA_BYTES_PER_RECORD)
+            {
+                n = LOG_DATA_BYTES_PER_RECORD;
+            }
 
-#ifndef CAN_SUPPORTS_DCAN
+            DeferredLog_write(LOG_RX_DATA_1B + n - 1U,
+                              rxElem.data[i],
+                              (n > 1U) ? rxElem.data[i + 1U] : 0U,
+                              (n > 2U) ? rxElem.data[i + 2U] : 0U,
+                              (n > 3U) ? rxElem.data[i + 3U] : 0U);
+        }
 
-    sprintf(formattedMsg + strlen(formattedMsg), "BRS: %u\r\n", rxElem.brs);
+        LOG_WRITE0(LOG_RX_DATA_END);
+#endif /* CAN_TIMESYNC_TOKENIZED_LOG */
+    }
+}
 
-#endif /* CAN_SUPPORTS_DCAN */
+/*
+ *  ======== toggleLed ========
+ *  Scheduled action executed from the SYSTIM compare interrupt at the target
+ *  time after the time sync message SOF.
+ */
+static void toggleLed(uintptr_t arg)
+{
+    ScheduledAction_Stats stats;
 
-    sprintf(formattedMsg + strlen(formattedMsg), "ESI: %u\r\n", rxElem.esi);
+#ifdef CONFIG_GPIO_LED_1
 
-    if (rxElem.dlc < DLC_TABLE_SIZE)
-    {
-        dataLen = dlcToDataSize[rxElem.dlc];
+    /* Toggle LED1 */
+    GPIO_toggle(CONFIG_GPIO_LED_1);
 
-        sprintf(formattedMsg + strlen(formattedMsg), "Data[%lu]: ", (unsigned long)dataLen);
+#endif /* CONFIG_GPIO_LED_1 */
 
-        /* Format the message as printable hex */
-        for (i = 0U; i < dataLen; i++)
-        {
-            sprintf(formattedMsg + strlen(formattedMsg), "%02X ", rxElem.data[i]);
-        }
+    ScheduledAction_getStats(&stats);
 
-        sprintf(formattedMsg + strlen(formattedMsg), "\r\n\n");
-    }
+    LOG_WRITE4(LOG_LED_TOGGLED, stats.lastLatency, stats.minLatency, stats.maxLatency, stats.lateCount);
+}
 
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+/*
+ *  ======== scheduleLedToggle ========
+ */
+static void scheduleLedToggle(uint32_t targetTime)
+{
+    if (ScheduledAction_schedule(targetTime, toggleLed, 0U) != ScheduledAction_STATUS_SUCCESS)
+    {
+        LOG_WRITE1(LOG_LED_TOGGLE_BUSY, targetTime);
+    }
 }
 
 /*
@@ -265,151 +683,125 @@ static void printRxMsg(void)
  */
 static void handleTxEvent(void)
 {
+    CANTimestamp_Ref ref;
     int_fast16_t status;
-    uint16_t tscv;
     uint16_t txts;
-    uint16_t txtsToTscvDelta;
     uint32_t sofTime;
-    uint32_t systim;
-    uint32_t targetTime;
-    uintptr_t hwiKey;
 
-    hwiKey = HwiP_disable();
-
-    /* Read current system time */
-    systim = HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N);
-
-#ifndef CAN_SUPPORTS_DCAN
-
-    /* Get current timestamp counter value */
-    tscv = MCAN_getTimestampCounter();
-
-#else
-
-    tscv = DCAN_getTimestampCounter();
-
-#endif /* (DeviceFamily_PARENT != DeviceFamily_PARENT_CC35XX) */
+    /* Sample the system time and the CAN timestamp counter */
+    CANTimestamp_capture(&ref);
 
     /* Read Tx Event element */
     status = CAN_readTxEvent(canHandle, &txEventelem);
 
     if (status != CAN_STATUS_SUCCESS)
     {
-        sprintf(formattedMsg, "> Failed to read Tx Event\r\n\n");
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        LOG_WRITE0(LOG_TX_EVENT_READ_FAILED);
+
+        /* Release the main thread without a valid SOF time for the follow-up */
+        txSyncSofTimeValid = false;
+        sem_post(&followUpSem);
         return;
     }
 
     if (txEventelem.id != CAN_TIME_SYNC_MSG_ID)
     {
-        sprintf(formattedMsg, "> Unexpected time sync msg ID: 0x%x\r\n\n", (unsigned int)txEventelem.id);
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        LOG_WRITE1(LOG_UNEXPECTED_TX_EVENT_ID, txEventelem.id);
         return;
     }
 
     /* Read the Tx timestamp */
     txts = txEventelem.txts;
 
-    /* Determine the time from the Tx timestamp to where the live
-     * timestamp counter value was read in the event callback.
-     */
-    txtsToTscvDelta = tscv - txts;
-
-    /* Calculate the SOF time in system time domain. Since both the
-     * System Timer and CAN external timestamp have 250ns resolution, no
-     * scaling of the txtsToTscvDelta is necessary.
-     */
-    sofTime = systim - txtsToTscvDelta - sofToTimestampDelay;
-
-    /* Calculate a target time after the SOF */
-    targetTime = sofTime + USEC_TO_SYSTIM(SOF_TO_LED_TOGGLE_USEC);
-
-    /* For simplicity, this example polls until the target system time
-     * is reached.
+    /* Calculate the SOF time in system time domain. The message cannot have
+     * been sent before it was written, so the result stays correct even if
+     * the Tx Event is handled more than one timestamp counter period late.
      */
-    while (HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N) < targetTime) {}
+    sofTime = (uint32_t)CANTimestamp_toSofTimeAfter(&ref, txts, txSyncWriteTime);
 
-#ifdef CONFIG_GPIO_LED_1
+    /* Toggle the LED at a target time after the SOF */
+    scheduleLedToggle(sofTime + USEC_TO_SYSTIM(SOF_TO_LED_TOGGLE_USEC));
 
-    /* Toggle LED1 */
-    GPIO_toggle(CONFIG_GPIO_LED_1);
-
-#endif /* CONFIG_GPIO_LED_1 */
+    LOG_WRITE2(LOG_TX_EVENT, txts, sofTime);
 
-    HwiP_restore(hwiKey);
-
-    sprintf(formattedMsg,
-            "> Tx Event. TXTS = 0x%04x, SOF time = 0x%08x\r\n\n",
-            (unsigned int)txts,
-            (unsigned int)sofTime);
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    /* Hand the SOF time to the main thread, which sends it in the follow-up */
+    txSyncSofTime      = sofTime;
+    txSyncSofTimeValid = true;
+    sem_post(&followUpSem);
 }
 
 /*
  *  ======== handleTimeSyncRx ========
  */
-static void handleTimeSyncRx(void)
+static void handleTimeSyncRx(const CAN_RxBufElement *elem, void *arg)
 {
+    CANTimestamp_Ref ref;
     uint16_t rxts;
-    uint16_t rxtsToTscvDelta;
-    uint16_t tscv;
     uint32_t sofTime;
-    uint32_t systim;
-    uint32_t targetTime;
-    uintptr_t hwiKey;
 
-    hwiKey = HwiP_disable();
-
-    /* Read current system time */
-    systim = HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N);
-
-#ifndef CAN_SUPPORTS_DCAN
+    /* Sample the system time and the CAN timestamp counter */
+    CANTimestamp_capture(&ref);
 
-    /* Get current timestamp counter value */
-    tscv = MCAN_getTimestampCounter();
+    /* Read the Rx timestamp */
+    rxts = elem->rxts;
 
-#else
+    /* Calculate the SOF time in system time domain */
+    sofTime = (uint32_t)CANTimestamp_toSofTime(&ref, rxts);
 
-    tscv = DCAN_getTimestampCounter();
+    /* Toggle the LED at a target time after the SOF */
+    scheduleLedToggle(sofTime + USEC_TO_SYSTIM(SOF_TO_LED_TOGGLE_USEC));
 
-#endif /* CAN_SUPPORTS_DCAN */
+    LOG_WRITE2(LOG_TIME_SYNC_RX, rxts, sofTime);
 
-    /* Read the Rx timestamp */
-    rxts = rxElem.rxts;
+    /* Keep the local SOF time until the master's follow-up arrives */
+    if (elem->dlc >= TIME_SYNC_MSG_DLC)
+    {
+        rxSyncSeq     = elem->data[0];
+        rxSyncSofTime = sofTime;
+        rxSyncValid   = true;
+    }
+}
 
-    /* Determine the time from the Rx timestamp to where the live
-     * timestamp counter value was read in the event callback.
-     */
-    rxtsToTscvDelta = tscv - rxts;
+/*
+ *  ======== handleFollowUpRx ========
+ *  Pairs the master's SOF time from a follow-up message with the local SOF time
+ *  of the matching time sync message and feeds the pair to the clock servo.
+ */
+static void handleFollowUpRx(const CAN_RxBufElement *elem, void *arg)
+{
+    int32_t offset;
+    uint8_t seq;
+    uint32_t masterSofTime;
 
-    /* Calculate the SOF time in system time domain. Since both the
-     * System Timer and CAN external timestamp have 250ns resolution, no
-     * scaling of the rxtsToTscvDelta is necessary.
-     */
-    sofTime = systim - rxtsToTscvDelta - sofToTimestampDelay;
+    if (elem->dlc < TIME_SYNC_FOLLOW_UP_MSG_DLC)
+    {
+        return;
+    }
 
-    /* Calculate a target time after the SOF */
-    targetTime = sofTime + USEC_TO_SYSTIM(SOF_TO_LED_TOGGLE_USEC);
+    seq = elem->data[TIME_SYNC_FOLLOW_UP_SEQ_IDX];
 
-    /* For simplicity, this example polls until the target system time
-     * is reached.
-     */
-    while (HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N) < targetTime) {}
+    if (!rxSyncValid || (seq != rxSyncSeq))
+    {
+        LOG_WRITE2(LOG_FOLLOW_UP_SEQ_MISMATCH, seq, rxSyncSeq);
+        return;
+    }
 
-#ifdef CONFIG_GPIO_LED_1
+    /* Each time sync message is used for at most one servo sample */
+    rxSyncValid = false;
 
-    /* Toggle LED1 */
-    GPIO_toggle(CONFIG_GPIO_LED_1);
+    masterSofTime = (uint32_t)elem->data[0] | ((uint32_t)elem->data[1] << 8) | ((uint32_t)elem->data[2] << 16) |
+                    ((uint32_t)elem->data[3] << 24);
 
-#endif /* CONFIG_GPIO_LED_1 */
+    offset = TimeSyncServo_update(&servo, rxSyncSofTime, masterSofTime);
 
-    HwiP_restore(hwiKey);
+    TimeSyncServo_getStats(&servo, &servoStats);
 
-    sprintf(formattedMsg,
-            "> Time Sync msg Rx'ed. RXTS = 0x%04x, SOF time = 0x%08x\r\n\n",
-            (unsigned int)rxts,
-            (unsigned int)sofTime);
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    LOG_WRITE3(LOG_SERVO_SAMPLE, SYSTIM_TO_NSEC(offset), servoStats.freqPpb, TimeSyncServo_getState(&servo));
+    LOG_WRITE4(LOG_SERVO_STATS,
+               servoStats.samples,
+               servoStats.meanOffsetNs,
+               servoStats.maxOffsetNs,
+               servoStats.stddevOffsetNs);
 }
 
 /*
@@ -417,27 +809,73 @@ static void handleTimeSyncRx(void)
  */
 static void processRxMsg(void)
 {
+    uint32_t count = 0U;
+
     /* Read all available CAN messages */
     while (CAN_read(canHandle, &rxElem) == CAN_STATUS_SUCCESS)
     {
         rxMsgCnt++;
+        count++;
+        CANStats_rxFrame(&rxElem);
 
-        if (rxElem.id == CAN_TIME_SYNC_MSG_ID)
+        /* Messages with an unregistered ID are dropped */
+        if (CANDispatch_dispatch(&canDispatch, &rxElem))
         {
-            handleTimeSyncRx();
+            LOG_WRITE2(LOG_RX_MSG_CNT, rxMsgCnt, rxEventCnt);
+
+            printRxMsg();
         }
+    }
 
-        sprintf(formattedMsg, "RxMsg Cnt: %u, RxEvt Cnt: %u\r\n", (unsigned int)rxMsgCnt, (unsigned int)rxEventCnt);
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    CANStats_rxBurst(count);
+}
 
-        printRxMsg();
-    }
+/*
+ *  ======== initDispatch ========
+ *  Registers the handlers for the received message IDs. On devices with an
+ *  MCAN peripheral the acceptance filters are built from the registered IDs,
+ *  so other messages are rejected by the hardware.
+ */
+static void initDispatch(CAN_Params *canParams)
+{
+    CANDispatch_init(&canDispatch);
+
+    CANDispatch_registerId(&canDispatch, CAN_TIME_SYNC_MSG_ID, true, handleTimeSyncRx, NULL);
+    CANDispatch_registerId(&canDispatch, CAN_TIME_SYNC_FOLLOW_UP_MSG_ID, true, handleFollowUpRx, NULL);
+
+    /* Non-time sync messages are only printed. Bulk data messages are not
+     * registered, so they are dropped.
+     */
+    CANDispatch_registerId(&canDispatch, CAN_NON_TIME_SYNC_MSG_ID, true, NULL, NULL);
+
+#ifndef CAN_SUPPORTS_DCAN
+
+    CANDispatch_buildFilters(&canDispatch, &canFilters, &msgRAMConfig);
+
+    msgRAMConfig.rxFIFONum[0]   = MSG_RAM_RX_FIFO_NUM;
+    msgRAMConfig.rxFIFONum[1]   = 0U;
+    msgRAMConfig.rxBufNum       = 0U;
+    msgRAMConfig.txBufNum       = 0U;
+    msgRAMConfig.txFIFOQNum     = MSG_RAM_TX_FIFO_Q_NUM;
+    msgRAMConfig.txFIFOQMode    = 1U; /* Tx queue: lowest ID first */
+    msgRAMConfig.txEventFIFONum = MSG_RAM_TX_EVENT_FIFO_NUM;
+
+    canParams->msgRAMConfig = &msgRAMConfig;
+
+#endif /* CAN_SUPPORTS_DCAN */
 }
 
 /*
  *  ======== txTestMsg ========
+ *  Submits a message to transmit scheduler queue queueIdx. Returns false if
+ *  the queue was full.
  */
-static void txTestMsg(uint32_t id, uint32_t efc, uint32_t dlc, uint32_t brsEnable)
+static bool txTestMsg(uint32_t queueIdx,
+                      uint32_t id,
+                      uint32_t efc,
+                      uint32_t dlc,
+                      uint32_t brsEnable,
+                      const uint8_t *data)
 {
     uint_fast8_t i;
     int_fast16_t status;
@@ -456,17 +894,374 @@ static void txTestMsg(uint32_t id, uint32_t efc, uint32_t dlc, uint32_t brsEnabl
     txElem.efc = efc;
     txElem.mm  = 1U;
 
-    for (i = 0U; i < dlcToDataSize[txElem.dlc]; i++)
+    for (i = 0U; i < CANCodec_dlcToLength(txElem.dlc); i++)
     {
-        txElem.data[i] = i;
+        txElem.data[i] = (data != NULL) ? data[i] : i;
     }
 
-    status = CAN_write(canHandle, &txElem);
+    status = CANTxSched_submit(&txSched, queueIdx, &txElem, CANTimestamp_getTime());
     if (status != CAN_STATUS_SUCCESS)
     {
-        /* CAN_write() failed */
-        while (1) {}
+        LOG_WRITE2(LOG_TX_FAILED, id, status);
+        return false;
+    }
+
+    sem_post(&txSchedSem);
+
+    return true;
+}
+
+#if TX_BULK_RATE_HZ > 0
+/*
+ *  ======== submitBulkMsgs ========
+ *  Keeps the bulk data queue filled with messages carrying a counter. The
+ *  queue rate limit sets the rate they are sent at.
+ */
+static void submitBulkMsgs(uint64_t now)
+{
+    static CAN_TxBufElement bulkElem;
+    static uint32_t bulkCnt = 0U;
+
+    bulkElem.id  = CAN_BULK_MSG_ID;
+    bulkElem.rtr = 0U;
+    bulkElem.xtd = 1U;
+    bulkElem.dlc = CAN_DLC_8B;
+    bulkElem.efc = 0U;
+    bulkElem.mm  = 0U;
+
+    while (CANTxSched_getCount(&txSched, TX_QUEUE_BULK) < CANTxSched_QUEUE_SIZE)
+    {
+        bulkElem.data[0] = (uint8_t)bulkCnt;
+        bulkElem.data[1] = (uint8_t)(bulkCnt >> 8);
+        bulkElem.data[2] = (uint8_t)(bulkCnt >> 16);
+        bulkElem.data[3] = (uint8_t)(bulkCnt >> 24);
+        bulkCnt++;
+
+        (void)CANTxSched_submit(&txSched, TX_QUEUE_BULK, &bulkElem, now);
+    }
+}
+#endif /* TX_BULK_RATE_HZ > 0 */
+
+#if CYCLIC_SCHEDULE_ENABLE
+/*
+ *  ======== produceCyclicMsg ========
+ *  Cyclic message payload: the release time in network time, little-endian,
+ *  truncated to the message length.
+ */
+static bool produceCyclicMsg(void *arg, CAN_TxBufElement *elem, uint64_t releaseTime)
+{
+    uint_fast8_t i;
+
+    for (i = 0U; i < CANCodec_dlcToLength(elem->dlc); i++)
+    {
+        elem->data[i] = (uint8_t)(releaseTime >> (8U * (i % 8U)));
+    }
+
+    return true;
+}
+
+/*
+ *  ======== submitCyclicMsg ========
+ *  arg points to the Tx scheduler thread time of the current release, so the
+ *  submit time is never later than the time passed to CANTxSched_process().
+ */
+static int_fast16_t submitCyclicMsg(void *arg, const CAN_TxBufElement *elem)
+{
+    return CANTxSched_submit(&txSched, TX_QUEUE_CYCLIC, elem, *(const uint64_t *)arg);
+}
+
+/*
+ *  ======== wakeTxSchedThread ========
+ *  Cyclic release timer function, called from the SYSTIM compare interrupt.
+ *  Its priority must allow kernel calls.
+ */
+static void wakeTxSchedThread(uintptr_t arg)
+{
+    sem_post(&txSchedSem);
+}
+
+/*
+ *  ======== releaseCyclicMsgs ========
+ *  Submits the cyclic messages that are due and sets the timer for the next
+ *  release.
+ */
+static void releaseCyclicMsgs(uint64_t now)
+{
+    uint32_t localTime;
+    uint32_t networkTime;
+    uint32_t delay;
+    uintptr_t hwiKey;
+
+    cyclicReleaseTime = now;
+    localTime         = (uint32_t)now;
+
+    /* The servo is updated from the CAN event callback */
+    hwiKey      = HwiP_disable();
+    networkTime = TimeSyncServo_getNetworkTime(&servo, localTime);
+    HwiP_restore(hwiKey);
+
+    delay = CANSchedule_release(&cyclicSchedule, networkTime);
+
+    /* A servo step can move the next release earlier than the pending timer */
+    if (ScheduledAction_scheduleSlot(CYCLIC_RELEASE_SLOT, localTime + delay, wakeTxSchedThread, 0U) !=
+        ScheduledAction_STATUS_SUCCESS)
+    {
+        ScheduledAction_advanceSlot(CYCLIC_RELEASE_SLOT, localTime + delay);
+    }
+}
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+
+/*
+ *  ======== txSchedThread ========
+ *  Passes the submitted messages to the driver in priority order and
+ *  recovers from bus off. All CAN_write() calls are made from this thread.
+ */
+void *txSchedThread(void *arg0)
+{
+    uint64_t now;
+    uint64_t wakeTime;
+    uint32_t timeoutMs;
+    uint32_t wakeMs;
+
+    while (1)
+    {
+        now = CANTimestamp_getTime();
+
+        CANRecovery_process(&canRecovery, now);
+
+#if CYCLIC_SCHEDULE_ENABLE
+        releaseCyclicMsgs(now);
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+
+#if TX_BULK_RATE_HZ > 0
+        submitBulkMsgs(now);
+#endif /* TX_BULK_RATE_HZ > 0 */
+
+        wakeTime = CANTxSched_process(&txSched, now);
+
+        /* Wait for the next message, Tx finished event, rate limit or recovery check */
+        timeoutMs = CANRecovery_isBusOff(&canRecovery) ? RECOVERY_POLL_INTERVAL_MS : 0U;
+
+        if (wakeTime != CANTxSched_NO_WAKEUP)
+        {
+            wakeMs = (uint32_t)((wakeTime - now + USEC_TO_SYSTIM(1000U) - 1U) / USEC_TO_SYSTIM(1000U));
+
+            if ((timeoutMs == 0U) || (wakeMs < timeoutMs))
+            {
+                timeoutMs = wakeMs;
+            }
+        }
+
+        (void)waitForSem(&txSchedSem, timeoutMs);
+    }
+}
+
+/*
+ *  ======== writeFrame ========
+ *  Transmit scheduler and bus off recovery write function. Messages are held
+ *  in the scheduler queues while the bus is off.
+ */
+static int_fast16_t writeFrame(void *arg, const CAN_TxBufElement *elem)
+{
+    int_fast16_t status;
+
+    if (CANRecovery_isBusOff(&canRecovery))
+    {
+        return CAN_STATUS_TX_BUF_FULL;
+    }
+
+    status = CAN_write(canHandle, elem);
+    if (status == CAN_STATUS_SUCCESS)
+    {
+        CANStats_txFrame(elem);
+    }
+    else
+    {
+        CANStats_txFull();
+    }
+
+    return status;
+}
+
+/*
+ *  ======== restartDriver ========
+ *  Bus off recovery restart function. Reopening the driver resets the
+ *  controller, which then rejoins the bus.
+ */
+static bool restartDriver(void *arg)
+{
+    if (canHandle != NULL)
+    {
+        CAN_close(canHandle);
+    }
+
+    canHandle = CAN_open(CONFIG_CAN_0, &canParams);
+
+    /* The reopened driver has no messages in flight */
+    CANTxSched_txIdle(&txSched);
+
+    return (canHandle != NULL);
+}
+
+/*
+ *  ======== sendTimeSync ========
+ *  Sends a time sync message, waits for its Tx Event to provide the precise SOF
+ *  time, then sends that SOF time to the followers in a follow-up message.
+ */
+static void sendTimeSync(void)
+{
+    uint8_t data[TIME_SYNC_FOLLOW_UP_MSG_DLC];
+    uint8_t seq;
+    uint32_t sofTime;
+
+    seq     = txSyncSeq++;
+    data[0] = seq;
+
+    /* Discard Tx Events of time sync messages that timed out */
+    while (sem_trywait(&followUpSem) == 0) {}
+
+    LOG_WRITE0(LOG_SENDING_TIME_SYNC);
+
+    /* Lower bound for the SOF time of the time sync message, which is passed
+     * to the driver after it is submitted.
+     */
+    txSyncWriteTime = CANTimestamp_getTime();
+
+#ifndef CAN_SUPPORTS_DCAN
+    /* Tx CAN FD message with time sync msg ID and EFC */
+    if (!txTestMsg(TX_QUEUE_TIME_SYNC, CAN_TIME_SYNC_MSG_ID, 1U, TIME_SYNC_MSG_DLC, 1U, data))
+#else
+    /* Tx CAN message with time sync msg ID and EFC */
+    if (!txTestMsg(TX_QUEUE_TIME_SYNC, CAN_TIME_SYNC_MSG_ID, 1U, TIME_SYNC_MSG_DLC, 0U, data))
+#endif /* CAN_SUPPORTS_DCAN */
+    {
+        return;
+    }
+
+    /* Wait until the Tx Event of the time sync message has been handled */
+    if (!waitForSem(&followUpSem, TX_TIMEOUT_MS) || !txSyncSofTimeValid)
+    {
+        LOG_WRITE1(LOG_FOLLOW_UP_INVALID, seq);
+        return;
+    }
+
+    sofTime = txSyncSofTime;
+
+    data[0]                           = (uint8_t)sofTime;
+    data[1]                           = (uint8_t)(sofTime >> 8);
+    data[2]                           = (uint8_t)(sofTime >> 16);
+    data[3]                           = (uint8_t)(sofTime >> 24);
+    data[TIME_SYNC_FOLLOW_UP_SEQ_IDX] = seq;
+
+#ifndef CAN_SUPPORTS_DCAN
+    if (!txTestMsg(TX_QUEUE_TIME_SYNC, CAN_TIME_SYNC_FOLLOW_UP_MSG_ID, 0U, TIME_SYNC_FOLLOW_UP_MSG_DLC, 1U, data))
+#else
+    if (!txTestMsg(TX_QUEUE_TIME_SYNC, CAN_TIME_SYNC_FOLLOW_UP_MSG_ID, 0U, TIME_SYNC_FOLLOW_UP_MSG_DLC, 0U, data))
+#endif /* CAN_SUPPORTS_DCAN */
+    {
+        return;
+    }
+
+    LOG_WRITE2(LOG_FOLLOW_UP_SENT, seq, sofTime);
+}
+
+/*
+ *  ======== reportStats ========
+ *  Logs the bus statistics with the bus load since the last report.
+ */
+static void reportStats(void)
+{
+    const CANTxSched_QueueStats *queueStats;
+#if CYCLIC_SCHEDULE_ENABLE
+    const CANSchedule_Stats *slotStats;
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+    uint32_t load;
+    uint32_t i;
+
+    CANStats_getSnapshot(&curStats, CANTimestamp_getTime());
+
+    load = CANStats_getBusLoad(&prevStats, &curStats);
+
+    LOG_WRITE4(LOG_CAN_STATS, load / 10U, load % 10U, curStats.rxFrameCnt, curStats.txFrameCnt);
+    LOG_WRITE4(LOG_CAN_ERRORS,
+               CANStats_getEventCnt(&curStats, CAN_EVENT_BUS_OFF),
+               curStats.busOffTime / USEC_TO_SYSTIM(1000U),
+               CANStats_getEventCnt(&curStats, CAN_EVENT_ERR_PASSIVE),
+               curStats.errPassiveTime / USEC_TO_SYSTIM(1000U));
+    LOG_WRITE4(LOG_RECOVERY_STATS,
+               canRecovery.stats.restartCnt,
+               canRecovery.stats.restartFailCnt,
+               canRecovery.stats.downTime / CANRecovery_TICKS_PER_MSEC,
+               canRecovery.stats.droppedCnt);
+
+    for (i = 0U; i < CANTxSched_NUM_QUEUES; i++)
+    {
+        queueStats = &txSched.queues[i].stats;
+
+        LOG_WRITE4(LOG_TX_QUEUE_STATS,
+                   i,
+                   queueStats->sentCnt,
+                   (queueStats->sentCnt != 0U)
+                       ? (uint32_t)(queueStats->sumLatency / queueStats->sentCnt / USEC_TO_SYSTIM(1U))
+                       : 0U,
+                   queueStats->maxLatency / USEC_TO_SYSTIM(1U));
+    }
+
+#if CYCLIC_SCHEDULE_ENABLE
+    for (i = 0U; i < CYCLIC_ENTRY_CNT; i++)
+    {
+        slotStats = &cyclicSlots[i].stats;
+
+        LOG_WRITE4(LOG_CYCLIC_STATS,
+                   cyclicEntries[i].id,
+                   slotStats->missedCnt,
+                   (slotStats->releasedCnt != 0U)
+                       ? (uint32_t)SYSTIM_TO_NSEC(slotStats->sumJitter / slotStats->releasedCnt)
+                       : 0U,
+                   SYSTIM_TO_NSEC(slotStats->maxJitter));
+    }
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+
+    prevStats = curStats;
+}
+
+/*
+ *  ======== waitForSem ========
+ *  Waits until sem is posted. Returns false if timeoutMs elapsed first. A
+ *  timeoutMs of 0 waits forever.
+ */
+static bool waitForSem(sem_t *sem, uint32_t timeoutMs)
+{
+    struct timespec timeout;
+
+    if (timeoutMs == 0U)
+    {
+        sem_wait(sem);
+        return true;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec  += timeoutMs / 1000U;
+    timeout.tv_nsec += (long)(timeoutMs % 1000U) * 1000000L;
+
+    if (timeout.tv_nsec >= 1000000000L)
+    {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
     }
+
+    return (sem_timedwait(sem, &timeout) == 0);
+}
+
+/*
+ *  ======== waitForButton ========
+ *  Returns true if a button was pressed, or false if TIME_SYNC_INTERVAL_MS
+ *  elapsed without a button press.
+ */
+static bool waitForButton(void)
+{
+    return waitForSem(&buttonSem, TIME_SYNC_INTERVAL_MS);
 }
 
 /*
@@ -497,20 +1292,31 @@ static void buttonPressedCallback(Button_Handle buttonHandle, Button_EventMask b
 
 /*
  *  ======== mainThread ========
- * This thread transmits a CAN message with zero bytes of payload when the user
- * presses one of the LaunchPad buttons. If BTN-1 is pressed, the message is
- * sent with a "time sync" message ID. If BTN-2 is pressed, the message is sent
- * with a "regular" message ID.
+ * This thread transmits a CAN message when the user presses one of the
+ * LaunchPad buttons. If BTN-1 is pressed, the message is sent with a "time
+ * sync" message ID and is followed by a follow-up message carrying its SOF
+ * time. If BTN-2 is pressed, a message with zero bytes of payload is sent with
+ * a "regular" message ID.
  */
 void *mainThread(void *arg0)
 {
-    CAN_Params canParams;
-    CAN_BitTimingParams bitTiming;
+    CANRecovery_Params recoveryParams;
+    CANTxSched_Params txSchedParams;
+#if CYCLIC_SCHEDULE_ENABLE
+    uint32_t nomBitRate;
+    uint32_t dataBitRate;
+    uint32_t load;
+    bool feasible;
+#endif /* CYCLIC_SCHEDULE_ENABLE */
     int retc;
+    pthread_attr_t attrs;
+#if !CAN_TIMESYNC_TOKENIZED_LOG
+    pthread_t formatterThread;
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
+    pthread_t txThread;
+    struct sched_param priParam;
+#if !CAN_TIMESYNC_TOKENIZED_LOG
     UART2_Params uart2Params;
-    uint32_t clkFreqKhz;
-    uint32_t clkPeriod;
-    uint32_t tq;
 
     UART2_Params_init(&uart2Params);
     uart2Params.writeMode = UART2_Mode_NONBLOCKING;
@@ -523,6 +1329,37 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
+    /* All UART output is written by the deferred log formatter thread. It runs
+     * at the lowest application priority so that formatting and UART writes
+     * never delay CAN event handling.
+     */
+    DeferredLog_init(uart2Handle, logFormats, LOG_ID_COUNT);
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
+
+    ScheduledAction_init();
+    TimeSyncServo_construct(&servo);
+
+    priParam.sched_priority = 1;
+
+    retc = pthread_attr_init(&attrs);
+    retc |= pthread_attr_setschedparam(&attrs, &priParam);
+    retc |= pthread_attr_setdetachstate(&attrs, PTHREAD_CREATE_DETACHED);
+    retc |= pthread_attr_setstacksize(&attrs, THREAD_STACK_SIZE);
+    if (retc != 0)
+    {
+        /* Failed to set thread attributes */
+        while (1) {}
+    }
+
+#if !CAN_TIMESYNC_TOKENIZED_LOG
+    retc = pthread_create(&formatterThread, &attrs, DeferredLog_formatterThread, NULL);
+    if (retc != 0)
+    {
+        /* pthread_create() failed */
+        while (1) {}
+    }
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
+
     retc = sem_init(&buttonSem, 0, 0);
     if (retc != 0)
     {
@@ -530,7 +1367,14 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
-    retc = sem_init(&txCompleteSem, 0, 0);
+    retc = sem_init(&txSchedSem, 0, 0);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+    retc = sem_init(&followUpSem, 0, 0);
     if (retc != 0)
     {
         /* sem_init() failed */
@@ -543,38 +1387,79 @@ void *mainThread(void *arg0)
     canParams.eventCbk    = eventCallback;
     canParams.eventMask   = CAN_EVENT_MASK;
 
+    /* Dispatch the received messages by ID */
+    initDispatch(&canParams);
+
+    /* Recover from bus off with exponential backoff */
+    recoveryParams.minBackoffMs = RECOVERY_MIN_BACKOFF_MS;
+    recoveryParams.maxBackoffMs = RECOVERY_MAX_BACKOFF_MS;
+    recoveryParams.stableTimeMs = RECOVERY_STABLE_TIME_MS;
+    recoveryParams.dropOldest   = false;
+    recoveryParams.writeFxn     = writeFrame;
+    recoveryParams.restartFxn   = restartDriver;
+    recoveryParams.arg          = NULL;
+
+    CANRecovery_init(&canRecovery, &recoveryParams);
+
+    /* Schedule the transmissions by priority. Only bulk data is rate limited. */
+    memset(&txSchedParams, 0, sizeof(txSchedParams));
+    txSchedParams.queueParams[TX_QUEUE_BULK].rateHz = TX_BULK_RATE_HZ;
+    txSchedParams.queueParams[TX_QUEUE_BULK].burst  = TX_BULK_BURST;
+    txSchedParams.maxInFlight                       = TX_SCHED_MAX_IN_FLIGHT;
+    txSchedParams.writeFxn                          = writeFrame;
+    txSchedParams.arg                               = NULL;
+
+    CANTxSched_init(&txSched, &txSchedParams);
+
     /* Open the CAN driver */
     canHandle = CAN_open(CONFIG_CAN_0, &canParams);
     if (canHandle == NULL)
     {
         /* CAN_open() failed */
-        sprintf(formattedMsg, "\r\nError opening CAN driver!\r\n");
-        UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+        LOG_WRITE0(LOG_CAN_OPEN_FAILED);
         while (1) {}
     }
 
-    CAN_getBitTiming(canHandle, &bitTiming, &clkFreqKhz);
+    /* Convert Tx/Rx timestamps to SOF times in the system time domain */
+    CANTimestamp_init(canHandle, CANCC27XX_EXT_TIMESTAMP_PRESCALER);
 
-    /* Calculate the CAN functional clock period in picoseconds */
-    clkPeriod = 1000000000U / clkFreqKhz;
+    /* Collect bus statistics from now on */
+    CANStats_init(canHandle, CANTimestamp_getTime());
+    CANStats_getSnapshot(&prevStats, CANTimestamp_getTime());
 
-    /* Determine the Time Quantum in picoseconds.
-     * Note: Add 1 to nomRatePrescaler to get functional value.
-     */
-    tq = clkPeriod * (bitTiming.nomRatePrescaler + 1U);
-
-    /* Calculate the Start Of Frame to Tx/Rx timestamp delta value in picoseconds.
-     * The formula is based on RTL simulation is:
-     *     (6 * CAN_FUNCTIONAL_CLK_PERIOD) + (TSEG1 * tq)
-     * where TSEG1 is the number of time quantum before the sampling point:
-     * Prop_Seg + Phase_Seg1
-     *
-     * Note: Add 1 to nomTimeSeg1 to get functional value
-     */
-    sofToTimestampDelay = (6U * clkPeriod) + ((bitTiming.nomTimeSeg1 + 1U) * tq);
+#if CYCLIC_SCHEDULE_ENABLE
+    /* Check that the cyclic messages fit on the bus */
+    CANStats_getBitRates(&nomBitRate, &dataBitRate);
+
+    load     = CANSchedule_getLoad(cyclicEntries, CYCLIC_ENTRY_CNT, nomBitRate, dataBitRate);
+    feasible = CANSchedule_analyze(cyclicEntries, CYCLIC_ENTRY_CNT, nomBitRate, dataBitRate, cyclicResponseTimeUs);
+
+    LOG_WRITE4(LOG_CYCLIC_SCHEDULE, CYCLIC_ENTRY_CNT, load / 10U, load % 10U, feasible);
 
-    /* Convert the Start Of Frame to Tx timestamp delta value to system time domain */
-    sofToTimestampDelay = PSEC_TO_SYSTIM(sofToTimestampDelay);
+    CANSchedule_init(&cyclicSchedule,
+                     cyclicEntries,
+                     cyclicSlots,
+                     CYCLIC_ENTRY_CNT,
+                     submitCyclicMsg,
+                     &cyclicReleaseTime);
+#endif /* CYCLIC_SCHEDULE_ENABLE */
+
+    /* All CAN_write() calls are made from the transmit scheduler thread */
+    priParam.sched_priority = TX_SCHED_THREAD_PRIORITY;
+
+    retc = pthread_attr_setschedparam(&attrs, &priParam);
+    if (retc != 0)
+    {
+        /* Failed to set thread attributes */
+        while (1) {}
+    }
+
+    retc = pthread_create(&txThread, &attrs, txSchedThread, NULL);
+    if (retc != 0)
+    {
+        /* pthread_create() failed */
+        while (1) {}
+    }
 
 #ifdef CONFIG_GPIO_LED_0
 
@@ -611,44 +1496,39 @@ void *mainThread(void *arg0)
         while (1) {};
     }
 
-    sprintf(formattedMsg,
-            "\r\nCAN Time Sync ready.\r\nPress BTN-1 to send time sync msg or BTN-2 to send a regular msg...\r\n\n");
-    UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+    LOG_WRITE0(LOG_READY);
 
     /* Loop forever */
     while (1)
     {
-        /* Wait until button press callback semaphore is posted */
-        sem_wait(&buttonSem);
-
-        if (efcEnable)
+        /* Wait for a button press or for the time sync interval to elapse */
+        if (!waitForButton() || efcEnable)
         {
-            sprintf(formattedMsg, "\r\nSending time sync message...\r\n\n");
-            UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
-
-#ifndef CAN_SUPPORTS_DCAN
-            /* Tx CAN FD message with time sync msg ID and EFC */
-            txTestMsg(CAN_TIME_SYNC_MSG_ID, 1U, CAN_DLC_0B, 1U);
-#else
-            /* Tx CAN message with time sync msg ID and EFC */
-            txTestMsg(CAN_TIME_SYNC_MSG_ID, 1U, CAN_DLC_0B, 0U);
-#endif /* (DeviceFamily_PARENT != DeviceFamily_PARENT_CC35XX) */
+            sendTimeSync();
         }
         else
         {
-            sprintf(formattedMsg, "\r\nSending regular message...\r\n\n");
-            UART2_write(uart2Handle, formattedMsg, strlen(formattedMsg), NULL);
+            LOG_WRITE0(LOG_SENDING_REGULAR);
 
 #ifndef CAN_SUPPORTS_DCAN
             /* Tx CAN FD message with non-time sync msg ID without EFC */
-            txTestMsg(CAN_NON_TIME_SYNC_MSG_ID, 0U, CAN_DLC_0B, 1U);
+            txTestMsg(TX_QUEUE_REGULAR, CAN_NON_TIME_SYNC_MSG_ID, 0U, CAN_DLC_0B, 1U, NULL);
 #else
             /* Tx CAN message with non-time sync msg ID without EFC */
-            txTestMsg(CAN_NON_TIME_SYNC_MSG_ID, 0U, CAN_DLC_0B, 0U);
+            txTestMsg(TX_QUEUE_REGULAR, CAN_NON_TIME_SYNC_MSG_ID, 0U, CAN_DLC_0B, 0U, NULL);
 #endif /* CAN_SUPPORTS_DCAN */
         }
 
-        /* Wait until Tx is completed */
-        sem_wait(&txCompleteSem);
+#if !CAN_TIMESYNC_TOKENIZED_LOG
+        /* Report the deferred logging cost and usage */
+        DeferredLog_getStats(&logStats);
+        LOG_WRITE4(LOG_STATS,
+                   logStats.records,
+                   logStats.dropped,
+                   logStats.highWaterMark,
+                   logStats.maxWriteCycles);
+#endif /* !CAN_TIMESYNC_TOKENIZED_LOG */
+
+        reportStats();
     }
 }
@@ -48,6 +48,16 @@
 
 #include <ti/drivers/Board.h>
 
+#include "ScheduledAction.h"
+
+/* The ScheduledAction callbacks post semaphores and write the deferred log
+ * from the compare interrupt, which must therefore be masked by the kernel
+ * critical sections.
+ */
+#if defined(configMAX_SYSCALL_INTERRUPT_PRIORITY) && (ScheduledAction_INT_PRIORITY < configMAX_SYSCALL_INTERRUPT_PRIORITY)
+    #error "ScheduledAction_INT_PRIORITY must not be higher than configMAX_SYSCALL_INTERRUPT_PRIORITY"
+#endif
+
 extern void *mainThread(void *arg0);
 
 /* Stack size in bytes */
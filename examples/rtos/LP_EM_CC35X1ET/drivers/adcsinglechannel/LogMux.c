@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== LogMux.c ========
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "LogMux.h"
+
+#define LINE_INDEX_MASK (LogMux_CHANNEL_SIZE - 1U)
+
+/* Number of lines a channel may hold for a line of each priority to be queued */
+static const uint32_t queueLimit[LogMux_PRIORITY_COUNT] = {
+    LogMux_CHANNEL_SIZE / 2U,
+    (LogMux_CHANNEL_SIZE * 3U) / 4U,
+    LogMux_CHANNEL_SIZE,
+};
+
+/*
+ *  ======== LogMux_init ========
+ */
+void LogMux_init(LogMux_Object *obj, const LogMux_Params *params)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->params = *params;
+}
+
+/*
+ *  ======== LogMux_printf ========
+ */
+bool LogMux_printf(LogMux_Object *obj, uint32_t channel, LogMux_Priority priority, const char *format, ...)
+{
+    va_list args;
+    bool queued;
+
+    va_start(args, format);
+    queued = LogMux_vprintf(obj, channel, priority, format, args);
+    va_end(args);
+
+    return queued;
+}
+
+/*
+ *  ======== LogMux_vprintf ========
+ */
+bool LogMux_vprintf(LogMux_Object *obj, uint32_t channel, LogMux_Priority priority, const char *format, va_list args)
+{
+    LogMux_Channel *ch;
+    LogMux_Line *line;
+    uint32_t head;
+    uint32_t count;
+
+    if (channel >= LogMux_CHANNEL_COUNT)
+    {
+        return false;
+    }
+
+    ch    = &obj->channels[channel];
+    head  = ch->head;
+    count = head - ch->tail;
+
+    if (count >= queueLimit[priority])
+    {
+        ch->droppedCnt[priority]++;
+        return false;
+    }
+
+    line = &ch->lines[head & LINE_INDEX_MASK];
+
+    (void)vsnprintf(line->text, sizeof(line->text), format, args);
+    line->priority = priority;
+
+    /* Publish the line only after it has been written */
+    ch->head = head + 1U;
+
+    if (count >= ch->highWaterMark)
+    {
+        ch->highWaterMark = count + 1U;
+    }
+
+    obj->params.signalFxn(obj->params.arg);
+
+    return true;
+}
+
+/*
+ *  ======== LogMux_drain ========
+ */
+uint32_t LogMux_drain(LogMux_Object *obj)
+{
+    LogMux_Channel *best;
+    LogMux_Channel *ch;
+    LogMux_Priority bestPriority;
+    LogMux_Priority priority;
+    uint32_t bestIndex;
+    uint32_t index;
+    uint32_t i;
+    uint32_t tail;
+    uint32_t written = 0U;
+
+    while (1)
+    {
+        best         = NULL;
+        bestIndex    = 0U;
+        bestPriority = LogMux_PRIORITY_LOW;
+
+        /* Find the oldest line with the highest priority, starting after the
+         * channel written last so equal priorities are served in turn.
+         */
+        for (i = 0U; i < LogMux_CHANNEL_COUNT; i++)
+        {
+            index = (obj->nextChannel + i) % LogMux_CHANNEL_COUNT;
+            ch    = &obj->channels[index];
+
+            if (ch->head != ch->tail)
+            {
+                priority = ch->lines[ch->tail & LINE_INDEX_MASK].priority;
+
+                if ((best == NULL) || (priority > bestPriority))
+                {
+                    best         = ch;
+                    bestIndex    = index;
+                    bestPriority = priority;
+                }
+            }
+        }
+
+        if (best == NULL)
+        {
+            break;
+        }
+
+        tail = best->tail;
+        obj->params.writeFxn(obj->params.arg, best->lines[tail & LINE_INDEX_MASK].text);
+
+        /* Release the line only after it has been written */
+        best->tail = tail + 1U;
+
+        obj->nextChannel = (bestIndex + 1U) % LogMux_CHANNEL_COUNT;
+        written++;
+    }
+
+    return written;
+}
+
+/*
+ *  ======== LogMux_getDroppedCnt ========
+ */
+uint32_t LogMux_getDroppedCnt(const LogMux_Object *obj, LogMux_Priority priority)
+{
+    uint32_t count = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < LogMux_CHANNEL_COUNT; i++)
+    {
+        count += obj->channels[i].droppedCnt[priority];
+    }
+
+    return count;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== LogMux.h ========
+ *  Output multiplexer giving several threads whole-line, non-blocking output.
+ *
+ *  Each producer thread formats its lines into a channel of its own. A
+ *  channel is a single-producer/single-consumer ring of LogMux_CHANNEL_SIZE
+ *  lines in which each side owns exactly one index, so no locking is required
+ *  on a single-core device. A single writer thread drains the channels and
+ *  writes each line in one piece, so lines of different threads never
+ *  interleave and the producers never wait for the output device.
+ *
+ *  The writer takes the oldest line of each channel and writes the one with
+ *  the highest priority first. Lines of the same channel are written in
+ *  order. When a channel fills up, low priority lines are dropped first: a
+ *  low priority line is only queued while the channel is less than half full,
+ *  a normal priority line while it is less than three quarters full, and a
+ *  high priority line while there is room. Dropped lines are counted per
+ *  priority.
+ *
+ *  The module does not call a driver itself. Lines are written through a
+ *  function supplied by the application, which is also notified through a
+ *  signal function when a line was queued.
+ *
+ *  The module only depends on the C library.
+ */
+
+#ifndef LOGMUX_H_
+#define LOGMUX_H_
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of channels, one per producer thread */
+#ifndef LogMux_CHANNEL_COUNT
+    #define LogMux_CHANNEL_COUNT 3U
+#endif
+
+/* Number of lines per channel. Must be a power of two. */
+#ifndef LogMux_CHANNEL_SIZE
+    #define LogMux_CHANNEL_SIZE 32U
+#endif
+
+#if (LogMux_CHANNEL_SIZE & (LogMux_CHANNEL_SIZE - 1U)) != 0U
+    #error "LogMux_CHANNEL_SIZE must be a power of two"
+#endif
+
+/* Line size in characters, including the terminating null. Longer lines are truncated. */
+#ifndef LogMux_LINE_SIZE
+    #define LogMux_LINE_SIZE 64U
+#endif
+
+/* Line priority */
+typedef enum
+{
+    LogMux_PRIORITY_LOW,
+    LogMux_PRIORITY_NORMAL,
+    LogMux_PRIORITY_HIGH,
+    LogMux_PRIORITY_COUNT
+} LogMux_Priority;
+
+/* Writes a null-terminated line */
+typedef void (*LogMux_WriteFxn)(void *arg, const char *line);
+
+/* Notifies the writer thread that a line was queued */
+typedef void (*LogMux_SignalFxn)(void *arg);
+
+/* Multiplexer parameters */
+typedef struct
+{
+    LogMux_WriteFxn writeFxn;
+    LogMux_SignalFxn signalFxn;
+    void *arg;                  /* Passed to writeFxn and signalFxn */
+} LogMux_Params;
+
+/* Queued line */
+typedef struct
+{
+    volatile LogMux_Priority priority;
+    char text[LogMux_LINE_SIZE];
+} LogMux_Line;
+
+/* Channel of one producer thread. head and tail are free-running. */
+typedef struct
+{
+    LogMux_Line lines[LogMux_CHANNEL_SIZE];
+    volatile uint32_t head;                              /* Written by the producer only */
+    volatile uint32_t tail;                              /* Written by the writer only */
+    volatile uint32_t droppedCnt[LogMux_PRIORITY_COUNT]; /* Lines dropped because the channel was full */
+    volatile uint32_t highWaterMark;                     /* Maximum number of lines queued */
+} LogMux_Channel;
+
+/* Multiplexer object. The fields are private, except for the channel counters. */
+typedef struct
+{
+    LogMux_Params params;
+    LogMux_Channel channels[LogMux_CHANNEL_COUNT];
+    uint32_t nextChannel; /* First channel considered on the next write, for fairness */
+} LogMux_Object;
+
+/*
+ *  ======== LogMux_init ========
+ *  Initializes a multiplexer with empty channels. Must be called before the
+ *  producer threads are started.
+ */
+extern void LogMux_init(LogMux_Object *obj, const LogMux_Params *params);
+
+/*
+ *  ======== LogMux_printf ========
+ *  Formats a line into a channel and signals the writer thread. Must only be
+ *  called by the thread owning the channel. Returns false if the line was
+ *  dropped or channel is not less than LogMux_CHANNEL_COUNT.
+ */
+extern bool LogMux_printf(LogMux_Object *obj, uint32_t channel, LogMux_Priority priority, const char *format, ...);
+
+/*
+ *  ======== LogMux_vprintf ========
+ */
+extern bool LogMux_vprintf(LogMux_Object *obj,
+                           uint32_t channel,
+                           LogMux_Priority priority,
+                           const char *format,
+                           va_list args);
+
+/*
+ *  ======== LogMux_drain ========
+ *  Writes all queued lines, highest priority first. Must only be called by
+ *  the writer thread. Returns the number of lines written.
+ */
+extern uint32_t LogMux_drain(LogMux_Object *obj);
+
+/*
+ *  ======== LogMux_getDroppedCnt ========
+ *  Returns the number of lines of the given priority dropped on all channels.
+ */
+extern uint32_t LogMux_getDroppedCnt(const LogMux_Object *obj, LogMux_Priority priority);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGMUX_H_ */
@@ -33,11 +33,13 @@
 /*
  *  ======== adcsinglechannel.c ========
  */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
 /* POSIX Header files */
 #include <pthread.h>
+#include <semaphore.h>
 
 /* Driver Header files */
 #include <ti/drivers/ADC.h>
@@ -46,11 +48,21 @@
 /* Driver configuration */
 #include "ti_drivers_config.h"
 
+#include "LogMux.h"
+
 /* ADC sample count */
 #define ADC_SAMPLE_COUNT (10)
 
 #define THREADSTACKSIZE (768)
 
+/* Output channel of each thread */
+#define LOG_CHANNEL_THREAD0 (0U)
+#define LOG_CHANNEL_THREAD1 (1U)
+#define LOG_CHANNEL_MAIN    (2U)
+
+/* Number of threads sampling the ADC */
+#define ADC_THREAD_COUNT (2U)
+
 /* ADC conversion result variables */
 uint16_t adcValue0;
 uint32_t adcValue0MicroVolt;
@@ -59,6 +71,43 @@ uint32_t adcValue1MicroVolt[ADC_SAMPLE_COUNT];
 
 static Display_Handle display;
 
+/* Output of all threads, written by mainThread */
+static LogMux_Object logMux;
+
+/* Posted when a line is queued or a sampling thread is done */
+static sem_t logSem;
+
+/* Posted by each sampling thread when it is done */
+static sem_t threadDoneSem;
+
+/*
+ *  ======== writeLine ========
+ *  Output multiplexer write function. Only called by mainThread.
+ */
+static void writeLine(void *arg, const char *line)
+{
+    Display_printf(display, 0, 0, "%s", line);
+}
+
+/*
+ *  ======== signalWriter ========
+ *  Output multiplexer signal function.
+ */
+static void signalWriter(void *arg)
+{
+    sem_post(&logSem);
+}
+
+/*
+ *  ======== threadDone ========
+ *  Called by each sampling thread before it returns.
+ */
+static void threadDone(void)
+{
+    sem_post(&threadDoneSem);
+    sem_post(&logSem);
+}
+
 /*
  *  ======== threadFxn0 ========
  *  Open an ADC instance and get a sampling result from a one-shot conversion.
@@ -74,7 +123,7 @@ void *threadFxn0(void *arg0)
 
     if (adc == NULL)
     {
-        Display_printf(display, 0, 0, "Error initializing CONFIG_ADC_0\n");
+        LogMux_printf(&logMux, LOG_CHANNEL_THREAD0, LogMux_PRIORITY_HIGH, "Error initializing CONFIG_ADC_0\n");
         while (1) {}
     }
 
@@ -86,16 +135,22 @@ void *threadFxn0(void *arg0)
 
         adcValue0MicroVolt = ADC_convertRawToMicroVolts(adc, adcValue0);
 
-        Display_printf(display, 0, 0, "CONFIG_ADC_0 raw result: %d\n", adcValue0);
-        Display_printf(display, 0, 0, "CONFIG_ADC_0 convert result: %d uV\n", adcValue0MicroVolt);
+        LogMux_printf(&logMux, LOG_CHANNEL_THREAD0, LogMux_PRIORITY_LOW, "CONFIG_ADC_0 raw result: %d\n", adcValue0);
+        LogMux_printf(&logMux,
+                      LOG_CHANNEL_THREAD0,
+                      LogMux_PRIORITY_NORMAL,
+                      "CONFIG_ADC_0 convert result: %d uV\n",
+                      adcValue0MicroVolt);
     }
     else
     {
-        Display_printf(display, 0, 0, "CONFIG_ADC_0 convert failed\n");
+        LogMux_printf(&logMux, LOG_CHANNEL_THREAD0, LogMux_PRIORITY_HIGH, "CONFIG_ADC_0 convert failed\n");
     }
 
     ADC_close(adc);
 
+    threadDone();
+
     return (NULL);
 }
 
@@ -116,7 +171,7 @@ void *threadFxn1(void *arg0)
 
     if (adc == NULL)
     {
-        Display_printf(display, 0, 0, "Error initializing CONFIG_ADC_1\n");
+        LogMux_printf(&logMux, LOG_CHANNEL_THREAD1, LogMux_PRIORITY_HIGH, "Error initializing CONFIG_ADC_1\n");
         while (1) {}
     }
 
@@ -129,17 +184,29 @@ void *threadFxn1(void *arg0)
 
             adcValue1MicroVolt[i] = ADC_convertToMicroVolts(adc, adcValue1[i]);
 
-            Display_printf(display, 0, 0, "CONFIG_ADC_1 raw result (%d): %d\n", i, adcValue1[i]);
-            Display_printf(display, 0, 0, "CONFIG_ADC_1 convert result (%d): %d uV\n", i, adcValue1MicroVolt[i]);
+            LogMux_printf(&logMux,
+                          LOG_CHANNEL_THREAD1,
+                          LogMux_PRIORITY_LOW,
+                          "CONFIG_ADC_1 raw result (%d): %d\n",
+                          i,
+                          adcValue1[i]);
+            LogMux_printf(&logMux,
+                          LOG_CHANNEL_THREAD1,
+                          LogMux_PRIORITY_NORMAL,
+                          "CONFIG_ADC_1 convert result (%d): %d uV\n",
+                          i,
+                          adcValue1MicroVolt[i]);
         }
         else
         {
-            Display_printf(display, 0, 0, "CONFIG_ADC_1 convert failed (%d)\n", i);
+            LogMux_printf(&logMux, LOG_CHANNEL_THREAD1, LogMux_PRIORITY_HIGH, "CONFIG_ADC_1 convert failed (%d)\n", i);
         }
     }
 
     ADC_close(adc);
 
+    threadDone();
+
     return (NULL);
 }
 
@@ -153,6 +220,9 @@ void *mainThread(void *arg0)
     struct sched_param priParam;
     int retc;
     int detachState;
+    bool dropsReported     = false;
+    uint32_t threadDoneCnt = 0U;
+    LogMux_Params logMuxParams;
 
     /* Call driver init functions */
     ADC_init();
@@ -166,7 +236,28 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
-    Display_printf(display, 0, 0, "Starting the acdsinglechannel example\n");
+    /* Collect the output of all threads, to be written by this thread */
+    retc = sem_init(&logSem, 0, 0);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+    retc = sem_init(&threadDoneSem, 0, 0);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+    logMuxParams.writeFxn  = writeLine;
+    logMuxParams.signalFxn = signalWriter;
+    logMuxParams.arg       = NULL;
+
+    LogMux_init(&logMux, &logMuxParams);
+
+    LogMux_printf(&logMux, LOG_CHANNEL_MAIN, LogMux_PRIORITY_NORMAL, "Starting the acdsinglechannel example\n");
 
     /* Create application threads */
     pthread_attr_init(&attrs);
@@ -206,5 +297,31 @@ void *mainThread(void *arg0)
         while (1) {}
     }
 
-    return (NULL);
+    /* Write the lines queued by all threads. The sampling threads never wait
+     * for the UART, and their lines are never interleaved.
+     */
+    while (1)
+    {
+        sem_wait(&logSem);
+        LogMux_drain(&logMux);
+
+        /* Count the sampling threads done, only in this thread */
+        while (sem_trywait(&threadDoneSem) == 0)
+        {
+            threadDoneCnt++;
+        }
+
+        if ((threadDoneCnt == ADC_THREAD_COUNT) && !dropsReported)
+        {
+            dropsReported = true;
+
+            LogMux_printf(&logMux,
+                          LOG_CHANNEL_MAIN,
+                          LogMux_PRIORITY_HIGH,
+                          "Lines dropped: low %u, normal %u, high %u\n",
+                          (unsigned int)LogMux_getDroppedCnt(&logMux, LogMux_PRIORITY_LOW),
+                          (unsigned int)LogMux_getDroppedCnt(&logMux, LogMux_PRIORITY_NORMAL),
+                          (unsigned int)LogMux_getDroppedCnt(&logMux, LogMux_PRIORITY_HIGH));
+        }
+    }
 }
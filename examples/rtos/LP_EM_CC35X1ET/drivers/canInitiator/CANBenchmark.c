@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANBenchmark.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "CANBenchmark.h"
+
+static CANBenchmark_Params params;
+
+/* Outstanding requests, indexed by sequence number modulo the window */
+static bool slotBusy[CANBenchmark_WINDOW_MAX];
+static uint32_t slotSeq[CANBenchmark_WINDOW_MAX];
+static uint32_t slotSendTime[CANBenchmark_WINDOW_MAX];
+
+static uint32_t nextSeq;
+static uint32_t outstanding;
+static uint32_t highestSeq;
+static uint32_t startTime;
+static uint32_t lastRxTime;
+
+static uint32_t received;
+static uint32_t lost;
+static uint32_t reordered;
+static uint32_t unexpected;
+static uint32_t latencyMax;
+static uint32_t histogram[CANBenchmark_HIST_BINS];
+
+/*
+ *  ======== percentile ========
+ *  Returns the upper bound of the histogram bin holding the given percentile,
+ *  limited to the maximum latency.
+ */
+static uint32_t percentile(uint32_t percent)
+{
+    uint32_t bin;
+    uint32_t bound;
+    uint32_t count;
+    uint32_t target;
+
+    if (received == 0U)
+    {
+        return 0U;
+    }
+
+    /* Rank of the percentile sample, rounded up */
+    target = (uint32_t)((((uint64_t)received * percent) + 99U) / 100U);
+    count  = 0U;
+
+    for (bin = 0U; bin < (CANBenchmark_HIST_BINS - 1U); bin++)
+    {
+        count += histogram[bin];
+        if (count >= target)
+        {
+            bound = (bin + 1U) * CANBenchmark_HIST_BIN_USEC;
+
+            return (bound < latencyMax) ? bound : latencyMax;
+        }
+    }
+
+    /* The percentile is beyond the histogram range */
+    return latencyMax;
+}
+
+/*
+ *  ======== CANBenchmark_start ========
+ */
+void CANBenchmark_start(const CANBenchmark_Params *benchParams, uint32_t now)
+{
+    uint32_t i;
+
+    params = *benchParams;
+
+    if (params.window > CANBenchmark_WINDOW_MAX)
+    {
+        params.window = CANBenchmark_WINDOW_MAX;
+    }
+    else if (params.window == 0U)
+    {
+        params.window = 1U;
+    }
+
+    for (i = 0U; i < CANBenchmark_WINDOW_MAX; i++)
+    {
+        slotBusy[i] = false;
+    }
+
+    for (i = 0U; i < CANBenchmark_HIST_BINS; i++)
+    {
+        histogram[i] = 0U;
+    }
+
+    nextSeq     = 0U;
+    outstanding = 0U;
+    highestSeq  = 0U;
+    startTime   = now;
+    lastRxTime  = now;
+    received    = 0U;
+    lost        = 0U;
+    reordered   = 0U;
+    unexpected  = 0U;
+    latencyMax  = 0U;
+}
+
+/*
+ *  ======== CANBenchmark_nextRequest ========
+ */
+bool CANBenchmark_nextRequest(uint32_t *seq)
+{
+    if ((nextSeq >= params.frameCount) || slotBusy[nextSeq % params.window])
+    {
+        return false;
+    }
+
+    *seq = nextSeq;
+
+    return true;
+}
+
+/*
+ *  ======== CANBenchmark_encode ========
+ */
+void CANBenchmark_encode(uint8_t *data, uint32_t payloadSize, uint32_t seq, uint32_t sendTime)
+{
+    uint32_t i;
+
+    data[0] = (uint8_t)seq;
+    data[1] = (uint8_t)(seq >> 8);
+    data[2] = (uint8_t)(seq >> 16);
+    data[3] = (uint8_t)(seq >> 24);
+    data[4] = (uint8_t)sendTime;
+    data[5] = (uint8_t)(sendTime >> 8);
+    data[6] = (uint8_t)(sendTime >> 16);
+    data[7] = (uint8_t)(sendTime >> 24);
+
+    for (i = CANBenchmark_PAYLOAD_MIN; i < payloadSize; i++)
+    {
+        data[i] = (uint8_t)i;
+    }
+}
+
+/*
+ *  ======== CANBenchmark_decode ========
+ */
+void CANBenchmark_decode(const uint8_t *data, uint32_t *seq, uint32_t *sendTime)
+{
+    *seq = (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+    *sendTime = (uint32_t)data[4] | ((uint32_t)data[5] << 8) | ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+}
+
+/*
+ *  ======== CANBenchmark_requestSent ========
+ */
+void CANBenchmark_requestSent(uint32_t seq, uint32_t sendTime)
+{
+    uint32_t slot = seq % params.window;
+
+    slotBusy[slot]     = true;
+    slotSeq[slot]      = seq;
+    slotSendTime[slot] = sendTime;
+
+    outstanding++;
+    nextSeq = seq + 1U;
+}
+
+/*
+ *  ======== CANBenchmark_requestFailed ========
+ */
+void CANBenchmark_requestFailed(uint32_t seq)
+{
+    slotBusy[seq % params.window] = false;
+
+    outstanding--;
+    nextSeq = seq;
+}
+
+/*
+ *  ======== CANBenchmark_responseReceived ========
+ */
+void CANBenchmark_responseReceived(uint32_t seq, uint32_t sendTime, uint32_t rxTime)
+{
+    uint32_t bin;
+    uint32_t latency;
+    uint32_t slot = seq % params.window;
+
+    if ((seq >= nextSeq) || !slotBusy[slot] || (slotSeq[slot] != seq))
+    {
+        /* Duplicate, corrupted, or answered after the timeout */
+        unexpected++;
+        return;
+    }
+
+    slotBusy[slot] = false;
+    outstanding--;
+
+    if ((received != 0U) && (seq < highestSeq))
+    {
+        reordered++;
+    }
+    else
+    {
+        highestSeq = seq;
+    }
+
+    received++;
+    lastRxTime = rxTime;
+
+    latency = (rxTime - sendTime) / CANBenchmark_TICKS_PER_USEC;
+
+    if (latency > latencyMax)
+    {
+        latencyMax = latency;
+    }
+
+    bin = latency / CANBenchmark_HIST_BIN_USEC;
+    if (bin >= CANBenchmark_HIST_BINS)
+    {
+        bin = CANBenchmark_HIST_BINS - 1U;
+    }
+
+    histogram[bin]++;
+}
+
+/*
+ *  ======== CANBenchmark_expire ========
+ */
+void CANBenchmark_expire(uint32_t now)
+{
+    uint32_t slot;
+
+    for (slot = 0U; slot < params.window; slot++)
+    {
+        if (slotBusy[slot] && ((now - slotSendTime[slot]) > params.timeout))
+        {
+            slotBusy[slot] = false;
+            outstanding--;
+            lost++;
+        }
+    }
+}
+
+/*
+ *  ======== CANBenchmark_isDone ========
+ */
+bool CANBenchmark_isDone(void)
+{
+    return (nextSeq >= params.frameCount) && (outstanding == 0U);
+}
+
+/*
+ *  ======== CANBenchmark_getResult ========
+ */
+void CANBenchmark_getResult(CANBenchmark_Result *result)
+{
+    result->frameCount     = params.frameCount;
+    result->payloadSize    = params.payloadSize;
+    result->window         = params.window;
+    result->sent           = nextSeq;
+    result->received       = received;
+    result->lost           = lost;
+    result->reordered      = reordered;
+    result->unexpected     = unexpected;
+    result->latencyP50Usec = percentile(50U);
+    result->latencyP99Usec = percentile(99U);
+    result->latencyMaxUsec = latencyMax;
+    result->elapsedUsec    = (lastRxTime - startTime) / CANBenchmark_TICKS_PER_USEC;
+
+    if (result->elapsedUsec != 0U)
+    {
+        result->framesPerSec      = (uint32_t)(((uint64_t)received * 1000000U) / result->elapsedUsec);
+        result->payloadBitsPerSec = (uint32_t)(((uint64_t)received * params.payloadSize * 8U * 1000000U) /
+                                               result->elapsedUsec);
+    }
+    else
+    {
+        result->framesPerSec      = 0U;
+        result->payloadBitsPerSec = 0U;
+    }
+}
+
+/*
+ *  ======== CANBenchmark_getHistogram ========
+ */
+const uint32_t *CANBenchmark_getHistogram(void)
+{
+    return histogram;
+}
+
+/*
+ *  ======== CANBenchmark_formatResult ========
+ */
+int CANBenchmark_formatResult(const CANBenchmark_Result *result, char *buf, size_t size)
+{
+    return snprintf(buf,
+                    size,
+                    "{\"frames\":%lu,\"payload_bytes\":%lu,\"window\":%lu,\"sent\":%lu,\"received\":%lu,"
+                    "\"lost\":%lu,\"reordered\":%lu,\"unexpected\":%lu,\"rtt_p50_us\":%lu,\"rtt_p99_us\":%lu,"
+                    "\"rtt_max_us\":%lu,\"elapsed_us\":%lu,\"frames_per_s\":%lu,\"payload_bps\":%lu}\r\n",
+                    (unsigned long)result->frameCount,
+                    (unsigned long)result->payloadSize,
+                    (unsigned long)result->window,
+                    (unsigned long)result->sent,
+                    (unsigned long)result->received,
+                    (unsigned long)result->lost,
+                    (unsigned long)result->reordered,
+                    (unsigned long)result->unexpected,
+                    (unsigned long)result->latencyP50Usec,
+                    (unsigned long)result->latencyP99Usec,
+                    (unsigned long)result->latencyMaxUsec,
+                    (unsigned long)result->elapsedUsec,
+                    (unsigned long)result->framesPerSec,
+                    (unsigned long)result->payloadBitsPerSec);
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANBenchmark.h ========
+ *  Round-trip latency and throughput benchmark for a CAN request/response
+ *  exchange.
+ *
+ *  The benchmark numbers the requests and keeps a window of outstanding
+ *  requests. Each request payload carries its sequence number and send time.
+ *  Responses are matched to requests by sequence number. Requests that are not
+ *  answered within the timeout are counted as lost, and responses that arrive
+ *  after a response with a higher sequence number are counted as reordered.
+ *
+ *  The module only does bookkeeping. The caller transmits the requests,
+ *  receives the responses and supplies all times. Times are 32-bit values in
+ *  250ns ticks, so the module does not depend on any driver and can also be
+ *  driven by a host harness.
+ */
+
+#ifndef CANBENCHMARK_H_
+#define CANBENCHMARK_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of outstanding requests */
+#define CANBenchmark_WINDOW_MAX 32U
+
+/* Round-trip latency histogram: CANBenchmark_HIST_BINS bins of
+ * CANBenchmark_HIST_BIN_USEC each. Longer latencies land in the last bin.
+ */
+#define CANBenchmark_HIST_BINS     128U
+#define CANBenchmark_HIST_BIN_USEC 25U
+
+/* Time ticks per microsecond */
+#define CANBenchmark_TICKS_PER_USEC 4U
+
+/* Payload bytes used by the sequence number and send time */
+#define CANBenchmark_PAYLOAD_MIN 8U
+
+/* Benchmark parameters */
+typedef struct
+{
+    uint32_t frameCount;  /* Number of requests to send */
+    uint32_t window;      /* Maximum outstanding requests, 1 to CANBenchmark_WINDOW_MAX */
+    uint32_t payloadSize; /* Payload bytes per request, at least CANBenchmark_PAYLOAD_MIN */
+    uint32_t timeout;     /* Time after which an unanswered request is lost, in ticks */
+} CANBenchmark_Params;
+
+/* Benchmark results */
+typedef struct
+{
+    uint32_t frameCount;
+    uint32_t payloadSize;
+    uint32_t window;
+    uint32_t sent;           /* Requests sent */
+    uint32_t received;       /* Responses matched to an outstanding request */
+    uint32_t lost;           /* Requests not answered within the timeout */
+    uint32_t reordered;      /* Responses received after a later response */
+    uint32_t unexpected;     /* Responses not matching an outstanding request */
+    uint32_t latencyP50Usec; /* Round-trip latency percentiles, histogram bin resolution */
+    uint32_t latencyP99Usec;
+    uint32_t latencyMaxUsec; /* Exact maximum round-trip latency */
+    uint32_t elapsedUsec;    /* First request to last response */
+    uint32_t framesPerSec;   /* Responses per second */
+    uint32_t payloadBitsPerSec;
+} CANBenchmark_Result;
+
+/*
+ *  ======== CANBenchmark_start ========
+ *  Resets the statistics and starts a benchmark at time now.
+ */
+extern void CANBenchmark_start(const CANBenchmark_Params *params, uint32_t now);
+
+/*
+ *  ======== CANBenchmark_nextRequest ========
+ *  Returns true and the sequence number of the next request if a request may
+ *  be sent now, or false if the window is full or all requests were sent.
+ */
+extern bool CANBenchmark_nextRequest(uint32_t *seq);
+
+/*
+ *  ======== CANBenchmark_encode ========
+ *  Fills a request payload of payloadSize bytes with the sequence number, the
+ *  send time and a byte pattern.
+ */
+extern void CANBenchmark_encode(uint8_t *data, uint32_t payloadSize, uint32_t seq, uint32_t sendTime);
+
+/*
+ *  ======== CANBenchmark_decode ========
+ *  Extracts the sequence number and send time from a request payload.
+ */
+extern void CANBenchmark_decode(const uint8_t *data, uint32_t *seq, uint32_t *sendTime);
+
+/*
+ *  ======== CANBenchmark_requestSent ========
+ *  Marks the request returned by CANBenchmark_nextRequest() as outstanding.
+ *  Call it before the request is transmitted, so the response always finds
+ *  the request outstanding.
+ */
+extern void CANBenchmark_requestSent(uint32_t seq, uint32_t sendTime);
+
+/*
+ *  ======== CANBenchmark_requestFailed ========
+ *  Releases a request marked as outstanding whose transmission failed. The
+ *  same sequence number is returned by the next CANBenchmark_nextRequest().
+ */
+extern void CANBenchmark_requestFailed(uint32_t seq);
+
+/*
+ *  ======== CANBenchmark_responseReceived ========
+ *  Matches a response to its request. sendTime is the send time carried in
+ *  the response and rxTime the time the response was received.
+ */
+extern void CANBenchmark_responseReceived(uint32_t seq, uint32_t sendTime, uint32_t rxTime);
+
+/*
+ *  ======== CANBenchmark_expire ========
+ *  Counts outstanding requests older than the timeout as lost.
+ */
+extern void CANBenchmark_expire(uint32_t now);
+
+/*
+ *  ======== CANBenchmark_isDone ========
+ *  Returns true once all requests were sent and none is outstanding.
+ */
+extern bool CANBenchmark_isDone(void);
+
+/*
+ *  ======== CANBenchmark_getResult ========
+ */
+extern void CANBenchmark_getResult(CANBenchmark_Result *result);
+
+/*
+ *  ======== CANBenchmark_getHistogram ========
+ *  Returns the round-trip latency histogram of CANBenchmark_HIST_BINS bins.
+ */
+extern const uint32_t *CANBenchmark_getHistogram(void);
+
+/*
+ *  ======== CANBenchmark_formatResult ========
+ *  Formats the results as a single line JSON object terminated by "\r\n".
+ *  Returns the number of characters written, excluding the terminating null.
+ */
+extern int CANBenchmark_formatResult(const CANBenchmark_Result *result, char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANBENCHMARK_H_ */
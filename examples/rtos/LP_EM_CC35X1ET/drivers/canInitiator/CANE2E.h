@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANE2E.h ========
+ *  End-to-end protection of CAN payloads with a CRC and an alive counter.
+ *
+ *  The sender writes a rolling 8-bit counter and a CRC into configurable
+ *  positions of the payload. The CRC covers the 16-bit data ID of the
+ *  message, which is not transmitted, followed by all payload bytes except
+ *  the CRC itself. A message sent with the wrong ID therefore fails the CRC
+ *  check. The receiver checks the CRC, and compares the counter with that of
+ *  the last valid message to detect repeated, lost and out of order messages.
+ *  This follows the scheme of the AUTOSAR E2E profiles 1 and 5.
+ *
+ *  Two CRCs are supported, both MSB first:
+ *
+ *    CANE2E_CRC8   CRC-8 SAE J1850, polynomial 0x1D, init 0xFF, XOR out 0xFF
+ *    CANE2E_CRC16  CRC-16 CCITT, polynomial 0x1021, init 0xFFFF
+ *
+ *  The CRCs are computed four bytes at a time with slicing-by-4 lookup
+ *  tables. The tables are built in RAM by CANE2E_init(), taking 1 KB for
+ *  CRC-8 and 2 KB for CRC-16, and are read without flash wait states.
+ *
+ *  The module only depends on the C library.
+ */
+
+#ifndef CANE2E_H_
+#define CANE2E_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* CRC start and final XOR values */
+#define CANE2E_CRC8_INIT     0xFFU
+#define CANE2E_CRC8_XOR_OUT  0xFFU
+#define CANE2E_CRC16_INIT    0xFFFFU
+#define CANE2E_CRC16_XOR_OUT 0x0000U
+
+/* CRC type */
+typedef enum
+{
+    CANE2E_CRC8, /* 1 byte */
+    CANE2E_CRC16 /* 2 bytes, most significant byte first */
+} CANE2E_CrcType;
+
+/* Result of a check */
+typedef enum
+{
+    CANE2E_OK,             /* Valid message following the last one */
+    CANE2E_OK_SOME_LOST,   /* Valid message, with up to maxDeltaCounter - 1 messages lost */
+    CANE2E_INITIAL,        /* First valid message */
+    CANE2E_REPEATED,       /* Valid message with the counter of the last one */
+    CANE2E_WRONG_SEQUENCE, /* Valid message, with more messages lost or out of order. Resynchronizes. */
+    CANE2E_ERROR           /* CRC error or payload too short */
+} CANE2E_Status;
+
+/* Protection of one message ID */
+typedef struct
+{
+    uint16_t dataId;         /* Identifies the message in the CRC */
+    CANE2E_CrcType crcType;
+    uint8_t crcOffset;       /* Payload position of the CRC */
+    uint8_t counterOffset;   /* Payload position of the counter */
+    uint8_t maxDeltaCounter; /* Largest counter increment accepted, 1 if no message may be lost */
+} CANE2E_Config;
+
+/* Check statistics */
+typedef struct
+{
+    uint32_t checkCnt;       /* Messages checked */
+    uint32_t okCnt;          /* CANE2E_OK and CANE2E_OK_SOME_LOST results */
+    uint32_t lostCnt;        /* Messages found missing from the counter increments */
+    uint32_t repeatedCnt;
+    uint32_t wrongSequenceCnt;
+    uint32_t errorCnt;
+} CANE2E_Stats;
+
+/* Sender or receiver state. The fields are private, except for stats. */
+typedef struct
+{
+    CANE2E_Config config;
+    CANE2E_Stats stats;
+    uint8_t counter; /* Counter of the next message sent, or of the last message received */
+    bool synced;     /* A valid message was received */
+} CANE2E_Object;
+
+/*
+ *  ======== CANE2E_init ========
+ *  Builds the CRC tables. Must be called once before the other functions.
+ */
+extern void CANE2E_init(void);
+
+/*
+ *  ======== CANE2E_construct ========
+ *  Initializes the state of a sender or receiver of one message ID.
+ */
+extern void CANE2E_construct(CANE2E_Object *obj, const CANE2E_Config *config);
+
+/*
+ *  ======== CANE2E_protect ========
+ *  Writes the counter and the CRC into a payload of length bytes and
+ *  increments the counter. Returns false if the payload is too short for the
+ *  configured positions.
+ */
+extern bool CANE2E_protect(CANE2E_Object *obj, uint8_t *data, size_t length);
+
+/*
+ *  ======== CANE2E_check ========
+ *  Checks a received payload of length bytes.
+ */
+extern CANE2E_Status CANE2E_check(CANE2E_Object *obj, const uint8_t *data, size_t length);
+
+/*
+ *  ======== CANE2E_crc8 ========
+ *  Updates a CRC-8 with length bytes. Start with CANE2E_CRC8_INIT and XOR the
+ *  result with CANE2E_CRC8_XOR_OUT.
+ */
+extern uint8_t CANE2E_crc8(uint8_t crc, const uint8_t *data, size_t length);
+
+/*
+ *  ======== CANE2E_crc16 ========
+ *  Updates a CRC-16 with length bytes. Start with CANE2E_CRC16_INIT and XOR
+ *  the result with CANE2E_CRC16_XOR_OUT.
+ */
+extern uint16_t CANE2E_crc16(uint16_t crc, const uint8_t *data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANE2E_H_ */
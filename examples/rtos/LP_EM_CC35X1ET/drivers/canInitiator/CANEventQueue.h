@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANEventQueue.h ========
+ *  Fixed-capacity single-producer/single-consumer queue for CAN driver events.
+ *
+ *  The CAN driver event callback (producer) runs in interrupt context and the
+ *  application thread (consumer) runs at task level. Each side owns exactly
+ *  one index, so no locking is required on a single-core device as long as
+ *  only one producer and one consumer access the queue.
+ */
+
+#ifndef CANEVENTQUEUE_H_
+#define CANEVENTQUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of queue entries. Must be a power of two. */
+#ifndef CANEventQueue_SIZE
+    #define CANEventQueue_SIZE 16U
+#endif
+
+#if (CANEventQueue_SIZE & (CANEventQueue_SIZE - 1U)) != 0U
+    #error "CANEventQueue_SIZE must be a power of two"
+#endif
+
+/* CAN event and its associated event data */
+typedef struct
+{
+    uint32_t event;
+    uint32_t data;
+} CANEventQueue_Entry;
+
+/*
+ * Queue object. The head and tail indices are free-running and are only
+ * masked when indexing the entry array, so (head - tail) is always the number
+ * of queued entries, even after the 32-bit indices wrap.
+ */
+typedef struct
+{
+    volatile CANEventQueue_Entry entries[CANEventQueue_SIZE];
+    volatile uint32_t head;          /* Written by the producer only */
+    volatile uint32_t tail;          /* Written by the consumer only */
+    volatile uint32_t overflowCnt;   /* Events dropped because the queue was full */
+    volatile uint32_t lastLostEvent; /* Most recent event dropped */
+    volatile uint32_t highWaterMark; /* Maximum number of entries queued */
+} CANEventQueue_Object;
+
+/*
+ *  ======== CANEventQueue_init ========
+ *  Initializes an empty queue. Must be called before the CAN driver is opened.
+ */
+extern void CANEventQueue_init(CANEventQueue_Object *queue);
+
+/*
+ *  ======== CANEventQueue_put ========
+ *  Appends an event to the queue. Intended to be called from the CAN driver
+ *  event callback. Returns false and increments the overflow counter if the
+ *  queue is full.
+ */
+extern bool CANEventQueue_put(CANEventQueue_Object *queue, uint32_t event, uint32_t data);
+
+/*
+ *  ======== CANEventQueue_get ========
+ *  Removes the oldest event from the queue. Returns false if the queue is
+ *  empty.
+ */
+extern bool CANEventQueue_get(CANEventQueue_Object *queue, uint32_t *event, uint32_t *data);
+
+/*
+ *  ======== CANEventQueue_getCount ========
+ *  Returns the number of events currently queued.
+ */
+extern uint32_t CANEventQueue_getCount(const CANEventQueue_Object *queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANEVENTQUEUE_H_ */
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANRpc.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "CANRpc.h"
+
+#define PENDING_MASK (CANRpc_PENDING_SIZE - 1U)
+
+/*
+ *  ======== sendRequest ========
+ *  Builds and sends the request frame of a pending call. Returns false if the
+ *  send function refused the frame.
+ */
+static bool sendRequest(CANRpc_Object *obj, const CANRpc_Pending *pending)
+{
+    CAN_TxBufElement elem;
+
+    obj->params.binding.encodeFxn(obj->params.binding.arg, pending->payload, pending->length, &elem);
+
+    if (!obj->params.sendFxn(obj->params.arg, &elem))
+    {
+        obj->stats.sendFailCnt++;
+
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== complete ========
+ *  Frees the entry of a call before calling its completion function, so the
+ *  completion function can make a new call.
+ */
+static void complete(CANRpc_Object *obj,
+                     CANRpc_Pending *pending,
+                     CANRpc_Status status,
+                     const uint8_t *data,
+                     size_t length)
+{
+    pending->busy = false;
+    obj->inFlight--;
+
+    pending->doneFxn(pending->doneArg, status, data, length);
+}
+
+/*
+ *  ======== CANRpc_init ========
+ */
+void CANRpc_init(CANRpc_Object *obj, const CANRpc_Params *params)
+{
+    memset(obj, 0, sizeof(*obj));
+
+    obj->params = *params;
+
+    CANRpc_setWindow(obj, params->window);
+}
+
+/*
+ *  ======== CANRpc_setWindow ========
+ */
+void CANRpc_setWindow(CANRpc_Object *obj, uint32_t window)
+{
+    obj->params.window = (window > CANRpc_PENDING_SIZE) ? CANRpc_PENDING_SIZE : window;
+}
+
+/*
+ *  ======== CANRpc_call ========
+ */
+bool CANRpc_call(CANRpc_Object *obj,
+                 const uint8_t *data,
+                 size_t length,
+                 CANRpc_DoneFxn doneFxn,
+                 void *doneArg,
+                 uint32_t now)
+{
+    CANRpc_Pending *pending;
+    uint16_t corrId;
+
+    if ((obj->inFlight >= obj->params.window) || (length > (CANRpc_PAYLOAD_MAX - CANRpc_HEADER_SIZE)))
+    {
+        return false;
+    }
+
+    /* Skip the correlation IDs whose entry is still taken by an older call.
+     * A free entry is found within CANRpc_PENDING_SIZE IDs, as fewer calls
+     * than that are in flight.
+     */
+    do
+    {
+        corrId  = obj->nextCorrId;
+        pending = &obj->pending[corrId & PENDING_MASK];
+        obj->nextCorrId++;
+    } while (pending->busy);
+
+    pending->busy       = true;
+    pending->corrId     = corrId;
+    pending->retries    = 0U;
+    pending->length     = (uint8_t)(CANRpc_HEADER_SIZE + length);
+    pending->deadline   = now + (obj->params.timeoutUs * CANRpc_TICKS_PER_USEC);
+    pending->doneFxn    = doneFxn;
+    pending->doneArg    = doneArg;
+    pending->payload[0] = (uint8_t)corrId;
+    pending->payload[1] = (uint8_t)(corrId >> 8);
+
+    memcpy(&pending->payload[CANRpc_HEADER_SIZE], data, length);
+
+    obj->inFlight++;
+    obj->stats.callCnt++;
+
+    if (obj->inFlight > obj->stats.maxInFlight)
+    {
+        obj->stats.maxInFlight = obj->inFlight;
+    }
+
+    pending->sent = sendRequest(obj, pending);
+
+    return true;
+}
+
+/*
+ *  ======== CANRpc_receive ========
+ */
+bool CANRpc_receive(CANRpc_Object *obj, const CAN_RxBufElement *elem)
+{
+    CANRpc_Pending *pending;
+    uint8_t payload[CANRpc_PAYLOAD_MAX];
+    uint16_t corrId;
+    size_t length;
+
+    length = obj->params.binding.decodeFxn(obj->params.binding.arg, elem, payload);
+    if (length < CANRpc_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    corrId  = (uint16_t)(payload[0] | ((uint16_t)payload[1] << 8));
+    pending = &obj->pending[corrId & PENDING_MASK];
+
+    if (!pending->busy || (pending->corrId != corrId))
+    {
+        obj->stats.unmatchedCnt++;
+
+        return false;
+    }
+
+    obj->stats.completedCnt++;
+
+    complete(obj, pending, CANRpc_SUCCESS, &payload[CANRpc_HEADER_SIZE], length - CANRpc_HEADER_SIZE);
+
+    return true;
+}
+
+/*
+ *  ======== CANRpc_process ========
+ */
+void CANRpc_process(CANRpc_Object *obj, uint32_t now)
+{
+    CANRpc_Pending *pending;
+    uint32_t i;
+
+    for (i = 0U; (i < CANRpc_PENDING_SIZE) && (obj->inFlight > 0U); i++)
+    {
+        pending = &obj->pending[i];
+
+        if (!pending->busy)
+        {
+            continue;
+        }
+
+        if (!pending->sent)
+        {
+            /* The response time is counted from the request being queued */
+            pending->sent = sendRequest(obj, pending);
+            if (pending->sent)
+            {
+                pending->deadline = now + (obj->params.timeoutUs * CANRpc_TICKS_PER_USEC);
+            }
+        }
+        else if ((int32_t)(now - pending->deadline) >= 0)
+        {
+            if (pending->retries < obj->params.maxRetries)
+            {
+                pending->retries++;
+                obj->stats.retryCnt++;
+
+                pending->sent     = sendRequest(obj, pending);
+                pending->deadline = now + (obj->params.timeoutUs * CANRpc_TICKS_PER_USEC);
+            }
+            else
+            {
+                obj->stats.timeoutCnt++;
+
+                complete(obj, pending, CANRpc_TIMEOUT, NULL, 0U);
+            }
+        }
+    }
+}
+
+/*
+ *  ======== CANRpc_getInFlight ========
+ */
+uint32_t CANRpc_getInFlight(const CANRpc_Object *obj)
+{
+    return obj->inFlight;
+}
+
+/*
+ *  ======== CANRpc_encodeEcho ========
+ */
+void CANRpc_encodeEcho(void *arg, const uint8_t *payload, size_t length, CAN_TxBufElement *elem)
+{
+    const CANRpc_EchoConfig *config = (const CANRpc_EchoConfig *)arg;
+    size_t frameLength;
+
+    elem->id  = config->id;
+    elem->rtr = 0U;
+    elem->xtd = config->xtd;
+#ifndef CAN_SUPPORTS_DCAN
+    elem->esi = 0U;
+    elem->brs = config->fd;
+    elem->fdf = config->fd;
+#endif /* CAN_SUPPORTS_DCAN */
+    elem->dlc = CANCodec_lengthToDlc((uint32_t)length);
+    elem->efc = 0U;
+    elem->mm  = 1U;
+
+    /* CAN FD lengths above 8 bytes are rounded up to the next DLC */
+    frameLength = CANCodec_dlcToLength(elem->dlc);
+
+    memcpy(elem->data, payload, length);
+    memset(&elem->data[length], 0, frameLength - length);
+}
+
+/*
+ *  ======== CANRpc_decodeEcho ========
+ */
+size_t CANRpc_decodeEcho(void *arg, const CAN_RxBufElement *elem, uint8_t *payload)
+{
+    const CANRpc_EchoConfig *config = (const CANRpc_EchoConfig *)arg;
+    uint32_t responseId;
+    size_t length;
+
+    responseId = ~config->id & (config->xtd ? 0x1FFFFFFFU : 0x7FFU);
+
+    if ((elem->id != responseId) || ((elem->xtd != 0U) != config->xtd))
+    {
+        return 0U;
+    }
+
+    length = CANCodec_dlcToLength(elem->dlc);
+
+    CANCodec_copyInverted(payload, elem->data, length);
+
+    return length;
+}
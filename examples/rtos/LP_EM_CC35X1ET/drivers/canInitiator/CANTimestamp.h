@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANTimestamp.h ========
+ *  Converts CAN Rx/Tx timestamps to Start Of Frame (SOF) times in an unwrapped
+ *  64-bit system timer (SYSTIM) time base.
+ *
+ *  The CAN timestamp counter is only 16 bits wide. With a timestamp prescaler
+ *  of 24 it ticks every 250ns and wraps every 16.384ms, so the delay between a
+ *  timestamp and the moment it is processed is only known modulo one counter
+ *  period. This module samples SYSTIM and the timestamp counter together,
+ *  extends SYSTIM to 64 bits and resolves counter wraps, optionally using a
+ *  caller supplied lower bound for the time of the event.
+ *
+ *  The lower 32 bits of every 64-bit time equal the SYSTIM register value, so
+ *  a time can be truncated to 32 bits wherever a SYSTIM value is expected.
+ */
+
+#ifndef CANTIMESTAMP_H_
+#define CANTIMESTAMP_H_
+
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Host System Clock (96 MHz) cycles per 250ns SYSTIM tick */
+#define CANTimestamp_HOST_CLK_PER_SYSTIM_TICK 24U
+
+/* Number of timestamp counter values before the counter wraps */
+#define CANTimestamp_COUNTER_RANGE 0x10000U
+
+/*
+ * Longest time in microseconds from the SOF of a received frame until the
+ * driver reports it in the event callback: the frame duration plus the
+ * interrupt latency. The default covers a classic CAN frame with 8 data
+ * bytes and worst-case bit stuffing at 125 kbit/s.
+ */
+#ifndef CANTimestamp_RX_MAX_AGE_USEC
+    #define CANTimestamp_RX_MAX_AGE_USEC 2000U
+#endif
+
+/* Snapshot of SYSTIM and the CAN timestamp counter taken at the same instant */
+typedef struct
+{
+    uint64_t systim; /* Unwrapped 64-bit SYSTIM time */
+    uint16_t tscv;   /* CAN timestamp counter value */
+} CANTimestamp_Ref;
+
+/*
+ *  ======== CANTimestamp_init ========
+ *  Must be called after CAN_open(). tsPrescaler is the timestamp prescaler
+ *  passed to CAN_open() in CAN_Params. The SOF to timestamp delay is derived
+ *  from the nominal bit timing of the CAN handle.
+ */
+extern void CANTimestamp_init(CAN_Handle handle, uint32_t tsPrescaler);
+
+/*
+ *  ======== CANTimestamp_getTime ========
+ *  Returns the current unwrapped 64-bit SYSTIM time. Can be called from any
+ *  context.
+ */
+extern uint64_t CANTimestamp_getTime(void);
+
+/*
+ *  ======== CANTimestamp_extendTime ========
+ *  Returns the latest 64-bit time, not later than now, whose lower 32 bits
+ *  equal systim.
+ */
+extern uint64_t CANTimestamp_extendTime(uint32_t systim);
+
+/*
+ *  ======== CANTimestamp_capture ========
+ *  Samples SYSTIM and the CAN timestamp counter with interrupts disabled.
+ *  Capture the reference after the timestamp to convert has been read from the
+ *  driver, so the timestamp is never later than the reference.
+ */
+extern void CANTimestamp_capture(CANTimestamp_Ref *ref);
+
+/*
+ *  ======== CANTimestamp_toSofTime ========
+ *  Converts a Rx/Tx timestamp to the SOF time of the frame. The timestamp must
+ *  be less than one counter period older than the reference.
+ */
+extern uint64_t CANTimestamp_toSofTime(const CANTimestamp_Ref *ref, uint16_t ts);
+
+/*
+ *  ======== CANTimestamp_toSofTimeAfter ========
+ *  Converts a Rx/Tx timestamp to the earliest SOF time that is not before
+ *  notBefore, such as the time a frame was passed to CAN_write(). The result
+ *  is correct for any delay between the timestamp and the reference, as long
+ *  as the SOF occurred less than one counter period after notBefore.
+ */
+extern uint64_t CANTimestamp_toSofTimeAfter(const CANTimestamp_Ref *ref, uint16_t ts, uint64_t notBefore);
+
+/*
+ *  ======== CANTimestamp_toRxSofTime ========
+ *  Converts the Rx timestamp of a frame read after the event callback reported
+ *  it at SYSTIM time eventTime. The SOF cannot precede eventTime by more than
+ *  CANTimestamp_RX_MAX_AGE_USEC, so the result is correct however late the
+ *  frame is read, as long as its SOF occurred less than one counter period
+ *  minus CANTimestamp_RX_MAX_AGE_USEC after eventTime.
+ */
+extern uint64_t CANTimestamp_toRxSofTime(const CANTimestamp_Ref *ref, uint16_t ts, uint32_t eventTime);
+
+/*
+ *  ======== CANTimestamp_getCounterPeriod ========
+ *  Returns the timestamp counter wrap period in SYSTIM ticks.
+ */
+extern uint32_t CANTimestamp_getCounterPeriod(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANTIMESTAMP_H_ */
@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== Telemetry.c ========
+ */
+
+#include <string.h>
+
+#include "Telemetry.h"
+
+#define RING_INDEX_MASK (Telemetry_RING_SIZE - 1U)
+
+/* Bytes of a frame around the payload */
+#define HEADER_SIZE 4U
+#define CRC_SIZE    2U
+
+/* Largest number of bytes added by the COBS encoding and the frame delimiter
+ * to a frame of up to 254 bytes.
+ */
+#define FRAMING_SIZE 3U
+
+#define CRC_INIT 0xFFFFU
+
+/* CRC-16 CCITT of each value of the upper four bits */
+static const uint16_t crcTable[16] = {0x0000U,
+                                      0x1021U,
+                                      0x2042U,
+                                      0x3063U,
+                                      0x4084U,
+                                      0x50A5U,
+                                      0x60C6U,
+                                      0x70E7U,
+                                      0x8108U,
+                                      0x9129U,
+                                      0xA14AU,
+                                      0xB16BU,
+                                      0xC18CU,
+                                      0xD1ADU,
+                                      0xE1CEU,
+                                      0xF1EFU};
+
+/*
+ *  ======== putByte ========
+ *  Adds a byte to the frame being queued, encoding it with COBS.
+ */
+static void putByte(Telemetry_Object *obj, uint8_t byte)
+{
+    obj->crc = (uint16_t)(obj->crc << 4) ^ crcTable[((obj->crc >> 12) ^ (byte >> 4)) & 0x0FU];
+    obj->crc = (uint16_t)(obj->crc << 4) ^ crcTable[((obj->crc >> 12) ^ byte) & 0x0FU];
+
+    if (byte != 0U)
+    {
+        obj->ring[obj->head & RING_INDEX_MASK] = byte;
+        obj->head++;
+        obj->code++;
+    }
+
+    /* A zero byte or a full block ends the block with its code byte */
+    if ((byte == 0U) || (obj->code == 0xFFU))
+    {
+        obj->ring[obj->codePos & RING_INDEX_MASK] = obj->code;
+        obj->codePos = obj->head;
+        obj->head++;
+        obj->code = 1U;
+    }
+}
+
+/*
+ *  ======== putUint16 ========
+ */
+static void putUint16(Telemetry_Object *obj, uint16_t value)
+{
+    putByte(obj, (uint8_t)value);
+    putByte(obj, (uint8_t)(value >> 8));
+}
+
+/*
+ *  ======== putUint32 ========
+ */
+static void putUint32(Telemetry_Object *obj, uint32_t value)
+{
+    putByte(obj, (uint8_t)value);
+    putByte(obj, (uint8_t)(value >> 8));
+    putByte(obj, (uint8_t)(value >> 16));
+    putByte(obj, (uint8_t)(value >> 24));
+}
+
+/*
+ *  ======== beginRecord ========
+ *  Starts queuing a record with a payload of length bytes. Returns false,
+ *  using up the sequence number, if the record does not fit in the Tx ring.
+ */
+static bool beginRecord(Telemetry_Object *obj, uint8_t type, uint8_t id, size_t length)
+{
+    size_t space = Telemetry_RING_SIZE - Telemetry_getPending(obj);
+
+    if (space < (HEADER_SIZE + length + CRC_SIZE + FRAMING_SIZE))
+    {
+        /* Make room for the record if the pending bytes can be written now */
+        Telemetry_flush(obj);
+        space = Telemetry_RING_SIZE - Telemetry_getPending(obj);
+    }
+
+    if (space < (HEADER_SIZE + length + CRC_SIZE + FRAMING_SIZE))
+    {
+        obj->seq++;
+        obj->stats.droppedCnt++;
+
+        return false;
+    }
+
+    obj->codePos = obj->head;
+    obj->head++;
+    obj->code = 1U;
+    obj->crc  = CRC_INIT;
+
+    putByte(obj, type);
+    putByte(obj, id);
+    putUint16(obj, obj->seq);
+
+    obj->seq++;
+
+    return true;
+}
+
+/*
+ *  ======== endRecord ========
+ *  Adds the CRC, ends the frame and writes the pending bytes if there are
+ *  more than the flush threshold.
+ */
+static void endRecord(Telemetry_Object *obj, uint32_t start)
+{
+    uint16_t crc = obj->crc;
+    size_t pending;
+
+    putByte(obj, (uint8_t)(crc >> 8));
+    putByte(obj, (uint8_t)crc);
+
+    /* The last code byte and the frame delimiter */
+    obj->ring[obj->codePos & RING_INDEX_MASK] = obj->code;
+    obj->ring[obj->head & RING_INDEX_MASK]    = 0U;
+    obj->head++;
+
+    obj->stats.recordCnt++;
+    obj->stats.bytesQueued += obj->head - start;
+
+    pending = Telemetry_getPending(obj);
+    if (pending > obj->stats.maxPending)
+    {
+        obj->stats.maxPending = pending;
+    }
+
+    if (pending > obj->params.flushThreshold)
+    {
+        Telemetry_flush(obj);
+    }
+}
+
+/*
+ *  ======== Telemetry_init ========
+ */
+void Telemetry_init(Telemetry_Object *obj, const Telemetry_Params *params)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->params = *params;
+}
+
+/*
+ *  ======== Telemetry_writeText ========
+ */
+bool Telemetry_writeText(Telemetry_Object *obj, uint8_t id, const char *text, size_t length)
+{
+    bool queued = true;
+    size_t chunk;
+    size_t i;
+    uint32_t start;
+
+    do
+    {
+        chunk = (length < Telemetry_PAYLOAD_MAX) ? length : Telemetry_PAYLOAD_MAX;
+        start = obj->head;
+
+        if (beginRecord(obj, Telemetry_TYPE_TEXT, id, chunk))
+        {
+            for (i = 0U; i < chunk; i++)
+            {
+                putByte(obj, (uint8_t)text[i]);
+            }
+
+            endRecord(obj, start);
+        }
+        else
+        {
+            queued = false;
+        }
+
+        text += chunk;
+        length -= chunk;
+    } while (length > 0U);
+
+    return queued;
+}
+
+/*
+ *  ======== Telemetry_writeCounters ========
+ */
+bool Telemetry_writeCounters(Telemetry_Object *obj, uint8_t id, const uint32_t *values, size_t count)
+{
+    size_t i;
+    uint32_t start = obj->head;
+
+    if ((count > Telemetry_COUNTERS_MAX) || !beginRecord(obj, Telemetry_TYPE_COUNTERS, id, count * 4U))
+    {
+        return false;
+    }
+
+    for (i = 0U; i < count; i++)
+    {
+        putUint32(obj, values[i]);
+    }
+
+    endRecord(obj, start);
+
+    return true;
+}
+
+/*
+ *  ======== Telemetry_writeHistogram ========
+ */
+bool Telemetry_writeHistogram(Telemetry_Object *obj,
+                              uint8_t id,
+                              const uint32_t *bins,
+                              size_t binCount,
+                              uint32_t binWidth)
+{
+    bool queued = true;
+    size_t chunk;
+    size_t first;
+    size_t i;
+    uint32_t start;
+
+    for (first = 0U; first < binCount; first += chunk)
+    {
+        chunk = binCount - first;
+        if (chunk > Telemetry_HISTOGRAM_BINS_MAX)
+        {
+            chunk = Telemetry_HISTOGRAM_BINS_MAX;
+        }
+
+        start = obj->head;
+
+        if (!beginRecord(obj, Telemetry_TYPE_HISTOGRAM, id, 8U + (chunk * 4U)))
+        {
+            queued = false;
+            continue;
+        }
+
+        putUint16(obj, (uint16_t)first);
+        putUint16(obj, (uint16_t)binCount);
+        putUint32(obj, binWidth);
+
+        for (i = 0U; i < chunk; i++)
+        {
+            putUint32(obj, bins[first + i]);
+        }
+
+        endRecord(obj, start);
+    }
+
+    return queued;
+}
+
+/*
+ *  ======== Telemetry_writeSample ========
+ */
+bool Telemetry_writeSample(Telemetry_Object *obj, uint8_t id, uint32_t time, const int32_t *values, size_t count)
+{
+    size_t i;
+    uint32_t start = obj->head;
+
+    if ((count > Telemetry_SAMPLE_MAX) || !beginRecord(obj, Telemetry_TYPE_SAMPLE, id, 4U + (count * 4U)))
+    {
+        return false;
+    }
+
+    putUint32(obj, time);
+
+    for (i = 0U; i < count; i++)
+    {
+        putUint32(obj, (uint32_t)values[i]);
+    }
+
+    endRecord(obj, start);
+
+    return true;
+}
+
+/*
+ *  ======== Telemetry_flush ========
+ */
+void Telemetry_flush(Telemetry_Object *obj)
+{
+    size_t length;
+    size_t offset;
+    size_t written;
+
+    while (obj->tail != obj->head)
+    {
+        /* Write up to the end of the ring, the rest on the next pass */
+        offset = obj->tail & RING_INDEX_MASK;
+        length = Telemetry_getPending(obj);
+        if (length > (Telemetry_RING_SIZE - offset))
+        {
+            length = Telemetry_RING_SIZE - offset;
+        }
+
+        written = obj->params.writeFxn(obj->params.arg, &obj->ring[offset], length);
+        if (written == 0U)
+        {
+            break;
+        }
+
+        obj->tail += written;
+        obj->stats.bytesWritten += written;
+        obj->stats.writeCnt++;
+
+        if (written < length)
+        {
+            break;
+        }
+    }
+}
+
+/*
+ *  ======== Telemetry_getPending ========
+ */
+size_t Telemetry_getPending(const Telemetry_Object *obj)
+{
+    return obj->head - obj->tail;
+}
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCapture.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+
+#include "CANCapture.h"
+#include "CANCodec.h"
+
+#define RING_MASK (CANCapture_RING_SIZE - 1U)
+
+/* Record field offsets */
+#define OFFSET_FLAGS 1U
+#define OFFSET_DLC   2U
+#define OFFSET_ID    3U
+#define OFFSET_TIME  7U
+
+/* Flag bits not defined by the record format */
+#define RESERVED_FLAGS 0x80U
+
+/*
+ *  ======== recordSize ========
+ */
+static size_t recordSize(uint32_t flags, uint32_t dlc)
+{
+    uint32_t dataLen = ((flags & CANCapture_FLAG_RTR) != 0U) ? 0U : CANCodec_dlcToLength(dlc & 0xFU);
+
+    return CANCapture_HEADER_SIZE + dataLen + 1U;
+}
+
+/*
+ *  ======== putLe32 ========
+ */
+static void putLe32(uint8_t *buf, uint32_t value)
+{
+    buf[0] = (uint8_t)value;
+    buf[1] = (uint8_t)(value >> 8);
+    buf[2] = (uint8_t)(value >> 16);
+    buf[3] = (uint8_t)(value >> 24);
+}
+
+/*
+ *  ======== getLe32 ========
+ */
+static uint32_t getLe32(const uint8_t *buf)
+{
+    return (uint32_t)buf[0] | ((uint32_t)buf[1] << 8) | ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+/*
+ *  ======== makeRoom ========
+ *  Returns true once the ring has room for size bytes, overwriting the
+ *  oldest records if the ring is a flight recorder.
+ */
+static bool makeRoom(CANCapture_Object *obj, size_t size)
+{
+    uint32_t tail;
+
+    while ((CANCapture_RING_SIZE - (obj->head - obj->tail)) < size)
+    {
+        if (!obj->overwrite)
+        {
+            return false;
+        }
+
+        tail = obj->tail;
+        obj->tail = tail + recordSize(obj->ring[(tail + OFFSET_FLAGS) & RING_MASK],
+                                      obj->ring[(tail + OFFSET_DLC) & RING_MASK]);
+        obj->stats.lostCnt++;
+        obj->lost = true;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== storeFrame ========
+ */
+static bool storeFrame(CANCapture_Object *obj,
+                       uint32_t flags,
+                       uint32_t dlc,
+                       uint32_t id,
+                       uint32_t time,
+                       const uint8_t *data)
+{
+    uint8_t record[CANCapture_MAX_RECORD_SIZE];
+    uint8_t sum = 0U;
+    size_t size;
+    size_t dataLen;
+    size_t first;
+    size_t i;
+    uint32_t head;
+    uint32_t used;
+
+    size    = recordSize(flags, dlc);
+    dataLen = size - CANCapture_HEADER_SIZE - 1U;
+
+    if (!makeRoom(obj, size))
+    {
+        obj->stats.lostCnt++;
+        obj->lost = true;
+        return false;
+    }
+
+    if (obj->lost)
+    {
+        flags |= CANCapture_FLAG_LOST;
+        obj->lost = false;
+    }
+
+    record[0]            = CANCapture_SYNC;
+    record[OFFSET_FLAGS] = (uint8_t)flags;
+    record[OFFSET_DLC]   = (uint8_t)dlc;
+    putLe32(&record[OFFSET_ID], id);
+    putLe32(&record[OFFSET_TIME], time);
+    memcpy(&record[CANCapture_HEADER_SIZE], data, dataLen);
+
+    for (i = 0U; i < (size - 1U); i++)
+    {
+        sum += record[i];
+    }
+
+    record[size - 1U] = (uint8_t)(0U - sum);
+
+    /* Copy the record in up to two parts if it wraps around the end of the ring */
+    head  = obj->head;
+    first = CANCapture_RING_SIZE - (head & RING_MASK);
+    if (first > size)
+    {
+        first = size;
+    }
+
+    memcpy(&obj->ring[head & RING_MASK], record, first);
+    memcpy(&obj->ring[0], &record[first], size - first);
+
+    obj->head = head + size;
+
+    obj->stats.recordCnt++;
+    used = obj->head - obj->tail;
+    if (used > obj->stats.highWaterMark)
+    {
+        obj->stats.highWaterMark = used;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== CANCapture_init ========
+ */
+void CANCapture_init(CANCapture_Object *obj, bool overwrite)
+{
+    memset(obj, 0, sizeof(CANCapture_Object));
+
+    obj->overwrite = overwrite;
+}
+
+/*
+ *  ======== CANCapture_rxFrame ========
+ */
+bool CANCapture_rxFrame(CANCapture_Object *obj, const CAN_RxBufElement *elem, uint32_t time)
+{
+    uint32_t flags = 0U;
+
+    flags |= (elem->xtd != 0U) ? CANCapture_FLAG_XTD : 0U;
+    flags |= (elem->rtr != 0U) ? CANCapture_FLAG_RTR : 0U;
+    flags |= (elem->esi != 0U) ? CANCapture_FLAG_ESI : 0U;
+#ifndef CAN_SUPPORTS_DCAN
+    flags |= (elem->fdf != 0U) ? CANCapture_FLAG_FDF : 0U;
+    flags |= (elem->brs != 0U) ? CANCapture_FLAG_BRS : 0U;
+#endif /* CAN_SUPPORTS_DCAN */
+
+    return storeFrame(obj, flags, elem->dlc, elem->id, time, elem->data);
+}
+
+/*
+ *  ======== CANCapture_txFrame ========
+ */
+bool CANCapture_txFrame(CANCapture_Object *obj, const CAN_TxBufElement *elem, uint32_t time)
+{
+    uint32_t flags = CANCapture_FLAG_TX;
+
+    flags |= (elem->xtd != 0U) ? CANCapture_FLAG_XTD : 0U;
+    flags |= (elem->rtr != 0U) ? CANCapture_FLAG_RTR : 0U;
+#ifndef CAN_SUPPORTS_DCAN
+    flags |= (elem->esi != 0U) ? CANCapture_FLAG_ESI : 0U;
+    flags |= (elem->fdf != 0U) ? CANCapture_FLAG_FDF : 0U;
+    flags |= (elem->brs != 0U) ? CANCapture_FLAG_BRS : 0U;
+#endif /* CAN_SUPPORTS_DCAN */
+
+    return storeFrame(obj, flags, elem->dlc, elem->id, time, elem->data);
+}
+
+/*
+ *  ======== CANCapture_peek ========
+ */
+size_t CANCapture_peek(const CANCapture_Object *obj, const uint8_t **data)
+{
+    uint32_t tail = obj->tail;
+    size_t count  = obj->head - tail;
+    size_t first  = CANCapture_RING_SIZE - (tail & RING_MASK);
+
+    *data = &obj->ring[tail & RING_MASK];
+
+    return (count < first) ? count : first;
+}
+
+/*
+ *  ======== CANCapture_consume ========
+ */
+void CANCapture_consume(CANCapture_Object *obj, size_t count)
+{
+    obj->tail += count;
+}
+
+/*
+ *  ======== CANCapture_getCount ========
+ */
+size_t CANCapture_getCount(const CANCapture_Object *obj)
+{
+    return obj->head - obj->tail;
+}
+
+/*
+ *  ======== CANCapture_decode ========
+ */
+int_fast16_t CANCapture_decode(const uint8_t *buf, size_t size, CANCapture_Record *record)
+{
+    uint8_t sum = 0U;
+    size_t recSize;
+    size_t i;
+
+    if ((size > 0U) && (buf[0] != CANCapture_SYNC))
+    {
+        return CANCapture_INVALID;
+    }
+
+    if (size < CANCapture_HEADER_SIZE)
+    {
+        return CANCapture_INCOMPLETE;
+    }
+
+    if ((buf[OFFSET_DLC] >= CANCodec_DLC_COUNT) || ((buf[OFFSET_FLAGS] & RESERVED_FLAGS) != 0U))
+    {
+        return CANCapture_INVALID;
+    }
+
+    recSize = recordSize(buf[OFFSET_FLAGS], buf[OFFSET_DLC]);
+    if (size < recSize)
+    {
+        return CANCapture_INCOMPLETE;
+    }
+
+    for (i = 0U; i < recSize; i++)
+    {
+        sum += buf[i];
+    }
+
+    if (sum != 0U)
+    {
+        return CANCapture_INVALID;
+    }
+
+    record->flags   = buf[OFFSET_FLAGS];
+    record->dlc     = buf[OFFSET_DLC];
+    record->id      = getLe32(&buf[OFFSET_ID]);
+    record->time    = getLe32(&buf[OFFSET_TIME]);
+    record->dataLen = (uint8_t)(recSize - CANCapture_HEADER_SIZE - 1U);
+    memcpy(record->data, &buf[CANCapture_HEADER_SIZE], record->dataLen);
+
+    return (int_fast16_t)recSize;
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCoalesce.h ========
+ *  Coalescing of CAN Rx events.
+ *
+ *  Without coalescing, each CAN_EVENT_RX_DATA_AVAIL event posts the event
+ *  semaphore and wakes the application thread, which at high frame rates
+ *  means one thread wake-up per frame. CANCoalesce_rxEvent() is called from
+ *  the event callback instead. It moves the received frames from the driver
+ *  to a ring and only calls the wake function supplied by the application
+ *  when one of these conditions is met:
+ *
+ *    - frameThreshold frames are pending
+ *    - timeoutUs has elapsed since the first pending frame was received
+ *    - a frame with one of the bypass IDs was received
+ *    - the ring is full
+ *
+ *  The timeout is measured with a one-shot ClockP started with the first
+ *  pending frame. It is rounded up to whole clock ticks, plus one tick as the
+ *  clock is started part way through a tick, so the first pending frame is
+ *  held for at least timeoutUs and at most two ticks longer. The wake
+ *  function is then called from the clock function.
+ *
+ *  The application thread reads the frames with CANCoalesce_read() instead of
+ *  CAN_read(). Frames left in the driver because the ring was full are read
+ *  from the driver once the ring is empty, so frames are always read in order.
+ *
+ *  The statistics show the trade-off between CPU load and latency: the number
+ *  of frames per wake-up, the reason for each wake-up and the time the first
+ *  pending frame was held before the wake-up. Times are 64-bit values in
+ *  250ns ticks.
+ */
+
+#ifndef CANCOALESCE_H_
+#define CANCOALESCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/ClockP.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of frames the ring can hold. Must be a power of two. */
+#ifndef CANCoalesce_RING_SIZE
+    #define CANCoalesce_RING_SIZE 32U
+#endif
+
+#if (CANCoalesce_RING_SIZE & (CANCoalesce_RING_SIZE - 1U)) != 0U
+    #error "CANCoalesce_RING_SIZE must be a power of two"
+#endif
+
+/* Maximum number of bypass IDs */
+#define CANCoalesce_BYPASS_MAX 4U
+
+/* Time ticks per microsecond */
+#define CANCoalesce_TICKS_PER_USEC 4U
+
+/* Wakes the application thread to read the pending frames. firstTime is the
+ * time the first of them was received. Called from the event callback or
+ * from the clock function.
+ */
+typedef void (*CANCoalesce_WakeFxn)(void *arg, uint64_t firstTime);
+
+/* Coalescing parameters */
+typedef struct
+{
+    uint32_t frameThreshold; /* Pending frames that wake the thread, 1 to CANCoalesce_RING_SIZE */
+    uint32_t timeoutUs;      /* Longest time the first pending frame is held */
+    CANCoalesce_WakeFxn wakeFxn;
+    void *arg;               /* Passed to wakeFxn */
+} CANCoalesce_Params;
+
+/* Coalescing statistics */
+typedef struct
+{
+    uint32_t frameCnt;         /* Frames moved from the driver to the ring */
+    uint32_t wakeCnt;          /* Calls to the wake function */
+    uint32_t thresholdWakeCnt; /* Wake-ups because frameThreshold frames were pending or the ring was full */
+    uint32_t timeoutWakeCnt;   /* Wake-ups because timeoutUs had elapsed */
+    uint32_t bypassWakeCnt;    /* Wake-ups because of a bypass ID */
+    uint32_t ringFullCnt;      /* Rx events that found the ring full */
+    uint64_t holdTime;         /* Total time the first pending frames were held */
+    uint64_t maxHoldTime;
+} CANCoalesce_Stats;
+
+/* Coalescing object. The fields are private, except for stats, which are
+ * updated in interrupt context and are read with CANCoalesce_getStats().
+ */
+typedef struct
+{
+    CANCoalesce_Params params;
+    CANCoalesce_Stats stats;
+    ClockP_Struct clock;
+    uint32_t bypassIds[CANCoalesce_BYPASS_MAX]; /* ID, with bit 31 set for 29-bit IDs */
+    uint32_t bypassCnt;
+    uint32_t pendingCnt;         /* Frames received since the last wake-up */
+    uint64_t firstTime;          /* Time the first pending frame was received */
+    volatile uint32_t head;      /* Free-running ring indices */
+    volatile uint32_t tail;
+    CAN_RxBufElement ring[CANCoalesce_RING_SIZE];
+} CANCoalesce_Object;
+
+/*
+ *  ======== CANCoalesce_init ========
+ *  Initializes an empty ring without bypass IDs. Must be called before the
+ *  CAN driver is opened.
+ */
+extern void CANCoalesce_init(CANCoalesce_Object *obj, const CANCoalesce_Params *params);
+
+/*
+ *  ======== CANCoalesce_addBypassId ========
+ *  Adds an ID whose frames wake the application thread immediately. xtd is
+ *  true for a 29-bit ID. Returns false if the bypass list is full. Must be
+ *  called before the CAN driver is opened.
+ */
+extern bool CANCoalesce_addBypassId(CANCoalesce_Object *obj, uint32_t id, bool xtd);
+
+/*
+ *  ======== CANCoalesce_rxEvent ========
+ *  Moves the received frames from the driver to the ring and calls the wake
+ *  function if one of the wake-up conditions is met. Must be called from the
+ *  event callback for CAN_EVENT_RX_DATA_AVAIL.
+ */
+extern void CANCoalesce_rxEvent(CANCoalesce_Object *obj, CAN_Handle handle);
+
+/*
+ *  ======== CANCoalesce_read ========
+ *  Removes the oldest frame from the ring, or reads it from the driver if the
+ *  ring is empty. Returns false if no frame is available.
+ */
+extern bool CANCoalesce_read(CANCoalesce_Object *obj, CAN_Handle handle, CAN_RxBufElement *elem);
+
+/*
+ *  ======== CANCoalesce_getStats ========
+ *  Returns a consistent copy of the statistics.
+ */
+extern void CANCoalesce_getStats(const CANCoalesce_Object *obj, CANCoalesce_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANCOALESCE_H_ */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCodec.h ========
+ *  CAN frame encoding helpers shared by the CAN examples.
+ *
+ *  The module converts between Data Length Codes (DLC) and payload lengths,
+ *  compares and inverts payloads a word at a time, and formats frames and
+ *  driver events as text.
+ *
+ *  Text is written through a cursor, which keeps the current end of the
+ *  output so that each call appends without searching the buffer for the
+ *  terminating null character. Hex digits are taken two at a time from a
+ *  256-entry lookup table. Output that does not fit in the buffer is
+ *  truncated, and CANCodec_finish() returns the length of the text and
+ *  terminates it. The functions do not call the C library formatting
+ *  functions and may be called from any context.
+ */
+
+#ifndef CANCODEC_H_
+#define CANCODEC_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of Data Length Codes */
+#define CANCodec_DLC_COUNT 16U
+
+/* Payload length of the largest CAN FD frame */
+#define CANCodec_MAX_DATA_LENGTH 64U
+
+/* Payload length of the largest classic CAN frame */
+#define CANCodec_MAX_CLASSIC_DATA_LENGTH 8U
+
+/* Text output cursor. The fields are private. */
+typedef struct
+{
+    char *start; /* Start of the buffer */
+    char *pos;   /* Next character */
+    char *end;   /* Last character of the buffer, kept for the null character */
+} CANCodec_Cursor;
+
+/*
+ *  ======== CANCodec_dlcToLength ========
+ *  Returns the payload length of a Data Length Code, or 0 if dlc is not a
+ *  valid code.
+ */
+extern uint32_t CANCodec_dlcToLength(uint32_t dlc);
+
+/*
+ *  ======== CANCodec_lengthToDlc ========
+ *  Returns the smallest Data Length Code whose payload holds length bytes.
+ *  Lengths above CANCodec_MAX_DATA_LENGTH return the largest code.
+ */
+extern uint32_t CANCodec_lengthToDlc(uint32_t length);
+
+/*
+ *  ======== CANCodec_findInvertedMismatch ========
+ *  Compares data with the bitwise inverse of ref. Returns the index of the
+ *  first byte of data that is not the inverse of the byte of ref, or length
+ *  if all bytes match.
+ */
+extern size_t CANCodec_findInvertedMismatch(const uint8_t *data, const uint8_t *ref, size_t length);
+
+/*
+ *  ======== CANCodec_copyInverted ========
+ *  Copies the bitwise inverse of length bytes of src to dst.
+ */
+extern void CANCodec_copyInverted(uint8_t *dst, const uint8_t *src, size_t length);
+
+/*
+ *  ======== CANCodec_init ========
+ *  Starts a cursor at the beginning of a buffer of size characters. size
+ *  must not be 0.
+ */
+extern void CANCodec_init(CANCodec_Cursor *cursor, char *buf, size_t size);
+
+/*
+ *  ======== CANCodec_finish ========
+ *  Terminates the text with a null character and returns its length.
+ */
+extern size_t CANCodec_finish(CANCodec_Cursor *cursor);
+
+/*
+ *  ======== CANCodec_putStr ========
+ *  Appends a null-terminated string.
+ */
+extern void CANCodec_putStr(CANCodec_Cursor *cursor, const char *str);
+
+/*
+ *  ======== CANCodec_putUint ========
+ *  Appends an unsigned decimal number.
+ */
+extern void CANCodec_putUint(CANCodec_Cursor *cursor, uint32_t value);
+
+/*
+ *  ======== CANCodec_putHex ========
+ *  Appends a lowercase hex number of at least minDigits digits, padded with
+ *  zeros. No more than 8 digits are appended.
+ */
+extern void CANCodec_putHex(CANCodec_Cursor *cursor, uint32_t value, uint32_t minDigits);
+
+/*
+ *  ======== CANCodec_putHexBytes ========
+ *  Appends each byte as two uppercase hex digits followed by a space.
+ */
+extern void CANCodec_putHexBytes(CANCodec_Cursor *cursor, const uint8_t *data, size_t length);
+
+/*
+ *  ======== CANCodec_putRxElem ========
+ *  Appends the ID, timestamp, Start Of Frame time, flags and payload of a
+ *  received frame, one field per line. sofTime is printed as 16 hex digits.
+ */
+extern void CANCodec_putRxElem(CANCodec_Cursor *cursor, const CAN_RxBufElement *elem, uint64_t sofTime);
+
+/*
+ *  ======== CANCodec_putEvent ========
+ *  Appends a line describing a driver event and its event data.
+ */
+extern void CANCodec_putEvent(CANCodec_Cursor *cursor, uint32_t event, uint32_t eventData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANCODEC_H_ */
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANDispatch.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANDispatch.h"
+
+/* Key bit marking a 29-bit ID */
+#define KEY_XTD 0x80000000U
+
+/* Mask of an exact ID entry */
+#define EXACT_MASK 0xFFFFFFFFU
+
+/* MCAN filter element types and configuration */
+#define FILTER_TYPE_DUAL    1U
+#define FILTER_TYPE_CLASSIC 2U
+#define FILTER_STORE_FIFO0  1U
+
+/*
+ *  ======== makeKey ========
+ */
+static uint32_t makeKey(uint32_t id, bool xtd)
+{
+    return xtd ? ((id & 0x1FFFFFFFU) | KEY_XTD) : (id & 0x7FFU);
+}
+
+/*
+ *  ======== hashKey ========
+ *  Fibonacci hash of the key, using the well-mixed middle bits of the
+ *  product.
+ */
+static uint32_t hashKey(uint32_t key)
+{
+    return ((key * 2654435761U) >> 16) & (CANDispatch_HASH_SIZE - 1U);
+}
+
+/*
+ *  ======== countBits ========
+ */
+static uint32_t countBits(uint32_t value)
+{
+    uint32_t count = 0U;
+
+    while (value != 0U)
+    {
+        value &= value - 1U;
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ *  ======== CANDispatch_init ========
+ */
+void CANDispatch_init(CANDispatch_Object *dispatch)
+{
+    memset(dispatch, 0, sizeof(*dispatch));
+}
+
+/*
+ *  ======== CANDispatch_registerId ========
+ */
+bool CANDispatch_registerId(CANDispatch_Object *dispatch,
+                            uint32_t id,
+                            bool xtd,
+                            CANDispatch_HandlerFxn fxn,
+                            void *arg)
+{
+    CANDispatch_Entry *entry;
+    uint32_t key = makeKey(id, xtd);
+    uint32_t slot;
+
+    /* Linear probing. The table is never more than half full, so a free slot
+     * or the key itself is always found.
+     */
+    for (slot = hashKey(key);; slot = (slot + 1U) & (CANDispatch_HASH_SIZE - 1U))
+    {
+        entry = &dispatch->exact[slot];
+
+        if (entry->mask == 0U)
+        {
+            if (dispatch->exactCnt == CANDispatch_EXACT_MAX)
+            {
+                return false;
+            }
+
+            dispatch->exactCnt++;
+            break;
+        }
+
+        if (entry->key == key)
+        {
+            break;
+        }
+    }
+
+    entry->key  = key;
+    entry->mask = EXACT_MASK;
+    entry->fxn  = fxn;
+    entry->arg  = arg;
+
+    return true;
+}
+
+/*
+ *  ======== CANDispatch_registerMask ========
+ */
+bool CANDispatch_registerMask(CANDispatch_Object *dispatch,
+                              uint32_t id,
+                              uint32_t mask,
+                              bool xtd,
+                              CANDispatch_HandlerFxn fxn,
+                              void *arg)
+{
+    uint32_t entryMask;
+    uint32_t i;
+
+    if (dispatch->maskCnt == CANDispatch_MASK_MAX)
+    {
+        return false;
+    }
+
+    /* The type bit is always compared so 11-bit and 29-bit IDs never match each other */
+    entryMask = makeKey(mask, xtd) | KEY_XTD;
+
+    /* Keep the list sorted from the most to the least specific mask */
+    i = dispatch->maskCnt;
+    while ((i > 0U) && (countBits(dispatch->masks[i - 1U].mask) < countBits(entryMask)))
+    {
+        dispatch->masks[i] = dispatch->masks[i - 1U];
+        i--;
+    }
+
+    dispatch->masks[i].key  = makeKey(id, xtd) & entryMask;
+    dispatch->masks[i].mask = entryMask;
+    dispatch->masks[i].fxn  = fxn;
+    dispatch->masks[i].arg  = arg;
+
+    dispatch->maskCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== CANDispatch_dispatch ========
+ */
+bool CANDispatch_dispatch(CANDispatch_Object *dispatch, const CAN_RxBufElement *elem)
+{
+    const CANDispatch_Entry *entry = NULL;
+    uint32_t key                   = makeKey(elem->id, elem->xtd != 0U);
+    uint32_t slot;
+    uint32_t i;
+
+    for (slot = hashKey(key); dispatch->exact[slot].mask != 0U; slot = (slot + 1U) & (CANDispatch_HASH_SIZE - 1U))
+    {
+        if (dispatch->exact[slot].key == key)
+        {
+            entry = &dispatch->exact[slot];
+            break;
+        }
+    }
+
+    for (i = 0U; (entry == NULL) && (i < dispatch->maskCnt); i++)
+    {
+        if ((key & dispatch->masks[i].mask) == dispatch->masks[i].key)
+        {
+            entry = &dispatch->masks[i];
+        }
+    }
+
+    if (entry == NULL)
+    {
+        dispatch->unmatchedCnt++;
+        return false;
+    }
+
+    if (entry->fxn != NULL)
+    {
+        entry->fxn(elem, entry->arg);
+    }
+
+    return true;
+}
+
+#ifndef CAN_SUPPORTS_DCAN
+
+/*
+ *  ======== CANDispatch_buildFilters ========
+ */
+void CANDispatch_buildFilters(const CANDispatch_Object *dispatch,
+                              CANDispatch_Filters *filters,
+                              CAN_MsgRAMConfig *config)
+{
+    const CANDispatch_Entry *entry;
+    MCAN_StdMsgIDFilterElement *stdFilter = NULL;
+    MCAN_ExtMsgIDFilterElement *extFilter = NULL;
+    uint32_t stdNum                       = 0U;
+    uint32_t extNum                       = 0U;
+    uint32_t i;
+
+    memset(filters, 0, sizeof(*filters));
+
+    /* Exact IDs, two per dual ID filter. A filter holding a single ID lists
+     * it twice.
+     */
+    for (i = 0U; i < CANDispatch_HASH_SIZE; i++)
+    {
+        entry = &dispatch->exact[i];
+
+        if (entry->mask == 0U)
+        {
+            continue;
+        }
+
+        if ((entry->key & KEY_XTD) == 0U)
+        {
+            if (stdFilter != NULL)
+            {
+                stdFilter->sfid2 = entry->key;
+                stdFilter        = NULL;
+            }
+            else
+            {
+                stdFilter        = &filters->std[stdNum++];
+                stdFilter->sfid1 = entry->key;
+                stdFilter->sfid2 = entry->key;
+                stdFilter->sfec  = FILTER_STORE_FIFO0;
+                stdFilter->sft   = FILTER_TYPE_DUAL;
+            }
+        }
+        else
+        {
+            if (extFilter != NULL)
+            {
+                extFilter->efid2 = entry->key & ~KEY_XTD;
+                extFilter        = NULL;
+            }
+            else
+            {
+                extFilter        = &filters->ext[extNum++];
+                extFilter->efid1 = entry->key & ~KEY_XTD;
+                extFilter->efid2 = entry->key & ~KEY_XTD;
+                extFilter->efec  = FILTER_STORE_FIFO0;
+                extFilter->eft   = FILTER_TYPE_DUAL;
+            }
+        }
+    }
+
+    /* Masks, one classic filter each */
+    for (i = 0U; i < dispatch->maskCnt; i++)
+    {
+        entry = &dispatch->masks[i];
+
+        if ((entry->key & KEY_XTD) == 0U)
+        {
+            stdFilter        = &filters->std[stdNum++];
+            stdFilter->sfid1 = entry->key;
+            stdFilter->sfid2 = entry->mask & 0x7FFU;
+            stdFilter->sfec  = FILTER_STORE_FIFO0;
+            stdFilter->sft   = FILTER_TYPE_CLASSIC;
+        }
+        else
+        {
+            extFilter        = &filters->ext[extNum++];
+            extFilter->efid1 = entry->key & ~KEY_XTD;
+            extFilter->efid2 = entry->mask & ~KEY_XTD;
+            extFilter->efec  = FILTER_STORE_FIFO0;
+            extFilter->eft   = FILTER_TYPE_CLASSIC;
+        }
+    }
+
+    config->stdFilterNum       = stdNum;
+    config->stdMsgIDFilterList = filters->std;
+    config->extFilterNum       = extNum;
+    config->extMsgIDFilterList = filters->ext;
+}
+
+#endif /* CAN_SUPPORTS_DCAN */
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANIsoTp.h ========
+ *  ISO 15765-2 (ISO-TP) segmented transport for classic CAN frames.
+ *
+ *  Messages of up to CANIsoTp_MSG_SIZE_MAX bytes are split into a single
+ *  frame, or a first frame followed by consecutive frames. The receiver paces
+ *  the sender with flow control frames that carry its block size (number of
+ *  consecutive frames between flow control frames) and STmin (minimum time
+ *  between consecutive frames). Messages that need more than one frame are
+ *  reassembled into buffers taken from a fixed pool shared by all links.
+ *
+ *  The module does not depend on the CAN driver. The caller supplies a
+ *  function that transmits one 8-byte frame, passes every received frame to
+ *  CANIsoTp_receiveFrame(), and calls CANIsoTp_process() whenever a Tx buffer
+ *  is freed and at least once per millisecond while a transfer is in progress.
+ *  Times are 32-bit values in 250ns ticks. All functions must be called from
+ *  the same thread.
+ */
+
+#ifndef CANISOTP_H_
+#define CANISOTP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Classic CAN frame payload size. Frames are always padded to this size. */
+#define CANIsoTp_FRAME_SIZE 8U
+
+/* Padding byte for unused frame bytes */
+#define CANIsoTp_PAD_BYTE 0xCCU
+
+/* Largest message the 12-bit first frame length can describe */
+#define CANIsoTp_MSG_SIZE_MAX 4095U
+
+/* Number and size of the reassembly buffers */
+#ifndef CANIsoTp_POOL_SIZE
+    #define CANIsoTp_POOL_SIZE 2U
+#endif
+
+#ifndef CANIsoTp_BUFFER_SIZE
+    #define CANIsoTp_BUFFER_SIZE CANIsoTp_MSG_SIZE_MAX
+#endif
+
+/* N_Bs and N_Cr: maximum time to wait for a flow control frame and for the
+ * next consecutive frame, in milliseconds.
+ */
+#define CANIsoTp_TIMEOUT_MS 1000U
+
+/* Maximum number of consecutive wait flow control frames accepted */
+#define CANIsoTp_WAIT_MAX 8U
+
+/* Time ticks per microsecond */
+#define CANIsoTp_TICKS_PER_USEC 4U
+
+/* Transmits one CANIsoTp_FRAME_SIZE byte frame. Returns false if the frame
+ * could not be queued, in which case it is retried by CANIsoTp_process().
+ */
+typedef bool (*CANIsoTp_SendFxn)(void *arg, uint32_t id, const uint8_t *data);
+
+/* Delivers a complete message. The data is only valid during the call. */
+typedef void (*CANIsoTp_ReceiveFxn)(void *arg, const uint8_t *data, uint32_t length);
+
+/* Status of the last transmission */
+typedef enum
+{
+    CANIsoTp_TX_IDLE,          /* No message sent yet */
+    CANIsoTp_TX_BUSY,          /* Transmission in progress */
+    CANIsoTp_TX_DONE,          /* Last frame queued */
+    CANIsoTp_TX_TIMEOUT,       /* No flow control frame within N_Bs */
+    CANIsoTp_TX_OVERFLOW,      /* Receiver has no buffer for the message */
+    CANIsoTp_TX_PROTOCOL_ERROR /* Invalid flow control frame or too many waits */
+} CANIsoTp_TxStatus;
+
+/* Link parameters */
+typedef struct
+{
+    uint32_t txId;              /* ID of the frames sent */
+    uint32_t rxId;              /* ID of the frames received */
+    uint8_t blockSize;          /* Block size requested from the sender, 0 for no flow control after the first */
+    uint8_t stMin;              /* STmin requested from the sender, ISO 15765-2 encoding */
+    CANIsoTp_SendFxn sendFxn;
+    CANIsoTp_ReceiveFxn receiveFxn;
+    void *arg;                  /* Passed to sendFxn and receiveFxn */
+} CANIsoTp_Params;
+
+/* Link statistics */
+typedef struct
+{
+    uint32_t txMsgCnt;      /* Messages sent */
+    uint32_t rxMsgCnt;      /* Messages received */
+    uint32_t txFrameCnt;    /* Frames sent, including flow control frames */
+    uint32_t rxFrameCnt;    /* Frames received on rxId */
+    uint32_t txErrorCnt;    /* Transmissions that ended in a timeout, overflow or protocol error */
+    uint32_t rxTimeoutCnt;  /* Receptions aborted because a consecutive frame did not arrive within N_Cr */
+    uint32_t rxSeqErrorCnt; /* Receptions aborted because of a sequence number gap */
+    uint32_t rxOverflowCnt; /* Receptions refused because no buffer was free or the message was too large */
+    uint32_t rxInvalidCnt;  /* Frames ignored because they were malformed or unexpected */
+} CANIsoTp_Stats;
+
+/* Link object. The fields are private, except for stats. */
+typedef struct
+{
+    CANIsoTp_Params params;
+    CANIsoTp_Stats stats;
+
+    /* Transmitter */
+    CANIsoTp_TxStatus txStatus;
+    bool txWaitFlowControl;
+    const uint8_t *txData;
+    uint32_t txLength;
+    uint32_t txOffset;
+    uint8_t txSeq;
+    uint8_t txBlockSize;
+    uint8_t txBlockCnt;
+    uint8_t txWaitCnt;
+    uint32_t txStMin;
+    uint32_t txNextTime;
+    uint32_t txDeadline;
+
+    /* Receiver */
+    uint8_t *rxBuf;
+    uint32_t rxLength;
+    uint32_t rxOffset;
+    uint8_t rxSeq;
+    uint8_t rxBlockCnt;
+    bool rxFlowControlPending;
+    uint8_t rxFlowStatus;
+    uint32_t rxDeadline;
+} CANIsoTp_Object;
+
+/*
+ *  ======== CANIsoTp_init ========
+ *  Initializes an idle link.
+ */
+extern void CANIsoTp_init(CANIsoTp_Object *link, const CANIsoTp_Params *params);
+
+/*
+ *  ======== CANIsoTp_send ========
+ *  Starts sending a message of 1 to CANIsoTp_MSG_SIZE_MAX bytes. The data must
+ *  stay valid until the transmission ends. Returns false if a transmission is
+ *  in progress or the length is invalid.
+ */
+extern bool CANIsoTp_send(CANIsoTp_Object *link, const uint8_t *data, uint32_t length, uint32_t now);
+
+/*
+ *  ======== CANIsoTp_getTxStatus ========
+ */
+extern CANIsoTp_TxStatus CANIsoTp_getTxStatus(const CANIsoTp_Object *link);
+
+/*
+ *  ======== CANIsoTp_receiveFrame ========
+ *  Handles a received frame of length bytes. Returns false if the frame does
+ *  not belong to the link.
+ */
+extern bool CANIsoTp_receiveFrame(CANIsoTp_Object *link, uint32_t id, const uint8_t *data, uint32_t length, uint32_t now);
+
+/*
+ *  ======== CANIsoTp_process ========
+ *  Sends the frames that are due and handles the timeouts.
+ */
+extern void CANIsoTp_process(CANIsoTp_Object *link, uint32_t now);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANISOTP_H_ */
@@ -0,0 +1,537 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANSlcan.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "CANSlcan.h"
+
+#define OUTPUT_MASK (CANSlcan_OUTPUT_SIZE - 1U)
+
+/* Reply characters */
+#define REPLY_OK    '\r'
+#define REPLY_ERROR '\a'
+
+/* Hex digits of the standard and extended IDs */
+#define STD_ID_DIGITS 3U
+#define EXT_ID_DIGITS 8U
+
+#define STD_ID_MAX 0x7FFU
+#define EXT_ID_MAX 0x1FFFFFFFU
+
+/* Timestamps wrap after one minute */
+#define TIMESTAMP_PERIOD_MS 60000U
+
+/* Version and serial number replies */
+#define VERSION_REPLY "V0101\r"
+#define SERIAL_REPLY  "N0001\r"
+
+/* Longest line reported for a received frame, with the timestamp and the carriage return */
+#define MAX_FRAME_LINE_LENGTH (CANSlcan_MAX_CMD_LENGTH + 4U + 1U)
+
+/* Nominal bit rates selected by the S command */
+static const uint32_t bitRates[] = {10000U, 20000U, 50000U, 100000U, 125000U, 250000U, 500000U, 800000U, 1000000U};
+
+static const char hexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+/*
+ *  ======== parseHex ========
+ *  Parses digits hex digits. Returns false if one of them is not a hex digit.
+ */
+static bool parseHex(const char *str, uint32_t digits, uint32_t *value)
+{
+    uint32_t result = 0U;
+    uint32_t nibble;
+    char c;
+
+    while (digits > 0U)
+    {
+        c = *str++;
+
+        if ((c >= '0') && (c <= '9'))
+        {
+            nibble = (uint32_t)(c - '0');
+        }
+        else if ((c >= 'A') && (c <= 'F'))
+        {
+            nibble = (uint32_t)(c - 'A') + 10U;
+        }
+        else if ((c >= 'a') && (c <= 'f'))
+        {
+            nibble = (uint32_t)(c - 'a') + 10U;
+        }
+        else
+        {
+            return false;
+        }
+
+        result = (result << 4) | nibble;
+        digits--;
+    }
+
+    *value = result;
+
+    return true;
+}
+
+/*
+ *  ======== putHex ========
+ *  Writes digits uppercase hex digits of value to buf.
+ */
+static char *putHex(char *buf, uint32_t value, uint32_t digits)
+{
+    while (digits > 0U)
+    {
+        digits--;
+        *buf++ = hexDigits[(value >> (4U * digits)) & 0xFU];
+    }
+
+    return buf;
+}
+
+/*
+ *  ======== store ========
+ *  Copies length bytes to the output ring. Returns false if they do not fit.
+ */
+static bool store(CANSlcan_Object *obj, const char *data, size_t length)
+{
+    uint32_t head = obj->head;
+    uint32_t used = head - obj->tail;
+    size_t first;
+
+    if ((CANSlcan_OUTPUT_SIZE - used) < length)
+    {
+        return false;
+    }
+
+    /* Copy the data in up to two parts if it wraps around the end of the ring */
+    first = CANSlcan_OUTPUT_SIZE - (head & OUTPUT_MASK);
+    if (first > length)
+    {
+        first = length;
+    }
+
+    memcpy(&obj->output[head & OUTPUT_MASK], data, first);
+    memcpy(&obj->output[0], &data[first], length - first);
+
+    obj->head = head + length;
+
+    used += length;
+    if (used > obj->stats.highWaterMark)
+    {
+        obj->stats.highWaterMark = used;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== reply ========
+ *  Returns false if the reply was dropped.
+ */
+static bool reply(CANSlcan_Object *obj, const char *data, size_t length)
+{
+    if (!store(obj, data, length))
+    {
+        obj->stats.replyDroppedCnt++;
+        return false;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== replyChar ========
+ */
+static void replyChar(CANSlcan_Object *obj, char c)
+{
+    if (c == REPLY_ERROR)
+    {
+        obj->stats.cmdErrCnt++;
+    }
+
+    reply(obj, &c, 1U);
+}
+
+/*
+ *  ======== transmit ========
+ *  Handles the transmit commands. Returns false if the command is invalid or
+ *  the frame could not be transmitted.
+ */
+static bool transmit(CANSlcan_Object *obj, const char *cmd, uint32_t length)
+{
+    CAN_TxBufElement elem;
+    char type = cmd[0];
+    bool xtd  = (type == 'T') || (type == 'R') || (type == 'D') || (type == 'B');
+    bool rtr  = (type == 'r') || (type == 'R');
+    bool fd   = (type == 'd') || (type == 'D') || (type == 'b') || (type == 'B');
+    uint32_t idDigits = xtd ? EXT_ID_DIGITS : STD_ID_DIGITS;
+    uint32_t dataLen;
+    uint32_t dlc;
+    uint32_t id;
+    uint32_t value;
+    uint32_t i;
+
+    if (!obj->open || (length < (1U + idDigits + 1U)))
+    {
+        return false;
+    }
+
+#ifdef CAN_SUPPORTS_DCAN
+    if (fd)
+    {
+        return false;
+    }
+#endif /* CAN_SUPPORTS_DCAN */
+
+    if (!parseHex(&cmd[1], idDigits, &id) || !parseHex(&cmd[1U + idDigits], 1U, &dlc))
+    {
+        return false;
+    }
+
+    if ((id > (xtd ? EXT_ID_MAX : STD_ID_MAX)) || (!fd && (dlc > CANCodec_MAX_CLASSIC_DATA_LENGTH)))
+    {
+        return false;
+    }
+
+    dataLen = rtr ? 0U : CANCodec_dlcToLength(dlc);
+    if (length != (1U + idDigits + 1U + (2U * dataLen)))
+    {
+        return false;
+    }
+
+    memset(&elem, 0, sizeof(elem));
+    elem.id  = id;
+    elem.xtd = xtd;
+    elem.rtr = rtr;
+    elem.dlc = dlc;
+#ifndef CAN_SUPPORTS_DCAN
+    elem.fdf = fd;
+    elem.brs = (type == 'b') || (type == 'B');
+#endif /* CAN_SUPPORTS_DCAN */
+
+    for (i = 0U; i < dataLen; i++)
+    {
+        if (!parseHex(&cmd[1U + idDigits + 1U + (2U * i)], 2U, &value))
+        {
+            return false;
+        }
+
+        elem.data[i] = (uint8_t)value;
+    }
+
+    if (!obj->params.writeFxn(obj->params.arg, &elem))
+    {
+        obj->stats.txRefusedCnt++;
+        obj->status |= CANSlcan_STATUS_TX_FULL;
+        return false;
+    }
+
+    obj->stats.txCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== handleCommand ========
+ */
+static void handleCommand(CANSlcan_Object *obj, const char *cmd, uint32_t length)
+{
+    char line[4];
+    bool ok = false;
+
+    obj->stats.cmdCnt++;
+
+    if (length == 0U)
+    {
+        /* Empty commands are sent by hosts to flush the line */
+        replyChar(obj, REPLY_OK);
+        return;
+    }
+
+    switch (cmd[0])
+    {
+        case 'S':
+            ok = (length == 2U) && !obj->open && (cmd[1] >= '0') && (cmd[1] <= '8') &&
+                 obj->params.bitRateFxn(obj->params.arg, bitRates[cmd[1] - '0']);
+            break;
+
+        case 'O':
+            ok        = (length == 1U) && !obj->open;
+            obj->open = obj->open || ok;
+            break;
+
+        case 'C':
+            ok        = (length == 1U);
+            obj->open = obj->open && !ok;
+            break;
+
+        case 't':
+        case 'T':
+        case 'r':
+        case 'R':
+        case 'd':
+        case 'D':
+        case 'b':
+        case 'B':
+            if (transmit(obj, cmd, length))
+            {
+                /* Frames with a 29-bit ID are acknowledged with an uppercase Z */
+                line[0] = ((cmd[0] >= 'A') && (cmd[0] <= 'Z')) ? 'Z' : 'z';
+                line[1] = REPLY_OK;
+                reply(obj, line, 2U);
+                return;
+            }
+            break;
+
+        case 'F':
+            if (length == 1U)
+            {
+                line[0] = 'F';
+                putHex(&line[1], obj->status, 2U);
+                line[3] = REPLY_OK;
+
+                /* The flags are kept until the host gets them */
+                if (reply(obj, line, 4U))
+                {
+                    obj->status = 0U;
+                }
+                return;
+            }
+            break;
+
+        case 'Z':
+            ok = (length == 2U) && ((cmd[1] == '0') || (cmd[1] == '1'));
+            if (ok)
+            {
+                obj->timestamps = (cmd[1] == '1');
+            }
+            break;
+
+        case 'V':
+            if (length == 1U)
+            {
+                reply(obj, VERSION_REPLY, sizeof(VERSION_REPLY) - 1U);
+                return;
+            }
+            break;
+
+        case 'N':
+            if (length == 1U)
+            {
+                reply(obj, SERIAL_REPLY, sizeof(SERIAL_REPLY) - 1U);
+                return;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    replyChar(obj, ok ? REPLY_OK : REPLY_ERROR);
+}
+
+/*
+ *  ======== CANSlcan_init ========
+ */
+void CANSlcan_init(CANSlcan_Object *obj, const CANSlcan_Params *params)
+{
+    memset(obj, 0, sizeof(CANSlcan_Object));
+
+    obj->params = *params;
+}
+
+/*
+ *  ======== CANSlcan_input ========
+ */
+void CANSlcan_input(CANSlcan_Object *obj, const uint8_t *data, size_t size)
+{
+    size_t i;
+    char c;
+
+    for (i = 0U; i < size; i++)
+    {
+        c = (char)data[i];
+
+        if (c == '\r')
+        {
+            if (obj->discard)
+            {
+                obj->discard = false;
+                obj->stats.cmdCnt++;
+                replyChar(obj, REPLY_ERROR);
+            }
+            else
+            {
+                handleCommand(obj, obj->cmd, obj->cmdLength);
+            }
+
+            obj->cmdLength = 0U;
+        }
+        else if (c == '\n')
+        {
+            /* Line feeds sent after carriage returns are ignored */
+        }
+        else if (obj->cmdLength < CANSlcan_MAX_CMD_LENGTH)
+        {
+            obj->cmd[obj->cmdLength++] = c;
+        }
+        else
+        {
+            obj->discard = true;
+        }
+    }
+}
+
+/*
+ *  ======== CANSlcan_rxFrame ========
+ */
+bool CANSlcan_rxFrame(CANSlcan_Object *obj, const CAN_RxBufElement *elem, uint32_t timeMs)
+{
+    char line[MAX_FRAME_LINE_LENGTH];
+    char *pos = line;
+    uint32_t dataLen;
+    uint32_t i;
+    bool fd = false;
+
+    if (!obj->open)
+    {
+        return false;
+    }
+
+#ifndef CAN_SUPPORTS_DCAN
+    fd = (elem->fdf != 0U);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    if (fd)
+    {
+#ifndef CAN_SUPPORTS_DCAN
+        *pos++ = (elem->brs != 0U) ? 'b' : 'd';
+#endif /* CAN_SUPPORTS_DCAN */
+    }
+    else
+    {
+        *pos++ = (elem->rtr != 0U) ? 'r' : 't';
+    }
+
+    if (elem->xtd != 0U)
+    {
+        /* Frames with a 29-bit ID use the uppercase command */
+        line[0] = (char)(line[0] - ('a' - 'A'));
+        pos     = putHex(pos, elem->id, EXT_ID_DIGITS);
+    }
+    else
+    {
+        pos = putHex(pos, elem->id, STD_ID_DIGITS);
+    }
+
+    *pos++ = hexDigits[elem->dlc & 0xFU];
+
+    dataLen = (!fd && (elem->rtr != 0U)) ? 0U : CANCodec_dlcToLength(elem->dlc);
+    for (i = 0U; i < dataLen; i++)
+    {
+        pos = putHex(pos, elem->data[i], 2U);
+    }
+
+    if (obj->timestamps)
+    {
+        pos = putHex(pos, timeMs % TIMESTAMP_PERIOD_MS, 4U);
+    }
+
+    *pos++ = '\r';
+
+    if (!store(obj, line, (size_t)(pos - line)))
+    {
+        obj->stats.rxDroppedCnt++;
+        obj->status |= CANSlcan_STATUS_OVERRUN;
+        return false;
+    }
+
+    obj->stats.rxCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== CANSlcan_setStatus ========
+ */
+void CANSlcan_setStatus(CANSlcan_Object *obj, uint32_t flags)
+{
+    obj->status |= (uint8_t)flags;
+}
+
+/*
+ *  ======== CANSlcan_isOpen ========
+ */
+bool CANSlcan_isOpen(const CANSlcan_Object *obj)
+{
+    return obj->open;
+}
+
+/*
+ *  ======== CANSlcan_peek ========
+ */
+size_t CANSlcan_peek(const CANSlcan_Object *obj, const char **data)
+{
+    uint32_t tail = obj->tail;
+    size_t count  = obj->head - tail;
+    size_t first  = CANSlcan_OUTPUT_SIZE - (tail & OUTPUT_MASK);
+
+    *data = &obj->output[tail & OUTPUT_MASK];
+
+    return (count < first) ? count : first;
+}
+
+/*
+ *  ======== CANSlcan_consume ========
+ */
+void CANSlcan_consume(CANSlcan_Object *obj, size_t count)
+{
+    obj->tail += count;
+}
+
+/*
+ *  ======== CANSlcan_getCount ========
+ */
+size_t CANSlcan_getCount(const CANSlcan_Object *obj)
+{
+    return obj->head - obj->tail;
+}
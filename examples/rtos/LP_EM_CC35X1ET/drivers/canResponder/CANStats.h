@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANStats.h ========
+ *  CAN bus health and load statistics.
+ *
+ *  The application reports each driver event, each frame it reads or writes
+ *  and each failed write. The module keeps:
+ *  - a counter per driver event
+ *  - Rx and Tx frame and payload byte counts
+ *  - the bus time taken by these frames, from which the bus load is estimated
+ *  - the largest number of frames read at once, which shows how full the
+ *    driver Rx ring buffer got, and the number of writes refused because the
+ *    Tx ring buffer was full
+ *  - the time spent error passive and bus off
+ *
+ *  The bus time of a frame is computed from its format, ID type and data
+ *  length, the bit timing of the driver and worst-case bit stuffing, so the
+ *  load is a slight overestimate. Frames rejected by the acceptance filters
+ *  are not seen, so they are not included.
+ *
+ *  Times are 64-bit values in 250ns system timer ticks. The functions may be
+ *  called from any context.
+ */
+
+#ifndef CANSTATS_H_
+#define CANSTATS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* One counter per event mask bit */
+#define CANStats_EVENT_CNT 32U
+
+/* Time ticks per microsecond */
+#define CANStats_TICKS_PER_USEC 4U
+
+/* Controller error state */
+typedef enum
+{
+    CANStats_ERR_ACTIVE,
+    CANStats_ERR_PASSIVE,
+    CANStats_BUS_OFF
+} CANStats_ErrorState;
+
+/* Statistics snapshot */
+typedef struct
+{
+    uint64_t time;                             /* Time the snapshot was taken */
+    uint64_t elapsed;                          /* Time since CANStats_init() */
+    uint64_t busTimeNs;                        /* Bus time of the Rx and Tx frames */
+    uint64_t errPassiveTime;                   /* Time spent error passive, including now */
+    uint64_t busOffTime;                       /* Time spent bus off, including now */
+    uint32_t eventCnt[CANStats_EVENT_CNT];     /* Indexed by event mask bit */
+    uint32_t rxFrameCnt;
+    uint32_t rxByteCnt;                        /* Payload bytes */
+    uint32_t txFrameCnt;                       /* Frames accepted by CAN_write() */
+    uint32_t txByteCnt;                        /* Payload bytes */
+    uint32_t txFullCnt;                        /* Frames refused by CAN_write() */
+    uint32_t rxBurstMax;                       /* Most frames read for one Rx event */
+    CANStats_ErrorState errorState;
+} CANStats_Snapshot;
+
+/*
+ *  ======== CANStats_init ========
+ *  Clears the statistics and reads the bit timing of the open driver.
+ */
+extern void CANStats_init(CAN_Handle handle, uint64_t now);
+
+/*
+ *  ======== CANStats_getBitRates ========
+ *  Returns the nominal and data phase bit rates of the driver, in bits per
+ *  second.
+ */
+extern void CANStats_getBitRates(uint32_t *nomBitRate, uint32_t *dataBitRate);
+
+/*
+ *  ======== CANStats_getFrameBits ========
+ *  Returns the worst-case number of bits of a frame sent at the nominal and
+ *  at the data bit rate, including the interframe space. Does not depend on
+ *  the driver, so it may also be used before it is opened.
+ */
+extern void CANStats_getFrameBits(bool xtd,
+                                  bool fdf,
+                                  bool brs,
+                                  uint32_t dataLen,
+                                  uint32_t *nomBits,
+                                  uint32_t *dataBits);
+
+/*
+ *  ======== CANStats_event ========
+ *  Counts a driver event and tracks the error state.
+ */
+extern void CANStats_event(uint32_t event, uint64_t now);
+
+/*
+ *  ======== CANStats_rxFrame ========
+ */
+extern void CANStats_rxFrame(const CAN_RxBufElement *elem);
+
+/*
+ *  ======== CANStats_rxBurst ========
+ *  Reports the number of frames read for one Rx event.
+ */
+extern void CANStats_rxBurst(uint32_t count);
+
+/*
+ *  ======== CANStats_txFrame ========
+ *  Counts a frame accepted by CAN_write().
+ */
+extern void CANStats_txFrame(const CAN_TxBufElement *elem);
+
+/*
+ *  ======== CANStats_txFull ========
+ *  Counts a frame refused by CAN_write().
+ */
+extern void CANStats_txFull(void);
+
+/*
+ *  ======== CANStats_getSnapshot ========
+ */
+extern void CANStats_getSnapshot(CANStats_Snapshot *snapshot, uint64_t now);
+
+/*
+ *  ======== CANStats_getEventCnt ========
+ *  Returns the count of a single CAN_EVENT_* event.
+ */
+extern uint32_t CANStats_getEventCnt(const CANStats_Snapshot *snapshot, uint32_t event);
+
+/*
+ *  ======== CANStats_getBusLoad ========
+ *  Returns the bus load between two snapshots in tenths of a percent.
+ */
+extern uint32_t CANStats_getBusLoad(const CANStats_Snapshot *prev, const CANStats_Snapshot *cur);
+
+/*
+ *  ======== CANStats_formatReport ========
+ *  Formats a compact single line report terminated by "\r\n". The bus load
+ *  is the load since prev and the other values are totals. Returns the number
+ *  of characters written, excluding the terminating null.
+ */
+extern int CANStats_formatReport(const CANStats_Snapshot *prev, const CANStats_Snapshot *cur, char *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CANSTATS_H_ */
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANCodec.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+
+#define WORD_SIZE sizeof(uint32_t)
+
+/* Two hex digits of each byte value */
+#define HEX_ROW(h)                                                                                           \
+    {h, '0'}, {h, '1'}, {h, '2'}, {h, '3'}, {h, '4'}, {h, '5'}, {h, '6'}, {h, '7'}, {h, '8'}, {h, '9'}, \
+        {h, 'A'}, {h, 'B'}, {h, 'C'}, {h, 'D'}, {h, 'E'}, {h, 'F'}
+
+static const char hexTable[256][2] = {HEX_ROW('0'),
+                                      HEX_ROW('1'),
+                                      HEX_ROW('2'),
+                                      HEX_ROW('3'),
+                                      HEX_ROW('4'),
+                                      HEX_ROW('5'),
+                                      HEX_ROW('6'),
+                                      HEX_ROW('7'),
+                                      HEX_ROW('8'),
+                                      HEX_ROW('9'),
+                                      HEX_ROW('A'),
+                                      HEX_ROW('B'),
+                                      HEX_ROW('C'),
+                                      HEX_ROW('D'),
+                                      HEX_ROW('E'),
+                                      HEX_ROW('F')};
+
+/* Converts the uppercase hex digits of hexTable to lowercase */
+#define LOWERCASE(c) ((char)((c) | 0x20))
+
+/* Payload bytes indexed by Data Length Code (DLC) field. */
+static const uint8_t dlcToDataSize[CANCodec_DLC_COUNT] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/*
+ *  ======== putChar ========
+ */
+static void putChar(CANCodec_Cursor *cursor, char c)
+{
+    if (cursor->pos < cursor->end)
+    {
+        *cursor->pos++ = c;
+    }
+}
+
+/*
+ *  ======== putFlag ========
+ *  Appends a line with a label and a single digit value.
+ */
+static void putFlag(CANCodec_Cursor *cursor, const char *label, uint32_t value)
+{
+    CANCodec_putStr(cursor, label);
+    CANCodec_putUint(cursor, value);
+    CANCodec_putStr(cursor, "\r\n");
+}
+
+/*
+ *  ======== CANCodec_dlcToLength ========
+ */
+uint32_t CANCodec_dlcToLength(uint32_t dlc)
+{
+    return (dlc < CANCodec_DLC_COUNT) ? dlcToDataSize[dlc] : 0U;
+}
+
+/*
+ *  ======== CANCodec_lengthToDlc ========
+ */
+uint32_t CANCodec_lengthToDlc(uint32_t length)
+{
+    uint32_t dlc;
+
+    if (length <= CANCodec_MAX_CLASSIC_DATA_LENGTH)
+    {
+        return length;
+    }
+
+    /* Lengths above 8 bytes are few, so the table is searched */
+    for (dlc = CANCodec_MAX_CLASSIC_DATA_LENGTH + 1U; dlc < (CANCodec_DLC_COUNT - 1U); dlc++)
+    {
+        if (length <= dlcToDataSize[dlc])
+        {
+            break;
+        }
+    }
+
+    return dlc;
+}
+
+/*
+ *  ======== CANCodec_findInvertedMismatch ========
+ */
+size_t CANCodec_findInvertedMismatch(const uint8_t *data, const uint8_t *ref, size_t length)
+{
+    size_t i = 0U;
+    uint32_t dataWord;
+    uint32_t refWord;
+
+    /* The words are copied, as the payloads need not be word aligned */
+    for (; (i + WORD_SIZE) <= length; i += WORD_SIZE)
+    {
+        memcpy(&dataWord, &data[i], WORD_SIZE);
+        memcpy(&refWord, &ref[i], WORD_SIZE);
+
+        if ((dataWord ^ refWord) != 0xFFFFFFFFU)
+        {
+            /* The byte loop below finds the mismatch in this word */
+            break;
+        }
+    }
+
+    for (; i < length; i++)
+    {
+        if (data[i] != (uint8_t)~ref[i])
+        {
+            break;
+        }
+    }
+
+    return i;
+}
+
+/*
+ *  ======== CANCodec_copyInverted ========
+ */
+void CANCodec_copyInverted(uint8_t *dst, const uint8_t *src, size_t length)
+{
+    size_t i;
+    uint32_t word;
+
+    for (i = 0U; (i + WORD_SIZE) <= length; i += WORD_SIZE)
+    {
+        memcpy(&word, &src[i], WORD_SIZE);
+        word = ~word;
+        memcpy(&dst[i], &word, WORD_SIZE);
+    }
+
+    for (; i < length; i++)
+    {
+        dst[i] = ~src[i];
+    }
+}
+
+/*
+ *  ======== CANCodec_init ========
+ */
+void CANCodec_init(CANCodec_Cursor *cursor, char *buf, size_t size)
+{
+    cursor->start = buf;
+    cursor->pos   = buf;
+    cursor->end   = &buf[size - 1U];
+}
+
+/*
+ *  ======== CANCodec_finish ========
+ */
+size_t CANCodec_finish(CANCodec_Cursor *cursor)
+{
+    *cursor->pos = '\0';
+
+    return (size_t)(cursor->pos - cursor->start);
+}
+
+/*
+ *  ======== CANCodec_putStr ========
+ */
+void CANCodec_putStr(CANCodec_Cursor *cursor, const char *str)
+{
+    while ((*str != '\0') && (cursor->pos < cursor->end))
+    {
+        *cursor->pos++ = *str++;
+    }
+}
+
+/*
+ *  ======== CANCodec_putUint ========
+ */
+void CANCodec_putUint(CANCodec_Cursor *cursor, uint32_t value)
+{
+    char digits[10];
+    uint_fast8_t n = 0U;
+
+    do
+    {
+        digits[n++] = (char)('0' + (value % 10U));
+        value /= 10U;
+    } while (value != 0U);
+
+    while (n > 0U)
+    {
+        putChar(cursor, digits[--n]);
+    }
+}
+
+/*
+ *  ======== CANCodec_putHex ========
+ */
+void CANCodec_putHex(CANCodec_Cursor *cursor, uint32_t value, uint32_t minDigits)
+{
+    uint32_t digits = 1U;
+    uint32_t shift;
+    const char *pair;
+
+    while ((digits < 8U) && ((value >> (4U * digits)) != 0U))
+    {
+        digits++;
+    }
+
+    if (digits < minDigits)
+    {
+        digits = (minDigits < 8U) ? minDigits : 8U;
+    }
+
+    shift = 4U * digits;
+
+    /* An odd number of digits starts with the low digit of a pair */
+    if ((digits & 1U) != 0U)
+    {
+        shift -= 4U;
+        putChar(cursor, LOWERCASE(hexTable[(value >> shift) & 0xFU][1]));
+    }
+
+    while (shift > 0U)
+    {
+        shift -= 8U;
+        pair = hexTable[(value >> shift) & 0xFFU];
+        putChar(cursor, LOWERCASE(pair[0]));
+        putChar(cursor, LOWERCASE(pair[1]));
+    }
+}
+
+/*
+ *  ======== CANCodec_putHexBytes ========
+ */
+void CANCodec_putHexBytes(CANCodec_Cursor *cursor, const uint8_t *data, size_t length)
+{
+    size_t i;
+    char *pos = cursor->pos;
+
+    if ((size_t)(cursor->end - pos) < (3U * length))
+    {
+        /* Truncate to the whole bytes that fit */
+        length = (size_t)(cursor->end - pos) / 3U;
+    }
+
+    for (i = 0U; i < length; i++)
+    {
+        pos[0] = hexTable[data[i]][0];
+        pos[1] = hexTable[data[i]][1];
+        pos[2] = ' ';
+        pos += 3;
+    }
+
+    cursor->pos = pos;
+}
+
+/*
+ *  ======== CANCodec_putRxElem ========
+ */
+void CANCodec_putRxElem(CANCodec_Cursor *cursor, const CAN_RxBufElement *elem, uint64_t sofTime)
+{
+    uint32_t dataLen;
+
+    CANCodec_putStr(cursor, "Msg ID: 0x");
+    CANCodec_putHex(cursor, elem->id, 1U);
+    CANCodec_putStr(cursor, "\r\nTS: 0x");
+    CANCodec_putHex(cursor, elem->rxts, 4U);
+    CANCodec_putStr(cursor, "\r\nSOF time: 0x");
+    CANCodec_putHex(cursor, (uint32_t)(sofTime >> 32), 8U);
+    CANCodec_putHex(cursor, (uint32_t)sofTime, 8U);
+    CANCodec_putStr(cursor, "\r\n");
+
+#ifndef CAN_SUPPORTS_DCAN
+    putFlag(cursor, "CAN FD: ", elem->fdf);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    putFlag(cursor, "DLC: ", elem->dlc);
+
+#ifndef CAN_SUPPORTS_DCAN
+    putFlag(cursor, "BRS: ", elem->brs);
+#endif /* CAN_SUPPORTS_DCAN */
+
+    putFlag(cursor, "ESI: ", elem->esi);
+
+    if (elem->dlc < CANCodec_DLC_COUNT)
+    {
+        dataLen = dlcToDataSize[elem->dlc];
+
+        CANCodec_putStr(cursor, "Data[");
+        CANCodec_putUint(cursor, dataLen);
+        CANCodec_putStr(cursor, "]: ");
+        CANCodec_putHexBytes(cursor, elem->data, dataLen);
+        CANCodec_putStr(cursor, "\r\n\n");
+    }
+}
+
+/*
+ *  ======== CANCodec_putEvent ========
+ */
+void CANCodec_putEvent(CANCodec_Cursor *cursor, uint32_t event, uint32_t eventData)
+{
+    if (event == CAN_EVENT_RX_DATA_AVAIL)
+    {
+        CANCodec_putStr(cursor, "> Rx data available");
+    }
+    else if (event == CAN_EVENT_TX_FINISHED)
+    {
+        CANCodec_putStr(cursor, "> Tx Finished");
+    }
+    else if (event == CAN_EVENT_TX_EVENT_AVAIL)
+    {
+        CANCodec_putStr(cursor, "> Tx event available");
+    }
+    else if (event == CAN_EVENT_TX_EVENT_LOST)
+    {
+        CANCodec_putStr(cursor, "> Tx event lost");
+    }
+    else if (event == CAN_EVENT_BUS_ON)
+    {
+        CANCodec_putStr(cursor, "> Bus On");
+    }
+    else if (event == CAN_EVENT_BUS_OFF)
+    {
+        CANCodec_putStr(cursor, "> Bus Off");
+    }
+    else if (event == CAN_EVENT_ERR_ACTIVE)
+    {
+        CANCodec_putStr(cursor, "> Error Active");
+    }
+    else if (event == CAN_EVENT_ERR_PASSIVE)
+    {
+        CANCodec_putStr(cursor, "> Error Passive");
+    }
+    else if (event == CAN_EVENT_RX_FIFO_MSG_LOST)
+    {
+        CANCodec_putStr(cursor, "> Rx FIFO ");
+        CANCodec_putUint(cursor, eventData);
+        CANCodec_putStr(cursor, " message lost");
+    }
+    else if (event == CAN_EVENT_RX_RING_BUFFER_FULL)
+    {
+        CANCodec_putStr(cursor, "> Rx ring buffer full: Cnt = ");
+        CANCodec_putUint(cursor, eventData);
+    }
+    else if (event == CAN_EVENT_BIT_ERR_UNCORRECTED)
+    {
+        CANCodec_putStr(cursor, "> Uncorrected bit error");
+    }
+    else if (event == CAN_EVENT_SPI_XFER_ERROR)
+    {
+        CANCodec_putStr(cursor, "> SPI transfer error: status = 0x");
+        CANCodec_putHex(cursor, eventData, 1U);
+    }
+    else
+    {
+        CANCodec_putStr(cursor, "> Undefined event");
+    }
+
+    CANCodec_putStr(cursor, "\r\n\n");
+}
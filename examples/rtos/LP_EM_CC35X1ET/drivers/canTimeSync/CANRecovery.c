@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANRecovery.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include "CANRecovery.h"
+
+#define QUEUE_MASK (CANRecovery_QUEUE_SIZE - 1U)
+
+/*
+ *  ======== nextBackoff ========
+ *  Returns the backoff time that follows backoffMs.
+ */
+static uint32_t nextBackoff(const CANRecovery_Object *obj, uint32_t backoffMs)
+{
+    if (backoffMs >= (obj->params.maxBackoffMs / 2U))
+    {
+        return obj->params.maxBackoffMs;
+    }
+
+    return backoffMs * 2U;
+}
+
+/*
+ *  ======== enqueue ========
+ */
+static int_fast16_t enqueue(CANRecovery_Object *obj, const CAN_TxBufElement *elem)
+{
+    uint32_t count = obj->queueHead - obj->queueTail;
+
+    if (count == CANRecovery_QUEUE_SIZE)
+    {
+        obj->stats.droppedCnt++;
+
+        if (!obj->params.dropOldest)
+        {
+            return CAN_STATUS_TX_BUF_FULL;
+        }
+
+        obj->queueTail++;
+        count--;
+    }
+
+    obj->queue[obj->queueHead & QUEUE_MASK] = *elem;
+    obj->queueHead++;
+    count++;
+
+    obj->stats.queuedCnt++;
+
+    if (count > obj->stats.queueHighWaterMark)
+    {
+        obj->stats.queueHighWaterMark = count;
+    }
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== flushQueue ========
+ *  Writes queued frames until the driver Tx buffers are full.
+ */
+static void flushQueue(CANRecovery_Object *obj)
+{
+    int_fast16_t status;
+
+    while ((obj->queueTail != obj->queueHead) && (obj->state == CANRecovery_BUS_ON))
+    {
+        status = obj->params.writeFxn(obj->params.arg, &obj->queue[obj->queueTail & QUEUE_MASK]);
+
+        if (status == CAN_STATUS_TX_BUF_FULL)
+        {
+            break;
+        }
+
+        if (status != CAN_STATUS_SUCCESS)
+        {
+            /* The frame is dropped so it cannot block the queue */
+            obj->stats.droppedCnt++;
+        }
+
+        obj->queueTail++;
+    }
+}
+
+/*
+ *  ======== recover ========
+ *  Ends the backoff unless the bus went off again since busOffCnt was read.
+ *  Returns false if the backoff was restarted.
+ */
+static bool recover(CANRecovery_Object *obj, uint32_t busOffCnt, uint64_t now)
+{
+    uint64_t downTime;
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    if (obj->stats.busOffCnt != busOffCnt)
+    {
+        obj->restartTime = now + ((uint64_t)obj->backoffMs * CANRecovery_TICKS_PER_MSEC);
+        obj->backoffMs   = nextBackoff(obj, obj->backoffMs);
+
+        HwiP_restore(hwiKey);
+
+        return false;
+    }
+
+    obj->state = CANRecovery_BUS_ON;
+    downTime   = now - obj->busOffTime;
+
+    HwiP_restore(hwiKey);
+
+    obj->busOnTime          = now;
+    obj->stats.downTime    += downTime;
+    obj->stats.lastDownTime = downTime;
+
+    if (downTime > obj->stats.maxDownTime)
+    {
+        obj->stats.maxDownTime = downTime;
+    }
+
+    return true;
+}
+
+/*
+ *  ======== CANRecovery_init ========
+ */
+void CANRecovery_init(CANRecovery_Object *obj, const CANRecovery_Params *params)
+{
+    memset(obj, 0, sizeof(*obj));
+
+    obj->params      = *params;
+    obj->state       = CANRecovery_BUS_ON;
+    obj->driverBusOn = true;
+    obj->backoffMs   = params->minBackoffMs;
+}
+
+/*
+ *  ======== CANRecovery_event ========
+ */
+void CANRecovery_event(CANRecovery_Object *obj, uint32_t event, uint64_t now)
+{
+    uintptr_t hwiKey;
+
+    if ((event != CAN_EVENT_BUS_OFF) && (event != CAN_EVENT_BUS_ON))
+    {
+        return;
+    }
+
+    hwiKey = HwiP_disable();
+
+    if (event == CAN_EVENT_BUS_ON)
+    {
+        obj->driverBusOn = true;
+    }
+    else
+    {
+        obj->driverBusOn = false;
+        obj->stats.busOffCnt++;
+
+        if (obj->state == CANRecovery_BUS_ON)
+        {
+            /* Start over from the shortest backoff once the bus was stable */
+            if ((now - obj->busOnTime) >= ((uint64_t)obj->params.stableTimeMs * CANRecovery_TICKS_PER_MSEC))
+            {
+                obj->backoffMs = obj->params.minBackoffMs;
+            }
+
+            obj->state       = CANRecovery_BACKOFF;
+            obj->busOffTime  = now;
+            obj->restartTime = now + ((uint64_t)obj->backoffMs * CANRecovery_TICKS_PER_MSEC);
+            obj->backoffMs   = nextBackoff(obj, obj->backoffMs);
+        }
+    }
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANRecovery_write ========
+ */
+int_fast16_t CANRecovery_write(CANRecovery_Object *obj, const CAN_TxBufElement *elem)
+{
+    int_fast16_t status;
+
+    if (obj->state == CANRecovery_BUS_ON)
+    {
+        /* Queued frames go first */
+        flushQueue(obj);
+
+        if (obj->queueTail == obj->queueHead)
+        {
+            status = obj->params.writeFxn(obj->params.arg, elem);
+
+            if (status != CAN_STATUS_TX_BUF_FULL)
+            {
+                return status;
+            }
+        }
+    }
+
+    return enqueue(obj, elem);
+}
+
+/*
+ *  ======== CANRecovery_process ========
+ */
+void CANRecovery_process(CANRecovery_Object *obj, uint64_t now)
+{
+    bool driverBusOn;
+    uint32_t busOffCnt;
+    uintptr_t hwiKey;
+
+    if (obj->state == CANRecovery_BACKOFF)
+    {
+        hwiKey = HwiP_disable();
+
+        if (now < obj->restartTime)
+        {
+            HwiP_restore(hwiKey);
+            return;
+        }
+
+        driverBusOn = obj->driverBusOn;
+        busOffCnt   = obj->stats.busOffCnt;
+
+        HwiP_restore(hwiKey);
+
+        /* Restart the driver unless it recovered by itself */
+        if (!driverBusOn)
+        {
+            obj->stats.restartCnt++;
+
+            if (!obj->params.restartFxn(obj->params.arg))
+            {
+                obj->stats.restartFailCnt++;
+
+                hwiKey = HwiP_disable();
+
+                obj->restartTime = now + ((uint64_t)obj->backoffMs * CANRecovery_TICKS_PER_MSEC);
+                obj->backoffMs   = nextBackoff(obj, obj->backoffMs);
+
+                HwiP_restore(hwiKey);
+
+                return;
+            }
+        }
+
+        if (!recover(obj, busOffCnt, now))
+        {
+            return;
+        }
+    }
+
+    flushQueue(obj);
+}
+
+/*
+ *  ======== CANRecovery_isBusOff ========
+ */
+bool CANRecovery_isBusOff(const CANRecovery_Object *obj)
+{
+    return (obj->state == CANRecovery_BACKOFF);
+}
+
+/*
+ *  ======== CANRecovery_isPending ========
+ */
+bool CANRecovery_isPending(const CANRecovery_Object *obj)
+{
+    return (obj->state == CANRecovery_BACKOFF) || (obj->queueTail != obj->queueHead);
+}
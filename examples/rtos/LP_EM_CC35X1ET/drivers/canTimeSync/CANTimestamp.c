@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANTimestamp.c ========
+ */
+#include <stdint.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/ClockP.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include <ti/devices/DeviceFamily.h>
+#include DeviceFamily_constructPath(inc/hw_memmap.h)
+#include DeviceFamily_constructPath(inc/hw_systim.h)
+#include DeviceFamily_constructPath(inc/hw_types.h)
+
+#include "CANTimestamp.h"
+
+/* The 32-bit SYSTIM wraps every 17.9 minutes. The wrap is tracked each time the
+ * time is read, and a clock function reads it at this interval so no wrap is
+ * missed while the application is idle.
+ */
+#define WRAP_CHECK_INTERVAL_USEC 60000000U
+
+/* Picoseconds to 250ns system timer tick conversion macro */
+#define PSEC_TO_SYSTIM(psec) ((psec * 4U) / 1000000U) /* Four 250ns system timer ticks per 1 million ps */
+
+/* Microseconds to 250ns system timer tick conversion macro */
+#define USEC_TO_SYSTIM(usec) ((usec) * 4U)
+
+#define SYSTIM_NOW() HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N)
+
+static ClockP_Struct wrapCheckClock;
+
+/* Upper 32 bits of the 64-bit time and the last SYSTIM value read */
+static uint32_t systimHigh;
+static uint32_t lastSystim;
+
+/* Timestamp counter ticks are converted to SYSTIM ticks by this ratio */
+static uint32_t tsPrescaler;
+static uint32_t counterPeriod;
+
+/* Start Of Frame to Tx/Rx timestamp delay in SYSTIM ticks */
+static uint32_t sofToTimestampDelay;
+
+/*
+ *  ======== extendSystim ========
+ *  Must be called with interrupts disabled.
+ */
+static uint64_t extendSystim(uint32_t systim)
+{
+    if (systim < lastSystim)
+    {
+        systimHigh++;
+    }
+
+    lastSystim = systim;
+
+    return ((uint64_t)systimHigh << 32) | systim;
+}
+
+/*
+ *  ======== wrapCheckFxn ========
+ */
+static void wrapCheckFxn(uintptr_t arg)
+{
+    (void)CANTimestamp_getTime();
+}
+
+/*
+ *  ======== toSofTime ========
+ */
+static uint64_t toSofTime(const CANTimestamp_Ref *ref, uint16_t ts)
+{
+    uint16_t tsToTscvDelta;
+
+    /* Determine the time from the timestamp to where the live timestamp
+     * counter value was read.
+     */
+    tsToTscvDelta = ref->tscv - ts;
+
+    return ref->systim - (((uint32_t)tsToTscvDelta * tsPrescaler) / CANTimestamp_HOST_CLK_PER_SYSTIM_TICK) -
+           sofToTimestampDelay;
+}
+
+/*
+ *  ======== CANTimestamp_init ========
+ */
+void CANTimestamp_init(CAN_Handle handle, uint32_t prescaler)
+{
+    CAN_BitTimingParams bitTiming;
+    ClockP_Params clockParams;
+    uint32_t clkFreqKhz;
+    uint32_t clkPeriod;
+    uint32_t tq;
+    uintptr_t hwiKey;
+
+    tsPrescaler   = prescaler;
+    counterPeriod = (CANTimestamp_COUNTER_RANGE * prescaler) / CANTimestamp_HOST_CLK_PER_SYSTIM_TICK;
+
+    CAN_getBitTiming(handle, &bitTiming, &clkFreqKhz);
+
+    /* Calculate the CAN functional clock period in picoseconds */
+    clkPeriod = 1000000000U / clkFreqKhz;
+
+    /* Determine the Time Quantum in picoseconds.
+     * Note: Add 1 to nomRatePrescaler to get functional value.
+     */
+    tq = clkPeriod * (bitTiming.nomRatePrescaler + 1U);
+
+    /* Calculate the Start Of Frame to Tx/Rx timestamp delta value in picoseconds.
+     * The formula is based on RTL simulation is:
+     *     (6 * CAN_FUNCTIONAL_CLK_PERIOD) + (TSEG1 * tq)
+     * where TSEG1 is the number of time quantum before the sampling point:
+     * Prop_Seg + Phase_Seg1
+     *
+     * Note: Add 1 to nomTimeSeg1 to get functional value
+     */
+    sofToTimestampDelay = (6U * clkPeriod) + ((bitTiming.nomTimeSeg1 + 1U) * tq);
+
+    /* Convert the Start Of Frame to Tx timestamp delta value to system time domain */
+    sofToTimestampDelay = PSEC_TO_SYSTIM(sofToTimestampDelay);
+
+    hwiKey = HwiP_disable();
+
+    systimHigh = 0U;
+    lastSystim = SYSTIM_NOW();
+
+    HwiP_restore(hwiKey);
+
+    ClockP_Params_init(&clockParams);
+    clockParams.period    = WRAP_CHECK_INTERVAL_USEC / ClockP_getSystemTickPeriod();
+    clockParams.startFlag = true;
+
+    ClockP_construct(&wrapCheckClock, wrapCheckFxn, clockParams.period, &clockParams);
+}
+
+/*
+ *  ======== CANTimestamp_getTime ========
+ */
+uint64_t CANTimestamp_getTime(void)
+{
+    uint64_t time;
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    time = extendSystim(SYSTIM_NOW());
+
+    HwiP_restore(hwiKey);
+
+    return time;
+}
+
+/*
+ *  ======== CANTimestamp_extendTime ========
+ */
+uint64_t CANTimestamp_extendTime(uint32_t systim)
+{
+    uint64_t now;
+
+    now = CANTimestamp_getTime();
+
+    return now - (uint32_t)((uint32_t)now - systim);
+}
+
+/*
+ *  ======== CANTimestamp_capture ========
+ */
+void CANTimestamp_capture(CANTimestamp_Ref *ref)
+{
+    uintptr_t hwiKey;
+
+    /* Interrupts are only disabled while sampling the system time and the
+     * CAN timestamp counter, so both values refer to the same instant.
+     */
+    hwiKey = HwiP_disable();
+
+    ref->systim = extendSystim(SYSTIM_NOW());
+
+#ifndef CAN_SUPPORTS_DCAN
+
+    /* Get current timestamp counter value */
+    ref->tscv = MCAN_getTimestampCounter();
+
+#else
+
+    ref->tscv = DCAN_getTimestampCounter();
+
+#endif /* CAN_SUPPORTS_DCAN */
+
+    HwiP_restore(hwiKey);
+}
+
+/*
+ *  ======== CANTimestamp_toSofTime ========
+ */
+uint64_t CANTimestamp_toSofTime(const CANTimestamp_Ref *ref, uint16_t ts)
+{
+    return toSofTime(ref, ts);
+}
+
+/*
+ *  ======== CANTimestamp_toSofTimeAfter ========
+ */
+uint64_t CANTimestamp_toSofTimeAfter(const CANTimestamp_Ref *ref, uint16_t ts, uint64_t notBefore)
+{
+    uint64_t sofTime;
+
+    sofTime = toSofTime(ref, ts);
+
+    /* The timestamp only identifies the SOF time modulo the counter period.
+     * Move back by whole periods to the earliest candidate not before notBefore.
+     */
+    if (sofTime > notBefore)
+    {
+        sofTime -= ((sofTime - notBefore) / counterPeriod) * counterPeriod;
+    }
+
+    return sofTime;
+}
+
+/*
+ *  ======== CANTimestamp_toRxSofTime ========
+ */
+uint64_t CANTimestamp_toRxSofTime(const CANTimestamp_Ref *ref, uint16_t ts, uint32_t eventTime)
+{
+    uint64_t notBefore;
+
+    notBefore = CANTimestamp_extendTime(eventTime) - USEC_TO_SYSTIM(CANTimestamp_RX_MAX_AGE_USEC);
+
+    return CANTimestamp_toSofTimeAfter(ref, ts, notBefore);
+}
+
+/*
+ *  ======== CANTimestamp_getCounterPeriod ========
+ */
+uint32_t CANTimestamp_getCounterPeriod(void)
+{
+    return counterPeriod;
+}
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CANTxSched.c ========
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Driver Header files */
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include "CANTxSched.h"
+
+#define QUEUE_MASK (CANTxSched_QUEUE_SIZE - 1U)
+
+/* Standard and extended identifier fields */
+#define STD_ID_MASK  0x7FFU
+#define EXT_ID_MASK  0x3FFFFU
+#define EXT_ID_SHIFT 18U
+
+/*
+ *  ======== arbitrationKey ========
+ *  Returns a value that orders frames as CAN arbitration does: the lower
+ *  value wins. The fields are compared in the order they are sent: the base
+ *  identifier, the RTR bit of a standard frame or the SRR bit of an extended
+ *  frame, the IDE bit, the identifier extension and the RTR bit of an
+ *  extended frame.
+ */
+static uint32_t arbitrationKey(const CAN_TxBufElement *elem)
+{
+    if (elem->xtd != 0U)
+    {
+        return (((elem->id >> EXT_ID_SHIFT) & STD_ID_MASK) << 21) | (1U << 20) | (1U << 19) |
+               ((elem->id & EXT_ID_MASK) << 1) | elem->rtr;
+    }
+
+    return ((elem->id & STD_ID_MASK) << 21) | ((uint32_t)elem->rtr << 20);
+}
+
+/*
+ *  ======== CANTxSched_init ========
+ */
+void CANTxSched_init(CANTxSched_Object *obj, const CANTxSched_Params *params)
+{
+    CANTxSched_Queue *queue;
+    uint32_t burst;
+    uint32_t i;
+
+    memset(obj, 0, sizeof(*obj));
+
+    obj->maxInFlight = (params->maxInFlight != 0U) ? params->maxInFlight : 1U;
+    obj->writeFxn    = params->writeFxn;
+    obj->arg         = params->arg;
+
+    for (i = 0U; i < CANTxSched_NUM_QUEUES; i++)
+    {
+        queue = &obj->queues[i];
+
+        if (params->queueParams[i].rateHz != 0U)
+        {
+            burst = (params->queueParams[i].burst != 0U) ? params->queueParams[i].burst : 1U;
+
+            queue->interval  = CANTxSched_TICKS_PER_SEC / params->queueParams[i].rateHz;
+            queue->burstTime = (uint64_t)(burst - 1U) * queue->interval;
+        }
+    }
+}
+
+/*
+ *  ======== CANTxSched_submit ========
+ */
+int_fast16_t CANTxSched_submit(CANTxSched_Object *obj, uint32_t queueIdx, const CAN_TxBufElement *elem, uint64_t now)
+{
+    CANTxSched_Queue *queue = &obj->queues[queueIdx];
+    uint32_t count;
+    uintptr_t hwiKey;
+
+    hwiKey = HwiP_disable();
+
+    count = queue->head - queue->tail;
+
+    if (count == CANTxSched_QUEUE_SIZE)
+    {
+        queue->stats.refusedCnt++;
+
+        HwiP_restore(hwiKey);
+
+        return CAN_STATUS_TX_BUF_FULL;
+    }
+
+    queue->elem[queue->head & QUEUE_MASK]       = *elem;
+    queue->submitTime[queue->head & QUEUE_MASK] = now;
+    queue->head++;
+    count++;
+
+    queue->stats.submittedCnt++;
+
+    if (count > queue->stats.highWaterMark)
+    {
+        queue->stats.highWaterMark = count;
+    }
+
+    HwiP_restore(hwiKey);
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== CANTxSched_txIdle ========
+ */
+void CANTxSched_txIdle(CANTxSched_Object *obj)
+{
+    obj->inFlight = 0U;
+}
+
+/*
+ *  ======== CANTxSched_process ========
+ */
+uint64_t CANTxSched_process(CANTxSched_Object *obj, uint64_t now)
+{
+    CANTxSched_Queue *queue;
+    CANTxSched_Queue *best;
+    int_fast16_t status;
+    uint64_t wakeTime;
+    uint64_t readyTime;
+    uint64_t latency;
+    uint32_t bestKey;
+    uint32_t key;
+    uint32_t i;
+    uintptr_t hwiKey;
+
+    while (1)
+    {
+        best     = NULL;
+        bestKey  = 0U;
+        wakeTime = CANTxSched_NO_WAKEUP;
+
+        /* Find the highest priority frame the rate limits allow */
+        for (i = 0U; i < CANTxSched_NUM_QUEUES; i++)
+        {
+            queue = &obj->queues[i];
+
+            if (queue->tail == queue->head)
+            {
+                continue;
+            }
+
+            if (queue->interval != 0U)
+            {
+                readyTime = (queue->nextTime > queue->burstTime) ? (queue->nextTime - queue->burstTime) : 0U;
+
+                if (now < readyTime)
+                {
+                    if (readyTime < wakeTime)
+                    {
+                        wakeTime = readyTime;
+                    }
+
+                    continue;
+                }
+            }
+
+            key = arbitrationKey(&queue->elem[queue->tail & QUEUE_MASK]);
+
+            if ((best == NULL) || (key < bestKey))
+            {
+                best    = queue;
+                bestKey = key;
+            }
+        }
+
+        if (best == NULL)
+        {
+            return wakeTime;
+        }
+
+        /* Count the frame in flight before writing it, so that a Tx finished
+         * event for it cannot be missed.
+         */
+        hwiKey = HwiP_disable();
+
+        if (obj->inFlight >= obj->maxInFlight)
+        {
+            HwiP_restore(hwiKey);
+            return wakeTime;
+        }
+
+        obj->inFlight++;
+
+        HwiP_restore(hwiKey);
+
+        status = obj->writeFxn(obj->arg, &best->elem[best->tail & QUEUE_MASK]);
+
+        if (status != CAN_STATUS_SUCCESS)
+        {
+            hwiKey = HwiP_disable();
+
+            if (obj->inFlight != 0U)
+            {
+                obj->inFlight--;
+            }
+
+            HwiP_restore(hwiKey);
+
+            if (status == CAN_STATUS_TX_BUF_FULL)
+            {
+                /* Retried when the driver reports Tx finished */
+                return wakeTime;
+            }
+
+            /* The frame is dropped so it cannot block the queue */
+            best->stats.failedCnt++;
+        }
+        else
+        {
+            /* A frame submitted after 'now' was read has no latency */
+            latency = best->submitTime[best->tail & QUEUE_MASK];
+            latency = (latency < now) ? (now - latency) : 0U;
+
+            best->stats.sentCnt++;
+            best->stats.sumLatency += latency;
+
+            if (latency > best->stats.maxLatency)
+            {
+                best->stats.maxLatency = (uint32_t)latency;
+            }
+
+            if (best->interval != 0U)
+            {
+                best->nextTime = ((best->nextTime > now) ? best->nextTime : now) + best->interval;
+            }
+        }
+
+        best->tail++;
+    }
+}
+
+/*
+ *  ======== CANTxSched_getCount ========
+ */
+uint32_t CANTxSched_getCount(const CANTxSched_Object *obj, uint32_t queueIdx)
+{
+    return obj->queues[queueIdx].head - obj->queues[queueIdx].tail;
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TimeSyncServo.h ========
+ *  Clock servo that disciplines a local time base to a time sync master.
+ *
+ *  Each sample pairs the Start Of Frame (SOF) time of a time sync message as
+ *  seen by the local node with the SOF time reported by the master in the
+ *  follow-up message. Both times are 32-bit system timer (SYSTIM) values with
+ *  250ns resolution. A proportional-integral (PI) servo tracks the offset and
+ *  the frequency difference between the two time bases, and the resulting
+ *  model converts local time to "network time" (the master's time base).
+ *
+ *  All arithmetic is integer, so the servo behaves identically on any target.
+ */
+
+#ifndef TIMESYNCSERVO_H_
+#define TIMESYNCSERVO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Proportional gain applied to the offset of each sample, as a fraction */
+#ifndef TimeSyncServo_KP_NUM
+    #define TimeSyncServo_KP_NUM 7
+    #define TimeSyncServo_KP_DEN 10
+#endif
+
+/* Integral gain applied to the frequency error of each sample, as a fraction */
+#ifndef TimeSyncServo_KI_NUM
+    #define TimeSyncServo_KI_NUM 3
+    #define TimeSyncServo_KI_DEN 10
+#endif
+
+/* Offsets larger than this (in 250ns ticks) reset the servo. Default: 1ms */
+#ifndef TimeSyncServo_STEP_THRESHOLD
+    #define TimeSyncServo_STEP_THRESHOLD 4000
+#endif
+
+/* Servo state */
+typedef enum
+{
+    TimeSyncServo_State_UNLOCKED, /* No sample received yet */
+    TimeSyncServo_State_LOCKING,  /* Offset known, frequency not yet estimated */
+    TimeSyncServo_State_LOCKED    /* Offset and frequency tracked */
+} TimeSyncServo_State;
+
+/* Sync accuracy statistics, computed over the samples taken while locked */
+typedef struct
+{
+    uint32_t samples;        /* Samples taken while locked */
+    uint32_t resets;         /* Servo resets caused by an offset step */
+    int32_t meanOffsetNs;    /* Mean offset before correction */
+    uint32_t maxOffsetNs;    /* Maximum absolute offset before correction */
+    uint32_t stddevOffsetNs; /* Standard deviation of the offset */
+    int32_t freqPpb;         /* Estimated master frequency relative to local, in ppb */
+} TimeSyncServo_Stats;
+
+/* Servo of one follower. The fields are private. */
+typedef struct
+{
+    /* Time model: networkTime = masterRef + (t - localRef) * (1 + freqPpb / 1e9) */
+    TimeSyncServo_State state;
+    uint32_t localRef;
+    uint32_t masterRef;
+    int32_t freqPpb;
+
+    /* Previous sample, used for the initial frequency estimate */
+    uint32_t prevLocalTime;
+    uint32_t prevMasterTime;
+
+    /* Statistics accumulators, in 250ns ticks */
+    uint32_t samples;
+    uint32_t resets;
+    int64_t sumOffset;
+    uint64_t sumSquaredOffset;
+    uint32_t maxOffset;
+} TimeSyncServo_Object;
+
+/*
+ *  ======== TimeSyncServo_construct ========
+ *  Initializes an unlocked servo with cleared statistics.
+ */
+extern void TimeSyncServo_construct(TimeSyncServo_Object *obj);
+
+/*
+ *  ======== TimeSyncServo_reset ========
+ *  Discards the time model and statistics, except for the reset count.
+ */
+extern void TimeSyncServo_reset(TimeSyncServo_Object *obj);
+
+/*
+ *  ======== TimeSyncServo_update ========
+ *  Adds a sample and returns the offset of the master time from the network
+ *  time predicted for localTime before the sample was applied, in 250ns ticks.
+ */
+extern int32_t TimeSyncServo_update(TimeSyncServo_Object *obj, uint32_t localTime, uint32_t masterTime);
+
+/*
+ *  ======== TimeSyncServo_getNetworkTime ========
+ *  Converts a local SYSTIM time to network time. Returns localTime unchanged
+ *  if the servo has not received a sample yet.
+ */
+extern uint32_t TimeSyncServo_getNetworkTime(const TimeSyncServo_Object *obj, uint32_t localTime);
+
+/*
+ *  ======== TimeSyncServo_getState ========
+ */
+extern TimeSyncServo_State TimeSyncServo_getState(const TimeSyncServo_Object *obj);
+
+/*
+ *  ======== TimeSyncServo_getStats ========
+ *  Returns the sync accuracy statistics. Must not be called concurrently with
+ *  TimeSyncServo_update().
+ */
+extern void TimeSyncServo_getStats(const TimeSyncServo_Object *obj, TimeSyncServo_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMESYNCSERVO_H_ */
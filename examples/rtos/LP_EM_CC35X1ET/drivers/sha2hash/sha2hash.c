@@ -32,9 +32,14 @@
 /*
  *  ======== sha2hash.c ========
  */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
+
+/* POSIX Header files */
+#include <semaphore.h>
 
 /* Driver Header files */
 #include <ti/drivers/UART2.h>
@@ -46,15 +51,46 @@
 /* Defines */
 #define MAX_MSG_LENGTH 256
 
+/* Set to 1 to hash a stream of binary data of a given length instead of a
+ * string typed on the console. The data is received in blocks of
+ * STREAM_BLOCK_SIZE bytes into two buffers, so each block is hashed while the
+ * next one is received.
+ */
+#ifndef SHA2HASH_STREAM_MODE
+    #define SHA2HASH_STREAM_MODE 0
+#endif
+
+/* Stream configuration */
+#define STREAM_BLOCK_SIZE    1024U /* Bytes read into each buffer */
+#define STREAM_LENGTH_DIGITS 9U    /* Digits of the largest stream length */
+
 /* UART pre-formated strings */
 static const char promptStartup[] = "\n\n\rSHA2 Driver hash demo.";
-static const char promptEnter[]   = "\n\n\rEnter a string to hash using SHA2:\n\n\r";
-static const char promptHash[]    = "\n\n\rThe hashed result: ";
+#if SHA2HASH_STREAM_MODE
+static const char promptEnter[] = "\n\n\rEnter the number of bytes to hash, then send the data:\n\n\r";
+#else
+static const char promptEnter[] = "\n\n\rEnter a string to hash using SHA2:\n\n\r";
+#endif /* SHA2HASH_STREAM_MODE */
+static const char promptHash[] = "\n\n\rThe hashed result: ";
 
 /* Message buffers */
 static char msg[MAX_MSG_LENGTH];
 static char formatedMsg[MAX_MSG_LENGTH];
 
+#if SHA2HASH_STREAM_MODE
+
+/* Stream buffers, one being hashed while the other is read */
+static uint8_t streamBuffers[2][STREAM_BLOCK_SIZE];
+
+/* Bytes and status of the last read, set by the read callback */
+static volatile size_t readCount;
+static volatile int_fast16_t readStatus;
+
+/* Posted by the read callback */
+static sem_t readSem;
+
+#endif /* SHA2HASH_STREAM_MODE */
+
 /*
  *  ======== printHash ========
  */
@@ -74,12 +110,148 @@ void printHash(UART2_Handle handle, uint8_t *msg)
     UART2_write(handle, formatedMsg, strlen(formatedMsg), NULL);
 }
 
+#if SHA2HASH_STREAM_MODE
+
+/*
+ *  ======== readCallback ========
+ */
+static void readCallback(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status)
+{
+    readCount  = count;
+    readStatus = status;
+
+    sem_post(&readSem);
+}
+
+/*
+ *  ======== startRead ========
+ *  Starts reading up to size bytes. The read completes as soon as some bytes
+ *  were received.
+ */
+static void startRead(UART2_Handle handle, uint8_t *buf, size_t size)
+{
+    if (UART2_read(handle, buf, size, NULL) != UART2_STATUS_SUCCESS)
+    {
+        /* UART2_read() failed */
+        while (1) {}
+    }
+}
+
+/*
+ *  ======== readLength ========
+ *  Reads and echoes a decimal stream length terminated by a carriage-return.
+ */
+static uint32_t readLength(UART2_Handle handle)
+{
+    uint32_t digits = 0U;
+    uint32_t length = 0U;
+    uint8_t input;
+
+    while (1)
+    {
+        startRead(handle, &input, 1U);
+        sem_wait(&readSem);
+
+        if ((readCount == 0U) || (input < '0') || (input > '9'))
+        {
+            if ((readCount != 0U) && (input == 0x0D) && (digits > 0U))
+            {
+                return length;
+            }
+
+            /* Ignore anything but digits, up to the carriage-return */
+            continue;
+        }
+
+        if (digits < STREAM_LENGTH_DIGITS)
+        {
+            UART2_write(handle, &input, 1, NULL);
+
+            length = (length * 10U) + (uint32_t)(input - '0');
+            digits++;
+        }
+    }
+}
+
+/*
+ *  ======== hashStream ========
+ *  Hashes length bytes received on the UART. Each block is hashed while the
+ *  next one is being received. Returns the number of bytes hashed, less than
+ *  length if a read failed.
+ */
+static uint32_t hashStream(UART2_Handle uart2Handle, SHA2_Handle sha2Handle, uint32_t length, uint8_t *digest)
+{
+    int_fast16_t result;
+    size_t count;
+    uint32_t bufIndex  = 0U;
+    uint32_t received  = 0U;
+    uint32_t requested = 0U;
+    uint8_t *buf;
+
+    SHA2_reset(sha2Handle);
+
+    if (length > 0U)
+    {
+        requested = (length < STREAM_BLOCK_SIZE) ? length : STREAM_BLOCK_SIZE;
+        startRead(uart2Handle, streamBuffers[0], requested);
+    }
+
+    while (received < length)
+    {
+        sem_wait(&readSem);
+
+        if (readStatus != UART2_STATUS_SUCCESS)
+        {
+            /* Overrun or framing error: the data received so far is hashed */
+            break;
+        }
+
+        count = readCount;
+        buf   = streamBuffers[bufIndex];
+
+        received += count;
+        bufIndex ^= 1U;
+
+        /* Receive the next block into the other buffer while this one is hashed */
+        if (received < length)
+        {
+            requested = length - received;
+            if (requested > STREAM_BLOCK_SIZE)
+            {
+                requested = STREAM_BLOCK_SIZE;
+            }
+
+            startRead(uart2Handle, streamBuffers[bufIndex], requested);
+        }
+
+        result = SHA2_addData(sha2Handle, buf, count);
+        if (result != SHA2_STATUS_SUCCESS)
+        {
+            // handle error
+            while (1) {}
+        }
+    }
+
+    result = SHA2_finalize(sha2Handle, digest);
+    if (result != SHA2_STATUS_SUCCESS)
+    {
+        // handle error
+        while (1) {}
+    }
+
+    return received;
+}
+
+#endif /* SHA2HASH_STREAM_MODE */
+
 /*
  *  ======== mainThread ========
  */
 void *mainThread(void *arg0)
 {
+#if !SHA2HASH_STREAM_MODE
     int_fast16_t result;
+#endif /* !SHA2HASH_STREAM_MODE */
 
     /* Driver handles */
     UART2_Handle uart2Handle;
@@ -87,8 +259,17 @@ void *mainThread(void *arg0)
 
     /* UART variables */
     UART2_Params uart2Params;
+#if SHA2HASH_STREAM_MODE
+    uint32_t streamLength;
+    uint32_t hashedLength;
+    uint32_t elapsedMs;
+    struct timespec startTime;
+    struct timespec endTime;
+#else
     uint8_t input;
     uint16_t msgLength = 0;
+    bool segmented;
+#endif /* SHA2HASH_STREAM_MODE */
 
     /* SHA2 variables */
     uint8_t hashedMsg[SHA2_DIGEST_LENGTH_BYTES_256];
@@ -98,7 +279,20 @@ void *mainThread(void *arg0)
 
     /* Open UART for console output */
     UART2_Params_init(&uart2Params);
+#if SHA2HASH_STREAM_MODE
+    /* Reads return as soon as data was received, and complete in the background */
+    uart2Params.readMode       = UART2_Mode_CALLBACK;
+    uart2Params.readCallback   = readCallback;
+    uart2Params.readReturnMode = UART2_ReadReturnMode_PARTIAL;
+
+    if (sem_init(&readSem, 0, 0) != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+#else
     uart2Params.readReturnMode = UART2_ReadReturnMode_FULL;
+#endif /* SHA2HASH_STREAM_MODE */
 
     uart2Handle = UART2_open(CONFIG_UART2_0, &uart2Params);
 
@@ -131,8 +325,32 @@ void *mainThread(void *arg0)
         /* Print prompt */
         UART2_write(uart2Handle, promptEnter, strlen(promptEnter), NULL);
 
+#if SHA2HASH_STREAM_MODE
+
+        streamLength = readLength(uart2Handle);
+
+        clock_gettime(CLOCK_MONOTONIC, &startTime);
+        hashedLength = hashStream(uart2Handle, sha2Handle, streamLength, hashedMsg);
+        clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+        elapsedMs = (uint32_t)(((endTime.tv_sec - startTime.tv_sec) * 1000) +
+                               ((endTime.tv_nsec - startTime.tv_nsec) / 1000000));
+
+        /* Print out the hashed result */
+        printHash(uart2Handle, hashedMsg);
+
+        sprintf(msg,
+                "\n\rHashed %lu of %lu bytes in %lu ms",
+                (unsigned long)hashedLength,
+                (unsigned long)streamLength,
+                (unsigned long)elapsedMs);
+        UART2_write(uart2Handle, msg, strlen(msg), NULL);
+
+#else
+
         /* Reset message length */
         msgLength = 0;
+        segmented = false;
 
         /* Read in from the console until carriage-return is detected */
         while (1)
@@ -155,13 +373,39 @@ void *mainThread(void *arg0)
             /* Check if message buffer is full */
             if (msgLength == MAX_MSG_LENGTH)
             {
-                /* We can't read in any more data, continue on to perform the hash */
-                break;
+                /* Hash the full buffer and continue to read, so longer strings are not truncated */
+                if (!segmented)
+                {
+                    SHA2_reset(sha2Handle);
+                    segmented = true;
+                }
+
+                result = SHA2_addData(sha2Handle, msg, msgLength);
+                if (result != SHA2_STATUS_SUCCESS)
+                {
+                    // handle error
+                    while (1) {}
+                }
+
+                msgLength = 0;
+            }
+        }
+
+        if (!segmented)
+        {
+            /* Perform a single step hash operation of the message */
+            result = SHA2_hashData(sha2Handle, msg, msgLength, hashedMsg);
+        }
+        else
+        {
+            /* Hash the rest of the message and finalize the hash */
+            result = (msgLength > 0U) ? SHA2_addData(sha2Handle, msg, msgLength) : SHA2_STATUS_SUCCESS;
+            if (result == SHA2_STATUS_SUCCESS)
+            {
+                result = SHA2_finalize(sha2Handle, hashedMsg);
             }
         }
 
-        /* Perform a single step hash operation of the message */
-        result = SHA2_hashData(sha2Handle, msg, msgLength, hashedMsg);
         if (result != SHA2_STATUS_SUCCESS)
         {
             // handle error
@@ -170,5 +414,7 @@ void *mainThread(void *arg0)
 
         /* Print out the hashed result */
         printHash(uart2Handle, hashedMsg);
+
+#endif /* SHA2HASH_STREAM_MODE */
     }
 }
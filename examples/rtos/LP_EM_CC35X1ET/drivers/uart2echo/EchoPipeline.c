@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== EchoPipeline.c ========
+ */
+
+#include <string.h>
+
+#include "EchoPipeline.h"
+
+#define BUFFER_INDEX_MASK (EchoPipeline_BUFFER_COUNT - 1U)
+
+static void pump(EchoPipeline_Object *obj);
+
+/*
+ *  ======== EchoPipeline_init ========
+ */
+void EchoPipeline_init(EchoPipeline_Object *obj, const EchoPipeline_Params *params)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->params = *params;
+}
+
+/*
+ *  ======== EchoPipeline_start ========
+ */
+void EchoPipeline_start(EchoPipeline_Object *obj)
+{
+    obj->running = true;
+
+    pump(obj);
+}
+
+/*
+ *  ======== EchoPipeline_stop ========
+ */
+void EchoPipeline_stop(EchoPipeline_Object *obj)
+{
+    obj->running = false;
+}
+
+/*
+ *  ======== EchoPipeline_isIdle ========
+ */
+bool EchoPipeline_isIdle(const EchoPipeline_Object *obj)
+{
+    return !obj->readInFlight && !obj->writeInFlight && (obj->readHead == obj->writeTail);
+}
+
+/*
+ *  ======== EchoPipeline_readDone ========
+ */
+void EchoPipeline_readDone(EchoPipeline_Object *obj, size_t count)
+{
+    uint32_t pendingCnt;
+
+    obj->readInFlight = false;
+
+    if (count > 0U)
+    {
+        obj->lengths[obj->readHead & BUFFER_INDEX_MASK] = count;
+        obj->readHead++;
+
+        obj->stats.bytesRead += count;
+        obj->stats.readCnt++;
+
+        pendingCnt = obj->readHead - obj->writeTail;
+        if (pendingCnt > obj->stats.maxPending)
+        {
+            obj->stats.maxPending = pendingCnt;
+        }
+
+        if (obj->running && (pendingCnt == EchoPipeline_BUFFER_COUNT))
+        {
+            obj->stats.stallCnt++;
+        }
+    }
+
+    pump(obj);
+}
+
+/*
+ *  ======== EchoPipeline_writeDone ========
+ */
+void EchoPipeline_writeDone(EchoPipeline_Object *obj)
+{
+    obj->stats.bytesWritten += obj->lengths[obj->writeTail & BUFFER_INDEX_MASK];
+    obj->stats.writeCnt++;
+
+    obj->writeTail++;
+    obj->writeInFlight = false;
+
+    pump(obj);
+}
+
+/*
+ *  ======== pump ========
+ *  Starts the write of the oldest buffer read and the read into the next free
+ *  buffer, as far as they are not already in flight. A completion reported
+ *  from a start function is only recorded, and handled by the next pass of
+ *  the outer call, so the start functions are never called recursively.
+ */
+static void pump(EchoPipeline_Object *obj)
+{
+    uint32_t index;
+
+    if (obj->pumping)
+    {
+        obj->pending = true;
+        return;
+    }
+
+    obj->pumping = true;
+
+    do
+    {
+        obj->pending = false;
+
+        if (!obj->writeInFlight && (obj->readHead != obj->writeTail))
+        {
+            index              = obj->writeTail & BUFFER_INDEX_MASK;
+            obj->writeInFlight = true;
+            obj->params.writeFxn(obj->params.arg,
+                                 &obj->params.buffers[index * obj->params.bufferSize],
+                                 obj->lengths[index]);
+        }
+
+        if (obj->running && !obj->readInFlight && ((obj->readHead - obj->writeTail) < EchoPipeline_BUFFER_COUNT))
+        {
+            index             = obj->readHead & BUFFER_INDEX_MASK;
+            obj->readInFlight = true;
+            obj->params.readFxn(obj->params.arg,
+                                &obj->params.buffers[index * obj->params.bufferSize],
+                                obj->params.bufferSize);
+        }
+    } while (obj->pending);
+
+    obj->pumping = false;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== EchoPipeline.h ========
+ *  Buffer pipeline of a streaming echo.
+ *
+ *  Received data is read into a ring of EchoPipeline_BUFFER_COUNT buffers.
+ *  Each completed read is written back while the next read is in flight, so
+ *  the receiver is only held up when all buffers are waiting to be written.
+ *  With two buffers, this is double buffering.
+ *
+ *  The module does not call a driver itself. Reads and writes are started
+ *  through functions supplied by the application, which reports their
+ *  completion with EchoPipeline_readDone() and EchoPipeline_writeDone(). The
+ *  start functions may report the completion before they return. All calls
+ *  must be made from the same context, or from contexts that do not preempt
+ *  each other, such as the callbacks of one driver instance. A thread calling
+ *  EchoPipeline_start(), EchoPipeline_stop() or EchoPipeline_isIdle() while
+ *  the callbacks may run must disable their interrupts around the call.
+ *
+ *  The module only depends on the C library.
+ */
+
+#ifndef ECHOPIPELINE_H_
+#define ECHOPIPELINE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of buffers. Must be a power of two. */
+#ifndef EchoPipeline_BUFFER_COUNT
+    #define EchoPipeline_BUFFER_COUNT 2U
+#endif
+
+#if (EchoPipeline_BUFFER_COUNT & (EchoPipeline_BUFFER_COUNT - 1U)) != 0U
+    #error "EchoPipeline_BUFFER_COUNT must be a power of two"
+#endif
+
+/* Starts a read of up to size bytes into buf */
+typedef void (*EchoPipeline_ReadFxn)(void *arg, uint8_t *buf, size_t size);
+
+/* Starts a write of count bytes from buf */
+typedef void (*EchoPipeline_WriteFxn)(void *arg, const uint8_t *buf, size_t count);
+
+/* Pipeline parameters */
+typedef struct
+{
+    uint8_t *buffers;               /* EchoPipeline_BUFFER_COUNT buffers of bufferSize bytes */
+    size_t bufferSize;
+    EchoPipeline_ReadFxn readFxn;
+    EchoPipeline_WriteFxn writeFxn;
+    void *arg;                      /* Passed to readFxn and writeFxn */
+} EchoPipeline_Params;
+
+/* Pipeline statistics */
+typedef struct
+{
+    uint32_t bytesRead;
+    uint32_t bytesWritten;
+    uint32_t readCnt;    /* Reads completed with data */
+    uint32_t writeCnt;   /* Writes completed */
+    uint32_t stallCnt;   /* Reads not restarted at once because all buffers were waiting to be written */
+    uint32_t maxPending; /* Largest number of buffers waiting to be written or being written */
+} EchoPipeline_Stats;
+
+/* Pipeline object. The fields are private, except for stats. */
+typedef struct
+{
+    EchoPipeline_Params params;
+    size_t lengths[EchoPipeline_BUFFER_COUNT];
+    uint32_t readHead;  /* Reads completed with data, free-running */
+    uint32_t writeTail; /* Writes completed, free-running */
+    bool readInFlight;
+    bool writeInFlight;
+    bool running;
+    bool pumping; /* Set while reads and writes are being started */
+    bool pending; /* A completion was reported while pumping */
+    EchoPipeline_Stats stats;
+} EchoPipeline_Object;
+
+/*
+ *  ======== EchoPipeline_init ========
+ *  Initializes a stopped pipeline with all buffers free.
+ */
+extern void EchoPipeline_init(EchoPipeline_Object *obj, const EchoPipeline_Params *params);
+
+/*
+ *  ======== EchoPipeline_start ========
+ *  Starts reading.
+ */
+extern void EchoPipeline_start(EchoPipeline_Object *obj);
+
+/*
+ *  ======== EchoPipeline_stop ========
+ *  Stops starting reads. The buffers already read are still written. The
+ *  read in flight, if any, must be cancelled by the application and reported
+ *  with EchoPipeline_readDone().
+ */
+extern void EchoPipeline_stop(EchoPipeline_Object *obj);
+
+/*
+ *  ======== EchoPipeline_isIdle ========
+ *  Returns true if no read or write is in flight and all buffers read have
+ *  been written.
+ */
+extern bool EchoPipeline_isIdle(const EchoPipeline_Object *obj);
+
+/*
+ *  ======== EchoPipeline_readDone ========
+ *  Reports the completion of a read with count bytes. A read with no data
+ *  is started again.
+ */
+extern void EchoPipeline_readDone(EchoPipeline_Object *obj, size_t count);
+
+/*
+ *  ======== EchoPipeline_writeDone ========
+ *  Reports the completion of a write.
+ */
+extern void EchoPipeline_writeDone(EchoPipeline_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ECHOPIPELINE_H_ */
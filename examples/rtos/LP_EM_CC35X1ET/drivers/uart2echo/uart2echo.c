@@ -33,38 +33,169 @@
 /*
  *  ======== uart2echo.c ========
  */
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* POSIX Header files */
+#include <semaphore.h>
 
 /* Driver Header files */
 #include <ti/drivers/GPIO.h>
 #include <ti/drivers/UART2.h>
+#include <ti/drivers/dpl/HwiP.h>
 
 /* Driver configuration */
 #include "ti_drivers_config.h"
 
+#include "EchoPipeline.h"
+
+/* Size of each echo buffer. A read returns when its buffer is full or the
+ * receive line has been idle for a few characters, so larger buffers take
+ * fewer driver calls per byte at high baud rates.
+ */
+#define ECHO_BUFFER_SIZE 256U
+
+/* Baud rate of the echo */
+#define ECHO_BAUD_RATE 115200U
+
+/* Set to 1 to measure the sustained echo throughput, the CPU load and the
+ * overrun count at each rate of benchBaudRates before echoing at
+ * ECHO_BAUD_RATE.
+ */
+#ifndef UART2ECHO_BENCHMARK_MODE
+    #define UART2ECHO_BENCHMARK_MODE 0
+#endif
+
+/* Benchmark configuration */
+#define BENCH_IDLE_TIMEOUT_MS  1000U /* A run ends this long after the last byte echoed */
+#define BENCH_CALIBRATION_MS   1000U /* Time the idle loop is timed without load */
+#define BENCH_DRAIN_POLL_USEC  1000U
+
+#define MAX_MSG_LENGTH 256
+
+#if UART2ECHO_BENCHMARK_MODE
+
+/* Iterations of the idle loop while the echo runs */
+typedef struct
+{
+    uint64_t startTime; /* Time of the first and last change in bytes echoed, in microseconds */
+    uint64_t endTime;
+    uint32_t startLoops;
+    uint32_t endLoops;
+    uint32_t startBytes;
+    uint32_t endBytes;
+} IdleLoopResult;
+
+/* Baud rates of the benchmark runs */
+const uint32_t benchBaudRates[] = {115200U, 921600U, 3000000U};
+
+#endif /* UART2ECHO_BENCHMARK_MODE */
+
+/* The following globals are not designated as 'static' to allow CCS IDE access */
+
+/* UART2 handle */
+UART2_Handle uart;
+
+/* Echo buffers and their pipeline */
+uint8_t echoBuffers[EchoPipeline_BUFFER_COUNT * ECHO_BUFFER_SIZE];
+EchoPipeline_Object echo;
+
+/* Set while a message other than echoed data is being written */
+volatile bool textWriteInFlight = false;
+
+/* Posted when a message has been written */
+sem_t textWriteSem;
+
+/* Formatted message buffer */
+char formattedMsg[MAX_MSG_LENGTH];
+
+/* Forward declarations */
+static void readCallback(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status);
+static void writeCallback(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status);
+static void startRead(void *arg, uint8_t *buf, size_t size);
+static void startWrite(void *arg, const uint8_t *buf, size_t count);
+static void openUart(uint32_t baudRate);
+static void writeText(const char *text);
+static void startEcho(void);
+#if UART2ECHO_BENCHMARK_MODE
+static void stopEcho(void);
+static uint64_t getTimeUsec(void);
+static void runIdleLoop(IdleLoopResult *result, uint32_t timeoutMs, bool waitForData);
+static void runBenchmark(uint32_t baudRate, const IdleLoopResult *calibration);
+#endif /* UART2ECHO_BENCHMARK_MODE */
+
 /*
- *  ======== mainThread ========
+ *  ======== readCallback ========
+ *  A read returns as soon as data is received, or with the data received so
+ *  far when it is cancelled. Overruns are counted by the driver.
  */
-void *mainThread(void *arg0)
+static void readCallback(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status)
 {
-    char input;
-    const char echoPrompt[] = "Echoing characters:\r\n";
-    UART2_Handle uart;
-    UART2_Params uartParams;
-    size_t bytesRead;
-    size_t bytesWritten = 0;
-    int_fast16_t status = UART2_STATUS_SUCCESS;
+    EchoPipeline_readDone(&echo, count);
+}
 
-    /* Call driver init functions */
-    GPIO_init();
+/*
+ *  ======== writeCallback ========
+ */
+static void writeCallback(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status)
+{
+    if (textWriteInFlight)
+    {
+        textWriteInFlight = false;
+        sem_post(&textWriteSem);
+    }
+    else
+    {
+        EchoPipeline_writeDone(&echo);
+    }
+}
 
-    /* Configure the LED pin */
-    GPIO_setConfig(CONFIG_GPIO_LED_0, GPIO_CFG_OUT_STD | GPIO_CFG_OUT_LOW);
+/*
+ *  ======== startRead ========
+ *  Echo pipeline read function.
+ */
+static void startRead(void *arg, uint8_t *buf, size_t size)
+{
+    if (UART2_read(uart, buf, size, NULL) != UART2_STATUS_SUCCESS)
+    {
+        /* UART2_read() failed */
+        while (1) {}
+    }
+}
+
+/*
+ *  ======== startWrite ========
+ *  Echo pipeline write function.
+ */
+static void startWrite(void *arg, const uint8_t *buf, size_t count)
+{
+    if (UART2_write(uart, buf, count, NULL) != UART2_STATUS_SUCCESS)
+    {
+        /* UART2_write() failed */
+        while (1) {}
+    }
+}
+
+/*
+ *  ======== openUart ========
+ *  Opens the UART in callback mode. Reads return as soon as data is received.
+ */
+static void openUart(uint32_t baudRate)
+{
+    UART2_Params uartParams;
 
-    /* Create a UART where the default read and write mode is BLOCKING */
     UART2_Params_init(&uartParams);
-    uartParams.baudRate = 115200;
+    uartParams.baudRate       = baudRate;
+    uartParams.readMode       = UART2_Mode_CALLBACK;
+    uartParams.writeMode      = UART2_Mode_CALLBACK;
+    uartParams.readCallback   = readCallback;
+    uartParams.writeCallback  = writeCallback;
+    uartParams.readReturnMode = UART2_ReadReturnMode_PARTIAL;
 
     uart = UART2_open(CONFIG_UART2_0, &uartParams);
 
@@ -73,37 +204,262 @@ void *mainThread(void *arg0)
         /* UART2_open() failed */
         while (1) {}
     }
+}
 
-    /* Turn on user LED to indicate successful initialization */
-    GPIO_write(CONFIG_GPIO_LED_0, CONFIG_GPIO_LED_ON);
+/*
+ *  ======== writeText ========
+ *  Writes a message and waits until it is written. Must not be called while
+ *  the echo writes data.
+ */
+static void writeText(const char *text)
+{
+    textWriteInFlight = true;
+
+    if (UART2_write(uart, text, strlen(text), NULL) != UART2_STATUS_SUCCESS)
+    {
+        /* UART2_write() failed */
+        while (1) {}
+    }
+
+    sem_wait(&textWriteSem);
+}
+
+/*
+ *  ======== startEcho ========
+ *  Starts the echo. From then on it runs in the UART callbacks.
+ */
+static void startEcho(void)
+{
+    EchoPipeline_Params echoParams;
+    uintptr_t hwiKey;
+
+    echoParams.buffers    = echoBuffers;
+    echoParams.bufferSize = ECHO_BUFFER_SIZE;
+    echoParams.readFxn    = startRead;
+    echoParams.writeFxn   = startWrite;
+    echoParams.arg        = NULL;
+
+    EchoPipeline_init(&echo, &echoParams);
+
+    /* The pipeline must not be entered from the UART callbacks meanwhile */
+    hwiKey = HwiP_disable();
+    EchoPipeline_start(&echo);
+    HwiP_restore(hwiKey);
+}
+
+#if UART2ECHO_BENCHMARK_MODE
+
+/*
+ *  ======== stopEcho ========
+ *  Stops the echo once the data received has been written back.
+ */
+static void stopEcho(void)
+{
+    uintptr_t hwiKey;
+    bool idle;
+
+    hwiKey = HwiP_disable();
+    EchoPipeline_stop(&echo);
+    HwiP_restore(hwiKey);
 
-    UART2_write(uart, echoPrompt, sizeof(echoPrompt), &bytesWritten);
+    UART2_readCancel(uart);
 
-    /* Loop forever echoing */
     while (1)
     {
-        bytesRead = 0;
-        while (bytesRead == 0)
+        hwiKey = HwiP_disable();
+        idle   = EchoPipeline_isIdle(&echo);
+        HwiP_restore(hwiKey);
+
+        if (idle)
         {
-            status = UART2_read(uart, &input, 1, &bytesRead);
+            break;
+        }
+
+        usleep(BENCH_DRAIN_POLL_USEC);
+    }
+}
+
+/*
+ *  ======== getTimeUsec ========
+ */
+static uint64_t getTimeUsec(void)
+{
+    struct timespec ts;
 
-            if (status != UART2_STATUS_SUCCESS)
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U);
+}
+
+/*
+ *  ======== runIdleLoop ========
+ *  Counts the iterations of a busy loop, which only runs when the echo
+ *  callbacks do not. The loop follows the number of bytes echoed and ends
+ *  timeoutMs after its last change. If waitForData is false, the loop is
+ *  timed from its start, to calibrate the iteration rate without load.
+ */
+static void runIdleLoop(IdleLoopResult *result, uint32_t timeoutMs, bool waitForData)
+{
+    uint64_t now;
+    uint32_t loops     = 0U;
+    uint32_t bytes;
+    uint32_t lastBytes = echo.stats.bytesWritten;
+    bool started       = !waitForData;
+
+    now                = getTimeUsec();
+    result->startTime  = now;
+    result->endTime    = now;
+    result->startLoops = 0U;
+    result->endLoops   = 0U;
+    result->startBytes = lastBytes;
+    result->endBytes   = lastBytes;
+
+    while (1)
+    {
+        loops++;
+        now   = getTimeUsec();
+        bytes = echo.stats.bytesWritten;
+
+        if (bytes != lastBytes)
+        {
+            if (!started)
             {
-                /* UART2_read() failed */
-                while (1) {}
+                started            = true;
+                result->startTime  = now;
+                result->startLoops = loops;
+                result->startBytes = bytes;
             }
-        }
 
-        bytesWritten = 0;
-        while (bytesWritten == 0)
+            lastBytes        = bytes;
+            result->endTime  = now;
+            result->endLoops = loops;
+            result->endBytes = bytes;
+        }
+        else if (started && ((now - result->endTime) >= ((uint64_t)timeoutMs * 1000U)))
         {
-            status = UART2_write(uart, &input, 1, &bytesWritten);
+            break;
+        }
+    }
 
-            if (status != UART2_STATUS_SUCCESS)
-            {
-                /* UART2_write() failed */
-                while (1) {}
-            }
+    if (!waitForData)
+    {
+        result->endTime  = now;
+        result->endLoops = loops;
+    }
+}
+
+/*
+ *  ======== runBenchmark ========
+ *  Echoes the data sent at baudRate until the sender has been idle for
+ *  BENCH_IDLE_TIMEOUT_MS, then prints the results as a single line JSON
+ *  object. The throughput and the CPU load are measured from the first to the
+ *  last change in the bytes echoed.
+ */
+static void runBenchmark(uint32_t baudRate, const IdleLoopResult *calibration)
+{
+    IdleLoopResult result;
+    uint64_t elapsed;
+    uint64_t idleLoops;
+    uint32_t bytesPerSec = 0U;
+    uint32_t loadPermille = 0U;
+
+    openUart(baudRate);
+
+    sprintf(formattedMsg,
+            "Benchmark at %u baud. Send data, the run ends %u ms after the last byte.\r\n",
+            (unsigned int)baudRate,
+            (unsigned int)BENCH_IDLE_TIMEOUT_MS);
+    writeText(formattedMsg);
+
+    startEcho();
+    runIdleLoop(&result, BENCH_IDLE_TIMEOUT_MS, true);
+    stopEcho();
+
+    elapsed = result.endTime - result.startTime;
+
+    if (elapsed > 0U)
+    {
+        bytesPerSec = (uint32_t)(((uint64_t)(result.endBytes - result.startBytes) * 1000000U) / elapsed);
+
+        /* Iterations the loop would have made without load in the same time */
+        idleLoops = ((uint64_t)calibration->endLoops * elapsed) / (calibration->endTime - calibration->startTime);
+
+        if (idleLoops > (result.endLoops - result.startLoops))
+        {
+            loadPermille = (uint32_t)(1000U - (((uint64_t)(result.endLoops - result.startLoops) * 1000U) / idleLoops));
         }
     }
+
+    sprintf(formattedMsg,
+            "{\"baud\":%u,\"buffer_size\":%u,\"buffers\":%u,\"bytes\":%u,\"elapsed_us\":%u,\"bytes_per_s\":%u,"
+            "\"cpu_load_pct\":%u.%u,\"overruns\":%u,\"stalls\":%u,\"max_pending\":%u}\r\n",
+            (unsigned int)baudRate,
+            (unsigned int)ECHO_BUFFER_SIZE,
+            (unsigned int)EchoPipeline_BUFFER_COUNT,
+            (unsigned int)echo.stats.bytesWritten,
+            (unsigned int)elapsed,
+            (unsigned int)bytesPerSec,
+            (unsigned int)(loadPermille / 10U),
+            (unsigned int)(loadPermille % 10U),
+            (unsigned int)UART2_getOverrunCount(uart),
+            (unsigned int)echo.stats.stallCnt,
+            (unsigned int)echo.stats.maxPending);
+    writeText(formattedMsg);
+
+    UART2_close(uart);
+}
+
+#endif /* UART2ECHO_BENCHMARK_MODE */
+
+/*
+ *  ======== mainThread ========
+ */
+void *mainThread(void *arg0)
+{
+    const char echoPrompt[] = "Echoing characters:\r\n";
+#if UART2ECHO_BENCHMARK_MODE
+    IdleLoopResult calibration;
+    uint32_t i;
+#endif /* UART2ECHO_BENCHMARK_MODE */
+    int retc;
+
+    /* Call driver init functions */
+    GPIO_init();
+
+    /* Configure the LED pin */
+    GPIO_setConfig(CONFIG_GPIO_LED_0, GPIO_CFG_OUT_STD | GPIO_CFG_OUT_LOW);
+
+    retc = sem_init(&textWriteSem, 0, 0);
+    if (retc != 0)
+    {
+        /* sem_init() failed */
+        while (1) {}
+    }
+
+#if UART2ECHO_BENCHMARK_MODE
+
+    /* Time the idle loop while nothing else runs */
+    runIdleLoop(&calibration, BENCH_CALIBRATION_MS, false);
+
+    for (i = 0U; i < (sizeof(benchBaudRates) / sizeof(benchBaudRates[0])); i++)
+    {
+        runBenchmark(benchBaudRates[i], &calibration);
+    }
+
+#endif /* UART2ECHO_BENCHMARK_MODE */
+
+    openUart(ECHO_BAUD_RATE);
+
+    /* Turn on user LED to indicate successful initialization */
+    GPIO_write(CONFIG_GPIO_LED_0, CONFIG_GPIO_LED_ON);
+
+    writeText(echoPrompt);
+
+    /* The echo runs in the UART callbacks from now on */
+    startEcho();
+
+    while (1)
+    {
+        sleep(1);
+    }
 }
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CaptureReader.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "CaptureReader.h"
+
+/* pcap file header fields: nanosecond timestamps, version 2.4 */
+#define PCAP_MAGIC_NSEC        0xA1B23C4DU
+#define PCAP_VERSION_MAJOR     2U
+#define PCAP_VERSION_MINOR     4U
+#define LINKTYPE_CAN_SOCKETCAN 227U
+
+/* SocketCAN frame layout */
+#define SOCKETCAN_HEADER_SIZE 8U
+#define SOCKETCAN_CAN_SIZE    16U
+#define SOCKETCAN_CANFD_SIZE  72U
+#define SOCKETCAN_EFF_FLAG    0x80000000U /* Extended frame format */
+#define SOCKETCAN_RTR_FLAG    0x40000000U /* Remote frame */
+#define SOCKETCANFD_BRS       0x01U
+#define SOCKETCANFD_ESI       0x02U
+#define SOCKETCANFD_FDF       0x04U
+
+/* Length of a classic CAN payload */
+#define CAN_CLASSIC_MAX_LENGTH 8U
+
+/* candump flags of a CAN FD frame */
+#define CANDUMP_FD_BRS 0x1U
+#define CANDUMP_FD_ESI 0x2U
+
+/* Longest interface name written to a candump line */
+#define CANDUMP_INTERFACE_MAX 16U
+
+#define NSEC_PER_SEC 1000000000ULL
+
+/*
+ *  ======== putLe16 ========
+ */
+static void putLe16(uint8_t *buf, uint32_t value)
+{
+    buf[0] = (uint8_t)value;
+    buf[1] = (uint8_t)(value >> 8);
+}
+
+/*
+ *  ======== putLe32 ========
+ */
+static void putLe32(uint8_t *buf, uint32_t value)
+{
+    buf[0] = (uint8_t)value;
+    buf[1] = (uint8_t)(value >> 8);
+    buf[2] = (uint8_t)(value >> 16);
+    buf[3] = (uint8_t)(value >> 24);
+}
+
+/*
+ *  ======== putBe32 ========
+ */
+static void putBe32(uint8_t *buf, uint32_t value)
+{
+    buf[0] = (uint8_t)(value >> 24);
+    buf[1] = (uint8_t)(value >> 16);
+    buf[2] = (uint8_t)(value >> 8);
+    buf[3] = (uint8_t)value;
+}
+
+/*
+ *  ======== readFrame ========
+ *  Passes a decoded record to the callback with its extended time.
+ */
+static void readFrame(CaptureReader_Object *obj, const CANCapture_Record *record)
+{
+    CaptureReader_Frame frame;
+
+    /* Records are stored in time order, so an earlier time is a wrap */
+    if (obj->started && (record->time < obj->lastTime))
+    {
+        obj->wrapTime += 0x100000000ULL;
+    }
+
+    obj->started  = true;
+    obj->lastTime = record->time;
+
+    obj->stats.recordCnt++;
+
+    if ((record->flags & CANCapture_FLAG_LOST) != 0U)
+    {
+        obj->stats.lostCnt++;
+    }
+
+    frame.time   = obj->wrapTime + record->time;
+    frame.record = *record;
+
+    obj->frameFxn(obj->arg, &frame);
+}
+
+/*
+ *  ======== CaptureReader_init ========
+ */
+void CaptureReader_init(CaptureReader_Object *obj, CaptureReader_FrameFxn frameFxn, void *arg)
+{
+    memset(obj, 0, sizeof(*obj));
+
+    obj->frameFxn = frameFxn;
+    obj->arg      = arg;
+}
+
+/*
+ *  ======== CaptureReader_receive ========
+ */
+void CaptureReader_receive(CaptureReader_Object *obj, const uint8_t *data, size_t length)
+{
+    CANCapture_Record record;
+    int_fast16_t result;
+    size_t count;
+
+    while (length > 0U)
+    {
+        /* Add as much of the input as the pending bytes can hold */
+        count = sizeof(obj->pending) - obj->pendingLength;
+        if (count > length)
+        {
+            count = length;
+        }
+
+        memcpy(&obj->pending[obj->pendingLength], data, count);
+        obj->pendingLength += count;
+        data += count;
+        length -= count;
+
+        while (obj->pendingLength > 0U)
+        {
+            result = CANCapture_decode(obj->pending, obj->pendingLength, &record);
+
+            if (result == CANCapture_INCOMPLETE)
+            {
+                break;
+            }
+
+            if (result == CANCapture_INVALID)
+            {
+                obj->stats.skippedCnt++;
+                result = 1;
+            }
+            else
+            {
+                readFrame(obj, &record);
+            }
+
+            obj->pendingLength -= (size_t)result;
+            memmove(obj->pending, &obj->pending[result], obj->pendingLength);
+        }
+    }
+}
+
+/*
+ *  ======== CaptureReader_getPending ========
+ */
+size_t CaptureReader_getPending(const CaptureReader_Object *obj)
+{
+    return obj->pendingLength;
+}
+
+/*
+ *  ======== CaptureReader_formatCandump ========
+ *  Classic frames are written as <id>#<data>, remote frames as <id>#R with
+ *  the DLC if it is not 0, and CAN FD frames as <id>##<flags><data>. The
+ *  time is given in microseconds. Interface names are cut at
+ *  CANDUMP_INTERFACE_MAX characters.
+ */
+size_t CaptureReader_formatCandump(const CaptureReader_Frame *frame, const char *interface, char *text, size_t size)
+{
+    const CANCapture_Record *record = &frame->record;
+    uint64_t timeNs                 = frame->time * CaptureReader_NSEC_PER_TICK;
+    char line[CaptureReader_CANDUMP_LINE_MAX];
+    size_t length;
+    uint32_t fdFlags;
+    uint32_t i;
+
+    length = (size_t)sprintf(line,
+                             ((record->flags & CANCapture_FLAG_XTD) != 0U) ? "(%llu.%06u) %.*s %08X#"
+                                                                           : "(%llu.%06u) %.*s %03X#",
+                             (unsigned long long)(timeNs / NSEC_PER_SEC),
+                             (unsigned int)((timeNs % NSEC_PER_SEC) / 1000U),
+                             (int)CANDUMP_INTERFACE_MAX,
+                             interface,
+                             (unsigned int)record->id);
+
+    if ((record->flags & CANCapture_FLAG_FDF) != 0U)
+    {
+        fdFlags = (((record->flags & CANCapture_FLAG_BRS) != 0U) ? CANDUMP_FD_BRS : 0U) |
+                  (((record->flags & CANCapture_FLAG_ESI) != 0U) ? CANDUMP_FD_ESI : 0U);
+
+        length += (size_t)sprintf(&line[length], "#%X", (unsigned int)fdFlags);
+    }
+    else if ((record->flags & CANCapture_FLAG_RTR) != 0U)
+    {
+        line[length++] = 'R';
+
+        if (record->dlc != 0U)
+        {
+            length += (size_t)sprintf(&line[length], "%X", (unsigned int)record->dlc);
+        }
+    }
+
+    for (i = 0U; i < record->dataLen; i++)
+    {
+        length += (size_t)sprintf(&line[length], "%02X", (unsigned int)record->data[i]);
+    }
+
+    line[length++] = '\n';
+
+    if (size == 0U)
+    {
+        return 0U;
+    }
+
+    if (length >= size)
+    {
+        length = size - 1U;
+    }
+
+    memcpy(text, line, length);
+    text[length] = '\0';
+
+    return length;
+}
+
+/*
+ *  ======== CaptureReader_getPcapHeader ========
+ */
+size_t CaptureReader_getPcapHeader(uint8_t *buf)
+{
+    putLe32(&buf[0], PCAP_MAGIC_NSEC);
+    putLe16(&buf[4], PCAP_VERSION_MAJOR);
+    putLe16(&buf[6], PCAP_VERSION_MINOR);
+    putLe32(&buf[8], 0U);  /* Time zone offset */
+    putLe32(&buf[12], 0U); /* Timestamp accuracy */
+    putLe32(&buf[16], SOCKETCAN_CANFD_SIZE);
+    putLe32(&buf[20], LINKTYPE_CAN_SOCKETCAN);
+
+    return CaptureReader_PCAP_HEADER_SIZE;
+}
+
+/*
+ *  ======== CaptureReader_encodePcap ========
+ *  The record holds a struct can_frame or struct canfd_frame of SocketCAN,
+ *  whose CAN ID is big endian in LINKTYPE_CAN_SOCKETCAN.
+ */
+size_t CaptureReader_encodePcap(const CaptureReader_Frame *frame, uint8_t *buf)
+{
+    const CANCapture_Record *record = &frame->record;
+    uint64_t timeNs                 = frame->time * CaptureReader_NSEC_PER_TICK;
+    uint8_t *can                    = &buf[16];
+    uint32_t canId                  = record->id;
+    uint32_t frameSize;
+    uint32_t length;
+
+    if ((record->flags & CANCapture_FLAG_XTD) != 0U)
+    {
+        canId |= SOCKETCAN_EFF_FLAG;
+    }
+
+    memset(can, 0, SOCKETCAN_CANFD_SIZE);
+
+    if ((record->flags & CANCapture_FLAG_FDF) != 0U)
+    {
+        frameSize = SOCKETCAN_CANFD_SIZE;
+        length    = record->dataLen;
+        can[5]    = SOCKETCANFD_FDF;
+
+        if ((record->flags & CANCapture_FLAG_BRS) != 0U)
+        {
+            can[5] |= SOCKETCANFD_BRS;
+        }
+
+        if ((record->flags & CANCapture_FLAG_ESI) != 0U)
+        {
+            can[5] |= SOCKETCANFD_ESI;
+        }
+    }
+    else
+    {
+        frameSize = SOCKETCAN_CAN_SIZE;
+        length    = (record->dlc < CAN_CLASSIC_MAX_LENGTH) ? record->dlc : CAN_CLASSIC_MAX_LENGTH;
+
+        if ((record->flags & CANCapture_FLAG_RTR) != 0U)
+        {
+            canId |= SOCKETCAN_RTR_FLAG;
+        }
+
+        /* DLCs 9 to 15 of classic frames, len8_dlc */
+        if (record->dlc > CAN_CLASSIC_MAX_LENGTH)
+        {
+            can[7] = record->dlc;
+        }
+    }
+
+    putBe32(&can[0], canId);
+    can[4] = (uint8_t)length;
+    memcpy(&can[SOCKETCAN_HEADER_SIZE], record->data, (record->dataLen < length) ? record->dataLen : length);
+
+    putLe32(&buf[0], (uint32_t)(timeNs / NSEC_PER_SEC));
+    putLe32(&buf[4], (uint32_t)(timeNs % NSEC_PER_SEC));
+    putLe32(&buf[8], frameSize);
+    putLe32(&buf[12], frameSize);
+
+    return 16U + frameSize;
+}
+
+/*
+ *  ======== CaptureReader_toTxElem ========
+ */
+void CaptureReader_toTxElem(const CANCapture_Record *record, CAN_TxBufElement *elem)
+{
+    memset(elem, 0, sizeof(*elem));
+
+    elem->id  = record->id;
+    elem->xtd = ((record->flags & CANCapture_FLAG_XTD) != 0U) ? 1U : 0U;
+    elem->rtr = ((record->flags & CANCapture_FLAG_RTR) != 0U) ? 1U : 0U;
+    elem->fdf = ((record->flags & CANCapture_FLAG_FDF) != 0U) ? 1U : 0U;
+    elem->brs = ((record->flags & CANCapture_FLAG_BRS) != 0U) ? 1U : 0U;
+    elem->esi = ((record->flags & CANCapture_FLAG_ESI) != 0U) ? 1U : 0U;
+    elem->dlc = record->dlc;
+
+    memcpy(elem->data, record->data, record->dataLen);
+}
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CaptureReader.h ========
+ *  Host reader of the CAN frame captures written by the CANCapture module of
+ *  the canResponder example.
+ *
+ *  The stream is fed in parts of any size, as received from the UART or read
+ *  from a file. The reader decodes the records with CANCapture_decode(),
+ *  skips the bytes that do not start a valid record, and passes each record
+ *  to a callback with its time extended to 64 bits. The 32-bit record time
+ *  wraps every 1073 seconds, so a capture must not pause for longer than
+ *  that.
+ *
+ *  The frames can be converted to the candump log format of the Linux
+ *  can-utils, or to pcap records of link type LINKTYPE_CAN_SOCKETCAN with
+ *  nanosecond timestamps, which Wireshark and tcpdump read.
+ */
+
+#ifndef CAPTUREREADER_H_
+#define CAPTUREREADER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCapture.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Nanoseconds per tick of the record time */
+#define CaptureReader_NSEC_PER_TICK 250U
+
+/* Size of the pcap file header */
+#define CaptureReader_PCAP_HEADER_SIZE 24U
+
+/* Largest pcap record: record header and a CAN FD frame */
+#define CaptureReader_PCAP_RECORD_MAX (16U + 72U)
+
+/* Largest candump log line, including the line feed and the terminating null */
+#define CaptureReader_CANDUMP_LINE_MAX 200U
+
+/* Frame read from a capture */
+typedef struct
+{
+    uint64_t time; /* Record time in ticks, extended to 64 bits */
+    CANCapture_Record record;
+} CaptureReader_Frame;
+
+/* Called for each valid record */
+typedef void (*CaptureReader_FrameFxn)(void *arg, const CaptureReader_Frame *frame);
+
+/* Reader statistics */
+typedef struct
+{
+    uint32_t recordCnt;  /* Valid records read */
+    uint32_t lostCnt;    /* Records carrying CANCapture_FLAG_LOST */
+    uint32_t skippedCnt; /* Bytes skipped while resynchronizing */
+} CaptureReader_Stats;
+
+/* Reader object. The fields are private, except for stats. */
+typedef struct
+{
+    CaptureReader_FrameFxn frameFxn;
+    void *arg;
+    CaptureReader_Stats stats;
+    uint8_t pending[CANCapture_MAX_RECORD_SIZE]; /* Start of a record not yet complete */
+    size_t pendingLength;
+    bool started;      /* A record was read and lastTime is valid */
+    uint32_t lastTime; /* Time of the last record */
+    uint64_t wrapTime; /* Record time wraps, in ticks */
+} CaptureReader_Object;
+
+/*
+ *  ======== CaptureReader_init ========
+ *  Initializes a reader that passes the frames to frameFxn.
+ */
+extern void CaptureReader_init(CaptureReader_Object *obj, CaptureReader_FrameFxn frameFxn, void *arg);
+
+/*
+ *  ======== CaptureReader_receive ========
+ *  Reads the next length bytes of the stream.
+ */
+extern void CaptureReader_receive(CaptureReader_Object *obj, const uint8_t *data, size_t length);
+
+/*
+ *  ======== CaptureReader_getPending ========
+ *  Returns the number of bytes of an incomplete record at the end of the
+ *  stream read so far.
+ */
+extern size_t CaptureReader_getPending(const CaptureReader_Object *obj);
+
+/*
+ *  ======== CaptureReader_formatCandump ========
+ *  Writes a candump log line of the frame, received on interface, to text,
+ *  which holds size bytes. The line is cut off if it does not fit. Returns
+ *  the length of the line.
+ */
+extern size_t CaptureReader_formatCandump(const CaptureReader_Frame *frame,
+                                          const char *interface,
+                                          char *text,
+                                          size_t size);
+
+/*
+ *  ======== CaptureReader_getPcapHeader ========
+ *  Writes the pcap file header to buf, which holds at least
+ *  CaptureReader_PCAP_HEADER_SIZE bytes, and returns its size.
+ */
+extern size_t CaptureReader_getPcapHeader(uint8_t *buf);
+
+/*
+ *  ======== CaptureReader_encodePcap ========
+ *  Writes the pcap record of the frame to buf, which holds at least
+ *  CaptureReader_PCAP_RECORD_MAX bytes, and returns its size.
+ */
+extern size_t CaptureReader_encodePcap(const CaptureReader_Frame *frame, uint8_t *buf);
+
+/*
+ *  ======== CaptureReader_toTxElem ========
+ *  Converts a record to the driver element that transmits its frame.
+ */
+extern void CaptureReader_toTxElem(const CANCapture_Record *record, CAN_TxBufElement *elem);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAPTUREREADER_H_ */
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CaptureReplay.c ========
+ */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CaptureReplay.h"
+#include "VirtualCAN.h"
+
+/* Frames allocated at once */
+#define FRAME_ALLOC_CNT 256U
+
+/* Time to wait for space in the inject queue */
+#define INJECT_RETRY_NSEC 1000000L
+
+/*
+ *  ======== getSofTime ========
+ */
+static uint64_t getSofTime(const CaptureReplay_Object *obj, size_t index, uint64_t startNs)
+{
+    return startNs + ((obj->frames[index].time - obj->frames[0].time) * CaptureReader_NSEC_PER_TICK);
+}
+
+/*
+ *  ======== CaptureReplay_init ========
+ */
+void CaptureReplay_init(CaptureReplay_Object *obj)
+{
+    memset(obj, 0, sizeof(*obj));
+}
+
+/*
+ *  ======== CaptureReplay_add ========
+ */
+void CaptureReplay_add(void *arg, const CaptureReader_Frame *frame)
+{
+    CaptureReplay_Object *obj = arg;
+    CaptureReader_Frame *frames;
+
+    if ((frame->record.flags & CANCapture_FLAG_TX) != 0U)
+    {
+        obj->txCnt++;
+        return;
+    }
+
+    if (obj->frameCnt == obj->frameSize)
+    {
+        frames = realloc(obj->frames, (obj->frameSize + FRAME_ALLOC_CNT) * sizeof(*frames));
+        if (frames == NULL)
+        {
+            obj->failedCnt++;
+            return;
+        }
+
+        obj->frames = frames;
+        obj->frameSize += FRAME_ALLOC_CNT;
+    }
+
+    obj->frames[obj->frameCnt] = *frame;
+    obj->frameCnt++;
+}
+
+/*
+ *  ======== CaptureReplay_run ========
+ */
+void CaptureReplay_run(const CaptureReplay_Object *obj, uint64_t startNs)
+{
+    const struct timespec retryTime = {0, INJECT_RETRY_NSEC};
+    CAN_TxBufElement elem;
+    size_t i;
+
+    for (i = 0U; i < obj->frameCnt; i++)
+    {
+        CaptureReader_toTxElem(&obj->frames[i].record, &elem);
+
+        /* The queue drains as the frames are sent at their times */
+        while (!VirtualCAN_inject(&elem, getSofTime(obj, i, startNs)))
+        {
+            nanosleep(&retryTime, NULL);
+        }
+    }
+}
+
+/*
+ *  ======== CaptureReplay_getEndTime ========
+ */
+uint64_t CaptureReplay_getEndTime(const CaptureReplay_Object *obj, uint64_t startNs)
+{
+    return (obj->frameCnt > 0U) ? getSofTime(obj, obj->frameCnt - 1U, startNs) : startNs;
+}
+
+/*
+ *  ======== CaptureReplay_free ========
+ */
+void CaptureReplay_free(CaptureReplay_Object *obj)
+{
+    free(obj->frames);
+    CaptureReplay_init(obj);
+}
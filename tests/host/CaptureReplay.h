@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CaptureReplay.h ========
+ *  Replay of a CAN frame capture into the nodes of the virtual CAN bus.
+ *
+ *  The frames a device received in the capture are injected into the bus
+ *  with their SOF at the captured time, relative to a start time, so the
+ *  nodes see the same frames in the same order and with the same timestamps
+ *  in each run. The frames the device wrote itself are left out, as the
+ *  replayed node writes its own.
+ */
+
+#ifndef CAPTUREREPLAY_H_
+#define CAPTUREREPLAY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "CaptureReader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Frames to replay. The fields are private, except for the counts. */
+typedef struct
+{
+    CaptureReader_Frame *frames;
+    size_t frameCnt;  /* Frames to inject */
+    size_t frameSize; /* Frames allocated */
+    size_t txCnt;     /* Frames written by the device, left out */
+    size_t failedCnt; /* Frames not added for lack of memory */
+} CaptureReplay_Object;
+
+/*
+ *  ======== CaptureReplay_init ========
+ */
+extern void CaptureReplay_init(CaptureReplay_Object *obj);
+
+/*
+ *  ======== CaptureReplay_add ========
+ *  CaptureReader_FrameFxn that adds a frame to the replay, arg being the
+ *  replay object.
+ */
+extern void CaptureReplay_add(void *arg, const CaptureReader_Frame *frame);
+
+/*
+ *  ======== CaptureReplay_run ========
+ *  Injects the frames into the bus, the first one with its SOF at bus time
+ *  startNs. Returns when the last frame was queued.
+ */
+extern void CaptureReplay_run(const CaptureReplay_Object *obj, uint64_t startNs);
+
+/*
+ *  ======== CaptureReplay_getEndTime ========
+ *  Returns the bus time of the SOF of the last frame replayed from startNs.
+ */
+extern uint64_t CaptureReplay_getEndTime(const CaptureReplay_Object *obj, uint64_t startNs);
+
+/*
+ *  ======== CaptureReplay_free ========
+ */
+extern void CaptureReplay_free(CaptureReplay_Object *obj);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CAPTUREREPLAY_H_ */
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== HostBench.h ========
+ *  Timing helpers for the host benchmarks. A benchmark times a loop of calls
+ *  several times and reports the fastest run, which is the least disturbed
+ *  by other processes. The results depend on the host and the compiler, and
+ *  are only comparable with each other.
+ */
+
+#ifndef HOSTBENCH_H_
+#define HOSTBENCH_H_
+
+#include <stdint.h>
+#include <time.h>
+
+/* Timed runs of each loop */
+#define HostBench_RUNS 7U
+
+/* Results are written here so that the compiler keeps the timed calls */
+static volatile uint32_t HostBench_sink;
+
+/*
+ *  ======== HostBench_nowNs ========
+ *  Returns the monotonic time in nanoseconds.
+ */
+static inline uint64_t HostBench_nowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/*
+ *  ======== HostBench_best ========
+ *  Returns the smaller of two run times, where 0 means no run yet.
+ */
+static inline uint64_t HostBench_best(uint64_t best, uint64_t time)
+{
+    return ((best == 0U) || (time < best)) ? time : best;
+}
+
+#endif /* HOSTBENCH_H_ */
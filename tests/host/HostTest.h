@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== HostTest.h ========
+ *  Minimal checks for the host tests. A failed check prints its location and
+ *  is counted, and HostTest_exit() reports the result of the test program.
+ */
+
+#ifndef HOSTTEST_H_
+#define HOSTTEST_H_
+
+#include <stdio.h>
+#include <stdlib.h>
+
+static unsigned int HostTest_checkCnt;
+static unsigned int HostTest_failCnt;
+
+/*
+ *  ======== HostTest_check ========
+ *  Checks that cond is true.
+ */
+#define HostTest_check(cond)                                               \
+    do                                                                     \
+    {                                                                      \
+        HostTest_checkCnt++;                                               \
+        if (!(cond))                                                       \
+        {                                                                  \
+            HostTest_failCnt++;                                            \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        }                                                                  \
+    } while (0)
+
+/*
+ *  ======== HostTest_checkEqual ========
+ *  Checks that two integer values are equal and prints both if they are not.
+ */
+#define HostTest_checkEqual(actual, expected)                                            \
+    do                                                                                   \
+    {                                                                                    \
+        long long actualValue_   = (long long)(actual);                                  \
+        long long expectedValue_ = (long long)(expected);                                \
+        HostTest_checkCnt++;                                                             \
+        if (actualValue_ != expectedValue_)                                              \
+        {                                                                                \
+            HostTest_failCnt++;                                                          \
+            printf("%s:%d: check failed: %s == %s (%lld != %lld)\n",                     \
+                   __FILE__,                                                             \
+                   __LINE__,                                                             \
+                   #actual,                                                              \
+                   #expected,                                                            \
+                   actualValue_,                                                         \
+                   expectedValue_);                                                      \
+        }                                                                                \
+    } while (0)
+
+/*
+ *  ======== HostTest_exit ========
+ *  Prints the result and returns the exit status of the test program.
+ */
+static inline int HostTest_exit(const char *name)
+{
+    printf("%s: %u checks, %u failed\n", name, HostTest_checkCnt, HostTest_failCnt);
+
+    return (HostTest_failCnt == 0U) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#endif /* HOSTTEST_H_ */
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TelemetryDecoder.c ========
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "TelemetryDecoder.h"
+
+/* Header and CRC bytes of a frame */
+#define FRAME_OVERHEAD 6U
+
+/*
+ *  ======== decodeFrame ========
+ *  Decodes the frame received before a delimiter and counts the records
+ *  missing before it.
+ */
+static void decodeFrame(TelemetryDecoder_Object *obj)
+{
+    TelemetryDecoder_Record record;
+    uint8_t frame[TelemetryDecoder_FRAME_MAX];
+    uint16_t gap;
+    int length = -1;
+
+    /* Delimiters sent to resynchronize the receiver */
+    if (obj->encodedLength == 0U)
+    {
+        return;
+    }
+
+    if (obj->encodedLength <= sizeof(obj->encoded))
+    {
+        length = TelemetryDecoder_decodeCobs(obj->encoded, obj->encodedLength, frame, sizeof(frame));
+    }
+
+    if ((length < (int)FRAME_OVERHEAD) ||
+        (TelemetryDecoder_crc(frame, (size_t)length - 2U) != (((uint16_t)frame[length - 2] << 8) | frame[length - 1])))
+    {
+        obj->stats.badFrameCnt++;
+        return;
+    }
+
+    record.type   = frame[0];
+    record.id     = frame[1];
+    record.seq    = (uint16_t)(frame[2] | (frame[3] << 8));
+    record.length = (size_t)length - FRAME_OVERHEAD;
+    (void)memcpy(record.payload, &frame[4], record.length);
+
+    if (obj->synced)
+    {
+        gap = (uint16_t)(record.seq - obj->nextSeq);
+
+        if (gap < 0x8000U)
+        {
+            obj->stats.lostCnt += gap;
+        }
+        else
+        {
+            obj->stats.restartCnt++;
+        }
+    }
+
+    obj->synced  = true;
+    obj->nextSeq = (uint16_t)(record.seq + 1U);
+    obj->stats.recordCnt++;
+
+    obj->recordFxn(obj->arg, &record);
+}
+
+/*
+ *  ======== TelemetryDecoder_init ========
+ */
+void TelemetryDecoder_init(TelemetryDecoder_Object *obj, TelemetryDecoder_RecordFxn recordFxn, void *arg)
+{
+    (void)memset(obj, 0, sizeof(*obj));
+
+    obj->recordFxn = recordFxn;
+    obj->arg       = arg;
+}
+
+/*
+ *  ======== TelemetryDecoder_receive ========
+ */
+void TelemetryDecoder_receive(TelemetryDecoder_Object *obj, const uint8_t *data, size_t length)
+{
+    size_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        if (data[i] == 0U)
+        {
+            decodeFrame(obj);
+            obj->encodedLength = 0U;
+        }
+        else
+        {
+            /* Bytes of an overlong frame are counted but not kept */
+            if (obj->encodedLength < sizeof(obj->encoded))
+            {
+                obj->encoded[obj->encodedLength] = data[i];
+            }
+
+            obj->encodedLength++;
+        }
+    }
+}
+
+/*
+ *  ======== TelemetryDecoder_getPending ========
+ */
+size_t TelemetryDecoder_getPending(const TelemetryDecoder_Object *obj)
+{
+    return obj->encodedLength;
+}
+
+/*
+ *  ======== TelemetryDecoder_crc ========
+ */
+uint16_t TelemetryDecoder_crc(const uint8_t *data, size_t length)
+{
+    uint16_t crc = 0xFFFFU;
+    uint32_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= (uint16_t)(*data++ << 8);
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== TelemetryDecoder_decodeCobs ========
+ */
+int TelemetryDecoder_decodeCobs(const uint8_t *src, size_t length, uint8_t *dst, size_t size)
+{
+    size_t in  = 0U;
+    size_t out = 0U;
+    uint8_t code;
+    uint8_t i;
+
+    while (in < length)
+    {
+        code = src[in++];
+
+        if ((code == 0U) || ((in + code - 1U) > length) || ((out + code - 1U) > size))
+        {
+            return -1;
+        }
+
+        for (i = 1U; i < code; i++)
+        {
+            dst[out++] = src[in++];
+        }
+
+        /* A block shorter than 254 bytes ends with a zero, except the last one */
+        if ((code != 0xFFU) && (in < length))
+        {
+            if (out >= size)
+            {
+                return -1;
+            }
+
+            dst[out++] = 0U;
+        }
+    }
+
+    return (int)out;
+}
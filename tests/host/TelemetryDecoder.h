@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== TelemetryDecoder.h ========
+ *  Host decoder of the telemetry stream written by the Telemetry module of
+ *  the canInitiator example.
+ *
+ *  The stream is fed in parts of any size, as received from the UART. The
+ *  decoder splits it at the zero frame delimiters, decodes the COBS encoding,
+ *  checks the length and the CRC, and passes each valid record to a callback.
+ *  Frames that fail any check are counted and dropped.
+ *
+ *  Records dropped on the target, lost on the link and dropped by the decoder
+ *  all leave a gap in the sequence numbers. The decoder counts the records
+ *  missing from the gaps. The first record received sets the expected
+ *  sequence number, so records lost before it are not counted. A sequence
+ *  number more than half the sequence space behind the expected one is taken
+ *  as a restart of the target, which is counted instead of a gap.
+ */
+
+#ifndef TELEMETRYDECODER_H_
+#define TELEMETRYDECODER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Telemetry.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest frame before encoding: header, payload and CRC */
+#define TelemetryDecoder_FRAME_MAX (4U + Telemetry_PAYLOAD_MAX + 2U)
+
+/* Record decoded from the stream */
+typedef struct
+{
+    uint8_t type; /* Telemetry_TYPE_* */
+    uint8_t id;
+    uint16_t seq;
+    size_t length; /* Payload length in bytes */
+    uint8_t payload[Telemetry_PAYLOAD_MAX];
+} TelemetryDecoder_Record;
+
+/* Called for each valid record */
+typedef void (*TelemetryDecoder_RecordFxn)(void *arg, const TelemetryDecoder_Record *record);
+
+/* Decoder statistics */
+typedef struct
+{
+    uint32_t recordCnt;   /* Valid records decoded */
+    uint32_t badFrameCnt; /* Frames with invalid encoding, length or CRC */
+    uint32_t lostCnt;     /* Records missing from the sequence numbers */
+    uint32_t restartCnt;  /* Sequence numbers restarted by the target */
+} TelemetryDecoder_Stats;
+
+/* Decoder object. The fields are private, except for stats. */
+typedef struct
+{
+    TelemetryDecoder_RecordFxn recordFxn;
+    void *arg;
+    TelemetryDecoder_Stats stats;
+    uint8_t encoded[TelemetryDecoder_FRAME_MAX + 1U]; /* Frame received since the last delimiter */
+    size_t encodedLength; /* Bytes received since the last delimiter, including those not kept */
+    bool synced;          /* A record was received and nextSeq is valid */
+    uint16_t nextSeq; /* Expected sequence number */
+} TelemetryDecoder_Object;
+
+/*
+ *  ======== TelemetryDecoder_init ========
+ *  Initializes a decoder that passes the records to recordFxn. Bytes before
+ *  the first frame delimiter fed are decoded as a frame.
+ */
+extern void TelemetryDecoder_init(TelemetryDecoder_Object *obj, TelemetryDecoder_RecordFxn recordFxn, void *arg);
+
+/*
+ *  ======== TelemetryDecoder_receive ========
+ *  Decodes the next length bytes of the stream.
+ */
+extern void TelemetryDecoder_receive(TelemetryDecoder_Object *obj, const uint8_t *data, size_t length);
+
+/*
+ *  ======== TelemetryDecoder_getPending ========
+ *  Returns the number of bytes received after the last frame delimiter.
+ */
+extern size_t TelemetryDecoder_getPending(const TelemetryDecoder_Object *obj);
+
+/*
+ *  ======== TelemetryDecoder_crc ========
+ *  CRC-16 CCITT with init 0xFFFF, computed bitwise.
+ */
+extern uint16_t TelemetryDecoder_crc(const uint8_t *data, size_t length);
+
+/*
+ *  ======== TelemetryDecoder_decodeCobs ========
+ *  Decodes length COBS encoded bytes, without the delimiter, into dst.
+ *  Returns the decoded length, or -1 if the encoded bytes are invalid or
+ *  decode to more than size bytes.
+ */
+extern int TelemetryDecoder_decodeCobs(const uint8_t *src, size_t length, uint8_t *dst, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRYDECODER_H_ */
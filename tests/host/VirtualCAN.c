@@ -0,0 +1,1871 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== VirtualCAN.c ========
+ *  Each node has a recursive lock standing in for its interrupt mask. The
+ *  functions called in interrupt context by the drivers, the event callback
+ *  of the CAN driver, the clock functions, the button callbacks and the
+ *  SYSTIM interrupt, are called with the lock of their node held. The bus,
+ *  clock and UART locks may be taken while the lock of a node is held, so
+ *  the bus and clock threads release them before they lock a node.
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <ti/drivers/CAN.h>
+#include <ti/drivers/GPIO.h>
+#include <ti/drivers/UART2.h>
+#include <ti/drivers/apps/Button.h>
+#include <ti/drivers/dpl/ClockP.h>
+#include <ti/drivers/dpl/HwiP.h>
+
+#include <ti/devices/DeviceFamily.h>
+#include DeviceFamily_constructPath(inc/hw_memmap.h)
+#include DeviceFamily_constructPath(inc/hw_systim.h)
+#include DeviceFamily_constructPath(inc/hw_types.h)
+
+#include "ti_drivers_config.h"
+#include "VirtualCAN.h"
+#include "VirtualCAN_node.h"
+
+/* The bus uses the host functions */
+#undef pthread_create
+#undef pthread_attr_setstacksize
+#undef pthread_attr_setschedparam
+
+/* Size of the Rx, Tx and Tx Event queues of the driver */
+#define QUEUE_MAX 64U
+
+/* Queue sizes without a message RAM configuration */
+#define DEFAULT_QUEUE_SIZE 8U
+
+/* Frames waiting to be injected */
+#define INJECT_MAX 64U
+
+/* UART output kept for each node, and UART input waiting to be read */
+#define OUTPUT_MAX (16U * 1024U * 1024U)
+#define INPUT_SIZE 4096U
+
+/* Number of registers of each peripheral */
+#define REG_COUNT 64U
+
+/* Clock of the CAN timestamp counter and the DWT cycle counter */
+#define HOST_CLK_PER_USEC 96U
+
+/* Bit timing: 80 MHz functional clock, 160 time quanta per nominal bit and 40
+ * per data bit. The fields hold the functional values minus one.
+ */
+#define CLK_FREQ_KHZ    80000U
+#define NOM_TIME_SEG1   126U
+#define NOM_TIME_SEG2   31U
+#define DATA_TIME_SEG1  28U
+#define DATA_TIME_SEG2  9U
+#define CLK_PERIOD_PSEC (1000000000U / CLK_FREQ_KHZ)
+
+/* SOF to timestamp delay of the controller: 6 clocks and the time quanta up
+ * to the sample point.
+ */
+#define SOF_TO_TIMESTAMP_NSEC (((6U + NOM_TIME_SEG1 + 1U) * CLK_PERIOD_PSEC) / 1000U)
+
+/* Time between the checks of the SYSTIM compare channel */
+#define COMPARE_POLL_NSEC 20000L
+
+/* Message RAM filter types and configurations */
+#define FILTER_TYPE_RANGE    0U
+#define FILTER_TYPE_DUAL     1U
+#define FILTER_TYPE_CLASSIC  2U
+#define FILTER_DISABLED      0U
+#define FILTER_STORE_FIFO0   1U
+#define FILTER_STORE_FIFO1   2U
+#define FILTER_REJECT        3U
+#define FILTER_PRIO_FIFO0    5U
+#define FILTER_PRIO_FIFO1    6U
+
+/* Index of a register in the register array of a peripheral */
+#define REG_INDEX(offset) ((offset) / 4U)
+
+/* CAN controller of a node */
+struct CAN_Config
+{
+    bool open;
+    uint32_t openCnt; /* Counts the opens and closes */
+    CAN_EventCbk eventCbk;
+    uint32_t eventMask;
+    void *userArg;
+    uint32_t tsPrescaler;
+    const CAN_MsgRAMConfig *msgRAMConfig;
+    CAN_RxBufElement rxFifo[QUEUE_MAX];
+    uint32_t rxHead;
+    uint32_t rxCount;
+    uint32_t rxSize;
+    CAN_TxBufElement txQueue[QUEUE_MAX];
+    uint32_t txCount;
+    uint32_t txSize;
+    bool txPriority; /* Tx queue sends the lowest ID first, not the oldest */
+    CAN_TxEventElement txEvents[QUEUE_MAX];
+    uint32_t txEventHead;
+    uint32_t txEventCount;
+    uint32_t txEventSize;
+};
+
+/* UART of a node */
+struct UART2_Config_
+{
+    UART2_Mode readMode;
+    UART2_ReadReturnMode readReturnMode;
+};
+
+struct VirtualCAN_Node_
+{
+    const char *name;
+    void *(*mainFxn)(void *arg0);
+    int32_t freqPpb;
+    uint64_t startNs; /* Node time at bus time 0 */
+    pthread_mutex_t lock;
+
+    struct CAN_Config can;
+
+    struct UART2_Config_ uart;
+    pthread_mutex_t uartLock;
+    pthread_cond_t uartCond;
+    char *output;
+    size_t outputLength;
+    bool outputLineStart;
+    uint8_t input[INPUT_SIZE];
+    size_t inputHead;
+    size_t inputCount;
+
+    volatile uint32_t systimRegs[REG_COUNT];
+    volatile uint32_t evtsvtRegs[REG_COUNT];
+    uint32_t compareTime; /* SYSTIM value at the last compare check */
+    HwiP_Fxn hwiFxn;
+    uintptr_t hwiArg;
+    bool hwiPosted;
+
+    Button_Config buttons[2];
+    Button_HWAttrs buttonHWAttrs[2];
+    Button_Params buttonParams[2];
+    bool buttonOpen[2];
+
+    uint32_t ledToggles[2];
+    uint64_t ledToggleNs[2];
+    uint32_t leds[2];
+};
+
+/* Frame injected into the bus */
+typedef struct
+{
+    CAN_TxBufElement elem;
+    uint64_t timeNs; /* Bus time of the SOF */
+} InjectedFrame;
+
+/* Thread started for a node */
+typedef struct
+{
+    VirtualCAN_Node *node;
+    void *(*fxn)(void *arg0);
+    void *arg;
+} ThreadStart;
+
+bool VirtualCAN_trace = false;
+
+volatile uint32_t VirtualCAN_dwtCtrl;
+volatile uint32_t VirtualCAN_demcr;
+
+static VirtualCAN_Node nodes[VirtualCAN_NODE_MAX];
+static uint32_t nodeCnt;
+
+static struct timespec epoch;
+
+static VirtualCAN_MonitorFxn monitor;
+static void *monitorArg;
+
+/* Bus requests and injected frames, protected by busLock */
+static pthread_mutex_t busLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t busCond;
+static uint32_t busRequestCnt;
+static InjectedFrame injected[INJECT_MAX];
+static uint32_t injectHead;
+static uint32_t injectCount;
+
+/* Bus time at which the bus is idle again, only used by the bus thread */
+static uint64_t busIdleNs;
+
+/* Constructed clocks, protected by clockLock */
+static pthread_mutex_t clockLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t clockCond;
+static ClockP_Struct *clocks;
+
+/* Output of the nodes to stdout */
+static pthread_mutex_t traceLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Node of the calling thread, and the bus time at which the thread took the
+ * lock of the node. The node time stands still while the lock is held.
+ */
+static __thread VirtualCAN_Node *currentNode;
+static __thread uint32_t lockDepth;
+static __thread uint64_t lockTimeNs;
+
+static const uint8_t dlcToLength[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/*
+ *  ======== getHostTime ========
+ *  Bus time in nanoseconds.
+ */
+static uint64_t getHostTime(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)(now.tv_sec - epoch.tv_sec) * 1000000000ULL) + (uint64_t)now.tv_nsec - (uint64_t)epoch.tv_nsec;
+}
+
+/*
+ *  ======== getTimespec ========
+ *  Monotonic clock time of the bus time timeNs.
+ */
+static struct timespec getTimespec(uint64_t timeNs)
+{
+    struct timespec time;
+    uint64_t nsec;
+
+    nsec         = (uint64_t)epoch.tv_nsec + timeNs;
+    time.tv_sec  = epoch.tv_sec + (time_t)(nsec / 1000000000ULL);
+    time.tv_nsec = (long)(nsec % 1000000000ULL);
+
+    return time;
+}
+
+/*
+ *  ======== getThreadTime ========
+ *  Bus time seen by the calling thread, which stands still while it holds
+ *  the lock of its node.
+ */
+static uint64_t getThreadTime(void)
+{
+    return (lockDepth > 0U) ? lockTimeNs : getHostTime();
+}
+
+/*
+ *  ======== getNodeTime ========
+ *  Time of the node clock in nanoseconds at bus time timeNs.
+ */
+static uint64_t getNodeTime(const VirtualCAN_Node *node, uint64_t timeNs)
+{
+    return node->startNs + timeNs + (uint64_t)(((int64_t)timeNs * node->freqPpb) / 1000000000LL);
+}
+
+/*
+ *  ======== getCounter ========
+ *  CAN timestamp counter of the node at bus time timeNs.
+ */
+static uint16_t getCounter(const VirtualCAN_Node *node, uint64_t timeNs)
+{
+    uint32_t prescaler = (node->can.tsPrescaler != 0U) ? node->can.tsPrescaler : 1U;
+
+    return (uint16_t)(((getNodeTime(node, timeNs) * HOST_CLK_PER_USEC) / 1000U) / prescaler);
+}
+
+/*
+ *  ======== getNode ========
+ */
+static VirtualCAN_Node *getNode(void)
+{
+    if (currentNode == NULL)
+    {
+        fprintf(stderr, "VirtualCAN: driver called outside of a node\n");
+        abort();
+    }
+
+    return currentNode;
+}
+
+/*
+ *  ======== lockNode ========
+ *  Locks node for the calling thread, which must not hold another lock.
+ */
+static void lockNode(VirtualCAN_Node *node)
+{
+    currentNode = node;
+    (void)HwiP_disable();
+}
+
+/*
+ *  ======== unlockNode ========
+ */
+static void unlockNode(void)
+{
+    HwiP_restore(0U);
+}
+
+/*
+ *  ======== postEvent ========
+ *  Calls the event callback of the CAN driver. The node must be locked.
+ */
+static void postEvent(VirtualCAN_Node *node, uint32_t event, uint32_t data)
+{
+    struct CAN_Config *can = &node->can;
+
+    if ((can->eventCbk != NULL) && ((can->eventMask & event) != 0U))
+    {
+        can->eventCbk(can, event, data, can->userArg);
+    }
+}
+
+/*
+ *  ======== commitRegWrites ========
+ *  Applies the writes to the SYSTIM set and clear registers. The node must be
+ *  locked.
+ */
+static void commitRegWrites(VirtualCAN_Node *node)
+{
+    volatile uint32_t *regs = node->systimRegs;
+
+    regs[REG_INDEX(SYSTIM_O_IMASK)] |= regs[REG_INDEX(SYSTIM_O_IMSET)];
+    regs[REG_INDEX(SYSTIM_O_IMASK)] &= ~regs[REG_INDEX(SYSTIM_O_IMCLR)];
+    regs[REG_INDEX(SYSTIM_O_RIS)] &= ~regs[REG_INDEX(SYSTIM_O_ICLR)];
+
+    regs[REG_INDEX(SYSTIM_O_IMSET)] = 0U;
+    regs[REG_INDEX(SYSTIM_O_IMCLR)] = 0U;
+    regs[REG_INDEX(SYSTIM_O_ICLR)]  = 0U;
+}
+
+/*
+ *  ======== getFrameTime ========
+ *  Time of the frame bits in nanoseconds, without stuff bits.
+ */
+static uint32_t getFrameTime(const CAN_TxBufElement *elem)
+{
+    uint32_t length = dlcToLength[elem->dlc];
+    uint32_t nomBits;
+    uint32_t dataBits;
+
+    if (!elem->fdf)
+    {
+        /* SOF, arbitration and control fields, CRC, ACK, EOF and interframe space */
+        nomBits = (elem->xtd ? 67U : 47U) + (8U * length);
+
+        return nomBits * (1000000000U / VirtualCAN_NOM_BIT_RATE);
+    }
+
+    /* The data phase runs from the ESI bit to the CRC delimiter */
+    nomBits  = (elem->xtd ? 36U : 17U) + 12U;
+    dataBits = 5U + (8U * length) + 4U + ((length > 16U) ? 21U : 17U) + 1U;
+
+    return (nomBits * (1000000000U / VirtualCAN_NOM_BIT_RATE)) +
+           (dataBits * (1000000000U / (elem->brs ? VirtualCAN_DATA_BIT_RATE : VirtualCAN_NOM_BIT_RATE)));
+}
+
+/*
+ *  ======== getArbitrationKey ========
+ *  Lower keys win the arbitration. A standard ID wins against an extended ID
+ *  with the same base ID.
+ */
+static uint32_t getArbitrationKey(const CAN_TxBufElement *elem)
+{
+    return elem->xtd ? (((uint32_t)elem->id << 1) | 1U) : ((uint32_t)elem->id << 19);
+}
+
+/*
+ *  ======== getNextTx ========
+ *  Index of the frame the node sends next, or -1. The node must be locked.
+ */
+static int32_t getNextTx(const VirtualCAN_Node *node)
+{
+    const struct CAN_Config *can = &node->can;
+    int32_t next                 = -1;
+    uint32_t i;
+
+    if (!can->open || (can->txCount == 0U))
+    {
+        return -1;
+    }
+
+    if (!can->txPriority)
+    {
+        return 0;
+    }
+
+    for (i = 0U; i < can->txCount; i++)
+    {
+        if ((next < 0) || (getArbitrationKey(&can->txQueue[i]) < getArbitrationKey(&can->txQueue[next])))
+        {
+            next = (int32_t)i;
+        }
+    }
+
+    return next;
+}
+
+/*
+ *  ======== matchFilter ========
+ */
+static bool matchFilter(uint32_t type, uint32_t id, uint32_t id1, uint32_t id2)
+{
+    switch (type)
+    {
+        case FILTER_TYPE_RANGE:
+            return (id >= id1) && (id <= id2);
+
+        case FILTER_TYPE_DUAL:
+            return (id == id1) || (id == id2);
+
+        case FILTER_TYPE_CLASSIC:
+            return (id & id2) == (id1 & id2);
+
+        default:
+            return false;
+    }
+}
+
+/*
+ *  ======== acceptFrame ========
+ *  Applies the acceptance filters of the message RAM configuration. Frames
+ *  matching no filter are rejected, and all frames are accepted without a
+ *  configuration. Returns the filter index in fidx.
+ */
+static bool acceptFrame(const CAN_MsgRAMConfig *config, const CAN_TxBufElement *elem, uint32_t *fidx)
+{
+    uint32_t action;
+    uint32_t i;
+
+    *fidx = 0U;
+
+    if (config == NULL)
+    {
+        return true;
+    }
+
+    for (i = 0U; i < (elem->xtd ? config->extFilterNum : config->stdFilterNum); i++)
+    {
+        if (elem->xtd)
+        {
+            const MCAN_ExtMsgIDFilterElement *filter = &config->extMsgIDFilterList[i];
+
+            if (!matchFilter(filter->eft, elem->id, filter->efid1, filter->efid2))
+            {
+                continue;
+            }
+
+            action = filter->efec;
+        }
+        else
+        {
+            const MCAN_StdMsgIDFilterElement *filter = &config->stdMsgIDFilterList[i];
+
+            if (!matchFilter(filter->sft, elem->id, filter->sfid1, filter->sfid2))
+            {
+                continue;
+            }
+
+            action = filter->sfec;
+        }
+
+        if (action == FILTER_DISABLED)
+        {
+            continue;
+        }
+
+        *fidx = i;
+
+        return (action == FILTER_STORE_FIFO0) || (action == FILTER_STORE_FIFO1) ||
+               (action == FILTER_PRIO_FIFO0) || (action == FILTER_PRIO_FIFO1);
+    }
+
+    return false;
+}
+
+/*
+ *  ======== receiveFrame ========
+ *  Stores a frame in the Rx FIFO of node, whose timestamp counter is sampled
+ *  after the SOF at bus time sofTimeNs.
+ */
+static void receiveFrame(VirtualCAN_Node *node, const CAN_TxBufElement *elem, uint64_t sofTimeNs)
+{
+    struct CAN_Config *can = &node->can;
+    CAN_RxBufElement *rxElem;
+    uint32_t fidx;
+
+    lockNode(node);
+
+    if (can->open && acceptFrame(can->msgRAMConfig, elem, &fidx))
+    {
+        if (can->rxCount < can->rxSize)
+        {
+            rxElem = &can->rxFifo[(can->rxHead + can->rxCount) % can->rxSize];
+            can->rxCount++;
+
+            memset(rxElem, 0, sizeof(*rxElem));
+            rxElem->id   = elem->id;
+            rxElem->rtr  = elem->rtr;
+            rxElem->xtd  = elem->xtd;
+            rxElem->esi  = elem->esi;
+            rxElem->rxts = getCounter(node, sofTimeNs + SOF_TO_TIMESTAMP_NSEC);
+            rxElem->dlc  = elem->dlc;
+            rxElem->brs  = elem->brs;
+            rxElem->fdf  = elem->fdf;
+            rxElem->fidx = fidx;
+            memcpy(rxElem->data, elem->data, dlcToLength[elem->dlc]);
+
+            postEvent(node, CAN_EVENT_RX_DATA_AVAIL, 0U);
+        }
+        else
+        {
+            postEvent(node, CAN_EVENT_RX_FIFO_MSG_LOST, 0U);
+        }
+    }
+
+    unlockNode();
+}
+
+/*
+ *  ======== finishTx ========
+ *  Stores the Tx Event of a frame sent by node and reports that it was sent,
+ *  unless the driver was reopened since the frame was taken.
+ */
+static void finishTx(VirtualCAN_Node *node, const CAN_TxBufElement *elem, uint64_t sofTimeNs, uint32_t openCnt)
+{
+    struct CAN_Config *can = &node->can;
+    CAN_TxEventElement *event;
+
+    lockNode(node);
+
+    if (can->open && (can->openCnt == openCnt))
+    {
+        if (elem->efc && (can->txEventSize > 0U))
+        {
+            if (can->txEventCount < can->txEventSize)
+            {
+                event = &can->txEvents[(can->txEventHead + can->txEventCount) % can->txEventSize];
+                can->txEventCount++;
+
+                memset(event, 0, sizeof(*event));
+                event->id   = elem->id;
+                event->rtr  = elem->rtr;
+                event->xtd  = elem->xtd;
+                event->esi  = elem->esi;
+                event->txts = getCounter(node, sofTimeNs + SOF_TO_TIMESTAMP_NSEC);
+                event->dlc  = elem->dlc;
+                event->brs  = elem->brs;
+                event->fdf  = elem->fdf;
+                event->et   = 1U;
+                event->mm   = elem->mm;
+
+                postEvent(node, CAN_EVENT_TX_EVENT_AVAIL, 0U);
+            }
+            else
+            {
+                postEvent(node, CAN_EVENT_TX_EVENT_LOST, 0U);
+            }
+        }
+
+        postEvent(node, CAN_EVENT_TX_FINISHED, 0U);
+    }
+
+    unlockNode();
+}
+
+/*
+ *  ======== transmitNext ========
+ *  Transmits the frame winning the arbitration. Returns false if no frame is
+ *  waiting.
+ */
+static bool transmitNext(void)
+{
+    VirtualCAN_Frame frame;
+    VirtualCAN_Node *winner = NULL;
+    struct timespec endTime;
+    uint64_t now            = getHostTime();
+    uint32_t winnerKey      = 0U;
+    uint32_t openCnt        = 0U;
+    uint32_t key;
+    int32_t next;
+    uint32_t i;
+
+    for (i = 0U; i < nodeCnt; i++)
+    {
+        lockNode(&nodes[i]);
+
+        next = getNextTx(&nodes[i]);
+        if (next >= 0)
+        {
+            key = getArbitrationKey(&nodes[i].can.txQueue[next]);
+
+            if ((winner == NULL) || (key < winnerKey))
+            {
+                winner    = &nodes[i];
+                winnerKey = key;
+            }
+        }
+
+        unlockNode();
+    }
+
+    currentNode = NULL;
+
+    pthread_mutex_lock(&busLock);
+
+    /* An injected frame takes part in the arbitration once its SOF time has
+     * come, and keeps that time if the bus thread is late
+     */
+    if ((injectCount > 0U) && (injected[injectHead].timeNs <= now) &&
+        ((winner == NULL) || (getArbitrationKey(&injected[injectHead].elem) < winnerKey)))
+    {
+        frame.elem   = injected[injectHead].elem;
+        frame.source = NULL;
+        now          = injected[injectHead].timeNs;
+        injectHead   = (injectHead + 1U) % INJECT_MAX;
+        injectCount--;
+        winner = NULL;
+    }
+    else if (winner == NULL)
+    {
+        pthread_mutex_unlock(&busLock);
+        return false;
+    }
+
+    pthread_mutex_unlock(&busLock);
+
+    if (winner != NULL)
+    {
+        /* Take the frame the node sends next now, as the queue may have
+         * changed since the arbitration.
+         */
+        lockNode(winner);
+
+        next = getNextTx(winner);
+        if (next >= 0)
+        {
+            frame.elem   = winner->can.txQueue[next];
+            frame.source = winner->name;
+            openCnt      = winner->can.openCnt;
+
+            winner->can.txCount--;
+            memmove(&winner->can.txQueue[next],
+                    &winner->can.txQueue[next + 1],
+                    (winner->can.txCount - (uint32_t)next) * sizeof(CAN_TxBufElement));
+        }
+
+        unlockNode();
+        currentNode = NULL;
+
+        if (next < 0)
+        {
+            return true;
+        }
+    }
+
+    frame.sofTimeNs  = (winner != NULL) ? getHostTime() : now;
+    frame.durationNs = getFrameTime(&frame.elem);
+
+    if (frame.sofTimeNs < busIdleNs)
+    {
+        frame.sofTimeNs = busIdleNs;
+    }
+
+    busIdleNs = frame.sofTimeNs + frame.durationNs;
+
+    endTime = getTimespec(busIdleNs);
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &endTime, NULL) != 0) {}
+
+    /* The monitor sees the frame before the nodes can respond to it */
+    if (monitor != NULL)
+    {
+        monitor(&frame, monitorArg);
+    }
+
+    /* A controller does not receive the frames it sends */
+    for (i = 0U; i < nodeCnt; i++)
+    {
+        if (&nodes[i] != winner)
+        {
+            receiveFrame(&nodes[i], &frame.elem, frame.sofTimeNs);
+        }
+    }
+
+    if (winner != NULL)
+    {
+        finishTx(winner, &frame.elem, frame.sofTimeNs, openCnt);
+    }
+
+    currentNode = NULL;
+
+    return true;
+}
+
+/*
+ *  ======== requestBus ========
+ *  Wakes the bus thread after a frame was queued.
+ */
+static void requestBus(void)
+{
+    pthread_mutex_lock(&busLock);
+    busRequestCnt++;
+    pthread_cond_signal(&busCond);
+    pthread_mutex_unlock(&busLock);
+}
+
+/*
+ *  ======== busThread ========
+ */
+static void *busThread(void *arg0)
+{
+    struct timespec dueTime;
+    uint32_t handledCnt = 0U;
+
+    while (1)
+    {
+        while (transmitNext()) {}
+
+        pthread_mutex_lock(&busLock);
+
+        /* Wait for a frame to be queued or for the next injected frame */
+        while (busRequestCnt == handledCnt)
+        {
+            if (injectCount == 0U)
+            {
+                pthread_cond_wait(&busCond, &busLock);
+            }
+            else if (injected[injectHead].timeNs > getHostTime())
+            {
+                dueTime = getTimespec(injected[injectHead].timeNs);
+                (void)pthread_cond_timedwait(&busCond, &busLock, &dueTime);
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        handledCnt = busRequestCnt;
+
+        pthread_mutex_unlock(&busLock);
+    }
+
+    return NULL;
+}
+
+/*
+ *  ======== clockThread ========
+ *  Calls the clock functions when they are due.
+ */
+static void *clockThread(void *arg0)
+{
+    ClockP_Struct *clockP;
+    ClockP_Struct *due;
+    struct timespec dueTime;
+    uint32_t startCnt;
+    bool fire;
+
+    pthread_mutex_lock(&clockLock);
+
+    while (1)
+    {
+        due = NULL;
+
+        for (clockP = clocks; clockP != NULL; clockP = clockP->next)
+        {
+            if (clockP->active && ((due == NULL) || (clockP->dueNs < due->dueNs)))
+            {
+                due = clockP;
+            }
+        }
+
+        if (due == NULL)
+        {
+            pthread_cond_wait(&clockCond, &clockLock);
+            continue;
+        }
+
+        if (due->dueNs > getHostTime())
+        {
+            dueTime = getTimespec(due->dueNs);
+            (void)pthread_cond_timedwait(&clockCond, &clockLock, &dueTime);
+            continue;
+        }
+
+        if (due->period != 0U)
+        {
+            due->dueNs += (uint64_t)due->period * ClockP_getSystemTickPeriod() * 1000U;
+        }
+        else
+        {
+            due->active = false;
+        }
+
+        startCnt = due->startCnt;
+
+        pthread_mutex_unlock(&clockLock);
+
+        /* The clock may be stopped or started again before the node is locked */
+        lockNode(due->node);
+
+        pthread_mutex_lock(&clockLock);
+        fire = (due->startCnt == startCnt);
+        pthread_mutex_unlock(&clockLock);
+
+        if (fire)
+        {
+            due->fxn(due->arg);
+        }
+
+        unlockNode();
+        currentNode = NULL;
+
+        pthread_mutex_lock(&clockLock);
+    }
+
+    return NULL;
+}
+
+/*
+ *  ======== hwiThread ========
+ *  Calls the SYSTIM interrupt function of a node when a compare event is
+ *  enabled and pending, or the interrupt was posted. An event is raised when
+ *  the SYSTIM passes the compare value.
+ */
+static void *hwiThread(void *arg0)
+{
+    VirtualCAN_Node *node = arg0;
+    const struct timespec pollTime = {0, COMPARE_POLL_NSEC};
+    volatile uint32_t *regs        = node->systimRegs;
+    uint32_t systim;
+    uint32_t compare;
+
+    while (1)
+    {
+        nanosleep(&pollTime, NULL);
+
+        lockNode(node);
+
+        commitRegWrites(node);
+
+        systim  = (uint32_t)(getNodeTime(node, lockTimeNs) / 250U);
+        compare = regs[REG_INDEX(SYSTIM_O_CH1CC)];
+
+        if ((uint32_t)(compare - node->compareTime - 1U) < (uint32_t)(systim - node->compareTime))
+        {
+            regs[REG_INDEX(SYSTIM_O_RIS)] |= SYSTIM_IMASK_EV1;
+        }
+
+        node->compareTime = systim;
+
+        if (node->hwiPosted || ((regs[REG_INDEX(SYSTIM_O_RIS)] & regs[REG_INDEX(SYSTIM_O_IMASK)]) != 0U))
+        {
+            node->hwiPosted = false;
+            node->hwiFxn(node->hwiArg);
+            commitRegWrites(node);
+        }
+
+        unlockNode();
+    }
+
+    return NULL;
+}
+
+/*
+ *  ======== threadStart ========
+ */
+static void *threadStart(void *arg0)
+{
+    ThreadStart start = *(ThreadStart *)arg0;
+
+    free(arg0);
+
+    currentNode = start.node;
+
+    return start.fxn(start.arg);
+}
+
+/*
+ *  ======== startThread ========
+ */
+static int startThread(pthread_t *thread, int detachState, VirtualCAN_Node *node, void *(*fxn)(void *arg0), void *arg)
+{
+    pthread_attr_t attrs;
+    ThreadStart *start;
+    pthread_t hostThread;
+    int retc;
+
+    start = malloc(sizeof(*start));
+    if (start == NULL)
+    {
+        return -1;
+    }
+
+    start->node = node;
+    start->fxn  = fxn;
+    start->arg  = arg;
+
+    pthread_attr_init(&attrs);
+    pthread_attr_setdetachstate(&attrs, detachState);
+
+    retc = pthread_create((thread != NULL) ? thread : &hostThread, &attrs, threadStart, start);
+    if (retc != 0)
+    {
+        free(start);
+    }
+
+    pthread_attr_destroy(&attrs);
+
+    return retc;
+}
+
+/*
+ *  ======== appendOutput ========
+ */
+static void appendOutput(VirtualCAN_Node *node, const void *data, size_t length)
+{
+    const char *text = data;
+    char *output;
+    size_t i;
+
+    pthread_mutex_lock(&node->uartLock);
+
+    if ((node->outputLength + length) <= OUTPUT_MAX)
+    {
+        output = realloc(node->output, node->outputLength + length);
+        if (output != NULL)
+        {
+            node->output = output;
+            memcpy(&node->output[node->outputLength], data, length);
+            node->outputLength += length;
+            pthread_cond_broadcast(&node->uartCond);
+        }
+    }
+
+    if (VirtualCAN_trace)
+    {
+        pthread_mutex_lock(&traceLock);
+
+        for (i = 0U; i < length; i++)
+        {
+            if (node->outputLineStart)
+            {
+                printf("%s: ", node->name);
+            }
+
+            if (text[i] != '\r')
+            {
+                putchar(text[i]);
+            }
+
+            node->outputLineStart = (text[i] == '\n');
+        }
+
+        fflush(stdout);
+
+        pthread_mutex_unlock(&traceLock);
+    }
+
+    pthread_mutex_unlock(&node->uartLock);
+}
+
+/*
+ *  ======== countText ========
+ *  The UART lock of the node must be held.
+ */
+static uint32_t countText(const VirtualCAN_Node *node, const char *text)
+{
+    size_t length = strlen(text);
+    uint32_t count = 0U;
+    size_t i;
+
+    for (i = 0U; (i + length) <= node->outputLength; i++)
+    {
+        if (memcmp(&node->output[i], text, length) == 0)
+        {
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/*
+ *  ======== VirtualCAN_init ========
+ */
+void VirtualCAN_init(VirtualCAN_MonitorFxn monitorFxn, void *arg)
+{
+    pthread_condattr_t condAttrs;
+    pthread_t thread;
+
+    clock_gettime(CLOCK_MONOTONIC, &epoch);
+
+    monitor    = monitorFxn;
+    monitorArg = arg;
+
+    pthread_condattr_init(&condAttrs);
+    pthread_condattr_setclock(&condAttrs, CLOCK_MONOTONIC);
+    pthread_cond_init(&busCond, &condAttrs);
+    pthread_cond_init(&clockCond, &condAttrs);
+    pthread_condattr_destroy(&condAttrs);
+
+    if ((startThread(&thread, PTHREAD_CREATE_DETACHED, NULL, busThread, NULL) != 0) ||
+        (startThread(&thread, PTHREAD_CREATE_DETACHED, NULL, clockThread, NULL) != 0))
+    {
+        fprintf(stderr, "VirtualCAN: failed to start the bus\n");
+        abort();
+    }
+}
+
+/*
+ *  ======== VirtualCAN_addNode ========
+ */
+VirtualCAN_Node *VirtualCAN_addNode(const char *name, void *(*mainFxn)(void *arg0), int32_t freqPpb, uint32_t systimStart)
+{
+    pthread_mutexattr_t mutexAttrs;
+    VirtualCAN_Node *node;
+
+    if (nodeCnt >= VirtualCAN_NODE_MAX)
+    {
+        return NULL;
+    }
+
+    node = &nodes[nodeCnt];
+
+    memset(node, 0, sizeof(*node));
+    node->name            = name;
+    node->mainFxn         = mainFxn;
+    node->freqPpb         = freqPpb;
+    node->startNs         = (uint64_t)systimStart * 250U;
+    node->outputLineStart = true;
+
+    pthread_mutexattr_init(&mutexAttrs);
+    pthread_mutexattr_settype(&mutexAttrs, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&node->lock, &mutexAttrs);
+    pthread_mutexattr_destroy(&mutexAttrs);
+
+    pthread_mutex_init(&node->uartLock, NULL);
+    pthread_cond_init(&node->uartCond, NULL);
+
+    /* Nodes are only added before they are started */
+    nodeCnt++;
+
+    return node;
+}
+
+/*
+ *  ======== VirtualCAN_startNode ========
+ */
+void VirtualCAN_startNode(VirtualCAN_Node *node)
+{
+    if (startThread(NULL, PTHREAD_CREATE_DETACHED, node, node->mainFxn, NULL) != 0)
+    {
+        fprintf(stderr, "VirtualCAN: failed to start %s\n", node->name);
+        abort();
+    }
+}
+
+/*
+ *  ======== VirtualCAN_clickButton ========
+ */
+bool VirtualCAN_clickButton(VirtualCAN_Node *node, uint32_t index)
+{
+    Button_Params *params = &node->buttonParams[index];
+    bool clicked          = false;
+
+    lockNode(node);
+
+    if (node->buttonOpen[index] && (params->buttonCallback != NULL) &&
+        ((params->buttonEventMask & Button_EV_CLICKED) != 0U))
+    {
+        params->buttonCallback(&node->buttons[index], Button_EV_CLICKED);
+        clicked = true;
+    }
+
+    unlockNode();
+    currentNode = NULL;
+
+    return clicked;
+}
+
+/*
+ *  ======== VirtualCAN_writeInput ========
+ */
+void VirtualCAN_writeInput(VirtualCAN_Node *node, const void *data, size_t length)
+{
+    const uint8_t *bytes = data;
+    size_t i;
+
+    pthread_mutex_lock(&node->uartLock);
+
+    for (i = 0U; (i < length) && (node->inputCount < INPUT_SIZE); i++)
+    {
+        node->input[(node->inputHead + node->inputCount) % INPUT_SIZE] = bytes[i];
+        node->inputCount++;
+    }
+
+    pthread_cond_broadcast(&node->uartCond);
+    pthread_mutex_unlock(&node->uartLock);
+}
+
+/*
+ *  ======== VirtualCAN_readOutput ========
+ */
+size_t VirtualCAN_readOutput(VirtualCAN_Node *node, size_t offset, void *buf, size_t size)
+{
+    size_t count = 0U;
+
+    pthread_mutex_lock(&node->uartLock);
+
+    if (offset < node->outputLength)
+    {
+        count = node->outputLength - offset;
+        if (count > size)
+        {
+            count = size;
+        }
+
+        memcpy(buf, &node->output[offset], count);
+    }
+
+    pthread_mutex_unlock(&node->uartLock);
+
+    return count;
+}
+
+/*
+ *  ======== VirtualCAN_countOutput ========
+ */
+uint32_t VirtualCAN_countOutput(VirtualCAN_Node *node, const char *text)
+{
+    uint32_t count;
+
+    pthread_mutex_lock(&node->uartLock);
+    count = countText(node, text);
+    pthread_mutex_unlock(&node->uartLock);
+
+    return count;
+}
+
+/*
+ *  ======== VirtualCAN_waitForOutput ========
+ */
+bool VirtualCAN_waitForOutput(VirtualCAN_Node *node, const char *text, uint32_t count, uint32_t timeoutMs)
+{
+    struct timespec timeout;
+    bool found;
+
+    clock_gettime(CLOCK_REALTIME, &timeout);
+
+    timeout.tv_sec += timeoutMs / 1000U;
+    timeout.tv_nsec += (long)(timeoutMs % 1000U) * 1000000L;
+
+    if (timeout.tv_nsec >= 1000000000L)
+    {
+        timeout.tv_sec++;
+        timeout.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&node->uartLock);
+
+    while (!(found = (countText(node, text) >= count)))
+    {
+        if (pthread_cond_timedwait(&node->uartCond, &node->uartLock, &timeout) != 0)
+        {
+            found = (countText(node, text) >= count);
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&node->uartLock);
+
+    return found;
+}
+
+/*
+ *  ======== VirtualCAN_getLedToggles ========
+ */
+uint32_t VirtualCAN_getLedToggles(VirtualCAN_Node *node, uint32_t index, uint64_t *lastTimeNs)
+{
+    uint32_t toggles;
+
+    lockNode(node);
+    toggles = node->ledToggles[index];
+
+    if (lastTimeNs != NULL)
+    {
+        *lastTimeNs = node->ledToggleNs[index];
+    }
+
+    unlockNode();
+    currentNode = NULL;
+
+    return toggles;
+}
+
+/*
+ *  ======== VirtualCAN_inject ========
+ */
+bool VirtualCAN_inject(const CAN_TxBufElement *elem, uint64_t timeNs)
+{
+    InjectedFrame *frame;
+
+    pthread_mutex_lock(&busLock);
+
+    if (injectCount >= INJECT_MAX)
+    {
+        pthread_mutex_unlock(&busLock);
+        return false;
+    }
+
+    frame         = &injected[(injectHead + injectCount) % INJECT_MAX];
+    frame->elem   = *elem;
+    frame->timeNs = timeNs;
+    injectCount++;
+    busRequestCnt++;
+    pthread_cond_signal(&busCond);
+
+    pthread_mutex_unlock(&busLock);
+
+    return true;
+}
+
+/*
+ *  ======== VirtualCAN_getTime ========
+ */
+uint64_t VirtualCAN_getTime(void)
+{
+    return getHostTime();
+}
+
+/*
+ *  ======== VirtualCAN_pthreadCreate ========
+ *  Creates a thread of the calling node, keeping only the detach state of
+ *  the attributes.
+ */
+int VirtualCAN_pthreadCreate(pthread_t *thread, const pthread_attr_t *attr, void *(*startFxn)(void *), void *arg)
+{
+    int detachState = PTHREAD_CREATE_JOINABLE;
+
+    if (attr != NULL)
+    {
+        pthread_attr_getdetachstate(attr, &detachState);
+    }
+
+    return startThread(thread, detachState, getNode(), startFxn, arg);
+}
+
+/*
+ *  ======== VirtualCAN_pthreadAttrSetStackSize ========
+ */
+int VirtualCAN_pthreadAttrSetStackSize(pthread_attr_t *attr, size_t size)
+{
+    (void)attr;
+    (void)size;
+
+    return 0;
+}
+
+/*
+ *  ======== VirtualCAN_pthreadAttrSetSchedParam ========
+ */
+int VirtualCAN_pthreadAttrSetSchedParam(pthread_attr_t *attr, const struct sched_param *param)
+{
+    (void)attr;
+    (void)param;
+
+    return 0;
+}
+
+/*
+ *  ======== VirtualCAN_getCycles ========
+ */
+uint32_t VirtualCAN_getCycles(void)
+{
+    return (uint32_t)((getHostTime() * HOST_CLK_PER_USEC) / 1000U);
+}
+
+/*
+ *  ======== VirtualCAN_getReg ========
+ */
+volatile uint32_t *VirtualCAN_getReg(uintptr_t address)
+{
+    VirtualCAN_Node *node = getNode();
+    uint32_t offset;
+
+    if ((address >= SYSTIM_BASE) && (address < (SYSTIM_BASE + (REG_COUNT * 4U))))
+    {
+        offset = (uint32_t)(address - SYSTIM_BASE);
+
+        /* Apply the previous write before the register is accessed */
+        commitRegWrites(node);
+
+        if (offset == SYSTIM_O_TIME250N)
+        {
+            node->systimRegs[REG_INDEX(offset)] = (uint32_t)(getNodeTime(node, getThreadTime()) / 250U);
+        }
+        else if (offset == SYSTIM_O_TIME1U)
+        {
+            node->systimRegs[REG_INDEX(offset)] = (uint32_t)(getNodeTime(node, getThreadTime()) / 1000U);
+        }
+
+        return &node->systimRegs[REG_INDEX(offset)];
+    }
+
+    if ((address >= EVTSVT_BASE) && (address < (EVTSVT_BASE + (REG_COUNT * 4U))))
+    {
+        return &node->evtsvtRegs[REG_INDEX(address - EVTSVT_BASE)];
+    }
+
+    fprintf(stderr, "VirtualCAN: %s accessed register 0x%08lx\n", node->name, (unsigned long)address);
+    abort();
+}
+
+/*
+ *  ======== HwiP_disable ========
+ */
+uintptr_t HwiP_disable(void)
+{
+    pthread_mutex_lock(&getNode()->lock);
+
+    if (lockDepth++ == 0U)
+    {
+        lockTimeNs = getHostTime();
+    }
+
+    return 0U;
+}
+
+/*
+ *  ======== HwiP_restore ========
+ */
+void HwiP_restore(uintptr_t key)
+{
+    lockDepth--;
+
+    pthread_mutex_unlock(&getNode()->lock);
+}
+
+/*
+ *  ======== HwiP_Params_init ========
+ */
+void HwiP_Params_init(HwiP_Params *params)
+{
+    params->arg       = 0U;
+    params->priority  = ~0U;
+    params->enableInt = true;
+}
+
+/*
+ *  ======== HwiP_construct ========
+ *  Only the SYSTIM compare interrupt is supported.
+ */
+HwiP_Handle HwiP_construct(HwiP_Struct *hwiP, int interruptNum, HwiP_Fxn hwiFxn, HwiP_Params *params)
+{
+    VirtualCAN_Node *node = getNode();
+    pthread_t thread;
+
+    node->hwiFxn      = hwiFxn;
+    node->hwiArg      = (params != NULL) ? params->arg : 0U;
+    node->compareTime = (uint32_t)(getNodeTime(node, getThreadTime()) / 250U);
+
+    if (startThread(&thread, PTHREAD_CREATE_DETACHED, node, hwiThread, node) != 0)
+    {
+        return NULL;
+    }
+
+    return hwiP;
+}
+
+/*
+ *  ======== HwiP_post ========
+ */
+void HwiP_post(int interruptNum)
+{
+    VirtualCAN_Node *node = getNode();
+
+    lockNode(node);
+    node->hwiPosted = true;
+    unlockNode();
+}
+
+/*
+ *  ======== ClockP_Params_init ========
+ */
+void ClockP_Params_init(ClockP_Params *params)
+{
+    params->startFlag = false;
+    params->period    = 0U;
+    params->arg       = 0U;
+}
+
+/*
+ *  ======== ClockP_construct ========
+ */
+ClockP_Handle ClockP_construct(ClockP_Struct *clockP, ClockP_Fxn clockFxn, uint32_t timeout, ClockP_Params *params)
+{
+    ClockP_Params defaultParams;
+    ClockP_Struct *listed;
+
+    if (params == NULL)
+    {
+        ClockP_Params_init(&defaultParams);
+        params = &defaultParams;
+    }
+
+    pthread_mutex_lock(&clockLock);
+
+    for (listed = clocks; (listed != NULL) && (listed != clockP); listed = listed->next) {}
+
+    if (listed == NULL)
+    {
+        clockP->next = clocks;
+        clocks       = clockP;
+    }
+
+    clockP->node    = getNode();
+    clockP->fxn     = clockFxn;
+    clockP->arg     = params->arg;
+    clockP->timeout = timeout;
+    clockP->period  = params->period;
+    clockP->active  = false;
+    clockP->startCnt++;
+
+    pthread_mutex_unlock(&clockLock);
+
+    if (params->startFlag)
+    {
+        ClockP_start(clockP);
+    }
+
+    return clockP;
+}
+
+/*
+ *  ======== ClockP_start ========
+ */
+void ClockP_start(ClockP_Handle handle)
+{
+    uint64_t now = getThreadTime();
+
+    pthread_mutex_lock(&clockLock);
+
+    handle->dueNs  = now + ((uint64_t)handle->timeout * ClockP_getSystemTickPeriod() * 1000U);
+    handle->active = true;
+    handle->startCnt++;
+
+    pthread_cond_signal(&clockCond);
+    pthread_mutex_unlock(&clockLock);
+}
+
+/*
+ *  ======== ClockP_stop ========
+ */
+void ClockP_stop(ClockP_Handle handle)
+{
+    pthread_mutex_lock(&clockLock);
+
+    handle->active = false;
+    handle->startCnt++;
+
+    pthread_mutex_unlock(&clockLock);
+}
+
+/*
+ *  ======== ClockP_getSystemTickPeriod ========
+ */
+uint32_t ClockP_getSystemTickPeriod(void)
+{
+    return 1000U;
+}
+
+/*
+ *  ======== CAN_Params_init ========
+ */
+void CAN_Params_init(CAN_Params *params)
+{
+    memset(params, 0, sizeof(*params));
+    params->tsPrescaler = 1U;
+}
+
+/*
+ *  ======== CAN_open ========
+ */
+CAN_Handle CAN_open(uint_least8_t index, CAN_Params *params)
+{
+    VirtualCAN_Node *node  = getNode();
+    struct CAN_Config *can = &node->can;
+    const CAN_MsgRAMConfig *config;
+    CAN_Params defaultParams;
+
+    if (params == NULL)
+    {
+        CAN_Params_init(&defaultParams);
+        params = &defaultParams;
+    }
+
+    config = params->msgRAMConfig;
+
+    if ((index != CONFIG_CAN_0) ||
+        ((config != NULL) && (((config->rxFIFONum[0] + config->rxFIFONum[1]) > QUEUE_MAX) ||
+                              ((config->txFIFOQNum + config->txBufNum) > QUEUE_MAX) ||
+                              (config->txEventFIFONum > QUEUE_MAX))))
+    {
+        return NULL;
+    }
+
+    lockNode(node);
+
+    if (can->open)
+    {
+        unlockNode();
+        return NULL;
+    }
+
+    can->eventCbk     = params->eventCbk;
+    can->eventMask    = params->eventMask;
+    can->userArg      = params->userArg;
+    can->tsPrescaler  = params->tsPrescaler;
+    can->msgRAMConfig = config;
+    can->rxHead       = 0U;
+    can->rxCount      = 0U;
+    can->txCount      = 0U;
+    can->txEventHead  = 0U;
+    can->txEventCount = 0U;
+
+    if (config != NULL)
+    {
+        can->rxSize      = config->rxFIFONum[0] + config->rxFIFONum[1];
+        can->txSize      = config->txFIFOQNum + config->txBufNum;
+        can->txPriority  = (config->txFIFOQMode != 0U);
+        can->txEventSize = config->txEventFIFONum;
+    }
+    else
+    {
+        can->rxSize      = DEFAULT_QUEUE_SIZE;
+        can->txSize      = DEFAULT_QUEUE_SIZE;
+        can->txPriority  = false;
+        can->txEventSize = DEFAULT_QUEUE_SIZE;
+    }
+
+    can->open = true;
+    can->openCnt++;
+
+    unlockNode();
+
+    return can;
+}
+
+/*
+ *  ======== CAN_close ========
+ */
+void CAN_close(CAN_Handle handle)
+{
+    lockNode(getNode());
+
+    handle->open = false;
+    handle->openCnt++;
+
+    unlockNode();
+}
+
+/*
+ *  ======== CAN_read ========
+ */
+int_fast16_t CAN_read(CAN_Handle handle, CAN_RxBufElement *elem)
+{
+    int_fast16_t status = CAN_STATUS_NO_RX_MSG_AVAIL;
+
+    lockNode(getNode());
+
+    if (!handle->open)
+    {
+        status = CAN_STATUS_ERROR;
+    }
+    else if (handle->rxCount > 0U)
+    {
+        *elem          = handle->rxFifo[handle->rxHead];
+        handle->rxHead = (handle->rxHead + 1U) % handle->rxSize;
+        handle->rxCount--;
+        status = CAN_STATUS_SUCCESS;
+    }
+
+    unlockNode();
+
+    return status;
+}
+
+/*
+ *  ======== CAN_readTxEvent ========
+ */
+int_fast16_t CAN_readTxEvent(CAN_Handle handle, CAN_TxEventElement *elem)
+{
+    int_fast16_t status = CAN_STATUS_ERROR;
+
+    lockNode(getNode());
+
+    if (handle->open && (handle->txEventCount > 0U))
+    {
+        *elem               = handle->txEvents[handle->txEventHead];
+        handle->txEventHead = (handle->txEventHead + 1U) % handle->txEventSize;
+        handle->txEventCount--;
+        status = CAN_STATUS_SUCCESS;
+    }
+
+    unlockNode();
+
+    return status;
+}
+
+/*
+ *  ======== CAN_write ========
+ */
+int_fast16_t CAN_write(CAN_Handle handle, const CAN_TxBufElement *elem)
+{
+    int_fast16_t status = CAN_STATUS_SUCCESS;
+
+    lockNode(getNode());
+
+    if (!handle->open)
+    {
+        status = CAN_STATUS_ERROR;
+    }
+    else if (handle->txCount >= handle->txSize)
+    {
+        status = CAN_STATUS_TX_BUF_FULL;
+    }
+    else
+    {
+        handle->txQueue[handle->txCount] = *elem;
+        handle->txCount++;
+    }
+
+    unlockNode();
+
+    if (status == CAN_STATUS_SUCCESS)
+    {
+        requestBus();
+    }
+
+    return status;
+}
+
+/*
+ *  ======== CAN_getBitTiming ========
+ */
+int_fast16_t CAN_getBitTiming(CAN_Handle handle, CAN_BitTimingParams *bitTiming, uint32_t *clkFreqKhz)
+{
+    memset(bitTiming, 0, sizeof(*bitTiming));
+    bitTiming->nomRatePrescaler  = 0U;
+    bitTiming->nomTimeSeg1       = NOM_TIME_SEG1;
+    bitTiming->nomTimeSeg2       = NOM_TIME_SEG2;
+    bitTiming->dataRatePrescaler = 0U;
+    bitTiming->dataTimeSeg1      = DATA_TIME_SEG1;
+    bitTiming->dataTimeSeg2      = DATA_TIME_SEG2;
+    *clkFreqKhz                  = CLK_FREQ_KHZ;
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== MCAN_getTimestampCounter ========
+ */
+uint16_t MCAN_getTimestampCounter(void)
+{
+    VirtualCAN_Node *node = getNode();
+
+    return getCounter(node, getThreadTime());
+}
+
+/*
+ *  ======== DCAN_getTimestampCounter ========
+ */
+uint16_t DCAN_getTimestampCounter(void)
+{
+    return MCAN_getTimestampCounter();
+}
+
+/*
+ *  ======== UART2_Params_init ========
+ */
+void UART2_Params_init(UART2_Params *params)
+{
+    memset(params, 0, sizeof(*params));
+    params->readMode       = UART2_Mode_BLOCKING;
+    params->writeMode      = UART2_Mode_BLOCKING;
+    params->readReturnMode = UART2_ReadReturnMode_FULL;
+    params->baudRate       = 115200U;
+}
+
+/*
+ *  ======== UART2_open ========
+ */
+UART2_Handle UART2_open(uint_least8_t index, UART2_Params *params)
+{
+    VirtualCAN_Node *node = getNode();
+
+    if (index != CONFIG_UART2_0)
+    {
+        return NULL;
+    }
+
+    node->uart.readMode       = params->readMode;
+    node->uart.readReturnMode = params->readReturnMode;
+
+    return &node->uart;
+}
+
+/*
+ *  ======== UART2_read ========
+ *  Blocking reads wait for the whole buffer, or for the first byte with the
+ *  partial return mode. Nonblocking reads return the bytes available.
+ */
+int_fast16_t UART2_read(UART2_Handle handle, void *buffer, size_t size, size_t *bytesRead)
+{
+    VirtualCAN_Node *node = getNode();
+    uint8_t *bytes        = buffer;
+    size_t count          = 0U;
+    size_t needed;
+
+    pthread_mutex_lock(&node->uartLock);
+
+    while (count < size)
+    {
+        if (node->inputCount > 0U)
+        {
+            bytes[count++] = node->input[node->inputHead];
+            node->inputHead = (node->inputHead + 1U) % INPUT_SIZE;
+            node->inputCount--;
+            continue;
+        }
+
+        needed = (handle->readReturnMode == UART2_ReadReturnMode_FULL) ? size : 1U;
+
+        if ((handle->readMode != UART2_Mode_BLOCKING) || (count >= needed))
+        {
+            break;
+        }
+
+        pthread_cond_wait(&node->uartCond, &node->uartLock);
+    }
+
+    pthread_mutex_unlock(&node->uartLock);
+
+    if (bytesRead != NULL)
+    {
+        *bytesRead = count;
+    }
+
+    return UART2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== UART2_write ========
+ *  The whole buffer is written at once.
+ */
+int_fast16_t UART2_write(UART2_Handle handle, const void *buffer, size_t size, size_t *bytesWritten)
+{
+    appendOutput(getNode(), buffer, size);
+
+    if (bytesWritten != NULL)
+    {
+        *bytesWritten = size;
+    }
+
+    return UART2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== GPIO_write ========
+ */
+void GPIO_write(uint_least8_t index, unsigned int value)
+{
+    VirtualCAN_Node *node = getNode();
+
+    if (index <= CONFIG_GPIO_LED_1)
+    {
+        lockNode(node);
+        node->leds[index] = value;
+        unlockNode();
+    }
+}
+
+/*
+ *  ======== GPIO_toggle ========
+ */
+void GPIO_toggle(uint_least8_t index)
+{
+    VirtualCAN_Node *node = getNode();
+
+    if (index <= CONFIG_GPIO_LED_1)
+    {
+        lockNode(node);
+        node->leds[index] ^= 1U;
+        node->ledToggles[index]++;
+        node->ledToggleNs[index] = lockTimeNs;
+        unlockNode();
+    }
+}
+
+/*
+ *  ======== Button_Params_init ========
+ */
+void Button_Params_init(Button_Params *params)
+{
+    params->debounceDuration            = 10U;
+    params->longPressDuration           = 2000U;
+    params->doublePressDetectiontimeout = 200U;
+    params->buttonEventMask             = 0xFFU;
+    params->buttonCallback              = NULL;
+}
+
+/*
+ *  ======== Button_open ========
+ */
+Button_Handle Button_open(uint_least8_t buttonIndex, Button_Params *params)
+{
+    VirtualCAN_Node *node = getNode();
+
+    if (buttonIndex > CONFIG_BUTTON_1)
+    {
+        return NULL;
+    }
+
+    lockNode(node);
+
+    node->buttonHWAttrs[buttonIndex].gpioIndex = (buttonIndex == CONFIG_BUTTON_0) ? CONFIG_GPIO_BUTTON_0_INPUT
+                                                                                  : CONFIG_GPIO_BUTTON_1_INPUT;
+    node->buttons[buttonIndex].hwAttrs = &node->buttonHWAttrs[buttonIndex];
+    node->buttonParams[buttonIndex]    = *params;
+    node->buttonOpen[buttonIndex]      = true;
+
+    unlockNode();
+
+    return &node->buttons[buttonIndex];
+}
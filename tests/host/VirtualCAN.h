@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== VirtualCAN.h ========
+ *  In-process virtual CAN bus for host builds of the CAN examples.
+ *
+ *  Each example is linked into the check as a node, with its own copy of the
+ *  example globals, and runs on host threads. The bus implements the CAN,
+ *  UART2, GPIO, Button, ClockP and HwiP functions the examples use, and keeps
+ *  the SYSTIM registers, the CAN timestamp counter and the UART output of
+ *  each node. Frames are arbitrated by ID and take the time of their bits at
+ *  500 kbit/s and 2 Mbit/s in the CAN FD data phase, without stuff bits. Rx
+ *  and Tx timestamps are taken at the SOF of the frame in the time of each
+ *  node, whose clock may run at its own frequency. All frames are received
+ *  without errors.
+ */
+
+#ifndef VirtualCAN__include
+#define VirtualCAN__include
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of nodes */
+#define VirtualCAN_NODE_MAX 8U
+
+/* Bit rates of the bus */
+#define VirtualCAN_NOM_BIT_RATE  500000U
+#define VirtualCAN_DATA_BIT_RATE 2000000U
+
+/* Node of the bus */
+typedef struct VirtualCAN_Node_ VirtualCAN_Node;
+
+/* Frame transmitted on the bus */
+typedef struct
+{
+    uint64_t sofTimeNs;  /* Bus time of the SOF */
+    uint32_t durationNs; /* Time of the frame bits, including the interframe space */
+    const char *source;  /* Name of the transmitting node, or NULL for an injected frame */
+    CAN_TxBufElement elem;
+} VirtualCAN_Frame;
+
+/* Called for each frame after it was transmitted, before the nodes receive it */
+typedef void (*VirtualCAN_MonitorFxn)(const VirtualCAN_Frame *frame, void *arg);
+
+/* Print the UART output of the nodes to stdout */
+extern bool VirtualCAN_trace;
+
+/*
+ *  ======== VirtualCAN_init ========
+ *  Starts the bus. monitorFxn may be NULL.
+ */
+extern void VirtualCAN_init(VirtualCAN_MonitorFxn monitorFxn, void *arg);
+
+/*
+ *  ======== VirtualCAN_addNode ========
+ *  Adds a node running mainFxn. The clock of the node runs freqPpb faster
+ *  than the bus time and its SYSTIM starts at systimStart. Returns NULL if
+ *  there are VirtualCAN_NODE_MAX nodes.
+ */
+extern VirtualCAN_Node *VirtualCAN_addNode(const char *name,
+                                           void *(*mainFxn)(void *arg0),
+                                           int32_t freqPpb,
+                                           uint32_t systimStart);
+
+/*
+ *  ======== VirtualCAN_startNode ========
+ *  Runs the main function of the node in a new thread.
+ */
+extern void VirtualCAN_startNode(VirtualCAN_Node *node);
+
+/*
+ *  ======== VirtualCAN_clickButton ========
+ *  Reports a click of button index to the node. Returns false if the node
+ *  has not opened the button.
+ */
+extern bool VirtualCAN_clickButton(VirtualCAN_Node *node, uint32_t index);
+
+/*
+ *  ======== VirtualCAN_writeInput ========
+ *  Adds bytes to the UART input of the node.
+ */
+extern void VirtualCAN_writeInput(VirtualCAN_Node *node, const void *data, size_t length);
+
+/*
+ *  ======== VirtualCAN_readOutput ========
+ *  Copies up to size bytes of the UART output of the node from offset to buf,
+ *  and returns the number of bytes copied.
+ */
+extern size_t VirtualCAN_readOutput(VirtualCAN_Node *node, size_t offset, void *buf, size_t size);
+
+/*
+ *  ======== VirtualCAN_countOutput ========
+ *  Returns how often text occurs in the UART output of the node.
+ */
+extern uint32_t VirtualCAN_countOutput(VirtualCAN_Node *node, const char *text);
+
+/*
+ *  ======== VirtualCAN_waitForOutput ========
+ *  Waits until text occurs count times in the UART output of the node.
+ *  Returns false if timeoutMs elapsed first.
+ */
+extern bool VirtualCAN_waitForOutput(VirtualCAN_Node *node, const char *text, uint32_t count, uint32_t timeoutMs);
+
+/*
+ *  ======== VirtualCAN_getLedToggles ========
+ *  Returns the number of times LED index of the node was toggled, and the bus
+ *  time of the last toggle in lastTimeNs if it is not NULL.
+ */
+extern uint32_t VirtualCAN_getLedToggles(VirtualCAN_Node *node, uint32_t index, uint64_t *lastTimeNs);
+
+/*
+ *  ======== VirtualCAN_inject ========
+ *  Queues a frame transmitted by a device outside the nodes, with its SOF at
+ *  bus time timeNs, or when the bus is idle after timeNs. The frames are
+ *  sent in the order they are queued, so their times must not decrease.
+ *  Returns false if the queue is full.
+ */
+extern bool VirtualCAN_inject(const CAN_TxBufElement *elem, uint64_t timeNs);
+
+/*
+ *  ======== VirtualCAN_getTime ========
+ *  Returns the bus time in nanoseconds since VirtualCAN_init().
+ */
+extern uint64_t VirtualCAN_getTime(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VirtualCAN__include */
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== bench_CANCodec.c ========
+ *  Host timing of the received frame printout of the CAN examples: the
+ *  sprintf() and strlen() version of printRxMsg() that CANCodec replaced,
+ *  kept here as the reference, against CANCodec_putRxElem(). The output of
+ *  both is first compared for all DLCs, then both are timed on a classic
+ *  8 byte frame and a 64 byte CAN FD frame. Each time includes the length
+ *  passed to the UART write.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "HostBench.h"
+
+/* Calls per timed run */
+#define ITERATIONS 100000U
+
+/* Size of the formatted message buffer of the examples */
+#define MAX_MSG_LENGTH 512U
+
+#define DLC_TABLE_SIZE 16U
+
+static const uint32_t dlcToDataSize[DLC_TABLE_SIZE] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+
+/*
+ *  ======== printRxMsgSprintf ========
+ *  printRxMsg() before CANCodec, writing into formattedMsg instead of the
+ *  UART. Returns the length of the text.
+ */
+static size_t printRxMsgSprintf(char *formattedMsg, const CAN_RxBufElement *rxElem, uint64_t rxSofTime)
+{
+    uint_fast8_t dataLen;
+    uint_fast8_t i;
+
+    sprintf(formattedMsg, "Msg ID: 0x%x\r\n", (unsigned int)rxElem->id);
+
+    sprintf(formattedMsg + strlen(formattedMsg), "TS: 0x%04x\r\n", rxElem->rxts);
+
+    sprintf(formattedMsg + strlen(formattedMsg),
+            "SOF time: 0x%08x%08x\r\n",
+            (unsigned int)(rxSofTime >> 32),
+            (unsigned int)rxSofTime);
+
+#ifndef CAN_SUPPORTS_DCAN
+
+    sprintf(formattedMsg + strlen(formattedMsg), "CAN FD: %u\r\n", rxElem->fdf);
+
+#endif /* CAN_SUPPORTS_DCAN */
+
+    sprintf(formattedMsg + strlen(formattedMsg), "DLC: %u\r\n", rxElem->dlc);
+
+#ifndef CAN_SUPPORTS_DCAN
+
+    sprintf(formattedMsg + strlen(formattedMsg), "BRS: %u\r\n", rxElem->brs);
+
+#endif /* CAN_SUPPORTS_DCAN */
+
+    sprintf(formattedMsg + strlen(formattedMsg), "ESI: %u\r\n", rxElem->esi);
+
+    if (rxElem->dlc < DLC_TABLE_SIZE)
+    {
+        dataLen = dlcToDataSize[rxElem->dlc];
+
+        sprintf(formattedMsg + strlen(formattedMsg), "Data[%lu]: ", (unsigned long)dataLen);
+
+        /* Format the message as printable hex */
+        for (i = 0U; i < dataLen; i++)
+        {
+            sprintf(formattedMsg + strlen(formattedMsg), "%02X ", rxElem->data[i]);
+        }
+
+        sprintf(formattedMsg + strlen(formattedMsg), "\r\n\n");
+    }
+
+    return strlen(formattedMsg);
+}
+
+/*
+ *  ======== printRxMsgCodec ========
+ *  printRxMsg() with CANCodec.
+ */
+static size_t printRxMsgCodec(char *formattedMsg, const CAN_RxBufElement *rxElem, uint64_t rxSofTime)
+{
+    CANCodec_Cursor cursor;
+
+    CANCodec_init(&cursor, formattedMsg, MAX_MSG_LENGTH);
+    CANCodec_putRxElem(&cursor, rxElem, rxSofTime);
+
+    return CANCodec_finish(&cursor);
+}
+
+/*
+ *  ======== initFrame ========
+ */
+static void initFrame(CAN_RxBufElement *elem, uint32_t dlc)
+{
+    uint32_t i;
+
+    (void)memset(elem, 0, sizeof(*elem));
+    elem->id   = 0x5AAU ^ (dlc << 4);
+    elem->rxts = 0xB00U + dlc;
+    elem->dlc  = dlc;
+    elem->fdf  = (dlc > 8U) ? 1U : 0U;
+    elem->brs  = elem->fdf;
+
+    for (i = 0U; i < CAN_MAX_DATA_LENGTH; i++)
+    {
+        elem->data[i] = (uint8_t)((i * 29U) + dlc);
+    }
+}
+
+/*
+ *  ======== isMatch ========
+ *  Returns true if both printouts are identical for all DLCs.
+ */
+static bool isMatch(void)
+{
+    CAN_RxBufElement elem;
+    char expected[MAX_MSG_LENGTH];
+    char text[MAX_MSG_LENGTH];
+    size_t length;
+    uint32_t dlc;
+
+    for (dlc = 0U; dlc < DLC_TABLE_SIZE; dlc++)
+    {
+        initFrame(&elem, dlc);
+
+        length = printRxMsgSprintf(expected, &elem, 0x00000012DEADBEEFULL);
+
+        if ((printRxMsgCodec(text, &elem, 0x00000012DEADBEEFULL) != length) || (strcmp(text, expected) != 0))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ *  ======== timePrint ========
+ *  Returns the time of one printout in ns.
+ */
+static double timePrint(size_t (*printFxn)(char *, const CAN_RxBufElement *, uint64_t), const CAN_RxBufElement *elem)
+{
+    static char text[MAX_MSG_LENGTH];
+    uint64_t best = 0U;
+    uint64_t start;
+    uint32_t run;
+    uint32_t i;
+    size_t length = 0U;
+
+    for (run = 0U; run < HostBench_RUNS; run++)
+    {
+        start = HostBench_nowNs();
+
+        for (i = 0U; i < ITERATIONS; i++)
+        {
+            length += printFxn(text, elem, (uint64_t)i);
+        }
+
+        best = HostBench_best(best, HostBench_nowNs() - start);
+    }
+
+    HostBench_sink = (uint32_t)length;
+
+    return (double)best / ITERATIONS;
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    static const uint32_t dlcs[] = {CAN_DLC_8B, CAN_DLC_64B};
+    CAN_RxBufElement elem;
+    double sprintfNs;
+    double codecNs;
+    size_t i;
+
+    if (!isMatch())
+    {
+        printf("CANCodec printout differs from the sprintf() printout\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("printRxMsg() timing in ns per frame, fastest of %u runs\n", HostBench_RUNS);
+    printf("%-8s %9s %9s %7s\n", "Payload", "sprintf", "CANCodec", "Ratio");
+
+    for (i = 0U; i < (sizeof(dlcs) / sizeof(dlcs[0])); i++)
+    {
+        initFrame(&elem, dlcs[i]);
+
+        sprintfNs = timePrint(printRxMsgSprintf, &elem);
+        codecNs   = timePrint(printRxMsgCodec, &elem);
+
+        printf("%6u B %9.1f %9.1f %6.1fx\n", dlcToDataSize[dlcs[i]], sprintfNs, codecNs, sprintfNs / codecNs);
+    }
+
+    return EXIT_SUCCESS;
+}
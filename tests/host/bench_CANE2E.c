@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== bench_CANE2E.c ========
+ *  Host timing of the CANE2E CRCs against the bitwise and the one byte per
+ *  lookup implementations they replace. Each implementation is first checked
+ *  against the bitwise one for all payload lengths, then timed on 8 and 64
+ *  byte payloads, and the time of a full check of a 64 byte payload with
+ *  CRC-16 is added:
+ *
+ *      CANE2E CRC timing in ns per call, fastest of 7 runs
+ *      CRC      Length  Bitwise  Byte table  Slicing-by-4
+ *      CRC-8       8 B    114.3        25.3           9.3
+ *      CRC-8      64 B    935.6       199.5          65.7
+ *      ...
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "CANE2E.h"
+#include "HostBench.h"
+
+/* Calls per timed run */
+#define ITERATIONS 200000U
+
+/* Longest payload, that of a CAN FD frame */
+#define PAYLOAD_MAX 64U
+
+/* CRC implementation, with the CRC-8 passed in the low byte */
+typedef uint16_t (*CrcFxn)(uint16_t crc, const uint8_t *data, size_t length);
+
+/* One byte per lookup tables */
+static uint8_t crc8Table[256];
+static uint16_t crc16Table[256];
+
+/*
+ *  ======== crc8Bitwise ========
+ */
+static uint16_t crc8Bitwise(uint16_t crc, const uint8_t *data, size_t length)
+{
+    uint8_t value = (uint8_t)crc;
+    uint32_t bit;
+
+    while (length-- > 0U)
+    {
+        value ^= *data++;
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            value = ((value & 0x80U) != 0U) ? (uint8_t)((value << 1) ^ 0x1DU) : (uint8_t)(value << 1);
+        }
+    }
+
+    return value;
+}
+
+/*
+ *  ======== crc16Bitwise ========
+ */
+static uint16_t crc16Bitwise(uint16_t crc, const uint8_t *data, size_t length)
+{
+    uint32_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= (uint16_t)(*data++ << 8);
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== crc8Byte ========
+ */
+static uint16_t crc8Byte(uint16_t crc, const uint8_t *data, size_t length)
+{
+    uint8_t value = (uint8_t)crc;
+
+    while (length-- > 0U)
+    {
+        value = crc8Table[value ^ *data++];
+    }
+
+    return value;
+}
+
+/*
+ *  ======== crc16Byte ========
+ */
+static uint16_t crc16Byte(uint16_t crc, const uint8_t *data, size_t length)
+{
+    while (length-- > 0U)
+    {
+        crc = (uint16_t)(crc << 8) ^ crc16Table[(crc >> 8) ^ *data++];
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== crc8Slicing ========
+ */
+static uint16_t crc8Slicing(uint16_t crc, const uint8_t *data, size_t length)
+{
+    return CANE2E_crc8((uint8_t)crc, data, length);
+}
+
+/*
+ *  ======== crc16Slicing ========
+ */
+static uint16_t crc16Slicing(uint16_t crc, const uint8_t *data, size_t length)
+{
+    return CANE2E_crc16(crc, data, length);
+}
+
+/*
+ *  ======== initTables ========
+ */
+static void initTables(void)
+{
+    uint8_t byte;
+    uint32_t x;
+
+    for (x = 0U; x < 256U; x++)
+    {
+        byte = (uint8_t)x;
+
+        crc8Table[x]  = (uint8_t)crc8Bitwise(0U, &byte, 1U);
+        crc16Table[x] = crc16Bitwise(0U, &byte, 1U);
+    }
+}
+
+/*
+ *  ======== isMatch ========
+ *  Returns true if fxn computes the same CRC as the bitwise reference for
+ *  all lengths and alignments of the payload.
+ */
+static bool isMatch(CrcFxn fxn, CrcFxn reference, uint16_t init, const uint8_t *data)
+{
+    size_t offset;
+    size_t length;
+
+    for (offset = 0U; offset < 4U; offset++)
+    {
+        for (length = 0U; length <= (PAYLOAD_MAX - offset); length++)
+        {
+            if (fxn(init, &data[offset], length) != reference(init, &data[offset], length))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/*
+ *  ======== timeCrc ========
+ *  Returns the time of one call in ns.
+ */
+static double timeCrc(CrcFxn fxn, uint16_t init, const uint8_t *data, size_t length)
+{
+    uint64_t best = 0U;
+    uint64_t start;
+    uint32_t run;
+    uint32_t i;
+    uint16_t crc;
+
+    for (run = 0U; run < HostBench_RUNS; run++)
+    {
+        crc   = init;
+        start = HostBench_nowNs();
+
+        /* Chain the calls, so that they are not run in parallel */
+        for (i = 0U; i < ITERATIONS; i++)
+        {
+            crc = fxn((uint16_t)(crc ^ init), data, length);
+        }
+
+        best           = HostBench_best(best, HostBench_nowNs() - start);
+        HostBench_sink = crc;
+    }
+
+    return (double)best / ITERATIONS;
+}
+
+/*
+ *  ======== timeCheck ========
+ *  Returns the time of a CANE2E_check() of a valid 64 byte payload with
+ *  CRC-16 in ns.
+ */
+static double timeCheck(uint8_t *data)
+{
+    static const CANE2E_Config config = {0x1234U, CANE2E_CRC16, 0U, 2U, 1U};
+    CANE2E_Object sender;
+    CANE2E_Object receiver;
+    uint64_t best = 0U;
+    uint64_t start;
+    uint32_t run;
+    uint32_t i;
+    uint32_t status = 0U;
+
+    CANE2E_construct(&sender, &config);
+    CANE2E_construct(&receiver, &config);
+    (void)CANE2E_protect(&sender, data, PAYLOAD_MAX);
+
+    for (run = 0U; run < HostBench_RUNS; run++)
+    {
+        start = HostBench_nowNs();
+
+        /* All checks after the first find a repeated message */
+        for (i = 0U; i < ITERATIONS; i++)
+        {
+            status += (uint32_t)CANE2E_check(&receiver, data, PAYLOAD_MAX);
+        }
+
+        best = HostBench_best(best, HostBench_nowNs() - start);
+    }
+
+    HostBench_sink = status;
+
+    return (receiver.stats.errorCnt == 0U) ? ((double)best / ITERATIONS) : -1.0;
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    static const size_t lengths[] = {8U, PAYLOAD_MAX};
+    static const int widths[]     = {8, 11, 13};
+    static const struct
+    {
+        const char *name;
+        uint16_t init;
+        CrcFxn fxn[3];
+    } crcs[] = {
+        {"CRC-8", CANE2E_CRC8_INIT, {crc8Bitwise, crc8Byte, crc8Slicing}},
+        {"CRC-16", CANE2E_CRC16_INIT, {crc16Bitwise, crc16Byte, crc16Slicing}},
+    };
+    uint8_t data[PAYLOAD_MAX];
+    size_t c;
+    size_t l;
+    size_t f;
+
+    for (l = 0U; l < PAYLOAD_MAX; l++)
+    {
+        data[l] = (uint8_t)((l * 37U) + 11U);
+    }
+
+    CANE2E_init();
+    initTables();
+
+    for (c = 0U; c < (sizeof(crcs) / sizeof(crcs[0])); c++)
+    {
+        for (f = 1U; f < 3U; f++)
+        {
+            if (!isMatch(crcs[c].fxn[f], crcs[c].fxn[0], crcs[c].init, data))
+            {
+                printf("%s implementation %u differs from the bitwise CRC\n", crcs[c].name, (unsigned int)f);
+                return EXIT_FAILURE;
+            }
+        }
+    }
+
+    printf("CANE2E CRC timing in ns per call, fastest of %u runs\n", HostBench_RUNS);
+    printf("%-7s %7s %8s %11s %13s\n", "CRC", "Length", "Bitwise", "Byte table", "Slicing-by-4");
+
+    for (c = 0U; c < (sizeof(crcs) / sizeof(crcs[0])); c++)
+    {
+        for (l = 0U; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+        {
+            printf("%-7s %5u B", crcs[c].name, (unsigned int)lengths[l]);
+
+            for (f = 0U; f < 3U; f++)
+            {
+                printf(" %*.1f", widths[f], timeCrc(crcs[c].fxn[f], crcs[c].init, data, lengths[l]));
+            }
+
+            printf("\n");
+        }
+    }
+
+    printf("CANE2E_check() of a 64 B payload with CRC-16: %.1f ns\n", timeCheck(data));
+
+    return EXIT_SUCCESS;
+}
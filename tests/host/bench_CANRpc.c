@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== bench_CANRpc.c ========
+ *  Throughput of the pipelined CAN calls of the canInitiator RPC mode for
+ *  each window size, in a tick simulation of a 500 kbit/s bus with the
+ *  canResponder echo. The calls, frames, timeouts and retries are those of
+ *  runRpcBenchmark(): 1000 calls with 6 bytes of data in classic 8 byte
+ *  frames, for windows 1 to 16.
+ *
+ *  The bus sends one frame at a time, the lower ID first, and a frame takes
+ *  its bit count without stuff bits. The responder queues the response a
+ *  turnaround time after the request ends, and the initiator passes a
+ *  response to CANRpc_receive() the same time after it ends, which stands for
+ *  the driver and thread latency. The sweep is run a second time with every
+ *  50th frame lost by its receiver, so those calls complete through retries.
+ *  The simulation is deterministic, and prints one JSON line per window in
+ *  the format of the example.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "CANRpc.h"
+
+/* Call parameters of the canInitiator RPC mode */
+#define RPC_MSG_ID       0x3A0U
+#define RPC_CALL_COUNT   1000U
+#define RPC_DATA_SIZE    6U
+#define RPC_TIMEOUT_USEC 20000U
+#define RPC_MAX_RETRIES  2U
+
+/* Simulated bus and nodes */
+#define BIT_RATE_KBPS   500U
+#define TICKS_PER_USEC  CANRpc_TICKS_PER_USEC
+#define TICKS_PER_BIT   ((1000U * TICKS_PER_USEC) / BIT_RATE_KBPS)
+#define TURNAROUND_USEC 50U
+#define TX_BUFFERS      8U
+#define STEP_TICKS      TICKS_PER_USEC
+
+/* Frames lost in the second sweep */
+#define DROP_INTERVAL 50U
+
+/* Frames a queue holds */
+#define QUEUE_SIZE 64U
+
+/* Frame waiting for the bus or for a node */
+typedef struct
+{
+    CAN_TxBufElement elem;
+    uint32_t readyTime;
+} Frame;
+
+/* FIFO of frames */
+typedef struct
+{
+    Frame frames[QUEUE_SIZE];
+    uint32_t head;
+    uint32_t count;
+} Queue;
+
+static CANRpc_Object rpc;
+static CANRpc_EchoConfig echoConfig;
+static uint8_t rpcData[RPC_DATA_SIZE];
+static uint32_t matchCnt;
+
+/* Initiator Tx buffers, responses waiting for the responder turnaround, and
+ * responses waiting for the initiator
+ */
+static Queue txQueue;
+static Queue responderQueue;
+static Queue rxQueue;
+
+/* Frame on the bus */
+static Frame busFrame;
+static bool busBusy;
+static bool busFromInitiator;
+static uint32_t busEnd;
+
+static uint32_t now;
+static uint32_t frameCnt;
+static uint32_t dropInterval;
+
+/*
+ *  ======== put ========
+ */
+static bool put(Queue *queue, const CAN_TxBufElement *elem, uint32_t readyTime, uint32_t size)
+{
+    Frame *frame;
+
+    if (queue->count == size)
+    {
+        return false;
+    }
+
+    frame            = &queue->frames[(queue->head + queue->count) % QUEUE_SIZE];
+    frame->elem      = *elem;
+    frame->readyTime = readyTime;
+    queue->count++;
+
+    return true;
+}
+
+/*
+ *  ======== peek ========
+ *  Returns the first frame of the queue if it is ready, or NULL.
+ */
+static const Frame *peek(const Queue *queue)
+{
+    const Frame *frame = &queue->frames[queue->head];
+
+    return ((queue->count > 0U) && ((int32_t)(now - frame->readyTime) >= 0)) ? frame : NULL;
+}
+
+/*
+ *  ======== drop ========
+ *  Removes the first frame of the queue.
+ */
+static void drop(Queue *queue)
+{
+    queue->head = (queue->head + 1U) % QUEUE_SIZE;
+    queue->count--;
+}
+
+/*
+ *  ======== sendFxn ========
+ *  Queues a request in a free Tx buffer.
+ */
+static bool sendFxn(void *arg, const CAN_TxBufElement *elem)
+{
+    (void)arg;
+
+    return put(&txQueue, elem, now, TX_BUFFERS);
+}
+
+/*
+ *  ======== doneFxn ========
+ *  Counts the responses carrying the inverted call data, as
+ *  completeRpcCall() does.
+ */
+static void doneFxn(void *arg, CANRpc_Status status, const uint8_t *data, size_t length)
+{
+    (void)arg;
+
+    if ((status == CANRpc_SUCCESS) && (length == RPC_DATA_SIZE) && (memcmp(data, rpcData, length) == 0))
+    {
+        matchCnt++;
+    }
+}
+
+/*
+ *  ======== frameTicks ========
+ *  Time of a classic frame with an 11-bit ID, including the interframe
+ *  space: 47 bits and the data bits.
+ */
+static uint32_t frameTicks(const CAN_TxBufElement *elem)
+{
+    return (47U + (8U * CANCodec_dlcToLength(elem->dlc))) * TICKS_PER_BIT;
+}
+
+/*
+ *  ======== endFrame ========
+ *  Passes the frame that ended to its receiver, unless it is lost.
+ */
+static void endFrame(void)
+{
+    CAN_TxBufElement response;
+
+    frameCnt++;
+
+    if ((dropInterval != 0U) && ((frameCnt % dropInterval) == 0U))
+    {
+        return;
+    }
+
+    if (busFromInitiator)
+    {
+        /* The responder flips all ID and data bits */
+        response    = busFrame.elem;
+        response.id = ~busFrame.elem.id & 0x7FFU;
+        CANCodec_copyInverted(response.data, busFrame.elem.data, CANCodec_dlcToLength(busFrame.elem.dlc));
+
+        (void)put(&responderQueue, &response, now + (TURNAROUND_USEC * TICKS_PER_USEC), QUEUE_SIZE);
+    }
+    else
+    {
+        (void)put(&rxQueue, &busFrame.elem, now + (TURNAROUND_USEC * TICKS_PER_USEC), QUEUE_SIZE);
+    }
+}
+
+/*
+ *  ======== stepBus ========
+ *  Ends the frame on the bus, and starts the next one. The lower ID wins the
+ *  arbitration.
+ */
+static void stepBus(void)
+{
+    const Frame *request;
+    const Frame *response;
+
+    if (busBusy && ((int32_t)(now - busEnd) >= 0))
+    {
+        busBusy = false;
+        endFrame();
+    }
+
+    if (busBusy)
+    {
+        return;
+    }
+
+    request  = peek(&txQueue);
+    response = peek(&responderQueue);
+
+    if ((request != NULL) && ((response == NULL) || (request->elem.id < response->elem.id)))
+    {
+        busFrame         = *request;
+        busFromInitiator = true;
+        drop(&txQueue);
+    }
+    else if (response != NULL)
+    {
+        busFrame         = *response;
+        busFromInitiator = false;
+        drop(&responderQueue);
+    }
+    else
+    {
+        return;
+    }
+
+    busBusy = true;
+    busEnd  = now + frameTicks(&busFrame.elem);
+}
+
+/*
+ *  ======== receiveResponses ========
+ *  Passes the responses whose turnaround is over to the calls.
+ */
+static void receiveResponses(void)
+{
+    CAN_RxBufElement elem;
+    const Frame *frame;
+
+    while ((frame = peek(&rxQueue)) != NULL)
+    {
+        (void)memset(&elem, 0, sizeof(elem));
+        elem.id  = frame->elem.id;
+        elem.xtd = frame->elem.xtd;
+        elem.dlc = frame->elem.dlc;
+        elem.fdf = frame->elem.fdf;
+        elem.brs = frame->elem.brs;
+        (void)memcpy(elem.data, frame->elem.data, CANCodec_dlcToLength(frame->elem.dlc));
+        drop(&rxQueue);
+
+        (void)CANRpc_receive(&rpc, &elem);
+    }
+}
+
+/*
+ *  ======== runWindow ========
+ *  Makes RPC_CALL_COUNT calls with up to window calls in flight, like
+ *  runRpcWindow(), and prints the results. Returns false if a call did not
+ *  complete.
+ */
+static bool runWindow(uint32_t window)
+{
+    CANRpc_Stats startStats;
+    uint32_t callCnt = 0U;
+    uint32_t startTime;
+    uint32_t elapsedUsec;
+    uint32_t completedCnt;
+    uint32_t timeoutCnt;
+
+    CANRpc_setWindow(&rpc, window);
+
+    startStats = rpc.stats;
+    matchCnt   = 0U;
+    startTime  = now;
+
+    while ((callCnt < RPC_CALL_COUNT) || (CANRpc_getInFlight(&rpc) > 0U))
+    {
+        stepBus();
+        receiveResponses();
+
+        while ((callCnt < RPC_CALL_COUNT) && CANRpc_call(&rpc, rpcData, RPC_DATA_SIZE, doneFxn, NULL, now))
+        {
+            callCnt++;
+        }
+
+        CANRpc_process(&rpc, now);
+        now += STEP_TICKS;
+    }
+
+    elapsedUsec  = (now - startTime) / TICKS_PER_USEC;
+    completedCnt = rpc.stats.completedCnt - startStats.completedCnt;
+    timeoutCnt   = rpc.stats.timeoutCnt - startStats.timeoutCnt;
+
+    printf("{\"window\":%u,\"drop_every\":%u,\"calls\":%u,\"completed\":%u,\"matched\":%u,\"timeouts\":%u,"
+           "\"retries\":%u,\"unmatched\":%u,\"elapsed_us\":%u,\"calls_per_s\":%u}\n",
+           window,
+           dropInterval,
+           rpc.stats.callCnt - startStats.callCnt,
+           completedCnt,
+           matchCnt,
+           timeoutCnt,
+           rpc.stats.retryCnt - startStats.retryCnt,
+           rpc.stats.unmatchedCnt - startStats.unmatchedCnt,
+           elapsedUsec,
+           (uint32_t)(((uint64_t)completedCnt * 1000000U) / elapsedUsec));
+
+    return (completedCnt + timeoutCnt) == RPC_CALL_COUNT;
+}
+
+/*
+ *  ======== runSweep ========
+ *  Runs the windows 1 to CANRpc_PENDING_SIZE on a new link, like
+ *  runRpcBenchmark().
+ */
+static bool runSweep(uint32_t interval)
+{
+    CANRpc_Params params;
+    uint32_t window;
+    bool ok = true;
+
+    params.window            = 1U;
+    params.timeoutUs         = RPC_TIMEOUT_USEC;
+    params.maxRetries        = RPC_MAX_RETRIES;
+    params.binding.encodeFxn = CANRpc_encodeEcho;
+    params.binding.decodeFxn = CANRpc_decodeEcho;
+    params.binding.arg       = &echoConfig;
+    params.sendFxn           = sendFxn;
+    params.arg               = NULL;
+
+    CANRpc_init(&rpc, &params);
+
+    dropInterval = interval;
+    frameCnt     = 0U;
+
+    for (window = 1U; window <= CANRpc_PENDING_SIZE; window *= 2U)
+    {
+        ok = runWindow(window) && ok;
+    }
+
+    return ok;
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    uint32_t i;
+    bool ok;
+
+    echoConfig.id  = RPC_MSG_ID;
+    echoConfig.xtd = false;
+    echoConfig.fd  = false;
+
+    for (i = 0U; i < RPC_DATA_SIZE; i++)
+    {
+        rpcData[i] = (uint8_t)i;
+    }
+
+    ok = runSweep(0U);
+    ok = runSweep(DROP_INTERVAL) && ok;
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== capturedump.c ========
+ *  Converts a CAN frame capture of the canResponder example to a candump log
+ *  or to a pcap file, followed by the reader statistics on standard error:
+ *
+ *      capturedump [-p] [file]
+ *
+ *  The candump log is written to standard output, or the pcap file with -p.
+ *  The capture is read from standard input if no file is given, so the tool
+ *  can also read a serial port as it receives data.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "CaptureReader.h"
+
+/* Interface name of the candump log */
+#define INTERFACE "can0"
+
+/*
+ *  ======== writeCandump ========
+ *  CaptureReader_FrameFxn that writes the candump log line of the frame.
+ */
+static void writeCandump(void *arg, const CaptureReader_Frame *frame)
+{
+    char line[CaptureReader_CANDUMP_LINE_MAX];
+
+    (void)arg;
+
+    (void)CaptureReader_formatCandump(frame, INTERFACE, line, sizeof(line));
+    fputs(line, stdout);
+}
+
+/*
+ *  ======== writePcap ========
+ *  CaptureReader_FrameFxn that writes the pcap record of the frame.
+ */
+static void writePcap(void *arg, const CaptureReader_Frame *frame)
+{
+    uint8_t record[CaptureReader_PCAP_RECORD_MAX];
+
+    (void)arg;
+
+    fwrite(record, 1U, CaptureReader_encodePcap(frame, record), stdout);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    CaptureReader_Object reader;
+    uint8_t buffer[512];
+    size_t length;
+    FILE *file = stdin;
+    bool pcap  = false;
+    int arg    = 1;
+
+    if ((arg < argc) && (strcmp(argv[arg], "-p") == 0))
+    {
+        pcap = true;
+        arg++;
+    }
+
+    if ((argc - arg) > 1)
+    {
+        fprintf(stderr, "usage: %s [-p] [file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (arg < argc)
+    {
+        file = fopen(argv[arg], "rb");
+        if (file == NULL)
+        {
+            perror(argv[arg]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (pcap)
+    {
+        fwrite(buffer, 1U, CaptureReader_getPcapHeader(buffer), stdout);
+        CaptureReader_init(&reader, writePcap, NULL);
+    }
+    else
+    {
+        CaptureReader_init(&reader, writeCandump, NULL);
+    }
+
+    while ((length = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+    {
+        CaptureReader_receive(&reader, buffer, length);
+        fflush(stdout);
+    }
+
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+
+    fprintf(stderr,
+            "records %u, lost %u, bytes skipped %u, %u bytes after the last record\n",
+            reader.stats.recordCnt,
+            reader.stats.lostCnt,
+            reader.stats.skippedCnt,
+            (unsigned int)CaptureReader_getPending(&reader));
+
+    return EXIT_SUCCESS;
+}
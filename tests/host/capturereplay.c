@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== capturereplay.c ========
+ *  Replays a CAN frame capture into the canResponder or canTimeSync example
+ *  running as a node of the virtual CAN bus:
+ *
+ *      capturereplay [-v] responder|timesync [file]
+ *
+ *  The frames the device received in the capture are sent to the node at
+ *  their captured times, and all frames on the bus, including those the
+ *  node sends, are written to standard output as a candump log on the time
+ *  base of the capture. -v also prints the UART output of the node. The
+ *  capture is read from standard input if no file is given.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "CANCodec.h"
+#include "CaptureReader.h"
+#include "CaptureReplay.h"
+#include "VirtualCAN.h"
+
+/* Interface name of the candump log */
+#define INTERFACE "vcan0"
+
+/* Time to wait for the node to be ready */
+#define READY_TIMEOUT_MS 2000U
+
+/* Time from the start of the replay to the first frame */
+#define START_DELAY_NS 10000000ULL
+
+/* Time the node may respond after the last frame */
+#define END_DELAY_NS 500000000ULL
+
+/* Node that can be replayed into */
+typedef struct
+{
+    const char *name;
+    void *(*mainFxn)(void *arg0);
+    const char *readyText;
+} NodeType;
+
+/* Time base of the candump log */
+typedef struct
+{
+    uint64_t startNs;     /* Bus time of the first frame */
+    uint64_t captureTime; /* Capture time of the first frame, in ticks */
+} TimeBase;
+
+extern void *responder_mainThread(void *arg0);
+extern void *timeSync_mainThread(void *arg0);
+
+static const NodeType nodeTypes[] = {
+    {"responder", responder_mainThread, "CAN Responder ready."},
+    {"timesync", timeSync_mainThread, "CAN Time Sync ready."},
+};
+
+/*
+ *  ======== printFrame ========
+ *  VirtualCAN_MonitorFxn that writes the candump log line of a frame on the
+ *  bus.
+ */
+static void printFrame(const VirtualCAN_Frame *frame, void *arg)
+{
+    const TimeBase *timeBase = arg;
+    CaptureReader_Frame captured;
+    char line[CaptureReader_CANDUMP_LINE_MAX];
+    int64_t offsetNs;
+
+    memset(&captured, 0, sizeof(captured));
+
+    offsetNs      = (int64_t)(frame->sofTimeNs - timeBase->startNs);
+    captured.time = timeBase->captureTime + (uint64_t)(offsetNs / (int64_t)CaptureReader_NSEC_PER_TICK);
+
+    captured.record.id      = frame->elem.id;
+    captured.record.dlc     = frame->elem.dlc;
+    captured.record.flags   = (frame->elem.xtd ? CANCapture_FLAG_XTD : 0U) | (frame->elem.rtr ? CANCapture_FLAG_RTR : 0U) |
+                            (frame->elem.fdf ? CANCapture_FLAG_FDF : 0U) | (frame->elem.brs ? CANCapture_FLAG_BRS : 0U) |
+                            (frame->elem.esi ? CANCapture_FLAG_ESI : 0U);
+    captured.record.dataLen = frame->elem.rtr ? 0U : CANCodec_dlcToLength(frame->elem.dlc);
+    memcpy(captured.record.data, frame->elem.data, captured.record.dataLen);
+
+    (void)CaptureReader_formatCandump(&captured, INTERFACE, line, sizeof(line));
+    fputs(line, stdout);
+    fflush(stdout);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    const NodeType *nodeType = NULL;
+    CaptureReader_Object reader;
+    CaptureReplay_Object replay;
+    VirtualCAN_Node *node;
+    TimeBase timeBase;
+    struct timespec delay;
+    uint64_t endNs;
+    uint64_t now;
+    uint8_t buffer[512];
+    size_t length;
+    FILE *file = stdin;
+    int arg    = 1;
+    uint32_t i;
+
+    if ((arg < argc) && (strcmp(argv[arg], "-v") == 0))
+    {
+        VirtualCAN_trace = true;
+        arg++;
+    }
+
+    for (i = 0U; (arg < argc) && (i < (sizeof(nodeTypes) / sizeof(nodeTypes[0]))); i++)
+    {
+        if (strcmp(argv[arg], nodeTypes[i].name) == 0)
+        {
+            nodeType = &nodeTypes[i];
+        }
+    }
+
+    if ((nodeType == NULL) || ((argc - arg) > 2))
+    {
+        fprintf(stderr, "usage: %s [-v] responder|timesync [file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    arg++;
+
+    if (arg < argc)
+    {
+        file = fopen(argv[arg], "rb");
+        if (file == NULL)
+        {
+            perror(argv[arg]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    CaptureReplay_init(&replay);
+    CaptureReader_init(&reader, CaptureReplay_add, &replay);
+
+    while ((length = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+    {
+        CaptureReader_receive(&reader, buffer, length);
+    }
+
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+
+    if (replay.failedCnt > 0U)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    VirtualCAN_init(printFrame, &timeBase);
+
+    node = VirtualCAN_addNode(nodeType->name, nodeType->mainFxn, 0, 0U);
+    VirtualCAN_startNode(node);
+
+    if (!VirtualCAN_waitForOutput(node, nodeType->readyText, 1U, READY_TIMEOUT_MS))
+    {
+        fprintf(stderr, "%s not ready\n", nodeType->name);
+        return EXIT_FAILURE;
+    }
+
+    timeBase.startNs     = VirtualCAN_getTime() + START_DELAY_NS;
+    timeBase.captureTime = (replay.frameCnt > 0U) ? replay.frames[0].time : 0U;
+
+    CaptureReplay_run(&replay, timeBase.startNs);
+
+    /* Let the node respond to the last frames */
+    endNs = CaptureReplay_getEndTime(&replay, timeBase.startNs) + END_DELAY_NS;
+
+    while ((now = VirtualCAN_getTime()) < endNs)
+    {
+        delay.tv_sec  = (time_t)((endNs - now) / 1000000000ULL);
+        delay.tv_nsec = (long)((endNs - now) % 1000000000ULL);
+        nanosleep(&delay, NULL);
+    }
+
+    fprintf(stderr,
+            "records %u, lost %u, bytes skipped %u, frames replayed %u, frames of the device left out %u\n",
+            reader.stats.recordCnt,
+            reader.stats.lostCnt,
+            reader.stats.skippedCnt,
+            (unsigned int)replay.frameCnt,
+            (unsigned int)replay.txCnt);
+
+    CaptureReplay_free(&replay);
+
+    return EXIT_SUCCESS;
+}
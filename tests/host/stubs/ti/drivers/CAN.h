@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== CAN.h ========
+ *  Host stub of the CAN driver interface. Only holds the definitions the
+ *  examples use. The functions are defined by the checks that need them, or
+ *  by the virtual CAN bus for the example nodes.
+ */
+
+#ifndef ti_drivers_CAN__include
+#define ti_drivers_CAN__include
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CAN_STATUS_SUCCESS         ((int_fast16_t)0)
+#define CAN_STATUS_ERROR           ((int_fast16_t)-1)
+#define CAN_STATUS_NOT_SUPPORTED   ((int_fast16_t)-2)
+#define CAN_STATUS_TX_BUF_FULL     ((int_fast16_t)-3)
+#define CAN_STATUS_NO_RX_MSG_AVAIL ((int_fast16_t)-4)
+
+#define CAN_EVENT_RX_DATA_AVAIL       (1U << 0)
+#define CAN_EVENT_TX_FINISHED         (1U << 1)
+#define CAN_EVENT_TX_EVENT_AVAIL      (1U << 2)
+#define CAN_EVENT_TX_EVENT_LOST       (1U << 3)
+#define CAN_EVENT_BUS_ON              (1U << 4)
+#define CAN_EVENT_BUS_OFF             (1U << 5)
+#define CAN_EVENT_ERR_ACTIVE          (1U << 6)
+#define CAN_EVENT_ERR_PASSIVE         (1U << 7)
+#define CAN_EVENT_RX_FIFO_MSG_LOST    (1U << 8)
+#define CAN_EVENT_RX_RING_BUFFER_FULL (1U << 9)
+#define CAN_EVENT_BIT_ERR_UNCORRECTED (1U << 10)
+#define CAN_EVENT_SPI_XFER_ERROR      (1U << 11)
+
+#define CAN_DLC_0B  0U
+#define CAN_DLC_1B  1U
+#define CAN_DLC_2B  2U
+#define CAN_DLC_3B  3U
+#define CAN_DLC_4B  4U
+#define CAN_DLC_5B  5U
+#define CAN_DLC_6B  6U
+#define CAN_DLC_7B  7U
+#define CAN_DLC_8B  8U
+#define CAN_DLC_12B 9U
+#define CAN_DLC_16B 10U
+#define CAN_DLC_20B 11U
+#define CAN_DLC_24B 12U
+#define CAN_DLC_32B 13U
+#define CAN_DLC_48B 14U
+#define CAN_DLC_64B 15U
+
+#define CAN_MAX_DATA_LENGTH 64U
+
+typedef struct CAN_Config *CAN_Handle;
+
+/* Event callback, called in interrupt context */
+typedef void (*CAN_EventCbk)(CAN_Handle handle, uint32_t event, uint32_t data, void *userArg);
+
+/* MCAN standard ID acceptance filter */
+typedef struct
+{
+    uint32_t sfid2:11;
+    uint32_t rsvd:5;
+    uint32_t sfid1:11;
+    uint32_t sfec:3;
+    uint32_t sft:2;
+} MCAN_StdMsgIDFilterElement;
+
+/* MCAN extended ID acceptance filter */
+typedef struct
+{
+    uint32_t efid1:29;
+    uint32_t efec:3;
+    uint32_t efid2:29;
+    uint32_t rsvd:1;
+    uint32_t eft:2;
+} MCAN_ExtMsgIDFilterElement;
+
+/* Message RAM configuration */
+typedef struct
+{
+    const MCAN_StdMsgIDFilterElement *stdMsgIDFilterList;
+    const MCAN_ExtMsgIDFilterElement *extMsgIDFilterList;
+    uint32_t stdFilterNum;
+    uint32_t extFilterNum;
+    uint32_t rxFIFONum[2];
+    uint32_t rxBufNum;
+    uint32_t txBufNum;
+    uint32_t txFIFOQNum;
+    uint32_t txFIFOQMode;
+    uint32_t txEventFIFONum;
+} CAN_MsgRAMConfig;
+
+/* Nominal and data phase bit timing */
+typedef struct
+{
+    uint32_t nomRatePrescaler;
+    uint32_t nomTimeSeg1;
+    uint32_t nomTimeSeg2;
+    uint32_t nomSynchJumpWidth;
+    uint32_t dataRatePrescaler;
+    uint32_t dataTimeSeg1;
+    uint32_t dataTimeSeg2;
+    uint32_t dataSynchJumpWidth;
+    uint32_t tdcEnable;
+} CAN_BitTimingParams;
+
+/* Received frame */
+typedef struct
+{
+    uint32_t id:29;
+    uint32_t rtr:1;
+    uint32_t xtd:1;
+    uint32_t esi:1;
+    uint32_t rxts:16;
+    uint32_t dlc:4;
+    uint32_t brs:1;
+    uint32_t fdf:1;
+    uint32_t rsvd:2;
+    uint32_t fidx:7;
+    uint32_t anmf:1;
+    uint8_t data[CAN_MAX_DATA_LENGTH];
+} CAN_RxBufElement;
+
+/* Frame to transmit */
+typedef struct
+{
+    uint32_t id:29;
+    uint32_t rtr:1;
+    uint32_t xtd:1;
+    uint32_t esi:1;
+    uint32_t rsvd1:16;
+    uint32_t dlc:4;
+    uint32_t brs:1;
+    uint32_t fdf:1;
+    uint32_t rsvd2:1;
+    uint32_t efc:1;
+    uint32_t mm:8;
+    uint8_t data[CAN_MAX_DATA_LENGTH];
+} CAN_TxBufElement;
+
+/* Tx Event of a transmitted frame */
+typedef struct
+{
+    uint32_t id:29;
+    uint32_t rtr:1;
+    uint32_t xtd:1;
+    uint32_t esi:1;
+    uint32_t txts:16;
+    uint32_t dlc:4;
+    uint32_t brs:1;
+    uint32_t fdf:1;
+    uint32_t et:2;
+    uint32_t mm:8;
+} CAN_TxEventElement;
+
+/* Driver parameters */
+typedef struct
+{
+    const CAN_MsgRAMConfig *msgRAMConfig;
+    const CAN_BitTimingParams *bitTiming;
+    CAN_EventCbk eventCbk;
+    uint32_t eventMask;
+    void *userArg;
+    uint32_t tsPrescaler;
+} CAN_Params;
+
+extern void CAN_Params_init(CAN_Params *params);
+extern CAN_Handle CAN_open(uint_least8_t index, CAN_Params *params);
+extern void CAN_close(CAN_Handle handle);
+extern int_fast16_t CAN_read(CAN_Handle handle, CAN_RxBufElement *elem);
+extern int_fast16_t CAN_write(CAN_Handle handle, const CAN_TxBufElement *elem);
+extern int_fast16_t CAN_readTxEvent(CAN_Handle handle, CAN_TxEventElement *elem);
+extern int_fast16_t CAN_getBitTiming(CAN_Handle handle, CAN_BitTimingParams *bitTiming, uint32_t *clkFreqKhz);
+extern uint16_t MCAN_getTimestampCounter(void);
+extern uint16_t DCAN_getTimestampCounter(void);
+
+#endif /* ti_drivers_CAN__include */
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== SHA2.h ========
+ *  Host stub of the SHA2 driver interface. Only holds the definitions the
+ *  examples use. The functions are defined by the checks that need them.
+ */
+
+#ifndef ti_drivers_SHA2__include
+#define ti_drivers_SHA2__include
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA2_STATUS_SUCCESS ((int_fast16_t)0)
+#define SHA2_STATUS_ERROR   ((int_fast16_t)-1)
+
+#define SHA2_DIGEST_LENGTH_BYTES_256 32
+
+typedef struct SHA2_Config_ *SHA2_Handle;
+
+typedef struct SHA2_Params_ SHA2_Params;
+
+extern void SHA2_init(void);
+extern SHA2_Handle SHA2_open(uint_least8_t index, const SHA2_Params *params);
+extern void SHA2_reset(SHA2_Handle handle);
+extern int_fast16_t SHA2_addData(SHA2_Handle handle, const void *data, size_t length);
+extern int_fast16_t SHA2_finalize(SHA2_Handle handle, void *digest);
+extern int_fast16_t SHA2_hashData(SHA2_Handle handle, const void *data, size_t length, void *digest);
+
+#endif /* ti_drivers_SHA2__include */
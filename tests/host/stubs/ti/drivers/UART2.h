@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== UART2.h ========
+ *  Host stub of the UART2 driver interface. Only holds the definitions the
+ *  examples use. The functions are defined by the checks that need them.
+ */
+
+#ifndef ti_drivers_UART2__include
+#define ti_drivers_UART2__include
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define UART2_STATUS_SUCCESS    ((int_fast16_t)0)
+#define UART2_STATUS_EOVERRUN   ((int_fast16_t)-4)
+#define UART2_STATUS_ECANCELLED ((int_fast16_t)-8)
+
+typedef struct UART2_Config_ *UART2_Handle;
+
+typedef enum
+{
+    UART2_Mode_BLOCKING,
+    UART2_Mode_CALLBACK,
+    UART2_Mode_NONBLOCKING
+} UART2_Mode;
+
+typedef enum
+{
+    UART2_ReadReturnMode_FULL,
+    UART2_ReadReturnMode_PARTIAL
+} UART2_ReadReturnMode;
+
+typedef void (*UART2_Callback)(UART2_Handle handle, void *buf, size_t count, void *userArg, int_fast16_t status);
+
+typedef struct
+{
+    UART2_Mode readMode;
+    UART2_Mode writeMode;
+    UART2_Callback readCallback;
+    UART2_Callback writeCallback;
+    UART2_ReadReturnMode readReturnMode;
+    uint32_t baudRate;
+    void *userArg;
+} UART2_Params;
+
+extern void UART2_Params_init(UART2_Params *params);
+extern UART2_Handle UART2_open(uint_least8_t index, UART2_Params *params);
+extern int_fast16_t UART2_read(UART2_Handle handle, void *buffer, size_t size, size_t *bytesRead);
+extern int_fast16_t UART2_write(UART2_Handle handle, const void *buffer, size_t size, size_t *bytesWritten);
+
+#endif /* ti_drivers_UART2__include */
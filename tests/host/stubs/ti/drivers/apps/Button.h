@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== Button.h ========
+ *  Host stub of the Button interface. Only holds the definitions the examples
+ *  use. The functions are defined by the virtual CAN bus for the example
+ *  nodes.
+ */
+
+#ifndef ti_drivers_apps_Button__include
+#define ti_drivers_apps_Button__include
+
+#include <stdint.h>
+
+#define Button_EV_CLICKED 0x10U
+
+typedef uint32_t Button_EventMask;
+
+typedef struct
+{
+    uint_least8_t gpioIndex;
+    uint32_t internalPullEnabled;
+} Button_HWAttrs;
+
+typedef struct
+{
+    void *object;
+    const void *hwAttrs;
+} Button_Config;
+
+typedef Button_Config *Button_Handle;
+
+typedef void (*Button_Callback)(Button_Handle buttonHandle, Button_EventMask buttonEvents);
+
+typedef struct
+{
+    uint32_t debounceDuration;
+    uint32_t longPressDuration;
+    uint32_t doublePressDetectiontimeout;
+    Button_EventMask buttonEventMask;
+    Button_Callback buttonCallback;
+} Button_Params;
+
+extern void Button_Params_init(Button_Params *params);
+extern Button_Handle Button_open(uint_least8_t buttonIndex, Button_Params *params);
+
+#endif /* ti_drivers_apps_Button__include */
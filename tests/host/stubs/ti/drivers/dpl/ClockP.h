@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== ClockP.h ========
+ *  Host stub of the clock interface. Clock functions are never called.
+ */
+
+#ifndef ti_dpl_ClockP__include
+#define ti_dpl_ClockP__include
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t reserved;
+} ClockP_Struct;
+
+typedef ClockP_Struct *ClockP_Handle;
+
+typedef void (*ClockP_Fxn)(uintptr_t arg);
+
+typedef struct
+{
+    bool startFlag;
+    uint32_t period;
+    uintptr_t arg;
+} ClockP_Params;
+
+static inline void ClockP_Params_init(ClockP_Params *params)
+{
+    params->startFlag = false;
+    params->period    = 0U;
+    params->arg       = 0U;
+}
+
+static inline ClockP_Handle ClockP_construct(ClockP_Struct *clockP,
+                                             ClockP_Fxn clockFxn,
+                                             uint32_t timeout,
+                                             ClockP_Params *params)
+{
+    (void)clockFxn;
+    (void)timeout;
+    (void)params;
+
+    return clockP;
+}
+
+/* System tick period in microseconds */
+static inline uint32_t ClockP_getSystemTickPeriod(void)
+{
+    return 1000U;
+}
+
+#endif /* ti_dpl_ClockP__include */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== telemetrydump.c ========
+ *  Prints the records of a telemetry stream captured from the canInitiator
+ *  UART in telemetry mode, one line per record, followed by the decoder
+ *  statistics:
+ *
+ *      telemetrydump [file]
+ *
+ *  The stream is read from standard input if no file is given, so the tool
+ *  can also read a serial port as it receives data.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "TelemetryDecoder.h"
+
+/*
+ *  ======== getUint16 ========
+ */
+static uint32_t getUint16(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8);
+}
+
+/*
+ *  ======== getUint32 ========
+ */
+static uint32_t getUint32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/*
+ *  ======== printRecord ========
+ *  TelemetryDecoder_RecordFxn that prints the record in the layout of its
+ *  type.
+ */
+static void printRecord(void *arg, const TelemetryDecoder_Record *record)
+{
+    size_t i;
+
+    (void)arg;
+
+    printf("%5u id %3u ", record->seq, record->id);
+
+    switch (record->type)
+    {
+        case Telemetry_TYPE_TEXT:
+            printf("text \"%.*s\"\n", (int)record->length, (const char *)record->payload);
+            break;
+
+        case Telemetry_TYPE_COUNTERS:
+            printf("counters");
+            for (i = 0U; (i + 4U) <= record->length; i += 4U)
+            {
+                printf(" %u", getUint32(&record->payload[i]));
+            }
+            printf("\n");
+            break;
+
+        case Telemetry_TYPE_HISTOGRAM:
+            if (record->length < 8U)
+            {
+                printf("histogram, short payload\n");
+                break;
+            }
+
+            printf("histogram bins %u-%u of %u, width %u:",
+                   getUint16(&record->payload[0]),
+                   getUint16(&record->payload[0]) + (uint32_t)((record->length - 8U) / 4U) - 1U,
+                   getUint16(&record->payload[2]),
+                   getUint32(&record->payload[4]));
+            for (i = 8U; (i + 4U) <= record->length; i += 4U)
+            {
+                printf(" %u", getUint32(&record->payload[i]));
+            }
+            printf("\n");
+            break;
+
+        case Telemetry_TYPE_SAMPLE:
+            if (record->length < 4U)
+            {
+                printf("sample, short payload\n");
+                break;
+            }
+
+            printf("sample time %u:", getUint32(&record->payload[0]));
+            for (i = 4U; (i + 4U) <= record->length; i += 4U)
+            {
+                printf(" %d", (int32_t)getUint32(&record->payload[i]));
+            }
+            printf("\n");
+            break;
+
+        default:
+            printf("type %u, %u bytes\n", record->type, (unsigned int)record->length);
+            break;
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    TelemetryDecoder_Object decoder;
+    uint8_t buffer[512];
+    size_t length;
+    FILE *file = stdin;
+
+    if (argc > 2)
+    {
+        fprintf(stderr, "usage: %s [file]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (argc == 2)
+    {
+        file = fopen(argv[1], "rb");
+        if (file == NULL)
+        {
+            perror(argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    TelemetryDecoder_init(&decoder, printRecord, NULL);
+
+    while ((length = fread(buffer, 1U, sizeof(buffer), file)) > 0U)
+    {
+        TelemetryDecoder_receive(&decoder, buffer, length);
+        fflush(stdout);
+    }
+
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+
+    fprintf(stderr,
+            "records %u, lost %u, bad frames %u, restarts %u, %u bytes after the last frame\n",
+            decoder.stats.recordCnt,
+            decoder.stats.lostCnt,
+            decoder.stats.badFrameCnt,
+            decoder.stats.restartCnt,
+            (unsigned int)TelemetryDecoder_getPending(&decoder));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANBenchmark.c ========
+ *  Host checks of the CAN benchmark bookkeeping: payload encoding, the request
+ *  window, loss, reorder and duplicate accounting, latency percentiles and
+ *  the result line.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "CANBenchmark.h"
+#include "HostTest.h"
+
+/* Start time close to the wrap of the 32-bit time */
+#define START_TIME 0xFFFFF000U
+
+/* Ticks per microsecond */
+#define TICKS CANBenchmark_TICKS_PER_USEC
+
+/*
+ *  ======== startBenchmark ========
+ */
+static void startBenchmark(uint32_t frameCount, uint32_t window, uint32_t timeout)
+{
+    CANBenchmark_Params params;
+
+    params.frameCount  = frameCount;
+    params.window      = window;
+    params.payloadSize = 64U;
+    params.timeout     = timeout;
+
+    CANBenchmark_start(&params, START_TIME);
+}
+
+/*
+ *  ======== sendNext ========
+ *  Sends the next request at time now and returns its sequence number.
+ */
+static uint32_t sendNext(uint32_t now)
+{
+    uint32_t seq = 0xFFFFFFFFU;
+
+    HostTest_check(CANBenchmark_nextRequest(&seq));
+    CANBenchmark_requestSent(seq, now);
+
+    return seq;
+}
+
+/*
+ *  ======== checkEncoding ========
+ */
+static void checkEncoding(void)
+{
+    uint8_t data[64];
+    uint32_t seq;
+    uint32_t sendTime;
+    uint32_t i;
+
+    memset(data, 0xAA, sizeof(data));
+    CANBenchmark_encode(data, sizeof(data), 0x12345678U, 0xCAFEF00DU);
+    CANBenchmark_decode(data, &seq, &sendTime);
+
+    HostTest_checkEqual(seq, 0x12345678U);
+    HostTest_checkEqual(sendTime, 0xCAFEF00DU);
+    HostTest_checkEqual(data[0], 0x78U);
+    HostTest_checkEqual(data[7], 0xCAU);
+
+    for (i = CANBenchmark_PAYLOAD_MIN; i < sizeof(data); i++)
+    {
+        HostTest_checkEqual(data[i], i);
+    }
+}
+
+/*
+ *  ======== checkWindow ========
+ *  No more requests than the window are outstanding, and a failed request is
+ *  sent again.
+ */
+static void checkWindow(void)
+{
+    uint32_t seq;
+    uint32_t i;
+
+    startBenchmark(6U, 4U, 1000U * TICKS);
+
+    for (i = 0U; i < 4U; i++)
+    {
+        HostTest_checkEqual(sendNext(START_TIME), i);
+    }
+
+    HostTest_check(!CANBenchmark_nextRequest(&seq));
+
+    /* Answering the oldest request frees its slot */
+    CANBenchmark_responseReceived(0U, START_TIME, START_TIME + (100U * TICKS));
+    HostTest_check(CANBenchmark_nextRequest(&seq));
+    HostTest_checkEqual(seq, 4U);
+
+    /* A failed transmission returns the same sequence number */
+    CANBenchmark_requestSent(seq, START_TIME);
+    CANBenchmark_requestFailed(seq);
+    HostTest_check(CANBenchmark_nextRequest(&seq));
+    HostTest_checkEqual(seq, 4U);
+
+    /* All sent requests are answered, except the one that failed to send */
+    for (i = 1U; i < 4U; i++)
+    {
+        CANBenchmark_responseReceived(i, START_TIME, START_TIME + (100U * TICKS));
+    }
+
+    HostTest_check(!CANBenchmark_isDone());
+    (void)sendNext(START_TIME);
+    (void)sendNext(START_TIME);
+    HostTest_check(!CANBenchmark_nextRequest(&seq));
+    CANBenchmark_responseReceived(4U, START_TIME, START_TIME + (100U * TICKS));
+    CANBenchmark_responseReceived(5U, START_TIME, START_TIME + (100U * TICKS));
+    HostTest_check(CANBenchmark_isDone());
+}
+
+/*
+ *  ======== checkAccounting ========
+ *  Lost, reordered and unexpected responses.
+ */
+static void checkAccounting(void)
+{
+    CANBenchmark_Result result;
+    uint32_t timeout = 1000U * TICKS;
+
+    startBenchmark(4U, 4U, timeout);
+
+    (void)sendNext(START_TIME);
+    (void)sendNext(START_TIME);
+    (void)sendNext(START_TIME);
+    (void)sendNext(START_TIME);
+
+    /* Request 1 is answered after request 2 */
+    CANBenchmark_responseReceived(2U, START_TIME, START_TIME + (200U * TICKS));
+    CANBenchmark_responseReceived(1U, START_TIME, START_TIME + (300U * TICKS));
+
+    /* A duplicate, and a response to a request that was never sent */
+    CANBenchmark_responseReceived(2U, START_TIME, START_TIME + (300U * TICKS));
+    CANBenchmark_responseReceived(9U, START_TIME, START_TIME + (300U * TICKS));
+
+    /* Requests 0 and 3 time out, only 3 is answered later */
+    CANBenchmark_expire(START_TIME + timeout);
+    HostTest_check(!CANBenchmark_isDone());
+    CANBenchmark_expire(START_TIME + timeout + 1U);
+    HostTest_check(CANBenchmark_isDone());
+    CANBenchmark_responseReceived(3U, START_TIME, START_TIME + timeout + (10U * TICKS));
+
+    CANBenchmark_getResult(&result);
+    HostTest_checkEqual(result.sent, 4U);
+    HostTest_checkEqual(result.received, 2U);
+    HostTest_checkEqual(result.lost, 2U);
+    HostTest_checkEqual(result.reordered, 1U);
+    HostTest_checkEqual(result.unexpected, 3U);
+    HostTest_checkEqual(result.latencyMaxUsec, 300U);
+    HostTest_checkEqual(result.elapsedUsec, 300U);
+}
+
+/*
+ *  ======== checkLatency ========
+ *  Percentiles at bin resolution, the overflow bin, and the throughput.
+ */
+static void checkLatency(void)
+{
+    CANBenchmark_Result result;
+    const uint32_t *histogram;
+    uint32_t sendTime;
+    uint32_t seq;
+    uint32_t i;
+    char line[512];
+    int length;
+
+    startBenchmark(100U, 1U, 1000000U * TICKS);
+
+    /* Round-trip latencies of 10us to 1000us, one request every 1000us */
+    for (i = 1U; i <= 100U; i++)
+    {
+        sendTime = START_TIME + ((i - 1U) * 1000U * TICKS);
+        seq      = sendNext(sendTime);
+        CANBenchmark_responseReceived(seq, sendTime, sendTime + (i * 10U * TICKS));
+    }
+
+    CANBenchmark_getResult(&result);
+    HostTest_checkEqual(result.received, 100U);
+    HostTest_checkEqual(result.latencyP50Usec, 525U);
+    HostTest_checkEqual(result.latencyP99Usec, 1000U);
+    HostTest_checkEqual(result.latencyMaxUsec, 1000U);
+    HostTest_checkEqual(result.elapsedUsec, 100000U);
+    HostTest_checkEqual(result.framesPerSec, 1000U);
+    HostTest_checkEqual(result.payloadBitsPerSec, 1000U * 64U * 8U);
+
+    length = CANBenchmark_formatResult(&result, line, sizeof(line));
+    HostTest_checkEqual(length, strlen(line));
+    HostTest_check(strstr(line, "\"received\":100,") != NULL);
+    HostTest_check(strstr(line, "\"rtt_p50_us\":525,") != NULL);
+    HostTest_check(strcmp(&line[length - 3], "}\r\n") == 0);
+
+    /* Latencies beyond the histogram land in the last bin */
+    startBenchmark(2U, 1U, 1000000U * TICKS);
+    seq = sendNext(START_TIME);
+    CANBenchmark_responseReceived(seq, START_TIME, START_TIME + (50000U * TICKS));
+    seq = sendNext(START_TIME);
+    CANBenchmark_responseReceived(seq, START_TIME, START_TIME + (60000U * TICKS));
+
+    histogram = CANBenchmark_getHistogram();
+    HostTest_checkEqual(histogram[CANBenchmark_HIST_BINS - 1U], 2U);
+
+    CANBenchmark_getResult(&result);
+    HostTest_checkEqual(result.latencyP50Usec, 60000U);
+    HostTest_checkEqual(result.latencyMaxUsec, 60000U);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkEncoding();
+    checkWindow();
+    checkAccounting();
+    checkLatency();
+
+    return HostTest_exit("CANBenchmark");
+}
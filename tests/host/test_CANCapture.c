@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANCapture.c ========
+ *  Host checks of the binary CAN frame capture: records read back through
+ *  the ring match the frames stored, refused and overwritten records are
+ *  flagged, and a reader resynchronizes after corrupted bytes.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCapture.h"
+#include "CANCodec.h"
+#include "HostTest.h"
+
+/* Frames stored by the checks */
+#define FRAME_COUNT 2000U
+
+/* Bytes read back from the ring by a check */
+#define STREAM_SIZE (FRAME_COUNT * CANCapture_MAX_RECORD_SIZE)
+
+static CANCapture_Object capture;
+static uint8_t stream[STREAM_SIZE];
+static size_t streamSize;
+static uint32_t randomState = 1U;
+
+/*
+ *  ======== nextRandom ========
+ */
+static uint32_t nextRandom(void)
+{
+    randomState = (randomState * 1103515245U) + 12345U;
+
+    return randomState >> 8;
+}
+
+/*
+ *  ======== makeFrame ========
+ *  Returns frame n of a sequence covering all DLCs and flags. The ID and the
+ *  time identify the frame.
+ */
+static void makeFrame(uint32_t n, CAN_RxBufElement *elem)
+{
+    uint32_t i;
+
+    memset(elem, 0, sizeof(*elem));
+
+    elem->xtd = ((n % 3U) == 0U) ? 1U : 0U;
+    elem->id  = (elem->xtd != 0U) ? (0x10000000U | n) : (n & 0x7FFU);
+    elem->dlc = n % CANCodec_DLC_COUNT;
+    elem->fdf = (elem->dlc > CAN_DLC_8B) ? 1U : 0U;
+    elem->brs = elem->fdf & (n >> 4);
+    elem->esi = ((n % 7U) == 0U) ? 1U : 0U;
+    elem->rtr = ((elem->fdf == 0U) && ((n % 11U) == 0U)) ? 1U : 0U;
+
+    for (i = 0U; i < CANCodec_dlcToLength(elem->dlc); i++)
+    {
+        elem->data[i] = (uint8_t)(n + (i * 13U));
+    }
+}
+
+/*
+ *  ======== storeFrame ========
+ */
+static bool storeFrame(uint32_t n)
+{
+    CAN_RxBufElement rxElem;
+    CAN_TxBufElement txElem;
+
+    makeFrame(n, &rxElem);
+
+    if ((n & 1U) == 0U)
+    {
+        return CANCapture_rxFrame(&capture, &rxElem, n * 1000U);
+    }
+
+    memset(&txElem, 0, sizeof(txElem));
+    txElem.id  = rxElem.id;
+    txElem.xtd = rxElem.xtd;
+    txElem.rtr = rxElem.rtr;
+    txElem.esi = rxElem.esi;
+    txElem.dlc = rxElem.dlc;
+    txElem.fdf = rxElem.fdf;
+    txElem.brs = rxElem.brs;
+    memcpy(txElem.data, rxElem.data, sizeof(txElem.data));
+
+    return CANCapture_txFrame(&capture, &txElem, n * 1000U);
+}
+
+/*
+ *  ======== checkRecord ========
+ *  Returns true if record holds frame n.
+ */
+static bool checkRecord(const CANCapture_Record *record, uint32_t n)
+{
+    CAN_RxBufElement elem;
+    uint8_t flags;
+
+    makeFrame(n, &elem);
+
+    flags = (uint8_t)(((elem.xtd != 0U) ? CANCapture_FLAG_XTD : 0U) | ((elem.rtr != 0U) ? CANCapture_FLAG_RTR : 0U) |
+                      ((elem.fdf != 0U) ? CANCapture_FLAG_FDF : 0U) | ((elem.brs != 0U) ? CANCapture_FLAG_BRS : 0U) |
+                      ((elem.esi != 0U) ? CANCapture_FLAG_ESI : 0U) | (((n & 1U) != 0U) ? CANCapture_FLAG_TX : 0U));
+
+    return (record->id == elem.id) && (record->time == (n * 1000U)) && (record->dlc == elem.dlc) &&
+           ((record->flags & (uint8_t)~CANCapture_FLAG_LOST) == flags) &&
+           (record->dataLen == ((elem.rtr != 0U) ? 0U : CANCodec_dlcToLength(elem.dlc))) &&
+           (memcmp(record->data, elem.data, record->dataLen) == 0);
+}
+
+/*
+ *  ======== drain ========
+ *  Appends up to limit bytes of the ring to the stream, in the contiguous
+ *  parts returned by CANCapture_peek().
+ */
+static void drain(size_t limit)
+{
+    const uint8_t *data;
+    size_t count;
+
+    while (limit > 0U)
+    {
+        count = CANCapture_peek(&capture, &data);
+        if (count == 0U)
+        {
+            break;
+        }
+
+        if (count > limit)
+        {
+            count = limit;
+        }
+
+        memcpy(&stream[streamSize], data, count);
+        streamSize += count;
+        limit      -= count;
+        CANCapture_consume(&capture, count);
+    }
+}
+
+/*
+ *  ======== decodeStream ========
+ *  Decodes the records of the stream, skipping bytes that do not start a
+ *  valid record, and checks each record against the frame its time
+ *  identifies. Returns the number of records. The first frame, the number of
+ *  records flagged as lost, of gaps in the frame sequence and of bytes
+ *  skipped are returned through the pointers.
+ */
+static uint32_t decodeStream(uint32_t *first, uint32_t *lostCnt, uint32_t *gapCnt, uint32_t *skipCnt)
+{
+    CANCapture_Record record;
+    int_fast16_t status;
+    size_t pos     = 0U;
+    uint32_t count = 0U;
+    uint32_t n;
+    uint32_t next = 0U;
+
+    *lostCnt = 0U;
+    *gapCnt  = 0U;
+    *skipCnt = 0U;
+
+    while (pos < streamSize)
+    {
+        status = CANCapture_decode(&stream[pos], streamSize - pos, &record);
+
+        if (status == CANCapture_INCOMPLETE)
+        {
+            break;
+        }
+
+        if (status == CANCapture_INVALID)
+        {
+            pos++;
+            (*skipCnt)++;
+            continue;
+        }
+
+        n = record.time / 1000U;
+
+        if (count == 0U)
+        {
+            *first = n;
+        }
+        else if (n != next)
+        {
+            HostTest_check(n > next);
+            (*gapCnt)++;
+        }
+
+        if ((record.flags & CANCapture_FLAG_LOST) != 0U)
+        {
+            (*lostCnt)++;
+        }
+
+        HostTest_check(checkRecord(&record, n));
+
+        pos += (size_t)status;
+        next = n + 1U;
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ *  ======== checkDrained ========
+ *  Frames stored while the ring is drained in uneven parts.
+ */
+static void checkDrained(void)
+{
+    uint32_t first;
+    uint32_t lostCnt;
+    uint32_t gapCnt;
+    uint32_t skipCnt;
+    uint32_t n;
+
+    CANCapture_init(&capture, false);
+    streamSize = 0U;
+
+    for (n = 0U; n < FRAME_COUNT; n++)
+    {
+        HostTest_check(storeFrame(n));
+        drain(nextRandom() % 80U);
+    }
+
+    drain(STREAM_SIZE);
+
+    HostTest_checkEqual(CANCapture_getCount(&capture), 0U);
+    HostTest_checkEqual(decodeStream(&first, &lostCnt, &gapCnt, &skipCnt), FRAME_COUNT);
+    HostTest_checkEqual(first, 0U);
+    HostTest_checkEqual(lostCnt, 0U);
+    HostTest_checkEqual(gapCnt, 0U);
+    HostTest_checkEqual(skipCnt, 0U);
+    HostTest_checkEqual(capture.stats.recordCnt, FRAME_COUNT);
+    HostTest_checkEqual(capture.stats.lostCnt, 0U);
+}
+
+/*
+ *  ======== checkRefused ========
+ *  A full ring refuses records, and the next record stored is flagged.
+ */
+static void checkRefused(void)
+{
+    uint32_t first;
+    uint32_t lostCnt;
+    uint32_t gapCnt;
+    uint32_t skipCnt;
+    uint32_t stored = 0U;
+    uint32_t n;
+
+    CANCapture_init(&capture, false);
+    streamSize = 0U;
+
+    for (n = 0U; n < 200U; n++)
+    {
+        if (storeFrame(n))
+        {
+            stored++;
+        }
+    }
+
+    HostTest_check(stored < 200U);
+    HostTest_checkEqual(capture.stats.lostCnt, 200U - stored);
+    HostTest_check(capture.stats.highWaterMark > (CANCapture_RING_SIZE - CANCapture_MAX_RECORD_SIZE));
+
+    drain(STREAM_SIZE);
+    HostTest_check(storeFrame(500U));
+    drain(STREAM_SIZE);
+
+    HostTest_checkEqual(decodeStream(&first, &lostCnt, &gapCnt, &skipCnt), stored + 1U);
+    HostTest_checkEqual(first, 0U);
+    HostTest_checkEqual(lostCnt, 1U);
+    HostTest_checkEqual(gapCnt, 1U);
+}
+
+/*
+ *  ======== checkFlightRecorder ========
+ *  A flight recorder keeps a run of the most recent records.
+ */
+static void checkFlightRecorder(void)
+{
+    uint32_t first;
+    uint32_t lostCnt;
+    uint32_t gapCnt;
+    uint32_t skipCnt;
+    uint32_t count;
+    uint32_t n;
+
+    CANCapture_init(&capture, true);
+    streamSize = 0U;
+
+    for (n = 0U; n < FRAME_COUNT; n++)
+    {
+        HostTest_check(storeFrame(n));
+    }
+
+    HostTest_check(CANCapture_getCount(&capture) <= CANCapture_RING_SIZE);
+    drain(STREAM_SIZE);
+
+    count = decodeStream(&first, &lostCnt, &gapCnt, &skipCnt);
+    HostTest_checkEqual(skipCnt, 0U);
+    HostTest_checkEqual(gapCnt, 0U);
+    HostTest_check(count < FRAME_COUNT);
+    HostTest_checkEqual(first + count, FRAME_COUNT);
+    HostTest_checkEqual(capture.stats.lostCnt, first);
+
+    /* Each record stored after overwriting older ones is flagged */
+    HostTest_check(lostCnt != 0U);
+}
+
+/*
+ *  ======== checkResync ========
+ *  Corrupted and truncated records, and garbage between records.
+ */
+static void checkResync(void)
+{
+    static const uint8_t garbage[] = {CANCapture_SYNC, 0x00U, 0x01U, CANCapture_SYNC, 0xFFU, 0x10U};
+    CANCapture_Record record;
+    uint32_t first;
+    uint32_t lostCnt;
+    uint32_t gapCnt;
+    uint32_t skipCnt;
+    uint32_t n;
+    size_t size;
+
+    CANCapture_init(&capture, false);
+    streamSize = 0U;
+
+    memcpy(stream, garbage, sizeof(garbage));
+    streamSize = sizeof(garbage);
+
+    for (n = 0U; n < 20U; n++)
+    {
+        (void)storeFrame(n);
+        drain(STREAM_SIZE);
+    }
+
+    /* Partial records are incomplete, not invalid */
+    size = (size_t)CANCapture_decode(&stream[sizeof(garbage)], streamSize, &record);
+    for (n = 0U; n < size; n++)
+    {
+        HostTest_checkEqual(CANCapture_decode(&stream[sizeof(garbage)], n, &record), CANCapture_INCOMPLETE);
+    }
+
+    /* A flipped payload bit and a flipped header bit each lose one record */
+    stream[sizeof(garbage) + size + CANCapture_HEADER_SIZE] ^= 0x01U;
+    stream[streamSize - 40U] ^= 0x80U;
+
+    HostTest_checkEqual(decodeStream(&first, &lostCnt, &gapCnt, &skipCnt) + 2U, 20U);
+    HostTest_checkEqual(first, 0U);
+    HostTest_checkEqual(gapCnt, 2U);
+    HostTest_checkEqual(lostCnt, 0U);
+    HostTest_check(skipCnt >= sizeof(garbage));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkDrained();
+    checkRefused();
+    checkFlightRecorder();
+    checkResync();
+
+    return HostTest_exit("CANCapture");
+}
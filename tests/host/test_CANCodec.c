@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANCodec.c ========
+ *  Host checks of the CAN frame encoding helpers. The text output is compared
+ *  with the output of the C library formatting functions.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCodec.h"
+#include "HostTest.h"
+
+/* Text buffer size */
+#define TEXT_SIZE 512U
+
+/*
+ *  ======== checkDlc ========
+ */
+static void checkDlc(void)
+{
+    static const uint32_t lengths[CANCodec_DLC_COUNT] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24, 32, 48, 64};
+    uint32_t length;
+    uint32_t dlc;
+
+    for (dlc = 0U; dlc < CANCodec_DLC_COUNT; dlc++)
+    {
+        HostTest_checkEqual(CANCodec_dlcToLength(dlc), lengths[dlc]);
+        HostTest_checkEqual(CANCodec_lengthToDlc(lengths[dlc]), dlc);
+    }
+
+    HostTest_checkEqual(CANCodec_dlcToLength(CANCodec_DLC_COUNT), 0U);
+
+    /* Each length maps to the smallest code that holds it */
+    for (length = 0U; length <= (CANCodec_MAX_DATA_LENGTH + 8U); length++)
+    {
+        dlc = CANCodec_lengthToDlc(length);
+
+        if (length <= CANCodec_MAX_DATA_LENGTH)
+        {
+            HostTest_check(CANCodec_dlcToLength(dlc) >= length);
+            HostTest_check((dlc == 0U) || (CANCodec_dlcToLength(dlc - 1U) < length));
+        }
+        else
+        {
+            HostTest_checkEqual(dlc, CANCodec_DLC_COUNT - 1U);
+        }
+    }
+}
+
+/*
+ *  ======== checkInverted ========
+ *  Every mismatch position at every alignment of both payloads.
+ */
+static void checkInverted(void)
+{
+    uint8_t ref[CANCodec_MAX_DATA_LENGTH + 4U];
+    uint8_t data[CANCodec_MAX_DATA_LENGTH + 4U];
+    uint32_t length;
+    uint32_t align;
+    uint32_t i;
+    uint32_t errorCnt = 0U;
+
+    for (i = 0U; i < sizeof(ref); i++)
+    {
+        ref[i] = (uint8_t)((i * 37U) + 11U);
+    }
+
+    for (align = 0U; align < 4U; align++)
+    {
+        for (length = 0U; length <= CANCodec_MAX_DATA_LENGTH; length++)
+        {
+            memset(data, 0, sizeof(data));
+            CANCodec_copyInverted(&data[3U - align], &ref[align], length);
+
+            for (i = 0U; i < length; i++)
+            {
+                if (data[3U - align + i] != (uint8_t)~ref[align + i])
+                {
+                    errorCnt++;
+                }
+            }
+
+            if (CANCodec_findInvertedMismatch(&data[3U - align], &ref[align], length) != length)
+            {
+                errorCnt++;
+            }
+
+            for (i = 0U; i < length; i++)
+            {
+                data[3U - align + i] ^= 0x10U;
+
+                if (CANCodec_findInvertedMismatch(&data[3U - align], &ref[align], length) != i)
+                {
+                    errorCnt++;
+                }
+
+                data[3U - align + i] ^= 0x10U;
+            }
+        }
+    }
+
+    HostTest_checkEqual(errorCnt, 0U);
+}
+
+/*
+ *  ======== checkNumbers ========
+ */
+static void checkNumbers(void)
+{
+    static const uint32_t values[] = {0U, 1U, 9U, 10U, 0xFU, 0x10U, 255U, 256U, 4095U, 65535U, 123456789U,
+                                      0x7FFFFFFFU, 0x80000000U, 0xFFFFFFFFU};
+    CANCodec_Cursor cursor;
+    char text[TEXT_SIZE];
+    char expected[TEXT_SIZE];
+    size_t length;
+    uint32_t minDigits;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(values) / sizeof(values[0])); i++)
+    {
+        CANCodec_init(&cursor, text, sizeof(text));
+        CANCodec_putUint(&cursor, values[i]);
+        length = CANCodec_finish(&cursor);
+        (void)snprintf(expected, sizeof(expected), "%lu", (unsigned long)values[i]);
+        HostTest_check(strcmp(text, expected) == 0);
+        HostTest_checkEqual(length, strlen(expected));
+
+        for (minDigits = 0U; minDigits <= 10U; minDigits++)
+        {
+            CANCodec_init(&cursor, text, sizeof(text));
+            CANCodec_putHex(&cursor, values[i], minDigits);
+            (void)CANCodec_finish(&cursor);
+            (void)snprintf(expected, sizeof(expected), "%0*lx", (int)((minDigits < 8U) ? minDigits : 8U),
+                           (unsigned long)values[i]);
+            HostTest_check(strcmp(text, expected) == 0);
+        }
+    }
+}
+
+/*
+ *  ======== checkTruncation ========
+ *  Output that does not fit is cut off and the text stays terminated.
+ */
+static void checkTruncation(void)
+{
+    static const uint8_t bytes[] = {0x00U, 0x5AU, 0xFFU};
+    CANCodec_Cursor cursor;
+    char text[8];
+
+    memset(text, '#', sizeof(text));
+    CANCodec_init(&cursor, text, sizeof(text));
+    CANCodec_putStr(&cursor, "abc");
+    CANCodec_putUint(&cursor, 123456U);
+    HostTest_checkEqual(CANCodec_finish(&cursor), 7U);
+    HostTest_check(strcmp(text, "abc1234") == 0);
+
+    CANCodec_init(&cursor, text, sizeof(text));
+    CANCodec_putHex(&cursor, 0xDEADBEEFU, 8U);
+    HostTest_checkEqual(CANCodec_finish(&cursor), 7U);
+    HostTest_check(strcmp(text, "deadbee") == 0);
+
+    /* Hex bytes are cut at a whole byte */
+    CANCodec_init(&cursor, text, sizeof(text));
+    CANCodec_putHexBytes(&cursor, bytes, sizeof(bytes));
+    HostTest_checkEqual(CANCodec_finish(&cursor), 6U);
+    HostTest_check(strcmp(text, "00 5A ") == 0);
+
+    CANCodec_init(&cursor, text, 1U);
+    CANCodec_putStr(&cursor, "abc");
+    CANCodec_putHexBytes(&cursor, bytes, sizeof(bytes));
+    HostTest_checkEqual(CANCodec_finish(&cursor), 0U);
+    HostTest_checkEqual(text[0], '\0');
+}
+
+/*
+ *  ======== checkFrames ========
+ */
+static void checkFrames(void)
+{
+    CAN_RxBufElement elem;
+    CANCodec_Cursor cursor;
+    char text[TEXT_SIZE];
+    uint32_t i;
+
+    memset(&elem, 0, sizeof(elem));
+    elem.id   = 0x1ABCDEFU;
+    elem.rxts = 0x1FU;
+    elem.dlc  = CAN_DLC_12B;
+    elem.fdf  = 1U;
+    elem.brs  = 1U;
+
+    for (i = 0U; i < 12U; i++)
+    {
+        elem.data[i] = (uint8_t)(0xF0U + i);
+    }
+
+    CANCodec_init(&cursor, text, sizeof(text));
+    CANCodec_putRxElem(&cursor, &elem, 0x0000000123456789ULL);
+    (void)CANCodec_finish(&cursor);
+    HostTest_check(strcmp(text,
+                          "Msg ID: 0x1abcdef\r\nTS: 0x001f\r\nSOF time: 0x0000000123456789\r\n"
+                          "CAN FD: 1\r\nDLC: 9\r\nBRS: 1\r\nESI: 0\r\n"
+                          "Data[12]: F0 F1 F2 F3 F4 F5 F6 F7 F8 F9 FA FB \r\n\n") == 0);
+
+    CANCodec_init(&cursor, text, sizeof(text));
+    CANCodec_putEvent(&cursor, CAN_EVENT_RX_FIFO_MSG_LOST, 1U);
+    CANCodec_putEvent(&cursor, CAN_EVENT_SPI_XFER_ERROR, 0xA5U);
+    CANCodec_putEvent(&cursor, 0x80000000U, 0U);
+    (void)CANCodec_finish(&cursor);
+    HostTest_check(strcmp(text,
+                          "> Rx FIFO 1 message lost\r\n\n"
+                          "> SPI transfer error: status = 0xa5\r\n\n"
+                          "> Undefined event\r\n\n") == 0);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkDlc();
+    checkInverted();
+    checkNumbers();
+    checkTruncation();
+    checkFrames();
+
+    return HostTest_exit("CANCodec");
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANE2E.c ========
+ *  Host checks of the CAN end-to-end protection: the table-driven CRCs
+ *  against their check values and a bitwise reference, and the counter
+ *  evaluation of the receiver.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "CANE2E.h"
+#include "HostTest.h"
+
+/*
+ *  ======== referenceCrc8 ========
+ *  Bitwise CRC-8 SAE J1850, without the final XOR.
+ */
+static uint8_t referenceCrc8(uint8_t crc, const uint8_t *data, size_t length)
+{
+    uint32_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= *data++;
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x80U) != 0U) ? (uint8_t)((crc << 1) ^ 0x1DU) : (uint8_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== referenceCrc16 ========
+ *  Bitwise CRC-16 CCITT.
+ */
+static uint16_t referenceCrc16(uint16_t crc, const uint8_t *data, size_t length)
+{
+    uint32_t bit;
+
+    while (length-- > 0U)
+    {
+        crc ^= (uint16_t)(*data++ << 8);
+
+        for (bit = 0U; bit < 8U; bit++)
+        {
+            crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+/*
+ *  ======== checkCrc ========
+ */
+static void checkCrc(void)
+{
+    static const uint8_t check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    uint8_t data[64];
+    uint32_t errorCnt = 0U;
+    size_t length;
+    size_t start;
+    size_t i;
+
+    /* Check values of the catalogued CRC-8/SAE-J1850 and CRC-16/CCITT-FALSE */
+    HostTest_checkEqual(CANE2E_crc8(CANE2E_CRC8_INIT, check, sizeof(check)) ^ CANE2E_CRC8_XOR_OUT, 0x4BU);
+    HostTest_checkEqual(CANE2E_crc16(CANE2E_CRC16_INIT, check, sizeof(check)) ^ CANE2E_CRC16_XOR_OUT, 0x29B1U);
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)((i * 151U) + 7U);
+    }
+
+    /* All lengths and alignments of the four byte slices */
+    for (start = 0U; start < 4U; start++)
+    {
+        for (length = 0U; length <= (sizeof(data) - start); length++)
+        {
+            if (CANE2E_crc8(0x5AU, &data[start], length) != referenceCrc8(0x5AU, &data[start], length))
+            {
+                errorCnt++;
+            }
+
+            if (CANE2E_crc16(0xA55AU, &data[start], length) != referenceCrc16(0xA55AU, &data[start], length))
+            {
+                errorCnt++;
+            }
+        }
+    }
+
+    HostTest_checkEqual(errorCnt, 0U);
+}
+
+/*
+ *  ======== checkProtection ========
+ *  Protected payloads pass, and any single bit error or another data ID
+ *  fails.
+ */
+static void checkProtection(void)
+{
+    static const CANE2E_Config configs[] = {
+        {0x1234U, CANE2E_CRC8, 0U, 1U, 1U},
+        {0x1234U, CANE2E_CRC16, 6U, 0U, 1U},
+        {0x0001U, CANE2E_CRC16, 30U, 29U, 1U},
+    };
+    static const size_t lengths[] = {8U, 8U, 64U};
+    CANE2E_Object sender;
+    CANE2E_Object receiver;
+    CANE2E_Config otherId;
+    uint8_t data[64];
+    uint32_t errorCnt = 0U;
+    uint32_t bit;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(configs) / sizeof(configs[0])); i++)
+    {
+        CANE2E_construct(&sender, &configs[i]);
+        CANE2E_construct(&receiver, &configs[i]);
+
+        memset(data, 0x3CU, sizeof(data));
+        HostTest_check(CANE2E_protect(&sender, data, lengths[i]));
+        HostTest_checkEqual(CANE2E_check(&receiver, data, lengths[i]), CANE2E_INITIAL);
+
+        for (bit = 0U; bit < (8U * lengths[i]); bit++)
+        {
+            data[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+
+            if (CANE2E_check(&receiver, data, lengths[i]) != CANE2E_ERROR)
+            {
+                errorCnt++;
+            }
+
+            data[bit / 8U] ^= (uint8_t)(1U << (bit % 8U));
+        }
+
+        otherId        = configs[i];
+        otherId.dataId = configs[i].dataId ^ 0x0100U;
+        CANE2E_construct(&receiver, &otherId);
+        HostTest_checkEqual(CANE2E_check(&receiver, data, lengths[i]), CANE2E_ERROR);
+    }
+
+    HostTest_checkEqual(errorCnt, 0U);
+
+    /* Payloads too short for the positions, and overlapping positions */
+    CANE2E_construct(&sender, &configs[2]);
+    HostTest_check(!CANE2E_protect(&sender, data, 31U));
+    HostTest_checkEqual(CANE2E_check(&sender, data, 31U), CANE2E_ERROR);
+
+    otherId               = configs[1];
+    otherId.counterOffset = 7U;
+    CANE2E_construct(&sender, &otherId);
+    HostTest_check(!CANE2E_protect(&sender, data, 8U));
+}
+
+/*
+ *  ======== checkCounter ========
+ *  Counter sequences including the 8-bit wrap.
+ */
+static void checkCounter(void)
+{
+    static const CANE2E_Config config = {0x0042U, CANE2E_CRC8, 7U, 0U, 3U};
+    static const struct
+    {
+        uint8_t counter;
+        CANE2E_Status status;
+    } sequence[] = {
+        {0xFDU, CANE2E_INITIAL},
+        {0xFEU, CANE2E_OK},
+        {0xFEU, CANE2E_REPEATED},
+        {0x00U, CANE2E_OK_SOME_LOST},
+        {0x03U, CANE2E_OK_SOME_LOST},
+        {0x07U, CANE2E_WRONG_SEQUENCE},
+        {0x08U, CANE2E_OK},
+        {0x06U, CANE2E_WRONG_SEQUENCE},
+        {0x07U, CANE2E_OK},
+    };
+    CANE2E_Object sender;
+    CANE2E_Object receiver;
+    uint8_t data[8];
+    uint32_t i;
+
+    CANE2E_construct(&sender, &config);
+    CANE2E_construct(&receiver, &config);
+
+    for (i = 0U; i < (sizeof(sequence) / sizeof(sequence[0])); i++)
+    {
+        memset(data, (int)i, sizeof(data));
+        sender.counter = sequence[i].counter;
+        HostTest_check(CANE2E_protect(&sender, data, sizeof(data)));
+        HostTest_checkEqual(data[config.counterOffset], sequence[i].counter);
+        HostTest_checkEqual(CANE2E_check(&receiver, data, sizeof(data)), sequence[i].status);
+    }
+
+    /* A CRC error does not change the last counter */
+    data[3] ^= 0x01U;
+    HostTest_checkEqual(CANE2E_check(&receiver, data, sizeof(data)), CANE2E_ERROR);
+    data[3] ^= 0x01U;
+    HostTest_checkEqual(CANE2E_check(&receiver, data, sizeof(data)), CANE2E_REPEATED);
+
+    HostTest_checkEqual(receiver.stats.checkCnt, 11U);
+    HostTest_checkEqual(receiver.stats.okCnt, 5U);
+    HostTest_checkEqual(receiver.stats.lostCnt, 3U);
+    HostTest_checkEqual(receiver.stats.repeatedCnt, 2U);
+    HostTest_checkEqual(receiver.stats.wrongSequenceCnt, 2U);
+    HostTest_checkEqual(receiver.stats.errorCnt, 1U);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    CANE2E_init();
+
+    checkCrc();
+    checkProtection();
+    checkCounter();
+
+    return HostTest_exit("CANE2E");
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANEventQueue.c ========
+ *  Host checks of the CAN event queue: ordering, overflow accounting, index
+ *  wrap, and a producer thread racing the consumer.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "CANEventQueue.h"
+#include "HostTest.h"
+
+/* Events passed from the producer thread to the consumer */
+#define STRESS_EVENT_COUNT 200000U
+
+static CANEventQueue_Object queue;
+
+/*
+ *  ======== checkOrder ========
+ */
+static void checkOrder(void)
+{
+    uint32_t event;
+    uint32_t data;
+    uint32_t i;
+
+    CANEventQueue_init(&queue);
+
+    HostTest_check(!CANEventQueue_get(&queue, &event, &data));
+
+    for (i = 0U; i < CANEventQueue_SIZE; i++)
+    {
+        HostTest_check(CANEventQueue_put(&queue, i, i * 3U));
+    }
+
+    HostTest_checkEqual(CANEventQueue_getCount(&queue), CANEventQueue_SIZE);
+    HostTest_checkEqual(queue.highWaterMark, CANEventQueue_SIZE);
+
+    for (i = 0U; i < CANEventQueue_SIZE; i++)
+    {
+        HostTest_check(CANEventQueue_get(&queue, &event, &data));
+        HostTest_checkEqual(event, i);
+        HostTest_checkEqual(data, i * 3U);
+    }
+
+    HostTest_check(!CANEventQueue_get(&queue, &event, &data));
+    HostTest_checkEqual(queue.overflowCnt, 0U);
+}
+
+/*
+ *  ======== checkOverflow ========
+ */
+static void checkOverflow(void)
+{
+    uint32_t event;
+    uint32_t data;
+    uint32_t i;
+
+    CANEventQueue_init(&queue);
+
+    for (i = 0U; i < CANEventQueue_SIZE; i++)
+    {
+        (void)CANEventQueue_put(&queue, i, 0U);
+    }
+
+    /* A full queue drops the new event and keeps the queued ones */
+    HostTest_check(!CANEventQueue_put(&queue, 100U, 0U));
+    HostTest_check(!CANEventQueue_put(&queue, 101U, 0U));
+    HostTest_checkEqual(queue.overflowCnt, 2U);
+    HostTest_checkEqual(queue.lastLostEvent, 101U);
+
+    HostTest_check(CANEventQueue_get(&queue, &event, &data));
+    HostTest_checkEqual(event, 0U);
+    HostTest_check(CANEventQueue_put(&queue, 102U, 0U));
+    HostTest_checkEqual(CANEventQueue_getCount(&queue), CANEventQueue_SIZE);
+}
+
+/*
+ *  ======== checkIndexWrap ========
+ *  The free-running indices keep the count right when they wrap.
+ */
+static void checkIndexWrap(void)
+{
+    uint32_t event;
+    uint32_t data;
+    uint32_t i;
+
+    CANEventQueue_init(&queue);
+    queue.head = UINT32_MAX - 2U;
+    queue.tail = UINT32_MAX - 2U;
+
+    for (i = 0U; i < 6U; i++)
+    {
+        HostTest_check(CANEventQueue_put(&queue, i, 0U));
+    }
+
+    HostTest_checkEqual(CANEventQueue_getCount(&queue), 6U);
+
+    for (i = 0U; i < 6U; i++)
+    {
+        HostTest_check(CANEventQueue_get(&queue, &event, &data));
+        HostTest_checkEqual(event, i);
+    }
+
+    HostTest_checkEqual(CANEventQueue_getCount(&queue), 0U);
+}
+
+/*
+ *  ======== producerFxn ========
+ *  Stands in for the CAN event callback. Retries the events the full queue
+ *  refused, so every event is delivered once. The threads yield while they
+ *  wait, so the check also runs on a single CPU.
+ */
+static void *producerFxn(void *arg)
+{
+    uint32_t i;
+
+    for (i = 0U; i < STRESS_EVENT_COUNT; i++)
+    {
+        while (!CANEventQueue_put(&queue, i, ~i))
+        {
+            (void)sched_yield();
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ *  ======== checkConcurrent ========
+ */
+static void checkConcurrent(void)
+{
+    pthread_t producer;
+    uint32_t expected = 0U;
+    uint32_t errorCnt = 0U;
+    uint32_t event;
+    uint32_t data;
+
+    CANEventQueue_init(&queue);
+
+    HostTest_checkEqual(pthread_create(&producer, NULL, producerFxn, NULL), 0);
+
+    while (expected < STRESS_EVENT_COUNT)
+    {
+        if (CANEventQueue_get(&queue, &event, &data))
+        {
+            if ((event != expected) || (data != ~expected))
+            {
+                errorCnt++;
+            }
+
+            expected++;
+        }
+        else
+        {
+            (void)sched_yield();
+        }
+    }
+
+    (void)pthread_join(producer, NULL);
+
+    HostTest_checkEqual(errorCnt, 0U);
+    HostTest_checkEqual(CANEventQueue_getCount(&queue), 0U);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkOrder();
+    checkOverflow();
+    checkIndexWrap();
+    checkConcurrent();
+
+    return HostTest_exit("CANEventQueue");
+}
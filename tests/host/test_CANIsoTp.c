@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANIsoTp.c ========
+ *  Host checks of the ISO-TP transport. Two links are connected through a
+ *  simulated bus that queues the frames sent and can refuse them, as a full
+ *  Tx FIFO would.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "CANIsoTp.h"
+#include "HostTest.h"
+
+#define ID_A 0x700U
+#define ID_B 0x708U
+
+/* 250ns ticks per millisecond */
+#define TICKS_PER_MS 4000U
+
+/* Frames the simulated bus holds */
+#define BUS_SIZE 16U
+
+typedef struct
+{
+    uint32_t id;
+    uint8_t data[CANIsoTp_FRAME_SIZE];
+} Frame;
+
+static Frame bus[BUS_SIZE];
+static uint32_t busCnt;
+static uint32_t busLimit;
+
+static uint8_t rxData[CANIsoTp_MSG_SIZE_MAX];
+static uint32_t rxLength;
+static uint32_t rxCnt;
+
+static CANIsoTp_Object linkA;
+static CANIsoTp_Object linkB;
+
+/*
+ *  ======== sendFxn ========
+ */
+static bool sendFxn(void *arg, uint32_t id, const uint8_t *data)
+{
+    (void)arg;
+
+    if (busCnt >= busLimit)
+    {
+        return false;
+    }
+
+    bus[busCnt].id = id;
+    memcpy(bus[busCnt].data, data, CANIsoTp_FRAME_SIZE);
+    busCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== receiveFxn ========
+ */
+static void receiveFxn(void *arg, const uint8_t *data, uint32_t length)
+{
+    (void)arg;
+
+    memcpy(rxData, data, length);
+    rxLength = length;
+    rxCnt++;
+}
+
+/*
+ *  ======== initLink ========
+ */
+static void initLink(CANIsoTp_Object *link, uint32_t txId, uint32_t rxId, uint8_t blockSize, uint8_t stMin)
+{
+    CANIsoTp_Params params;
+
+    params.txId       = txId;
+    params.rxId       = rxId;
+    params.blockSize  = blockSize;
+    params.stMin      = stMin;
+    params.sendFxn    = sendFxn;
+    params.receiveFxn = receiveFxn;
+    params.arg        = NULL;
+
+    CANIsoTp_init(link, &params);
+}
+
+/*
+ *  ======== initLinks ========
+ *  Connects link A to link B, which requests the given flow control.
+ */
+static void initLinks(uint8_t blockSize, uint8_t stMin)
+{
+    initLink(&linkA, ID_A, ID_B, 0U, 0U);
+    initLink(&linkB, ID_B, ID_A, blockSize, stMin);
+
+    busCnt   = 0U;
+    busLimit = BUS_SIZE;
+    rxLength = 0U;
+    rxCnt    = 0U;
+}
+
+/*
+ *  ======== deliver ========
+ *  Passes the frames on the bus to both links at time now, including the
+ *  frames they send in response, and returns the number of frames delivered.
+ */
+static uint32_t deliver(uint32_t now)
+{
+    Frame frame;
+    uint32_t count = 0U;
+
+    while (busCnt != 0U)
+    {
+        frame = bus[0];
+        busCnt--;
+        memmove(&bus[0], &bus[1], busCnt * sizeof(Frame));
+
+        HostTest_check(CANIsoTp_receiveFrame(&linkA, frame.id, frame.data, CANIsoTp_FRAME_SIZE, now) !=
+                       CANIsoTp_receiveFrame(&linkB, frame.id, frame.data, CANIsoTp_FRAME_SIZE, now));
+        count++;
+    }
+
+    return count;
+}
+
+/*
+ *  ======== run ========
+ *  Runs both links in 100us steps until the transmission of link A ends or
+ *  the time limit is reached, and returns the time.
+ */
+static uint32_t run(uint32_t now, uint32_t limit)
+{
+    while ((CANIsoTp_getTxStatus(&linkA) == CANIsoTp_TX_BUSY) && ((int32_t)(now - limit) < 0))
+    {
+        (void)deliver(now);
+        now += TICKS_PER_MS / 10U;
+        CANIsoTp_process(&linkA, now);
+        CANIsoTp_process(&linkB, now);
+    }
+
+    (void)deliver(now);
+
+    return now;
+}
+
+/*
+ *  ======== fillMessage ========
+ */
+static void fillMessage(uint8_t *data, uint32_t length, uint32_t seed)
+{
+    uint32_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        data[i] = (uint8_t)((i * 7U) + seed);
+    }
+}
+
+/*
+ *  ======== checkTransfer ========
+ *  Messages of all frame layouts arrive complete, with and without flow
+ *  control blocks, across sequence number wraps.
+ */
+static void checkTransfer(void)
+{
+    static const uint32_t lengths[] = {1U, 7U, 8U, 13U, 14U, 111U, 112U, 1000U, CANIsoTp_MSG_SIZE_MAX};
+    static const uint8_t blockSizes[] = {0U, 1U, 4U};
+    static uint8_t message[CANIsoTp_MSG_SIZE_MAX];
+    uint32_t frames;
+    uint32_t i;
+    uint32_t j;
+
+    for (j = 0U; j < (sizeof(blockSizes) / sizeof(blockSizes[0])); j++)
+    {
+        for (i = 0U; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+        {
+            initLinks(blockSizes[j], 0U);
+            fillMessage(message, lengths[i], i);
+
+            HostTest_check(CANIsoTp_send(&linkA, message, lengths[i], 0U));
+            (void)run(0U, 100U * TICKS_PER_MS);
+
+            /* A single frame, or a first frame with 6 bytes and consecutive frames with 7 */
+            frames = (lengths[i] <= 7U) ? 1U : (1U + (lengths[i] / 7U));
+
+            HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_DONE);
+            HostTest_checkEqual(rxCnt, 1U);
+            HostTest_checkEqual(rxLength, lengths[i]);
+            HostTest_check(memcmp(rxData, message, lengths[i]) == 0);
+            HostTest_checkEqual(linkA.stats.txMsgCnt, 1U);
+            HostTest_checkEqual(linkA.stats.txFrameCnt, frames);
+            HostTest_checkEqual(linkB.stats.rxMsgCnt, 1U);
+            HostTest_checkEqual(linkB.stats.rxInvalidCnt + linkB.stats.rxSeqErrorCnt, 0U);
+        }
+    }
+
+    /* Invalid lengths and a second message while busy are refused */
+    initLinks(0U, 0U);
+    HostTest_check(!CANIsoTp_send(&linkA, message, 0U, 0U));
+    HostTest_check(!CANIsoTp_send(&linkA, message, CANIsoTp_MSG_SIZE_MAX + 1U, 0U));
+    HostTest_check(CANIsoTp_send(&linkA, message, 20U, 0U));
+    HostTest_check(!CANIsoTp_send(&linkA, message, 20U, 0U));
+}
+
+/*
+ *  ======== checkFrameLayout ========
+ *  Single, first and flow control frames are padded to 8 bytes.
+ */
+static void checkFrameLayout(void)
+{
+    static const uint8_t single[] = {0x03U, 0x11U, 0x22U, 0x33U, 0xCCU, 0xCCU, 0xCCU, 0xCCU};
+    static const uint8_t first[]  = {0x10U, 0x14U, 0x00U, 0x07U, 0x0EU, 0x15U, 0x1CU, 0x23U};
+    static const uint8_t flow[]   = {0x30U, 0x05U, 0xF3U, 0xCCU, 0xCCU, 0xCCU, 0xCCU, 0xCCU};
+    uint8_t message[20];
+
+    initLinks(5U, 0xF3U);
+    message[0] = 0x11U;
+    message[1] = 0x22U;
+    message[2] = 0x33U;
+    HostTest_check(CANIsoTp_send(&linkA, message, 3U, 0U));
+    HostTest_checkEqual(busCnt, 1U);
+    HostTest_checkEqual(bus[0].id, ID_A);
+    HostTest_check(memcmp(bus[0].data, single, sizeof(single)) == 0);
+
+    initLinks(5U, 0xF3U);
+    fillMessage(message, sizeof(message), 0U);
+    HostTest_check(CANIsoTp_send(&linkA, message, sizeof(message), 0U));
+    HostTest_checkEqual(busCnt, 1U);
+    HostTest_check(memcmp(bus[0].data, first, sizeof(first)) == 0);
+
+    /* Link B answers the first frame with its flow control parameters */
+    busLimit = 1U;
+    busCnt   = 0U;
+    HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, first, sizeof(first), 0U));
+    HostTest_checkEqual(busCnt, 1U);
+    HostTest_checkEqual(bus[0].id, ID_B);
+    HostTest_check(memcmp(bus[0].data, flow, sizeof(flow)) == 0);
+
+    /* Frames of other IDs are not handled */
+    HostTest_check(!CANIsoTp_receiveFrame(&linkB, ID_B, first, sizeof(first), 0U));
+
+    /* Return the reassembly buffer to the pool */
+    CANIsoTp_process(&linkB, CANIsoTp_TIMEOUT_MS * TICKS_PER_MS);
+    HostTest_checkEqual(linkB.stats.rxTimeoutCnt, 1U);
+}
+
+/*
+ *  ======== checkPacing ========
+ *  STmin spaces the consecutive frames, and a refused frame is sent again.
+ */
+static void checkPacing(void)
+{
+    uint8_t message[30];
+    uint32_t now;
+
+    /* 20 bytes take a first frame and 2 consecutive frames. STmin is 2ms. */
+    initLinks(0U, 0x02U);
+    fillMessage(message, sizeof(message), 3U);
+    HostTest_check(CANIsoTp_send(&linkA, message, 20U, 0U));
+
+    /* The flow control frame releases the first consecutive frame at once */
+    HostTest_checkEqual(deliver(0U), 3U);
+    HostTest_checkEqual(linkA.stats.txFrameCnt, 2U);
+
+    CANIsoTp_process(&linkA, (2U * TICKS_PER_MS) - 1U);
+    HostTest_checkEqual(busCnt, 0U);
+    CANIsoTp_process(&linkA, 2U * TICKS_PER_MS);
+    HostTest_checkEqual(busCnt, 1U);
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_DONE);
+    (void)deliver(2U * TICKS_PER_MS);
+    HostTest_checkEqual(rxCnt, 1U);
+
+    /* A full bus stops the transmission until the next call */
+    initLinks(0U, 0U);
+    busLimit = 0U;
+    HostTest_check(CANIsoTp_send(&linkA, message, sizeof(message), 0U));
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_BUSY);
+    HostTest_checkEqual(linkA.stats.txFrameCnt, 0U);
+
+    busLimit = BUS_SIZE;
+    CANIsoTp_process(&linkA, 0U);
+    now = run(0U, 100U * TICKS_PER_MS);
+    HostTest_check(now < (100U * TICKS_PER_MS));
+    HostTest_checkEqual(rxCnt, 1U);
+    HostTest_check(memcmp(rxData, message, sizeof(message)) == 0);
+}
+
+/*
+ *  ======== checkFlowStatus ========
+ *  Wait and overflow flow control frames, and the N_Bs timeout.
+ */
+static void checkFlowStatus(void)
+{
+    static const uint8_t wait[]     = {0x31U, 0x00U, 0x00U};
+    static const uint8_t overflow[] = {0x32U, 0x00U, 0x00U};
+    uint8_t message[20];
+    uint32_t i;
+
+    fillMessage(message, sizeof(message), 0U);
+
+    /* Each wait frame restarts N_Bs, until there are too many */
+    initLinks(0U, 0U);
+    HostTest_check(CANIsoTp_send(&linkA, message, sizeof(message), 0U));
+    for (i = 0U; i < CANIsoTp_WAIT_MAX; i++)
+    {
+        HostTest_check(CANIsoTp_receiveFrame(&linkA, ID_B, wait, sizeof(wait), i * 900U * TICKS_PER_MS));
+        CANIsoTp_process(&linkA, ((i + 1U) * 900U * TICKS_PER_MS) - 1U);
+        HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_BUSY);
+    }
+
+    HostTest_check(CANIsoTp_receiveFrame(&linkA, ID_B, wait, sizeof(wait), i * 900U * TICKS_PER_MS));
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_PROTOCOL_ERROR);
+    HostTest_checkEqual(linkA.stats.txErrorCnt, 1U);
+
+    initLinks(0U, 0U);
+    HostTest_check(CANIsoTp_send(&linkA, message, sizeof(message), 0U));
+    HostTest_check(CANIsoTp_receiveFrame(&linkA, ID_B, overflow, sizeof(overflow), 0U));
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_OVERFLOW);
+
+    /* A flow control frame without a transmission is ignored */
+    HostTest_check(CANIsoTp_receiveFrame(&linkA, ID_B, overflow, sizeof(overflow), 0U));
+    HostTest_checkEqual(linkA.stats.rxInvalidCnt, 1U);
+
+    initLinks(0U, 0U);
+    HostTest_check(CANIsoTp_send(&linkA, message, sizeof(message), 0U));
+    CANIsoTp_process(&linkA, (CANIsoTp_TIMEOUT_MS * TICKS_PER_MS) - 1U);
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_BUSY);
+    CANIsoTp_process(&linkA, CANIsoTp_TIMEOUT_MS * TICKS_PER_MS);
+    HostTest_checkEqual(CANIsoTp_getTxStatus(&linkA), CANIsoTp_TX_TIMEOUT);
+}
+
+/*
+ *  ======== checkReceiveErrors ========
+ *  Sequence gaps, the N_Cr timeout and an exhausted buffer pool. Every
+ *  aborted reception returns its buffer to the pool.
+ */
+static void checkReceiveErrors(void)
+{
+    static CANIsoTp_Object links[CANIsoTp_POOL_SIZE + 1U];
+    static const uint8_t first[] = {0x10U, 0x14U, 0U, 1U, 2U, 3U, 4U, 5U};
+    static const uint8_t cf1[]   = {0x21U, 6U, 7U, 8U, 9U, 10U, 11U, 12U};
+    static const uint8_t cf3[]   = {0x23U, 13U, 14U, 15U, 16U, 17U, 18U, 19U};
+    uint32_t i;
+    uint32_t round;
+
+    for (round = 0U; round < 2U; round++)
+    {
+        /* A lost consecutive frame */
+        initLinks(0U, 0U);
+        HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, first, sizeof(first), 0U));
+        HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, cf1, sizeof(cf1), 0U));
+        HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, cf3, sizeof(cf3), 0U));
+        HostTest_checkEqual(linkB.stats.rxSeqErrorCnt, 1U);
+        HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, cf1, sizeof(cf1), 0U));
+        HostTest_checkEqual(linkB.stats.rxInvalidCnt, 1U);
+
+        /* A reception that stalls */
+        HostTest_check(CANIsoTp_receiveFrame(&linkB, ID_A, first, sizeof(first), 0U));
+        CANIsoTp_process(&linkB, (CANIsoTp_TIMEOUT_MS * TICKS_PER_MS) - 1U);
+        HostTest_checkEqual(linkB.stats.rxTimeoutCnt, 0U);
+        CANIsoTp_process(&linkB, CANIsoTp_TIMEOUT_MS * TICKS_PER_MS);
+        HostTest_checkEqual(linkB.stats.rxTimeoutCnt, 1U);
+        HostTest_checkEqual(rxCnt, 0U);
+
+        /* One more reception than buffers is refused with an overflow */
+        for (i = 0U; i <= CANIsoTp_POOL_SIZE; i++)
+        {
+            initLink(&links[i], ID_B + 1U + i, ID_A + 1U + i, 0U, 0U);
+            busCnt = 0U;
+            HostTest_check(CANIsoTp_receiveFrame(&links[i], ID_A + 1U + i, first, sizeof(first), 0U));
+            HostTest_checkEqual(busCnt, 1U);
+            HostTest_checkEqual(bus[0].data[0], (i < CANIsoTp_POOL_SIZE) ? 0x30U : 0x32U);
+        }
+
+        HostTest_checkEqual(links[CANIsoTp_POOL_SIZE].stats.rxOverflowCnt, 1U);
+
+        /* Completing the receptions frees the buffers for the next round */
+        for (i = 0U; i < CANIsoTp_POOL_SIZE; i++)
+        {
+            static const uint8_t cf2[] = {0x22U, 13U, 14U, 15U, 16U, 17U, 18U, 19U};
+
+            HostTest_check(CANIsoTp_receiveFrame(&links[i], ID_A + 1U + i, cf1, sizeof(cf1), 0U));
+            HostTest_check(CANIsoTp_receiveFrame(&links[i], ID_A + 1U + i, cf2, sizeof(cf2), 0U));
+            HostTest_checkEqual(links[i].stats.rxMsgCnt, 1U);
+            HostTest_checkEqual(rxLength, 20U);
+            HostTest_checkEqual(rxData[19], 19U);
+        }
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkTransfer();
+    checkFrameLayout();
+    checkPacing();
+    checkFlowStatus();
+    checkReceiveErrors();
+
+    return HostTest_exit("CANIsoTp");
+}
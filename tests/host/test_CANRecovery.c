@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANRecovery.c ========
+ *  Host checks of the bus off recovery: queueing while the driver Tx buffers
+ *  are full or the bus is off, the backoff sequence, driver restarts, and the
+ *  queue overflow policies. The driver is simulated by the write and restart
+ *  functions.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANRecovery.h"
+#include "HostTest.h"
+
+#define MIN_BACKOFF_MS 10U
+#define MAX_BACKOFF_MS 80U
+#define STABLE_TIME_MS 1000U
+
+#define MS(ms) ((uint64_t)(ms) * CANRecovery_TICKS_PER_MSEC)
+
+/* Simulated driver */
+static uint32_t txFree;
+static int_fast16_t writeError;
+static uint32_t writtenIds[64];
+static uint32_t writtenCnt;
+static bool restartResult;
+static uint32_t restartCalls;
+static bool busOffOnRestart;
+static uint64_t restartNow;
+
+static CANRecovery_Object recovery;
+
+/*
+ *  ======== writeFxn ========
+ */
+static int_fast16_t writeFxn(void *arg, const CAN_TxBufElement *elem)
+{
+    (void)arg;
+
+    if (writeError != CAN_STATUS_SUCCESS)
+    {
+        return writeError;
+    }
+
+    if (txFree == 0U)
+    {
+        return CAN_STATUS_TX_BUF_FULL;
+    }
+
+    txFree--;
+    writtenIds[writtenCnt++] = elem->id;
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== restartFxn ========
+ */
+static bool restartFxn(void *arg)
+{
+    uint64_t now = *(const uint64_t *)arg;
+
+    restartCalls++;
+
+    if (busOffOnRestart)
+    {
+        /* The bus goes off again while the driver restarts */
+        busOffOnRestart = false;
+        CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, now);
+    }
+
+    return restartResult;
+}
+
+/*
+ *  ======== init ========
+ */
+static void init(bool dropOldest)
+{
+    CANRecovery_Params params;
+
+    params.minBackoffMs = MIN_BACKOFF_MS;
+    params.maxBackoffMs = MAX_BACKOFF_MS;
+    params.stableTimeMs = STABLE_TIME_MS;
+    params.dropOldest   = dropOldest;
+    params.writeFxn     = writeFxn;
+    params.restartFxn   = restartFxn;
+    params.arg          = &restartNow;
+
+    CANRecovery_init(&recovery, &params);
+
+    txFree          = 64U;
+    writeError      = CAN_STATUS_SUCCESS;
+    writtenCnt      = 0U;
+    restartResult   = true;
+    restartCalls    = 0U;
+    busOffOnRestart = false;
+}
+
+/*
+ *  ======== writeFrame ========
+ */
+static int_fast16_t writeFrame(uint32_t id)
+{
+    CAN_TxBufElement elem = {0};
+
+    elem.id  = id;
+    elem.dlc = CAN_DLC_8B;
+
+    return CANRecovery_write(&recovery, &elem);
+}
+
+/*
+ *  ======== process ========
+ */
+static void process(uint64_t now)
+{
+    restartNow = now;
+    CANRecovery_process(&recovery, now);
+}
+
+/*
+ *  ======== checkTxFull ========
+ *  Frames are queued while the driver Tx buffers are full and written in
+ *  order once they are freed.
+ */
+static void checkTxFull(void)
+{
+    uint32_t i;
+
+    init(false);
+
+    HostTest_checkEqual(writeFrame(1U), CAN_STATUS_SUCCESS);
+    HostTest_checkEqual(writtenCnt, 1U);
+    HostTest_check(!CANRecovery_isPending(&recovery));
+
+    txFree = 0U;
+    HostTest_checkEqual(writeFrame(2U), CAN_STATUS_SUCCESS);
+    HostTest_checkEqual(writeFrame(3U), CAN_STATUS_SUCCESS);
+    HostTest_checkEqual(recovery.stats.queuedCnt, 2U);
+    HostTest_check(CANRecovery_isPending(&recovery));
+
+    /* A freed buffer takes the oldest queued frame, not the new one */
+    txFree = 1U;
+    HostTest_checkEqual(writeFrame(4U), CAN_STATUS_SUCCESS);
+    txFree = 64U;
+    process(0U);
+    HostTest_check(!CANRecovery_isPending(&recovery));
+
+    HostTest_checkEqual(writtenCnt, 4U);
+    for (i = 0U; i < 4U; i++)
+    {
+        HostTest_checkEqual(writtenIds[i], i + 1U);
+    }
+
+    /* Write errors are returned, and drop queued frames */
+    writeError = CAN_STATUS_ERROR;
+    HostTest_checkEqual(writeFrame(5U), CAN_STATUS_ERROR);
+    writeError = CAN_STATUS_SUCCESS;
+    txFree     = 0U;
+    (void)writeFrame(6U);
+    writeError = CAN_STATUS_ERROR;
+    process(0U);
+    HostTest_check(!CANRecovery_isPending(&recovery));
+    HostTest_checkEqual(recovery.stats.droppedCnt, 1U);
+}
+
+/*
+ *  ======== checkQueueFull ========
+ */
+static void checkQueueFull(void)
+{
+    uint32_t i;
+
+    init(false);
+    txFree = 0U;
+
+    for (i = 0U; i < CANRecovery_QUEUE_SIZE; i++)
+    {
+        HostTest_checkEqual(writeFrame(i), CAN_STATUS_SUCCESS);
+    }
+
+    HostTest_checkEqual(writeFrame(100U), CAN_STATUS_TX_BUF_FULL);
+    HostTest_checkEqual(recovery.stats.droppedCnt, 1U);
+    HostTest_checkEqual(recovery.stats.queueHighWaterMark, CANRecovery_QUEUE_SIZE);
+
+    txFree = 64U;
+    process(0U);
+    HostTest_checkEqual(writtenCnt, CANRecovery_QUEUE_SIZE);
+    HostTest_checkEqual(writtenIds[0], 0U);
+
+    /* Dropping the oldest keeps the newest frames */
+    init(true);
+    txFree = 0U;
+
+    for (i = 0U; i < (CANRecovery_QUEUE_SIZE + 2U); i++)
+    {
+        HostTest_checkEqual(writeFrame(i), CAN_STATUS_SUCCESS);
+    }
+
+    HostTest_checkEqual(recovery.stats.droppedCnt, 2U);
+
+    txFree = 64U;
+    process(0U);
+    HostTest_checkEqual(writtenCnt, CANRecovery_QUEUE_SIZE);
+    HostTest_checkEqual(writtenIds[0], 2U);
+    HostTest_checkEqual(writtenIds[CANRecovery_QUEUE_SIZE - 1U], CANRecovery_QUEUE_SIZE + 1U);
+}
+
+/*
+ *  ======== checkBusOff ========
+ *  Frames are held during the backoff and written after the restart.
+ */
+static void checkBusOff(void)
+{
+    uint64_t start = MS(5000U);
+
+    init(false);
+
+    /* Events other than bus off and bus on are ignored */
+    CANRecovery_event(&recovery, CAN_EVENT_ERR_PASSIVE, start);
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, start);
+    HostTest_check(CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(writeFrame(1U), CAN_STATUS_SUCCESS);
+    HostTest_checkEqual(writtenCnt, 0U);
+
+    process(start + MS(MIN_BACKOFF_MS) - 1U);
+    HostTest_check(CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(restartCalls, 0U);
+
+    process(start + MS(MIN_BACKOFF_MS));
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(restartCalls, 1U);
+    HostTest_checkEqual(writtenCnt, 1U);
+    HostTest_checkEqual(recovery.stats.lastDownTime, MS(MIN_BACKOFF_MS));
+
+    /* A driver that reports bus on by itself is not restarted */
+    start += MS(2U * STABLE_TIME_MS);
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, start);
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_ON, start + MS(2U));
+    process(start + MS(MIN_BACKOFF_MS));
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(restartCalls, 1U);
+
+    /* A failed restart is retried after the next backoff */
+    start += MS(2U * STABLE_TIME_MS);
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, start);
+    restartResult = false;
+    process(start + MS(MIN_BACKOFF_MS));
+    HostTest_check(CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(recovery.stats.restartFailCnt, 1U);
+    restartResult = true;
+    process(start + MS(MIN_BACKOFF_MS + (2U * MIN_BACKOFF_MS)) - 1U);
+    HostTest_check(CANRecovery_isBusOff(&recovery));
+    process(start + MS(MIN_BACKOFF_MS + (2U * MIN_BACKOFF_MS)));
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(recovery.stats.lastDownTime, MS(3U * MIN_BACKOFF_MS));
+
+    /* A bus off during the restart starts the next backoff */
+    start += MS(2U * STABLE_TIME_MS);
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, start);
+    busOffOnRestart = true;
+    process(start + MS(MIN_BACKOFF_MS));
+    HostTest_check(CANRecovery_isBusOff(&recovery));
+    process(start + MS(3U * MIN_BACKOFF_MS));
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(recovery.stats.busOffCnt, 5U);
+    HostTest_checkEqual(recovery.stats.maxDownTime, MS(3U * MIN_BACKOFF_MS));
+}
+
+/*
+ *  ======== checkBackoff ========
+ *  The backoff doubles up to the maximum while the bus goes off shortly after
+ *  each recovery, and starts over once the bus was stable.
+ */
+static void checkBackoff(void)
+{
+    static const uint32_t backoffs[] = {10U, 20U, 40U, 80U, 80U};
+    uint64_t now = MS(100U);
+    uint32_t i;
+
+    init(false);
+
+    for (i = 0U; i < (sizeof(backoffs) / sizeof(backoffs[0])); i++)
+    {
+        CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, now);
+        process(now + MS(backoffs[i]) - 1U);
+        HostTest_check(CANRecovery_isBusOff(&recovery));
+        now += MS(backoffs[i]);
+        process(now);
+        HostTest_check(!CANRecovery_isBusOff(&recovery));
+
+        now += MS(1U);
+    }
+
+    now += MS(STABLE_TIME_MS);
+    CANRecovery_event(&recovery, CAN_EVENT_BUS_OFF, now);
+    process(now + MS(MIN_BACKOFF_MS));
+    HostTest_check(!CANRecovery_isBusOff(&recovery));
+    HostTest_checkEqual(recovery.stats.downTime, MS(10U + 20U + 40U + 80U + 80U + MIN_BACKOFF_MS));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkTxFull();
+    checkQueueFull();
+    checkBusOff();
+    checkBackoff();
+
+    return HostTest_exit("CANRecovery");
+}
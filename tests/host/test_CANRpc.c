@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANRpc.c ========
+ *  Host checks of the pipelined CAN calls with the echo binding. The peer is
+ *  simulated by turning the sent requests into echo responses, which the
+ *  checks deliver in any order or drop.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANRpc.h"
+#include "HostTest.h"
+
+#define REQUEST_ID 0x123U
+
+/* 250ns ticks per millisecond */
+#define TICKS_PER_MS 4000U
+
+#define TIMEOUT_US  10000U
+#define MAX_RETRIES 2U
+
+/* Requests the simulated bus holds */
+#define BUS_SIZE 64U
+
+/* Result of a call, indexed by its doneArg */
+typedef struct
+{
+    uint32_t doneCnt;
+    CANRpc_Status status;
+    uint8_t data[CANRpc_PAYLOAD_MAX];
+    size_t length;
+} Result;
+
+static CANRpc_Object rpc;
+static CANRpc_EchoConfig echoConfig;
+static CAN_TxBufElement bus[BUS_SIZE];
+static uint32_t busCnt;
+static bool sendRefuse;
+static Result results[64];
+
+/*
+ *  ======== sendFxn ========
+ */
+static bool sendFxn(void *arg, const CAN_TxBufElement *elem)
+{
+    (void)arg;
+
+    if (sendRefuse || (busCnt == BUS_SIZE))
+    {
+        return false;
+    }
+
+    bus[busCnt++] = *elem;
+
+    return true;
+}
+
+/*
+ *  ======== doneFxn ========
+ */
+static void doneFxn(void *arg, CANRpc_Status status, const uint8_t *data, size_t length)
+{
+    Result *result = &results[(uintptr_t)arg];
+
+    result->doneCnt++;
+    result->status = status;
+    result->length = length;
+
+    if (length != 0U)
+    {
+        memcpy(result->data, data, length);
+    }
+}
+
+/*
+ *  ======== init ========
+ */
+static void init(uint32_t window, bool fd)
+{
+    CANRpc_Params params;
+
+    echoConfig.id  = REQUEST_ID;
+    echoConfig.xtd = false;
+    echoConfig.fd  = fd;
+
+    params.window            = window;
+    params.timeoutUs         = TIMEOUT_US;
+    params.maxRetries        = MAX_RETRIES;
+    params.binding.encodeFxn = CANRpc_encodeEcho;
+    params.binding.decodeFxn = CANRpc_decodeEcho;
+    params.binding.arg       = &echoConfig;
+    params.sendFxn           = sendFxn;
+    params.arg               = NULL;
+
+    CANRpc_init(&rpc, &params);
+
+    busCnt     = 0U;
+    sendRefuse = false;
+    memset(results, 0, sizeof(results));
+}
+
+/*
+ *  ======== call ========
+ *  Makes call n with a payload derived from n.
+ */
+static bool call(uint32_t n, size_t length, uint32_t now)
+{
+    uint8_t data[CANRpc_PAYLOAD_MAX];
+    size_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        data[i] = (uint8_t)((n * 16U) + i);
+    }
+
+    return CANRpc_call(&rpc, data, length, doneFxn, (void *)(uintptr_t)n, now);
+}
+
+/*
+ *  ======== respond ========
+ *  Delivers the echo response to request index of the bus.
+ */
+static bool respond(uint32_t index)
+{
+    CAN_RxBufElement elem;
+    uint32_t i;
+
+    memset(&elem, 0, sizeof(elem));
+    elem.id  = ~bus[index].id & 0x7FFU;
+    elem.dlc = bus[index].dlc;
+    elem.fdf = bus[index].fdf;
+    elem.brs = bus[index].brs;
+
+    for (i = 0U; i < CAN_MAX_DATA_LENGTH; i++)
+    {
+        elem.data[i] = ~bus[index].data[i];
+    }
+
+    return CANRpc_receive(&rpc, &elem);
+}
+
+/*
+ *  ======== corrIdOf ========
+ */
+static uint32_t corrIdOf(uint32_t index)
+{
+    return bus[index].data[0] | ((uint32_t)bus[index].data[1] << 8);
+}
+
+/*
+ *  ======== checkResult ========
+ *  Returns true if call n completed once with its payload of length bytes.
+ */
+static bool checkResult(uint32_t n, size_t length)
+{
+    const Result *result = &results[n];
+    size_t i;
+
+    if ((result->doneCnt != 1U) || (result->status != CANRpc_SUCCESS) || (result->length < length))
+    {
+        return false;
+    }
+
+    for (i = 0U; i < length; i++)
+    {
+        if (result->data[i] != (uint8_t)((n * 16U) + i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ *  ======== checkWindow ========
+ *  Responses in reverse order complete the matching calls.
+ */
+static void checkWindow(void)
+{
+    uint32_t n;
+
+    init(4U, false);
+
+    for (n = 0U; n < 4U; n++)
+    {
+        HostTest_check(call(n, 6U, 0U));
+    }
+
+    HostTest_check(!call(4U, 6U, 0U));
+    HostTest_checkEqual(CANRpc_getInFlight(&rpc), 4U);
+    HostTest_checkEqual(busCnt, 4U);
+    HostTest_checkEqual(bus[0].id, REQUEST_ID);
+    HostTest_checkEqual(bus[0].dlc, 8U);
+
+    for (n = 4U; n > 0U; n--)
+    {
+        HostTest_check(respond(n - 1U));
+    }
+
+    for (n = 0U; n < 4U; n++)
+    {
+        HostTest_check(checkResult(n, 6U));
+    }
+
+    /* A duplicate response matches no call */
+    HostTest_check(!respond(0U));
+    HostTest_checkEqual(rpc.stats.unmatchedCnt, 1U);
+    HostTest_checkEqual(rpc.stats.completedCnt, 4U);
+    HostTest_checkEqual(rpc.stats.maxInFlight, 4U);
+    HostTest_checkEqual(CANRpc_getInFlight(&rpc), 0U);
+
+    /* Data longer than a payload is refused */
+    HostTest_check(!call(5U, CANRpc_PAYLOAD_MAX - CANRpc_HEADER_SIZE + 1U, 0U));
+}
+
+/*
+ *  ======== checkRetries ========
+ *  Unanswered and refused requests are sent again, and a call times out
+ *  after the retries.
+ */
+static void checkRetries(void)
+{
+    uint32_t timeout = TIMEOUT_US * 4U;
+
+    init(2U, false);
+
+    HostTest_check(call(0U, 2U, 0U));
+    CANRpc_process(&rpc, timeout - 1U);
+    HostTest_checkEqual(busCnt, 1U);
+
+    /* Each retry reuses the correlation ID */
+    CANRpc_process(&rpc, timeout);
+    CANRpc_process(&rpc, 2U * timeout);
+    HostTest_checkEqual(busCnt, 3U);
+    HostTest_checkEqual(corrIdOf(2U), corrIdOf(0U));
+    HostTest_checkEqual(rpc.stats.retryCnt, 2U);
+
+    CANRpc_process(&rpc, 3U * timeout);
+    HostTest_checkEqual(results[0].doneCnt, 1U);
+    HostTest_checkEqual(results[0].status, CANRpc_TIMEOUT);
+    HostTest_checkEqual(rpc.stats.timeoutCnt, 1U);
+
+    /* The late response matches no call */
+    HostTest_check(!respond(2U));
+    HostTest_checkEqual(results[0].doneCnt, 1U);
+
+    /* A refused request is sent by the next process call, and its timeout
+     * starts then.
+     */
+    sendRefuse = true;
+    HostTest_check(call(1U, 2U, 0U));
+    HostTest_checkEqual(rpc.stats.sendFailCnt, 1U);
+    sendRefuse = false;
+    CANRpc_process(&rpc, 5U * TICKS_PER_MS);
+    HostTest_checkEqual(busCnt, 4U);
+    CANRpc_process(&rpc, (5U * TICKS_PER_MS) + timeout - 1U);
+    HostTest_checkEqual(rpc.stats.retryCnt, 2U);
+    HostTest_check(respond(3U));
+    HostTest_check(checkResult(1U, 2U));
+}
+
+/*
+ *  ======== checkCorrIds ========
+ *  Correlation IDs whose entry is taken by a call still in flight are
+ *  skipped, so a late response never completes a newer call. Shrinking the
+ *  window keeps the calls in flight.
+ */
+static void checkCorrIds(void)
+{
+    uint32_t n;
+
+    init(2U, false);
+
+    HostTest_check(call(0U, 1U, 0U));
+
+    for (n = 1U; n <= CANRpc_PENDING_SIZE; n++)
+    {
+        HostTest_check(call(n, 1U, 0U));
+        HostTest_check(respond(busCnt - 1U));
+    }
+
+    /* Correlation ID 16 would take the entry of call 0 */
+    HostTest_checkEqual(corrIdOf(CANRpc_PENDING_SIZE - 1U), CANRpc_PENDING_SIZE - 1U);
+    HostTest_checkEqual(corrIdOf(CANRpc_PENDING_SIZE), CANRpc_PENDING_SIZE + 1U);
+    HostTest_checkEqual(results[0].doneCnt, 0U);
+
+    CANRpc_setWindow(&rpc, 1U);
+    HostTest_check(!call(20U, 1U, 0U));
+    HostTest_check(respond(0U));
+    HostTest_check(checkResult(0U, 1U));
+    HostTest_check(call(20U, 1U, 0U));
+
+    CANRpc_setWindow(&rpc, 100U);
+    HostTest_checkEqual(rpc.params.window, CANRpc_PENDING_SIZE);
+}
+
+/*
+ *  ======== checkEcho ========
+ *  Frame layout of the echo binding.
+ */
+static void checkEcho(void)
+{
+    CAN_RxBufElement elem;
+    uint32_t i;
+
+    /* CAN FD payloads are padded to the next DLC */
+    init(1U, true);
+    HostTest_check(call(1U, 9U, 0U));
+    HostTest_checkEqual(bus[0].dlc, 9U);
+    HostTest_checkEqual(bus[0].fdf, 1U);
+    HostTest_checkEqual(bus[0].brs, 1U);
+    HostTest_checkEqual(bus[0].data[11], 0U);
+    HostTest_check(respond(0U));
+    HostTest_check(checkResult(1U, 9U));
+    HostTest_checkEqual(results[1].length, 10U);
+
+    /* Frames with another ID or format are not responses */
+    init(1U, false);
+    HostTest_check(call(2U, 4U, 0U));
+    memset(&elem, 0, sizeof(elem));
+    elem.id  = ~REQUEST_ID & 0x7FFU;
+    elem.xtd = 1U;
+    elem.dlc = 8U;
+    for (i = 0U; i < 8U; i++)
+    {
+        elem.data[i] = ~bus[0].data[i];
+    }
+
+    HostTest_check(!CANRpc_receive(&rpc, &elem));
+    elem.xtd = 0U;
+    elem.id  = REQUEST_ID;
+    HostTest_check(!CANRpc_receive(&rpc, &elem));
+    HostTest_checkEqual(rpc.stats.unmatchedCnt, 0U);
+    elem.id = ~REQUEST_ID & 0x7FFU;
+    HostTest_check(CANRpc_receive(&rpc, &elem));
+    HostTest_check(checkResult(2U, 4U));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkWindow();
+    checkRetries();
+    checkCorrIds();
+    checkEcho();
+
+    return HostTest_exit("CANRpc");
+}
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANSchedule.c ========
+ *  Host checks of the cyclic CAN schedule: releases on the period grid across
+ *  a network time wrap, jitter statistics, missed releases and realignment
+ *  after time steps, and the bus load and response time analysis.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANSchedule.h"
+#include "HostTest.h"
+
+#define TICKS_PER_USEC CANSchedule_TICKS_PER_USEC
+
+/* Release delay added to each call, cycling from 0 to JITTER_MAX ticks */
+#define JITTER_MAX 7U
+
+#define ENTRY_A 0U
+#define ENTRY_B 1U
+
+typedef struct
+{
+    uint64_t lastRelease;
+    uint32_t producedCnt;
+    uint32_t offGridCnt;
+    uint32_t lateCnt;
+    bool wrapSeen;
+} Producer;
+
+static Producer producers[2];
+static uint64_t releaseNow;
+static uint32_t skipEvery;
+static bool submitFails;
+static uint32_t submittedCnt;
+
+/*
+ *  ======== produceFxn ========
+ *  Checks that the release time is on the grid of the entry and not after
+ *  the release.
+ */
+static bool produceFxn(void *arg, CAN_TxBufElement *elem, uint64_t releaseTime);
+
+static const CANSchedule_Entry entries[] = {
+    {0x100U, false, false, false, CAN_DLC_8B, 1000U, 0U, produceFxn, &producers[ENTRY_A]},
+    {0x200U, false, false, false, CAN_DLC_8B, 2500U, 300U, produceFxn, &producers[ENTRY_B]},
+};
+
+static CANSchedule_Slot slots[2];
+static CANSchedule_Object schedule;
+
+static bool produceFxn(void *arg, CAN_TxBufElement *elem, uint64_t releaseTime)
+{
+    Producer *producer             = (Producer *)arg;
+    const CANSchedule_Entry *entry = &entries[elem->mm];
+    uint32_t period                = entry->periodUs * TICKS_PER_USEC;
+    uint32_t offset                = entry->offsetUs * TICKS_PER_USEC;
+
+    HostTest_checkEqual(elem->id, entry->id);
+    HostTest_checkEqual(elem->dlc, entry->dlc);
+
+    if ((((uint32_t)releaseTime - offset) % period) != 0U)
+    {
+        producer->offGridCnt++;
+    }
+
+    if ((releaseTime > releaseNow) || (releaseTime <= producer->lastRelease))
+    {
+        producer->lateCnt++;
+    }
+
+    if ((uint32_t)releaseTime == offset)
+    {
+        producer->wrapSeen = true;
+    }
+
+    producer->lastRelease = releaseTime;
+    producer->producedCnt++;
+
+    return (skipEvery == 0U) || ((producer->producedCnt % skipEvery) != 0U);
+}
+
+/*
+ *  ======== submitFxn ========
+ */
+static int_fast16_t submitFxn(void *arg, const CAN_TxBufElement *elem)
+{
+    (void)arg;
+    (void)elem;
+
+    if (submitFails)
+    {
+        return CAN_STATUS_TX_BUF_FULL;
+    }
+
+    submittedCnt++;
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== CAN_getBitTiming ========
+ *  Referenced by CANStats, not used by the checks.
+ */
+int_fast16_t CAN_getBitTiming(CAN_Handle handle, CAN_BitTimingParams *bitTiming, uint32_t *clkFreqKhz)
+{
+    (void)handle;
+    (void)bitTiming;
+    (void)clkFreqKhz;
+
+    return CAN_STATUS_NOT_SUPPORTED;
+}
+
+/*
+ *  ======== release ========
+ *  Releases the frames due at the 64-bit time now and returns the delay to
+ *  the next release.
+ */
+static uint32_t release(uint64_t now)
+{
+    releaseNow = now;
+
+    return CANSchedule_release(&schedule, (uint32_t)now);
+}
+
+/*
+ *  ======== checkReleases ========
+ *  Runs the schedule for 2000 releases across a network time wrap with a
+ *  varying release delay.
+ */
+static void checkReleases(void)
+{
+    uint64_t start = 0xFFFF0000ULL;
+    uint64_t now;
+    uint64_t expected;
+    uint32_t delay;
+    uint32_t i;
+
+    CANSchedule_init(&schedule, entries, slots, 2U, submitFxn, NULL);
+
+    now   = start;
+    delay = release(now);
+
+    for (i = 0U; i < 2000U; i++)
+    {
+        HostTest_check((delay != 0U) && (delay <= (1000U * TICKS_PER_USEC)));
+        now  += delay + (i % (JITTER_MAX + 1U));
+        delay = release(now);
+    }
+
+    /* Every grid point up to now was released once, in order and on time */
+    expected = ((now - start) / (1000U * TICKS_PER_USEC)) + 1U;
+    HostTest_check(now > 0x100000000ULL);
+    HostTest_checkEqual(producers[ENTRY_A].offGridCnt, 0U);
+    HostTest_checkEqual(producers[ENTRY_A].lateCnt, 0U);
+    HostTest_check(producers[ENTRY_A].wrapSeen);
+    HostTest_checkEqual(producers[ENTRY_B].offGridCnt, 0U);
+    HostTest_checkEqual(producers[ENTRY_B].lateCnt, 0U);
+    HostTest_check(producers[ENTRY_B].wrapSeen);
+
+    /* 2^32 ticks are not a multiple of the period of entry A, so the cycle
+     * before the wrap is shortened and adds one release.
+     */
+    HostTest_check((slots[ENTRY_A].stats.releasedCnt == expected) ||
+                   (slots[ENTRY_A].stats.releasedCnt == (expected + 1U)));
+    HostTest_checkEqual(slots[ENTRY_A].stats.missedCnt, 0U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.realignCnt, 0U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.minJitter, 0U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.maxJitter, JITTER_MAX);
+    HostTest_checkEqual(submittedCnt, slots[ENTRY_A].stats.releasedCnt + slots[ENTRY_B].stats.releasedCnt);
+}
+
+/*
+ *  ======== checkMissed ========
+ *  Skipped and refused releases, late releases, and realignment after the
+ *  network time steps forward and back.
+ */
+static void checkMissed(void)
+{
+    uint64_t now = 250000ULL * 1000U * TICKS_PER_USEC;
+    uint32_t period = 1000U * TICKS_PER_USEC;
+    uint32_t releasedCnt;
+
+    /* Only entry A, released at the start time */
+    CANSchedule_init(&schedule, entries, slots, 1U, submitFxn, NULL);
+    producers[ENTRY_A].lastRelease = 0U;
+
+    skipEvery = 2U;
+    (void)release(now);
+    (void)release(now + period);
+    HostTest_checkEqual(slots[ENTRY_A].stats.releasedCnt + slots[ENTRY_A].stats.skippedCnt, 2U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.skippedCnt, 1U);
+    skipEvery = 0U;
+
+    submitFails = true;
+    (void)release(now + (2U * period));
+    HostTest_checkEqual(slots[ENTRY_A].stats.failedCnt, 1U);
+    submitFails = false;
+
+    /* A release 3.5 periods late skips three releases */
+    releasedCnt = slots[ENTRY_A].stats.releasedCnt;
+    now        += (3U * period) + (3U * period) + (period / 2U);
+    (void)release(now);
+    HostTest_checkEqual(slots[ENTRY_A].stats.releasedCnt, releasedCnt);
+    HostTest_checkEqual(slots[ENTRY_A].stats.missedCnt, 3U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.realignCnt, 1U);
+
+    /* The next release is back on the grid */
+    HostTest_checkEqual(release(now), period / 2U);
+    (void)release(now + (period / 2U));
+    HostTest_checkEqual(slots[ENTRY_A].stats.releasedCnt, releasedCnt + 1U);
+
+    /* A step back realigns without releasing */
+    now -= 10U * period;
+    (void)release(now);
+    HostTest_checkEqual(slots[ENTRY_A].stats.realignCnt, 2U);
+    HostTest_checkEqual(slots[ENTRY_A].stats.releasedCnt, releasedCnt + 1U);
+    HostTest_checkEqual(producers[ENTRY_A].offGridCnt, 0U);
+}
+
+/*
+ *  ======== checkAnalysis ========
+ *  An 8-byte classic frame with an 11-bit ID takes at most 135 bits, 270us at
+ *  500kbit/s.
+ */
+static void checkAnalysis(void)
+{
+    static CANSchedule_Entry table[] = {
+        {0x300U, false, false, false, CAN_DLC_8B, 1000U, 0U, NULL, NULL},
+        {0x100U, false, false, false, CAN_DLC_8B, 1000U, 0U, NULL, NULL},
+        {0x200U, false, false, false, CAN_DLC_8B, 1000U, 0U, NULL, NULL},
+        {0x400U, false, false, false, CAN_DLC_8B, 1000U, 0U, NULL, NULL},
+    };
+    uint32_t responseTimeUs[4];
+
+    HostTest_checkEqual(CANSchedule_getLoad(table, 1U, 500000U, 500000U), 270U);
+    HostTest_checkEqual(CANSchedule_getLoad(table, 4U, 500000U, 500000U), 1080U);
+
+    HostTest_check(CANSchedule_analyze(table, 1U, 500000U, 500000U, responseTimeUs));
+    HostTest_checkEqual(responseTimeUs[0], 270U);
+
+    /* The lowest priority frame waits for the two higher ones, the others for
+     * one lower priority frame already on the bus.
+     */
+    HostTest_check(CANSchedule_analyze(table, 3U, 500000U, 500000U, responseTimeUs));
+    HostTest_checkEqual(responseTimeUs[0], 810U);
+    HostTest_checkEqual(responseTimeUs[1], 540U);
+    HostTest_checkEqual(responseTimeUs[2], 810U);
+
+    /* A fourth frame leaves no time for the two lowest priority frames */
+    HostTest_check(!CANSchedule_analyze(table, 4U, 500000U, 500000U, responseTimeUs));
+    HostTest_checkEqual(responseTimeUs[0], UINT32_MAX);
+    HostTest_checkEqual(responseTimeUs[1], 540U);
+    HostTest_checkEqual(responseTimeUs[2], 810U);
+    HostTest_checkEqual(responseTimeUs[3], UINT32_MAX);
+
+    /* An extended ID is ordered by its 11-bit base ID first, so it does not
+     * wait for the 11-bit ID 0x101.
+     */
+    table[0].id  = 0x101U;
+    table[0].dlc = CAN_DLC_0B;
+    table[1].id  = 0x100U << 18;
+    table[1].xtd = true;
+    table[1].dlc = CAN_DLC_0B;
+    HostTest_check(CANSchedule_analyze(table, 4U, 500000U, 500000U, responseTimeUs));
+    HostTest_check(responseTimeUs[1] < responseTimeUs[0]);
+
+    table[1].id = 0x102U << 18;
+    HostTest_check(CANSchedule_analyze(table, 4U, 500000U, 500000U, responseTimeUs));
+    HostTest_check(responseTimeUs[0] < responseTimeUs[1]);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkReleases();
+    checkMissed();
+    checkAnalysis();
+
+    return HostTest_exit("CANSchedule");
+}
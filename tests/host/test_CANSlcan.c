@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANSlcan.c ========
+ *  Host checks of the SLCAN gateway: the replies to each command, the frames
+ *  passed to the write function, the lines reported for received frames, and
+ *  the handling of malformed commands and a full output ring.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANSlcan.h"
+#include "HostTest.h"
+
+/* Lines of 8-byte classic frames with an 11-bit ID that fit in the output
+ * ring after a 6 byte reply
+ */
+#define FRAME_LINE_SIZE 22U
+#define FRAME_LINES     ((CANSlcan_OUTPUT_SIZE - 6U) / FRAME_LINE_SIZE)
+
+static CANSlcan_Object slcan;
+
+/* Simulated driver */
+static CAN_TxBufElement lastTx;
+static uint32_t txCnt;
+static bool txRefuse;
+static uint32_t lastBitRate;
+
+/* Output read from the ring by the last command */
+static char output[CANSlcan_OUTPUT_SIZE + 1U];
+
+/*
+ *  ======== writeFxn ========
+ */
+static bool writeFxn(void *arg, const CAN_TxBufElement *elem)
+{
+    (void)arg;
+
+    if (txRefuse)
+    {
+        return false;
+    }
+
+    lastTx = *elem;
+    txCnt++;
+
+    return true;
+}
+
+/*
+ *  ======== bitRateFxn ========
+ *  Accepts the bit rates up to 500kbit/s.
+ */
+static bool bitRateFxn(void *arg, uint32_t bitRate)
+{
+    (void)arg;
+
+    lastBitRate = bitRate;
+
+    return (bitRate <= 500000U);
+}
+
+/*
+ *  ======== readOutput ========
+ *  Moves the output ring to the output string.
+ */
+static const char *readOutput(void)
+{
+    const char *data;
+    size_t length = 0U;
+    size_t count;
+
+    while ((count = CANSlcan_peek(&slcan, &data)) != 0U)
+    {
+        memcpy(&output[length], data, count);
+        length += count;
+        CANSlcan_consume(&slcan, count);
+    }
+
+    output[length] = '\0';
+
+    return output;
+}
+
+/*
+ *  ======== command ========
+ *  Sends a command, one byte at a time if split is set, and returns the
+ *  output.
+ */
+static const char *command(const char *cmd, bool split)
+{
+    size_t i;
+
+    if (split)
+    {
+        for (i = 0U; cmd[i] != '\0'; i++)
+        {
+            CANSlcan_input(&slcan, (const uint8_t *)&cmd[i], 1U);
+        }
+    }
+    else
+    {
+        CANSlcan_input(&slcan, (const uint8_t *)cmd, strlen(cmd));
+    }
+
+    return readOutput();
+}
+
+/*
+ *  ======== init ========
+ */
+static void init(void)
+{
+    CANSlcan_Params params;
+
+    params.writeFxn   = writeFxn;
+    params.bitRateFxn = bitRateFxn;
+    params.arg        = NULL;
+
+    CANSlcan_init(&slcan, &params);
+
+    txCnt    = 0U;
+    txRefuse = false;
+}
+
+/*
+ *  ======== checkCommands ========
+ *  A session in whole and in single byte chunks.
+ */
+static void checkCommands(void)
+{
+    uint32_t split;
+
+    for (split = 0U; split < 2U; split++)
+    {
+        init();
+
+        HostTest_check(strcmp(command("V\r", split), "V0101\r") == 0);
+        HostTest_check(strcmp(command("N\r\n", split), "N0001\r") == 0);
+        HostTest_check(strcmp(command("\r", split), "\r") == 0);
+
+        HostTest_check(strcmp(command("S6\r", split), "\r") == 0);
+        HostTest_checkEqual(lastBitRate, 500000U);
+        HostTest_check(strcmp(command("S8\r", split), "\a") == 0);
+        HostTest_checkEqual(lastBitRate, 1000000U);
+        HostTest_check(strcmp(command("S9\rS\r", split), "\a\a") == 0);
+
+        /* Frames are only sent while the channel is open */
+        HostTest_check(strcmp(command("t1230\r", split), "\a") == 0);
+        HostTest_check(strcmp(command("O\r", split), "\r") == 0);
+        HostTest_check(CANSlcan_isOpen(&slcan));
+        HostTest_check(strcmp(command("O\rS6\r", split), "\a\a") == 0);
+
+        HostTest_check(strcmp(command("t1232aBbb7\r", split), "\a") == 0);
+        HostTest_check(strcmp(command("t1232aBbb\r", split), "z\r") == 0);
+        HostTest_checkEqual(lastTx.id, 0x123U);
+        HostTest_checkEqual(lastTx.xtd, 0U);
+        HostTest_checkEqual(lastTx.dlc, 2U);
+        HostTest_checkEqual(lastTx.data[0], 0xABU);
+        HostTest_checkEqual(lastTx.data[1], 0xBBU);
+
+        HostTest_check(strcmp(command("T1ABCDEF8801020304050607FF\r", split), "Z\r") == 0);
+        HostTest_checkEqual(lastTx.id, 0x1ABCDEF8U);
+        HostTest_checkEqual(lastTx.xtd, 1U);
+        HostTest_checkEqual(lastTx.data[7], 0xFFU);
+
+        HostTest_check(strcmp(command("r7FF4\rR000000010\r", split), "z\rZ\r") == 0);
+        HostTest_checkEqual(lastTx.rtr, 1U);
+        HostTest_checkEqual(lastTx.xtd, 1U);
+        HostTest_checkEqual(lastTx.dlc, 0U);
+
+        HostTest_check(strcmp(command("d1009000102030405060708090A0B\r", split), "z\r") == 0);
+        HostTest_checkEqual(lastTx.fdf, 1U);
+        HostTest_checkEqual(lastTx.brs, 0U);
+        HostTest_checkEqual(lastTx.dlc, 9U);
+        HostTest_checkEqual(lastTx.data[11], 0x0BU);
+        HostTest_check(strcmp(command("B1FFFFFFF1EE\r", split), "Z\r") == 0);
+        HostTest_checkEqual(lastTx.brs, 1U);
+        HostTest_checkEqual(lastTx.id, 0x1FFFFFFFU);
+
+        /* Out of range IDs and DLCs, bad lengths and digits */
+        HostTest_check(strcmp(command("t8000\rT200000000\rt1009000102030405060708090A0B\r", split), "\a\a\a") ==
+                       0);
+        HostTest_check(strcmp(command("t1001\rt10010G\rt12\rx\r", split), "\a\a\a\a") == 0);
+        HostTest_checkEqual(txCnt, 6U);
+
+        /* A refused frame sets the Tx full status flag */
+        txRefuse = true;
+        HostTest_check(strcmp(command("t1000\r", split), "\a") == 0);
+        CANSlcan_setStatus(&slcan, CANSlcan_STATUS_ERR_PASSIVE);
+        HostTest_check(strcmp(command("F\r", split), "F22\r") == 0);
+        HostTest_check(strcmp(command("F\r", split), "F00\r") == 0);
+
+        HostTest_check(strcmp(command("C\r", split), "\r") == 0);
+        HostTest_check(!CANSlcan_isOpen(&slcan));
+
+        HostTest_checkEqual(slcan.stats.txCnt, 6U);
+        HostTest_checkEqual(slcan.stats.txRefusedCnt, 1U);
+        HostTest_checkEqual(slcan.stats.cmdErrCnt, 15U);
+    }
+}
+
+/*
+ *  ======== checkLongCommand ========
+ *  A command longer than the longest valid one is refused as a whole.
+ */
+static void checkLongCommand(void)
+{
+    char cmd[CANSlcan_MAX_CMD_LENGTH + 3U];
+
+    init();
+
+    memset(cmd, '0', sizeof(cmd));
+    cmd[0]               = 'V';
+    cmd[sizeof(cmd) - 2U] = '\r';
+    cmd[sizeof(cmd) - 1U] = '\0';
+
+    HostTest_check(strcmp(command(cmd, false), "\a") == 0);
+    HostTest_check(strcmp(command("V\r", false), "V0101\r") == 0);
+}
+
+/*
+ *  ======== checkRxFrames ========
+ */
+static void checkRxFrames(void)
+{
+    CAN_RxBufElement elem;
+    uint32_t i;
+
+    init();
+
+    memset(&elem, 0, sizeof(elem));
+    elem.id      = 0x123U;
+    elem.dlc     = 2U;
+    elem.data[0] = 0xAAU;
+    elem.data[1] = 0x0BU;
+
+    HostTest_check(!CANSlcan_rxFrame(&slcan, &elem, 0U));
+    (void)command("O\r", false);
+
+    HostTest_check(CANSlcan_rxFrame(&slcan, &elem, 0U));
+    HostTest_check(strcmp(readOutput(), "t1232AA0B\r") == 0);
+
+    /* Timestamps are milliseconds modulo one minute */
+    (void)command("Z1\r", false);
+    HostTest_check(CANSlcan_rxFrame(&slcan, &elem, 60000U + 0x1234U));
+    HostTest_check(strcmp(readOutput(), "t1232AA0B1234\r") == 0);
+    (void)command("Z0\r", false);
+
+    elem.xtd = 1U;
+    elem.rtr = 1U;
+    elem.id  = 0x1ABCDEFU;
+    HostTest_check(CANSlcan_rxFrame(&slcan, &elem, 0U));
+    HostTest_check(strcmp(readOutput(), "R01ABCDEF2\r") == 0);
+
+    elem.xtd = 0U;
+    elem.rtr = 0U;
+    elem.fdf = 1U;
+    elem.brs = 1U;
+    elem.dlc = 9U;
+    for (i = 0U; i < 12U; i++)
+    {
+        elem.data[i] = (uint8_t)i;
+    }
+
+    elem.id = 0x7FFU;
+    HostTest_check(CANSlcan_rxFrame(&slcan, &elem, 0U));
+    HostTest_check(strcmp(readOutput(), "b7FF9000102030405060708090A0B\r") == 0);
+
+    /* Frames that do not fit in the output ring are dropped. A reply and the
+     * frame lines leave 2 bytes free.
+     */
+    elem.fdf = 0U;
+    elem.brs = 0U;
+    elem.dlc = 8U;
+    CANSlcan_input(&slcan, (const uint8_t *)"V\r", 2U);
+    for (i = 0U; i < (FRAME_LINES + 2U); i++)
+    {
+        (void)CANSlcan_rxFrame(&slcan, &elem, 0U);
+    }
+
+    HostTest_checkEqual(slcan.stats.rxCnt, FRAME_LINES + 4U);
+    HostTest_checkEqual(slcan.stats.rxDroppedCnt, 2U);
+    HostTest_checkEqual(CANSlcan_getCount(&slcan), CANSlcan_OUTPUT_SIZE - 2U);
+    HostTest_checkEqual(slcan.stats.highWaterMark, CANSlcan_OUTPUT_SIZE - 2U);
+
+    /* The status flags are kept until a reply reports them */
+    CANSlcan_input(&slcan, (const uint8_t *)"F\r", 2U);
+    HostTest_checkEqual(slcan.stats.replyDroppedCnt, 1U);
+    HostTest_check(strncmp(readOutput(), "V0101\rt7FF8", 11U) == 0);
+    HostTest_check(strcmp(command("F\r", false), "F08\r") == 0);
+    HostTest_check(strcmp(command("F\r", false), "F00\r") == 0);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkCommands();
+    checkLongCommand();
+    checkRxFrames();
+
+    return HostTest_exit("CANSlcan");
+}
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CANTimestamp.c ========
+ *  Host checks of the CAN timestamp conversion. SYSTIM and the CAN timestamp
+ *  counter are simulated, with the counter running at the SYSTIM rate and an
+ *  arbitrary phase.
+ */
+#include <stdint.h>
+
+#include <ti/drivers/CAN.h>
+
+#include <ti/devices/DeviceFamily.h>
+#include DeviceFamily_constructPath(inc/hw_memmap.h)
+#include DeviceFamily_constructPath(inc/hw_systim.h)
+#include DeviceFamily_constructPath(inc/hw_types.h)
+
+#include "CANTimestamp.h"
+#include "HostTest.h"
+
+/* Timestamp prescaler giving one counter tick per 250ns SYSTIM tick */
+#define TS_PRESCALER CANTimestamp_HOST_CLK_PER_SYSTIM_TICK
+
+/* 250ns ticks per millisecond */
+#define TICKS_PER_MS 4000U
+
+/* Phase of the timestamp counter relative to SYSTIM */
+#define COUNTER_PHASE 0x1234U
+
+uint32_t HostStub_systimRegs[64];
+
+/* Simulated 64-bit time */
+static uint64_t now;
+
+/* Start Of Frame to timestamp delay measured after CANTimestamp_init() */
+static uint32_t sofDelay;
+
+/*
+ *  ======== CAN_getBitTiming ========
+ *  80 MHz functional clock, 500 kbit/s nominal bit rate.
+ */
+int_fast16_t CAN_getBitTiming(CAN_Handle handle, CAN_BitTimingParams *bitTiming, uint32_t *clkFreqKhz)
+{
+    bitTiming->nomRatePrescaler = 0U;
+    bitTiming->nomTimeSeg1      = 126U;
+    bitTiming->nomTimeSeg2      = 31U;
+    *clkFreqKhz                 = 80000U;
+
+    return CAN_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== MCAN_getTimestampCounter ========
+ */
+uint16_t MCAN_getTimestampCounter(void)
+{
+    return (uint16_t)(now + COUNTER_PHASE);
+}
+
+/*
+ *  ======== DCAN_getTimestampCounter ========
+ */
+uint16_t DCAN_getTimestampCounter(void)
+{
+    return MCAN_getTimestampCounter();
+}
+
+/*
+ *  ======== advance ========
+ *  Moves the time forward by ticks, in steps short enough for the SYSTIM
+ *  wrap to be seen.
+ */
+static void advance(uint64_t ticks)
+{
+    uint64_t step;
+
+    while (ticks > 0U)
+    {
+        step = (ticks > 0x40000000U) ? 0x40000000U : ticks;
+        now += step;
+        ticks -= step;
+
+        HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N) = (uint32_t)now;
+        (void)CANTimestamp_getTime();
+    }
+}
+
+/*
+ *  ======== rxts ========
+ *  Rx timestamp of a frame with its SOF at sofTime.
+ */
+static uint16_t rxts(uint64_t sofTime)
+{
+    return (uint16_t)(sofTime + sofDelay + COUNTER_PHASE);
+}
+
+/*
+ *  ======== checkInit ========
+ */
+static void checkInit(void)
+{
+    CANTimestamp_Ref ref;
+
+    now = 0xFFFF0000U;
+    HWREG(SYSTIM_BASE + SYSTIM_O_TIME250N) = (uint32_t)now;
+
+    CANTimestamp_init(NULL, TS_PRESCALER);
+
+    HostTest_checkEqual(CANTimestamp_getCounterPeriod(), CANTimestamp_COUNTER_RANGE);
+
+    /* A timestamp taken at the reference is converted to the reference time
+     * minus the SOF delay.
+     */
+    CANTimestamp_capture(&ref);
+    sofDelay = (uint32_t)(ref.systim - CANTimestamp_toSofTime(&ref, ref.tscv));
+
+    HostTest_check((sofDelay > 0U) && (sofDelay < 100U));
+}
+
+/*
+ *  ======== checkWrap ========
+ *  The 64-bit time keeps counting across SYSTIM wraps.
+ */
+static void checkWrap(void)
+{
+    uint64_t start = CANTimestamp_getTime();
+
+    advance(3ULL << 32);
+
+    HostTest_checkEqual(CANTimestamp_getTime() - start, 3ULL << 32);
+    HostTest_checkEqual(CANTimestamp_extendTime((uint32_t)now - 10U), now - 10U);
+    HostTest_checkEqual(CANTimestamp_extendTime((uint32_t)now), now);
+}
+
+/*
+ *  ======== checkRxSofTime ========
+ *  Frames read long after their event still resolve to their SOF time, as
+ *  long as the SOF is within the bounds documented in CANTimestamp.h.
+ */
+static void checkRxSofTime(void)
+{
+    static const uint32_t readDelaysMs[] = {0U, 5U, 9U, 12U, 16U, 40U, 1000U};
+    CANTimestamp_Ref ref;
+    uint64_t eventTime;
+    uint64_t beforeSof;
+    uint64_t afterSof;
+    uint32_t i;
+
+    for (i = 0U; i < (sizeof(readDelaysMs) / sizeof(readDelaysMs[0])); i++)
+    {
+        /* One frame received the longest time allowed before the event, and
+         * one received 12ms after it and read in the same burst. The latter
+         * is more than half a counter period after the event.
+         */
+        advance(10U * TICKS_PER_MS);
+        eventTime = now;
+        beforeSof = eventTime - (CANTimestamp_RX_MAX_AGE_USEC * 4U) + 1U;
+        afterSof  = eventTime + (12U * TICKS_PER_MS);
+
+        advance(13U * TICKS_PER_MS);
+        advance(readDelaysMs[i] * TICKS_PER_MS);
+        CANTimestamp_capture(&ref);
+
+        HostTest_checkEqual(CANTimestamp_toRxSofTime(&ref, rxts(beforeSof), (uint32_t)eventTime), beforeSof);
+        HostTest_checkEqual(CANTimestamp_toRxSofTime(&ref, rxts(afterSof), (uint32_t)eventTime), afterSof);
+    }
+}
+
+/*
+ *  ======== checkSofTimeAfter ========
+ *  A Tx timestamp resolves to the first SOF after the write time.
+ */
+static void checkSofTimeAfter(void)
+{
+    CANTimestamp_Ref ref;
+    uint64_t writeTime;
+    uint64_t sofTime;
+
+    advance(TICKS_PER_MS);
+    writeTime = now;
+    sofTime   = writeTime + (3U * TICKS_PER_MS);
+
+    advance(50U * TICKS_PER_MS);
+    CANTimestamp_capture(&ref);
+
+    HostTest_checkEqual(CANTimestamp_toSofTimeAfter(&ref, rxts(sofTime), writeTime), sofTime);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkInit();
+    checkWrap();
+    checkRxSofTime();
+    checkSofTimeAfter();
+
+    return HostTest_exit("CANTimestamp");
+}
@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CaptureReader.c ========
+ *  Host checks of the capture reader: captures written by CANCapture are
+ *  read in uneven parts with corrupted bytes between the records, and
+ *  converted to candump log lines and pcap records across a wrap of the
+ *  record time.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCapture.h"
+#include "CaptureReader.h"
+#include "HostTest.h"
+
+/* Frames read by a check */
+#define FRAME_MAX 64U
+
+/* Capture bytes read by a check */
+#define STREAM_SIZE (FRAME_MAX * (CANCapture_MAX_RECORD_SIZE + 4U))
+
+/* Frames of the conversion checks */
+#define FRAME_COUNT 5U
+
+static CANCapture_Object capture;
+static uint8_t stream[STREAM_SIZE];
+static size_t streamSize;
+static CaptureReader_Frame frames[FRAME_MAX];
+static uint32_t frameCnt;
+
+/*
+ *  ======== storeFrame ========
+ *  CaptureReader_FrameFxn that keeps the frames read.
+ */
+static void storeFrame(void *arg, const CaptureReader_Frame *frame)
+{
+    if (frameCnt < FRAME_MAX)
+    {
+        frames[frameCnt] = *frame;
+    }
+
+    frameCnt++;
+}
+
+/*
+ *  ======== drain ========
+ *  Appends the bytes in the capture ring to the stream.
+ */
+static void drain(void)
+{
+    const uint8_t *data;
+    size_t count;
+
+    while ((count = CANCapture_peek(&capture, &data)) > 0U)
+    {
+        if (count > (sizeof(stream) - streamSize))
+        {
+            count = sizeof(stream) - streamSize;
+        }
+
+        memcpy(&stream[streamSize], data, count);
+        streamSize += count;
+        CANCapture_consume(&capture, count);
+    }
+}
+
+/*
+ *  ======== readStream ========
+ *  Reads the stream in parts of 1 to 7 bytes.
+ */
+static void readStream(CaptureReader_Object *reader)
+{
+    size_t offset = 0U;
+    size_t count;
+
+    CaptureReader_init(reader, storeFrame, NULL);
+    frameCnt = 0U;
+
+    while (offset < streamSize)
+    {
+        count = 1U + (offset % 7U);
+        if (count > (streamSize - offset))
+        {
+            count = streamSize - offset;
+        }
+
+        CaptureReader_receive(reader, &stream[offset], count);
+        offset += count;
+    }
+}
+
+/*
+ *  ======== writeFrames ========
+ *  Captures the frames of the conversion checks, with 3 corrupted bytes
+ *  before each record. The last two frames are stored across a wrap of the
+ *  record time.
+ */
+static void writeFrames(void)
+{
+    static const uint8_t corrupted[3] = {0x00U, 0xFFU, 0x5AU};
+    CAN_RxBufElement rxElem;
+    CAN_TxBufElement txElem;
+    uint32_t i;
+
+    CANCapture_init(&capture, false);
+    streamSize = 0U;
+
+    /* Classic frame */
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id  = 0x123U;
+    rxElem.dlc = CAN_DLC_8B;
+    for (i = 0U; i < 8U; i++)
+    {
+        rxElem.data[i] = (uint8_t)(0x11U * (i + 1U));
+    }
+    memcpy(&stream[streamSize], corrupted, sizeof(corrupted));
+    streamSize += sizeof(corrupted);
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 4000000U));
+    drain();
+
+    /* CAN FD frame with an extended ID and bit rate switching */
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id  = 0x1ABCDEFU;
+    rxElem.xtd = 1U;
+    rxElem.fdf = 1U;
+    rxElem.brs = 1U;
+    rxElem.dlc = CAN_DLC_12B;
+    for (i = 0U; i < 12U; i++)
+    {
+        rxElem.data[i] = (uint8_t)i;
+    }
+    memcpy(&stream[streamSize], corrupted, sizeof(corrupted));
+    streamSize += sizeof(corrupted);
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 4000001U));
+    drain();
+
+    /* Remote frame written by the device */
+    memset(&txElem, 0, sizeof(txElem));
+    txElem.id  = 0x7FFU;
+    txElem.rtr = 1U;
+    txElem.dlc = CAN_DLC_3B;
+    memcpy(&stream[streamSize], corrupted, sizeof(corrupted));
+    streamSize += sizeof(corrupted);
+    HostTest_check(CANCapture_txFrame(&capture, &txElem, 4000004U));
+    drain();
+
+    /* CAN FD frame with the error state indicator, before the wrap */
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id  = 0x001U;
+    rxElem.fdf = 1U;
+    rxElem.esi = 1U;
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 0xFFFFFFFFU));
+    drain();
+
+    /* Empty classic frame after the wrap */
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id = 0x100U;
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 4U));
+    drain();
+}
+
+/*
+ *  ======== checkCandump ========
+ */
+static void checkCandump(void)
+{
+    static const char *const lines[FRAME_COUNT] = {
+        "(1.000000) can0 123#1122334455667788\n",
+        "(1.000000) can0 01ABCDEF##1000102030405060708090A0B\n",
+        "(1.000001) can0 7FF#R3\n",
+        "(1073.741823) can0 001##2\n",
+        "(1073.741825) can0 100#\n",
+    };
+    CaptureReader_Object reader;
+    char line[CaptureReader_CANDUMP_LINE_MAX];
+    uint32_t i;
+
+    writeFrames();
+    readStream(&reader);
+
+    HostTest_checkEqual(frameCnt, FRAME_COUNT);
+    HostTest_checkEqual(reader.stats.recordCnt, FRAME_COUNT);
+    HostTest_checkEqual(reader.stats.lostCnt, 0U);
+    HostTest_checkEqual(reader.stats.skippedCnt, 9U);
+    HostTest_checkEqual(CaptureReader_getPending(&reader), 0U);
+
+    HostTest_check(frames[2].record.flags & CANCapture_FLAG_TX);
+    HostTest_check(frames[4].time == 0x100000004ULL);
+
+    for (i = 0U; (i < FRAME_COUNT) && (i < frameCnt); i++)
+    {
+        HostTest_checkEqual(CaptureReader_formatCandump(&frames[i], "can0", line, sizeof(line)), strlen(lines[i]));
+        HostTest_check(strcmp(line, lines[i]) == 0);
+    }
+
+    /* A line that does not fit is cut off */
+    HostTest_checkEqual(CaptureReader_formatCandump(&frames[0], "can0", line, 12U), 11U);
+    HostTest_check(strcmp(line, "(1.000000) ") == 0);
+}
+
+/*
+ *  ======== checkPcap ========
+ */
+static void checkPcap(void)
+{
+    static const uint8_t header[CaptureReader_PCAP_HEADER_SIZE] = {
+        0x4DU, 0x3CU, 0xB2U, 0xA1U, 0x02U, 0x00U, 0x04U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+        0x00U, 0x00U, 0x00U, 0x00U, 0x48U, 0x00U, 0x00U, 0x00U, 0xE3U, 0x00U, 0x00U, 0x00U,
+    };
+    static const uint8_t classic[16U + 16U] = {
+        0x01U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U,
+        0x00U, 0x10U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x01U, 0x23U, 0x08U, 0x00U,
+        0x00U, 0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U, 0x66U, 0x77U, 0x88U,
+    };
+    static const uint8_t fdHeader[16U + 8U] = {
+        0x01U, 0x00U, 0x00U, 0x00U, 0xFAU, 0x00U, 0x00U, 0x00U, 0x48U, 0x00U, 0x00U, 0x00U,
+        0x48U, 0x00U, 0x00U, 0x00U, 0x81U, 0xABU, 0xCDU, 0xEFU, 0x0CU, 0x05U, 0x00U, 0x00U,
+    };
+    static const uint8_t remote[16U + 8U] = {
+        0x01U, 0x00U, 0x00U, 0x00U, 0xE8U, 0x03U, 0x00U, 0x00U, 0x10U, 0x00U, 0x00U, 0x00U,
+        0x10U, 0x00U, 0x00U, 0x00U, 0x40U, 0x00U, 0x07U, 0xFFU, 0x03U, 0x00U, 0x00U, 0x00U,
+    };
+    CaptureReader_Object reader;
+    uint8_t buf[CaptureReader_PCAP_RECORD_MAX];
+    uint32_t i;
+
+    HostTest_checkEqual(CaptureReader_getPcapHeader(buf), CaptureReader_PCAP_HEADER_SIZE);
+    HostTest_check(memcmp(buf, header, sizeof(header)) == 0);
+
+    writeFrames();
+    readStream(&reader);
+
+    if (frameCnt < FRAME_COUNT)
+    {
+        HostTest_check(false);
+        return;
+    }
+
+    HostTest_checkEqual(CaptureReader_encodePcap(&frames[0], buf), sizeof(classic));
+    HostTest_check(memcmp(buf, classic, sizeof(classic)) == 0);
+
+    /* CAN FD frames are padded to 64 bytes */
+    HostTest_checkEqual(CaptureReader_encodePcap(&frames[1], buf), 16U + 72U);
+    HostTest_check(memcmp(buf, fdHeader, sizeof(fdHeader)) == 0);
+
+    for (i = 0U; i < 64U; i++)
+    {
+        if (buf[sizeof(fdHeader) + i] != ((i < 12U) ? i : 0U))
+        {
+            break;
+        }
+    }
+
+    HostTest_checkEqual(i, 64U);
+
+    /* 1.000001 s is 1 s and 1000 ns */
+    HostTest_checkEqual(CaptureReader_encodePcap(&frames[2], buf), 16U + 16U);
+    HostTest_check(memcmp(buf, remote, sizeof(remote)) == 0);
+}
+
+/*
+ *  ======== checkLost ========
+ *  Records refused by a full ring are counted from the flag of the next
+ *  record read.
+ */
+static void checkLost(void)
+{
+    CaptureReader_Object reader;
+    CAN_RxBufElement rxElem;
+    uint32_t storedCnt = 0U;
+    uint32_t i;
+
+    CANCapture_init(&capture, false);
+    streamSize = 0U;
+
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.fdf = 1U;
+    rxElem.dlc = CAN_DLC_64B;
+
+    for (i = 0U; i < FRAME_MAX; i++)
+    {
+        rxElem.id = i;
+        storedCnt += CANCapture_rxFrame(&capture, &rxElem, i) ? 1U : 0U;
+    }
+
+    drain();
+
+    rxElem.id = FRAME_MAX;
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, FRAME_MAX));
+    drain();
+
+    readStream(&reader);
+
+    HostTest_check(storedCnt < FRAME_MAX);
+    HostTest_checkEqual(frameCnt, storedCnt + 1U);
+    HostTest_checkEqual(reader.stats.lostCnt, 1U);
+    HostTest_checkEqual(reader.stats.skippedCnt, 0U);
+
+    if (frameCnt == (storedCnt + 1U))
+    {
+        HostTest_check(frames[storedCnt].record.flags & CANCapture_FLAG_LOST);
+        HostTest_checkEqual(frames[storedCnt].record.id, FRAME_MAX);
+    }
+}
+
+/*
+ *  ======== checkPending ========
+ *  A record cut off at the end of the stream stays pending.
+ */
+static void checkPending(void)
+{
+    CaptureReader_Object reader;
+
+    writeFrames();
+    streamSize -= 5U;
+    readStream(&reader);
+
+    HostTest_checkEqual(frameCnt, FRAME_COUNT - 1U);
+    HostTest_checkEqual(CaptureReader_getPending(&reader), CANCapture_HEADER_SIZE + 1U - 5U);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkCandump();
+    checkPcap();
+    checkLost();
+    checkPending();
+
+    return HostTest_exit("CaptureReader");
+}
@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_CaptureReplay.c ========
+ *  Host checks of the capture replay into example nodes of the virtual CAN
+ *  bus. A capture of a canTimeSync follower receiving the messages of a
+ *  master whose clock runs 20 ppm fast is replayed into a canTimeSync node,
+ *  which must lock to the master time, and a capture of a canResponder is
+ *  replayed into a canResponder node, which must answer the captured
+ *  requests. The frames replayed must start at their captured times, and
+ *  the frames the device wrote in the captures must be left out. Pass -v to
+ *  print the UART output of the nodes.
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "CANCapture.h"
+#include "CANCodec.h"
+#include "CaptureReader.h"
+#include "CaptureReplay.h"
+#include "HostTest.h"
+#include "VirtualCAN.h"
+
+/* Time sync messages in the capture */
+#define SYNC_COUNT 30U
+
+/* Capture time between time sync messages, 50 ms */
+#define SYNC_INTERVAL_TICKS 200000U
+
+/* Capture time from a time sync message to its follow-up, 1 ms */
+#define FOLLOW_UP_DELAY_TICKS 4000U
+
+/* Clock frequency error of the master against the capturing device, in ppb */
+#define MASTER_PPB 20000
+
+/* Capture time between the two requests of the responder capture, 10 ms */
+#define REQUEST_INTERVAL_TICKS 40000U
+
+/* Message IDs of the examples */
+#define TIME_SYNC_MSG_ID 0x2U
+#define REGULAR_MSG_ID   0x3U
+#define FOLLOW_UP_MSG_ID 0x4U
+#define TEST_MSG_ID      0x5AAU
+#define TEST_FD_MSG_ID   0x12345678U
+
+/* Samples skipped while the servo locks */
+#define LOCK_SAMPLES 10U
+
+/* Largest offset of the locked servo. The replayed SOF times are exact, up
+ * to the 250 ns ticks of the timestamp counter.
+ */
+#define MAX_LOCKED_OFFSET_NS 250
+
+/* Largest error of the frequency correction of the locked servo */
+#define MAX_FREQ_ERROR_PPB 100
+
+/* Printed value of TimeSyncServo_State_LOCKED */
+#define SERVO_STATE_LOCKED 2U
+
+/* Time from the start of a replay to its first frame */
+#define START_DELAY_NS 20000000ULL
+
+/* Time the nodes may respond after the last frame of a replay */
+#define END_DELAY_NS 200000000ULL
+
+/* Time to wait for the output of a node */
+#define OUTPUT_TIMEOUT_MS 2000U
+
+/* Output buffer size of a node */
+#define OUTPUT_SIZE (1024U * 1024U)
+
+/* Maximum number of frames recorded */
+#define FRAME_MAX 128U
+
+#define SERVO_TEXT "> Servo: "
+#define SERVO_LINE "> Servo: offset = %d ns, freq = %d ppb, state = %u"
+
+extern void *responder_mainThread(void *arg0);
+extern void *timeSync_mainThread(void *arg0);
+
+static pthread_mutex_t frameLock = PTHREAD_MUTEX_INITIALIZER;
+static VirtualCAN_Frame frames[FRAME_MAX];
+static uint32_t frameCnt;
+
+static CANCapture_Object capture;
+
+/*
+ *  ======== monitorFxn ========
+ */
+static void monitorFxn(const VirtualCAN_Frame *frame, void *arg)
+{
+    pthread_mutex_lock(&frameLock);
+
+    if (frameCnt < FRAME_MAX)
+    {
+        frames[frameCnt] = *frame;
+    }
+
+    frameCnt++;
+
+    pthread_mutex_unlock(&frameLock);
+}
+
+/*
+ *  ======== loadCapture ========
+ *  Reads the records in the capture ring into replay.
+ */
+static void loadCapture(CaptureReplay_Object *replay)
+{
+    CaptureReader_Object reader;
+    const uint8_t *data;
+    size_t count;
+
+    CaptureReplay_init(replay);
+    CaptureReader_init(&reader, CaptureReplay_add, replay);
+
+    while ((count = CANCapture_peek(&capture, &data)) > 0U)
+    {
+        CaptureReader_receive(&reader, data, count);
+        CANCapture_consume(&capture, count);
+    }
+
+    HostTest_checkEqual(reader.stats.skippedCnt, 0U);
+    HostTest_checkEqual(replay->failedCnt, 0U);
+}
+
+/*
+ *  ======== replayCapture ========
+ *  Replays the capture and waits until the nodes responded to its last
+ *  frame. Returns the bus time of the first frame.
+ */
+static uint64_t replayCapture(const CaptureReplay_Object *replay)
+{
+    const struct timespec pollTime = {0, 10000000L};
+    uint64_t startNs               = VirtualCAN_getTime() + START_DELAY_NS;
+    uint64_t endNs                 = CaptureReplay_getEndTime(replay, startNs) + END_DELAY_NS;
+
+    CaptureReplay_run(replay, startNs);
+
+    while (VirtualCAN_getTime() < endNs)
+    {
+        nanosleep(&pollTime, NULL);
+    }
+
+    return startNs;
+}
+
+/*
+ *  ======== checkTimeSync ========
+ */
+static void checkTimeSync(VirtualCAN_Node *node)
+{
+    CaptureReplay_Object replay;
+    CAN_RxBufElement rxElem;
+    CAN_TxBufElement txElem;
+    uint64_t masterTime;
+    uint64_t startNs;
+    uint32_t firstFrame;
+    uint32_t syncTime;
+    uint32_t sampleCnt    = 0U;
+    uint32_t lockedCnt    = 0U;
+    uint32_t timeErrorCnt = 0U;
+    int32_t maxOffset     = 0;
+    int32_t maxFreqError  = 0;
+    char *output;
+    const char *line;
+    size_t length;
+    int32_t offset;
+    int32_t freq;
+    unsigned int state;
+    uint32_t i;
+
+    CANCapture_init(&capture, false);
+
+    for (i = 0U; i < SYNC_COUNT; i++)
+    {
+        syncTime   = 1000000U + (i * SYNC_INTERVAL_TICKS);
+        masterTime = 0x80000000ULL + (i * SYNC_INTERVAL_TICKS) +
+                     (((int64_t)i * SYNC_INTERVAL_TICKS * MASTER_PPB) / 1000000000LL);
+
+        /* The example sends CAN FD frames with extended IDs */
+        memset(&rxElem, 0, sizeof(rxElem));
+        rxElem.id      = TIME_SYNC_MSG_ID;
+        rxElem.xtd     = 1U;
+        rxElem.fdf     = 1U;
+        rxElem.dlc     = CAN_DLC_1B;
+        rxElem.data[0] = (uint8_t)i;
+        HostTest_check(CANCapture_rxFrame(&capture, &rxElem, syncTime));
+
+        /* A regular message the device sent is not replayed */
+        memset(&txElem, 0, sizeof(txElem));
+        txElem.id  = REGULAR_MSG_ID;
+        txElem.xtd = 1U;
+        txElem.fdf = 1U;
+        HostTest_check(CANCapture_txFrame(&capture, &txElem, syncTime + 1000U));
+
+        rxElem.id      = FOLLOW_UP_MSG_ID;
+        rxElem.dlc     = CAN_DLC_5B;
+        rxElem.data[0] = (uint8_t)masterTime;
+        rxElem.data[1] = (uint8_t)(masterTime >> 8);
+        rxElem.data[2] = (uint8_t)(masterTime >> 16);
+        rxElem.data[3] = (uint8_t)(masterTime >> 24);
+        rxElem.data[4] = (uint8_t)i;
+        HostTest_check(CANCapture_rxFrame(&capture, &rxElem, syncTime + FOLLOW_UP_DELAY_TICKS));
+    }
+
+    loadCapture(&replay);
+
+    HostTest_checkEqual(replay.frameCnt, 2U * SYNC_COUNT);
+    HostTest_checkEqual(replay.txCnt, SYNC_COUNT);
+
+    firstFrame = frameCnt;
+    startNs    = replayCapture(&replay);
+
+    HostTest_check(VirtualCAN_waitForOutput(node, SERVO_TEXT, SYNC_COUNT, OUTPUT_TIMEOUT_MS));
+
+    /* Each frame starts at its captured time */
+    pthread_mutex_lock(&frameLock);
+
+    HostTest_checkEqual(frameCnt - firstFrame, 2U * SYNC_COUNT);
+
+    for (i = 0U; (i < (2U * SYNC_COUNT)) && ((firstFrame + i) < frameCnt); i++)
+    {
+        if (frames[firstFrame + i].sofTimeNs !=
+            (startNs + ((replay.frames[i].time - replay.frames[0].time) * CaptureReader_NSEC_PER_TICK)))
+        {
+            timeErrorCnt++;
+        }
+    }
+
+    pthread_mutex_unlock(&frameLock);
+
+    HostTest_checkEqual(timeErrorCnt, 0U);
+
+    output = malloc(OUTPUT_SIZE + 1U);
+    if (output == NULL)
+    {
+        HostTest_check(false);
+        CaptureReplay_free(&replay);
+        return;
+    }
+
+    length         = VirtualCAN_readOutput(node, 0U, output, OUTPUT_SIZE);
+    output[length] = '\0';
+
+    for (line = strstr(output, SERVO_TEXT); line != NULL; line = strstr(line + 1, SERVO_TEXT))
+    {
+        if (sscanf(line, SERVO_LINE, &offset, &freq, &state) != 3)
+        {
+            HostTest_check(false);
+            continue;
+        }
+
+        sampleCnt++;
+
+        if (sampleCnt > LOCK_SAMPLES)
+        {
+            lockedCnt += (state == SERVO_STATE_LOCKED);
+
+            if (abs(offset) > maxOffset)
+            {
+                maxOffset = abs(offset);
+            }
+
+            /* The node clock runs MASTER_PPB slower than the master clock */
+            if (abs(freq - MASTER_PPB) > maxFreqError)
+            {
+                maxFreqError = abs(freq - MASTER_PPB);
+            }
+        }
+    }
+
+    HostTest_checkEqual(sampleCnt, SYNC_COUNT);
+    HostTest_checkEqual(lockedCnt, SYNC_COUNT - LOCK_SAMPLES);
+    HostTest_check(maxOffset <= MAX_LOCKED_OFFSET_NS);
+    HostTest_check(maxFreqError <= MAX_FREQ_ERROR_PPB);
+
+    free(output);
+    CaptureReplay_free(&replay);
+}
+
+/*
+ *  ======== checkResponder ========
+ */
+static void checkResponder(void)
+{
+    CaptureReplay_Object replay;
+    CAN_RxBufElement rxElem;
+    CAN_TxBufElement txElem;
+    const VirtualCAN_Frame *request;
+    const VirtualCAN_Frame *response;
+    uint64_t startNs;
+    uint32_t firstFrame;
+    uint32_t i;
+    uint32_t j;
+
+    CANCapture_init(&capture, false);
+
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id  = TEST_MSG_ID;
+    rxElem.dlc = CAN_DLC_8B;
+    for (i = 0U; i < 8U; i++)
+    {
+        rxElem.data[i] = (uint8_t)i;
+    }
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 5000U));
+
+    /* The captured response is left out, the node sends its own */
+    memset(&txElem, 0, sizeof(txElem));
+    txElem.id  = ~TEST_MSG_ID & 0x7FFU;
+    txElem.dlc = CAN_DLC_8B;
+    HostTest_check(CANCapture_txFrame(&capture, &txElem, 5400U));
+
+    memset(&rxElem, 0, sizeof(rxElem));
+    rxElem.id  = TEST_FD_MSG_ID;
+    rxElem.xtd = 1U;
+    rxElem.fdf = 1U;
+    rxElem.brs = 1U;
+    rxElem.dlc = CAN_DLC_64B;
+    for (i = 0U; i < 64U; i++)
+    {
+        rxElem.data[i] = (uint8_t)(i * 3U);
+    }
+    HostTest_check(CANCapture_rxFrame(&capture, &rxElem, 5000U + REQUEST_INTERVAL_TICKS));
+
+    loadCapture(&replay);
+
+    HostTest_checkEqual(replay.frameCnt, 2U);
+    HostTest_checkEqual(replay.txCnt, 1U);
+
+    firstFrame = frameCnt;
+    startNs    = replayCapture(&replay);
+
+    pthread_mutex_lock(&frameLock);
+
+    HostTest_checkEqual(frameCnt - firstFrame, 4U);
+
+    for (i = 0U; (i < 2U) && ((firstFrame + (2U * i) + 1U) < frameCnt); i++)
+    {
+        request  = &frames[firstFrame + (2U * i)];
+        response = &frames[firstFrame + (2U * i) + 1U];
+
+        HostTest_check(request->source == NULL);
+        HostTest_check((response->source != NULL) && (strcmp(response->source, "responder") == 0));
+        HostTest_checkEqual(request->sofTimeNs, startNs + (i * REQUEST_INTERVAL_TICKS * CaptureReader_NSEC_PER_TICK));
+
+        /* The responder returns the inverted payload with the inverted ID */
+        HostTest_checkEqual(response->elem.id, ~request->elem.id & (request->elem.xtd ? 0x1FFFFFFFU : 0x7FFU));
+        HostTest_checkEqual(response->elem.dlc, request->elem.dlc);
+
+        for (j = 0U; j < CANCodec_dlcToLength(request->elem.dlc); j++)
+        {
+            if (response->elem.data[j] != (uint8_t)~request->elem.data[j])
+            {
+                break;
+            }
+        }
+
+        HostTest_checkEqual(j, CANCodec_dlcToLength(request->elem.dlc));
+    }
+
+    pthread_mutex_unlock(&frameLock);
+
+    CaptureReplay_free(&replay);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    VirtualCAN_Node *timeSync;
+    VirtualCAN_Node *responder;
+
+    VirtualCAN_trace = (argc > 1) && (strcmp(argv[1], "-v") == 0);
+
+    VirtualCAN_init(monitorFxn, NULL);
+
+    timeSync  = VirtualCAN_addNode("timeSync", timeSync_mainThread, 0, 0U);
+    responder = VirtualCAN_addNode("responder", responder_mainThread, 0, 0U);
+
+    /* The responder is started after the time sync replay, as its responses
+     * would delay the replayed frames
+     */
+    VirtualCAN_startNode(timeSync);
+    HostTest_check(VirtualCAN_waitForOutput(timeSync, "CAN Time Sync ready.", 1U, OUTPUT_TIMEOUT_MS));
+    checkTimeSync(timeSync);
+
+    VirtualCAN_startNode(responder);
+    HostTest_check(VirtualCAN_waitForOutput(responder, "CAN Responder ready.", 1U, OUTPUT_TIMEOUT_MS));
+    checkResponder();
+
+    return HostTest_exit("CaptureReplay");
+}
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_EchoPipeline.c ========
+ *  Host checks of the uart2echo buffer pipeline: the echoed stream with reads
+ *  and writes completed in any order and chunk size, completions reported
+ *  from within the start functions, stalls while all buffers wait to be
+ *  written, and stopping. The UART is simulated by the start functions.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "EchoPipeline.h"
+#include "HostTest.h"
+
+#define BUFFER_SIZE 16U
+#define STREAM_SIZE 5000U
+
+/* Simulated UART */
+static uint8_t input[STREAM_SIZE];
+static size_t inputLength;
+static size_t inputPos;
+static uint8_t output[STREAM_SIZE];
+static size_t outputLength;
+static uint8_t *readBuf;
+static size_t readSize;
+static const uint8_t *writeBuf;
+static size_t writeCount;
+static bool syncRead;
+static bool syncWrite;
+static uint32_t depth;
+static uint32_t maxDepth;
+static uint32_t overlapCnt;
+static uint32_t emptyReadCnt;
+
+static uint8_t buffers[EchoPipeline_BUFFER_COUNT * BUFFER_SIZE];
+static EchoPipeline_Object pipeline;
+
+static uint32_t randomState = 1U;
+
+/*
+ *  ======== nextRandom ========
+ */
+static uint32_t nextRandom(void)
+{
+    randomState = (randomState * 1103515245U) + 12345U;
+
+    return randomState >> 8;
+}
+
+/*
+ *  ======== completeRead ========
+ *  Completes the read in flight with up to count bytes of the input.
+ */
+static void completeRead(size_t count)
+{
+    uint8_t *buf = readBuf;
+
+    if (count > (inputLength - inputPos))
+    {
+        count = inputLength - inputPos;
+    }
+
+    if (count > readSize)
+    {
+        count = readSize;
+    }
+
+    if (count == 0U)
+    {
+        emptyReadCnt++;
+    }
+
+    (void)memcpy(buf, &input[inputPos], count);
+    inputPos += count;
+    readBuf = NULL;
+
+    EchoPipeline_readDone(&pipeline, count);
+}
+
+/*
+ *  ======== completeWrite ========
+ *  Completes the write in flight. The buffer is copied only now, so data
+ *  overwritten by a read while the write was in flight shows in the output.
+ */
+static void completeWrite(void)
+{
+    (void)memcpy(&output[outputLength], writeBuf, writeCount);
+    outputLength += writeCount;
+    writeBuf = NULL;
+
+    EchoPipeline_writeDone(&pipeline);
+}
+
+/*
+ *  ======== readFxn ========
+ */
+static void readFxn(void *arg, uint8_t *buf, size_t size)
+{
+    (void)arg;
+
+    HostTest_check(readBuf == NULL);
+    HostTest_checkEqual(size, BUFFER_SIZE);
+
+    if (buf == writeBuf)
+    {
+        overlapCnt++;
+    }
+
+    readBuf  = buf;
+    readSize = size;
+
+    depth++;
+    if (depth > maxDepth)
+    {
+        maxDepth = depth;
+    }
+
+    /* A driver only returns a read from within UART2_read() if data is available */
+    if (syncRead && (inputPos < inputLength))
+    {
+        completeRead(1U + (nextRandom() % BUFFER_SIZE));
+    }
+
+    depth--;
+}
+
+/*
+ *  ======== writeFxn ========
+ */
+static void writeFxn(void *arg, const uint8_t *buf, size_t count)
+{
+    (void)arg;
+
+    HostTest_check(writeBuf == NULL);
+    HostTest_check(count > 0U);
+
+    if (buf == readBuf)
+    {
+        overlapCnt++;
+    }
+
+    writeBuf   = buf;
+    writeCount = count;
+
+    depth++;
+    if (depth > maxDepth)
+    {
+        maxDepth = depth;
+    }
+
+    if (syncWrite)
+    {
+        completeWrite();
+    }
+
+    depth--;
+}
+
+/*
+ *  ======== setup ========
+ *  Resets the simulated UART with an input of length bytes and initializes
+ *  the pipeline.
+ */
+static void setup(size_t length, bool readsSync, bool writesSync)
+{
+    EchoPipeline_Params params;
+    size_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        input[i] = (uint8_t)((i * 13U) + (i >> 8));
+    }
+
+    inputLength  = length;
+    inputPos     = 0U;
+    outputLength = 0U;
+    readBuf      = NULL;
+    writeBuf     = NULL;
+    syncRead     = readsSync;
+    syncWrite    = writesSync;
+    depth        = 0U;
+    maxDepth     = 0U;
+    overlapCnt   = 0U;
+    emptyReadCnt = 0U;
+
+    params.buffers    = buffers;
+    params.bufferSize = BUFFER_SIZE;
+    params.readFxn    = readFxn;
+    params.writeFxn   = writeFxn;
+    params.arg        = NULL;
+    EchoPipeline_init(&pipeline, &params);
+}
+
+/*
+ *  ======== checkEcho ========
+ *  Checks that the whole input was echoed unchanged.
+ */
+static void checkEcho(void)
+{
+    HostTest_checkEqual(outputLength, inputLength);
+    HostTest_check(memcmp(output, input, inputLength) == 0);
+    HostTest_checkEqual(pipeline.stats.bytesRead, inputLength);
+    HostTest_checkEqual(pipeline.stats.bytesWritten, inputLength);
+    HostTest_checkEqual(pipeline.stats.readCnt, pipeline.stats.writeCnt);
+    HostTest_checkEqual(overlapCnt, 0U);
+}
+
+/*
+ *  ======== checkAsync ========
+ *  Reads and writes completed later, in random order and chunk sizes,
+ *  including reads returning no data.
+ */
+static void checkAsync(void)
+{
+    uint32_t steps = 0U;
+
+    setup(STREAM_SIZE, false, false);
+    EchoPipeline_start(&pipeline);
+    HostTest_check(readBuf != NULL);
+
+    while (((inputPos < inputLength) || !EchoPipeline_isIdle(&pipeline)) && (steps < 100000U))
+    {
+        if ((readBuf != NULL) && (inputPos < inputLength) && ((writeBuf == NULL) || ((nextRandom() % 2U) == 0U)))
+        {
+            completeRead(nextRandom() % (BUFFER_SIZE + 1U));
+        }
+        else if (writeBuf != NULL)
+        {
+            completeWrite();
+        }
+        else if (inputPos == inputLength)
+        {
+            /* All input read, cancel the read in flight */
+            EchoPipeline_stop(&pipeline);
+            completeRead(0U);
+        }
+
+        steps++;
+    }
+
+    HostTest_check(EchoPipeline_isIdle(&pipeline));
+    HostTest_check(emptyReadCnt > 0U);
+    checkEcho();
+    HostTest_checkEqual(pipeline.stats.maxPending, EchoPipeline_BUFFER_COUNT);
+    HostTest_check(pipeline.stats.stallCnt > 0U);
+    HostTest_checkEqual(maxDepth, 1U);
+}
+
+/*
+ *  ======== checkSync ========
+ *  Reads and writes completed from within the start functions, which must
+ *  not be called recursively.
+ */
+static void checkSync(void)
+{
+    setup(STREAM_SIZE, true, true);
+    EchoPipeline_start(&pipeline);
+
+    /* The whole input is echoed from within EchoPipeline_start() */
+    HostTest_checkEqual(inputPos, inputLength);
+    HostTest_check(readBuf != NULL);
+    HostTest_check(writeBuf == NULL);
+    checkEcho();
+    HostTest_checkEqual(maxDepth, 1U);
+
+    EchoPipeline_stop(&pipeline);
+    completeRead(0U);
+    HostTest_check(EchoPipeline_isIdle(&pipeline));
+    HostTest_check(readBuf == NULL);
+
+    /* Synchronous reads with writes completed later */
+    setup(STREAM_SIZE, true, false);
+    EchoPipeline_start(&pipeline);
+
+    while (writeBuf != NULL)
+    {
+        completeWrite();
+    }
+
+    HostTest_checkEqual(inputPos, inputLength);
+    checkEcho();
+    HostTest_checkEqual(maxDepth, 1U);
+}
+
+/*
+ *  ======== checkStall ========
+ *  No read is started while all buffers wait to be written.
+ */
+static void checkStall(void)
+{
+    uint32_t i;
+
+    setup(STREAM_SIZE, false, false);
+    EchoPipeline_start(&pipeline);
+
+    for (i = 0U; i < EchoPipeline_BUFFER_COUNT; i++)
+    {
+        HostTest_check(readBuf != NULL);
+        completeRead(BUFFER_SIZE);
+    }
+
+    HostTest_check(readBuf == NULL);
+    HostTest_check(writeBuf == &buffers[0]);
+    HostTest_checkEqual(pipeline.stats.stallCnt, 1U);
+    HostTest_checkEqual(pipeline.stats.maxPending, EchoPipeline_BUFFER_COUNT);
+
+    /* The write frees the first buffer, which is read into next */
+    completeWrite();
+    HostTest_check(readBuf == &buffers[0]);
+    HostTest_check(writeBuf == &buffers[BUFFER_SIZE]);
+
+    /* Stopping: the buffers read are still written, and no read is restarted */
+    EchoPipeline_stop(&pipeline);
+    completeRead(5U);
+    HostTest_check(readBuf == NULL);
+    HostTest_checkEqual(pipeline.stats.stallCnt, 1U);
+    HostTest_check(!EchoPipeline_isIdle(&pipeline));
+
+    while (writeBuf != NULL)
+    {
+        completeWrite();
+    }
+
+    HostTest_check(EchoPipeline_isIdle(&pipeline));
+    HostTest_checkEqual(outputLength, (EchoPipeline_BUFFER_COUNT * BUFFER_SIZE) + 5U);
+    HostTest_check(memcmp(output, input, outputLength) == 0);
+
+    /* Restarting */
+    EchoPipeline_start(&pipeline);
+    HostTest_check(readBuf != NULL);
+    HostTest_check(!EchoPipeline_isIdle(&pipeline));
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkAsync();
+    checkSync();
+    checkStall();
+
+    return HostTest_exit("EchoPipeline");
+}
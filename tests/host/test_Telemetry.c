@@ -0,0 +1,629 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_Telemetry.c ========
+ *  Host checks of the telemetry framing: the stream written is decoded with
+ *  TelemetryDecoder, whose COBS decoder and CRC are independent of the
+ *  encoder, and compared with the records queued, for all payload lengths,
+ *  split records, partial writes across the ring wrap, dropped records and
+ *  corrupted bytes. The decoder is also checked on its own.
+ */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "HostTest.h"
+#include "Telemetry.h"
+#include "TelemetryDecoder.h"
+
+#define STREAM_SIZE 0x80000U
+#define RECORD_MAX  4096U
+#define FRAME_MAX   TelemetryDecoder_FRAME_MAX
+
+/* Largest part of the stream fed to the decoder at once */
+#define RECEIVE_MAX 300U
+
+/* Simulated UART */
+static uint8_t stream[STREAM_SIZE];
+static size_t streamLength;
+static size_t writeLimit;
+static bool randomWrites;
+
+/* Decoded stream */
+static TelemetryDecoder_Object decoder;
+static TelemetryDecoder_Record records[RECORD_MAX];
+static size_t recordCnt;
+static uint32_t badFrameCnt;
+
+static Telemetry_Object telemetry;
+
+static uint32_t randomState = 1U;
+
+/*
+ *  ======== nextRandom ========
+ */
+static uint32_t nextRandom(void)
+{
+    randomState = (randomState * 1103515245U) + 12345U;
+
+    return randomState >> 8;
+}
+
+/*
+ *  ======== writeFxn ========
+ *  Takes up to writeLimit bytes, or a random number of bytes up to
+ *  writeLimit if randomWrites is set.
+ */
+static size_t writeFxn(void *arg, const uint8_t *data, size_t length)
+{
+    size_t limit = randomWrites ? (nextRandom() % (writeLimit + 1U)) : writeLimit;
+
+    (void)arg;
+
+    if (length > limit)
+    {
+        length = limit;
+    }
+
+    HostTest_check((streamLength + length) <= STREAM_SIZE);
+    (void)memcpy(&stream[streamLength], data, length);
+    streamLength += length;
+
+    return length;
+}
+
+/*
+ *  ======== setup ========
+ */
+static void setup(size_t flushThreshold, size_t limit, bool random)
+{
+    Telemetry_Params params;
+
+    streamLength = 0U;
+    writeLimit   = limit;
+    randomWrites = random;
+
+    params.writeFxn       = writeFxn;
+    params.arg            = NULL;
+    params.flushThreshold = flushThreshold;
+    Telemetry_init(&telemetry, &params);
+}
+
+/*
+ *  ======== storeRecord ========
+ *  TelemetryDecoder_RecordFxn that appends the record to records.
+ */
+static void storeRecord(void *arg, const TelemetryDecoder_Record *record)
+{
+    (void)arg;
+
+    HostTest_check(recordCnt < RECORD_MAX);
+    if (recordCnt < RECORD_MAX)
+    {
+        records[recordCnt++] = *record;
+    }
+}
+
+/*
+ *  ======== decodeStream ========
+ *  Decodes the stream written into records, fed to the decoder in parts of
+ *  random length. Frames with invalid encoding or CRC are counted in
+ *  badFrameCnt.
+ */
+static void decodeStream(void)
+{
+    size_t offset = 0U;
+    size_t length;
+
+    recordCnt = 0U;
+    TelemetryDecoder_init(&decoder, storeRecord, NULL);
+
+    while (offset < streamLength)
+    {
+        length = 1U + (nextRandom() % RECEIVE_MAX);
+        if (length > (streamLength - offset))
+        {
+            length = streamLength - offset;
+        }
+
+        TelemetryDecoder_receive(&decoder, &stream[offset], length);
+        offset += length;
+    }
+
+    badFrameCnt = decoder.stats.badFrameCnt;
+    HostTest_checkEqual(decoder.stats.recordCnt, recordCnt);
+
+    /* The stream ends with a frame delimiter */
+    HostTest_checkEqual(TelemetryDecoder_getPending(&decoder), 0U);
+}
+
+/*
+ *  ======== getUint32 ========
+ */
+static uint32_t getUint32(const uint8_t *data)
+{
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/*
+ *  ======== encodeText ========
+ *  Builds a text record with ID 0, encoded with COBS and followed by the
+ *  delimiter, and returns its length. If corrupt is set, a payload bit is
+ *  flipped after the CRC is computed.
+ */
+static size_t encodeText(uint16_t seq, const char *text, bool corrupt, uint8_t *dst)
+{
+    uint8_t frame[FRAME_MAX];
+    size_t length = strlen(text);
+    size_t code   = 0U;
+    size_t out    = 1U;
+    size_t i;
+    uint16_t crc;
+
+    frame[0] = Telemetry_TYPE_TEXT;
+    frame[1] = 0U;
+    frame[2] = (uint8_t)seq;
+    frame[3] = (uint8_t)(seq >> 8);
+    (void)memcpy(&frame[4], text, length);
+
+    crc                = TelemetryDecoder_crc(frame, length + 4U);
+    frame[length + 4U] = (uint8_t)(crc >> 8);
+    frame[length + 5U] = (uint8_t)crc;
+    frame[4] ^= corrupt ? 0x01U : 0x00U;
+
+    /* Short frames need no block of 254 bytes */
+    for (i = 0U; i < (length + 6U); i++)
+    {
+        if (frame[i] == 0U)
+        {
+            dst[code] = (uint8_t)(out - code);
+            code      = out++;
+        }
+        else
+        {
+            dst[out++] = frame[i];
+        }
+    }
+
+    dst[code]  = (uint8_t)(out - code);
+    dst[out++] = 0U;
+
+    return out;
+}
+
+/*
+ *  ======== checkDecoder ========
+ *  The decoder CRC and COBS decoder against known values, and the decoder on
+ *  a hand-built stream: a record split across two parts, an empty frame, a
+ *  bad CRC, an overlong frame, sequence gaps and a restart of the target.
+ */
+static void checkDecoder(void)
+{
+    static const uint8_t check[]   = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    static const uint8_t encoded[] = {0x03U, 0x11U, 0x22U, 0x02U, 0x33U};
+    uint8_t decoded[8];
+    uint8_t data[FRAME_MAX + 2U];
+    size_t length;
+
+    HostTest_checkEqual(TelemetryDecoder_crc(check, sizeof(check)), 0x29B1U);
+    HostTest_checkEqual(TelemetryDecoder_decodeCobs(encoded, sizeof(encoded), decoded, sizeof(decoded)), 4);
+    HostTest_check(memcmp(decoded, "\x11\x22\x00\x33", 4U) == 0);
+    HostTest_checkEqual(TelemetryDecoder_decodeCobs(encoded, sizeof(encoded), decoded, 3U), -1);
+    HostTest_checkEqual(TelemetryDecoder_decodeCobs(encoded, 4U, decoded, sizeof(decoded)), -1);
+
+    recordCnt = 0U;
+    TelemetryDecoder_init(&decoder, storeRecord, NULL);
+
+    /* An empty frame is ignored */
+    data[0] = 0U;
+    TelemetryDecoder_receive(&decoder, data, 1U);
+
+    /* A record received in two parts */
+    length = encodeText(0x0010U, "first", false, data);
+    TelemetryDecoder_receive(&decoder, data, 3U);
+    HostTest_checkEqual(TelemetryDecoder_getPending(&decoder), 3U);
+    TelemetryDecoder_receive(&decoder, &data[3], length - 3U);
+    HostTest_checkEqual(TelemetryDecoder_getPending(&decoder), 0U);
+
+    /* Record 0x0011 fails the CRC check, 0x0013 and 0x0014 are missing */
+    length = encodeText(0x0011U, "bad crc", true, data);
+    TelemetryDecoder_receive(&decoder, data, length);
+    length = encodeText(0x0012U, "gap of 1", false, data);
+    TelemetryDecoder_receive(&decoder, data, length);
+    length = encodeText(0x0015U, "gap of 2", false, data);
+    TelemetryDecoder_receive(&decoder, data, length);
+
+    /* A frame longer than the largest frame */
+    (void)memset(data, 0x55, sizeof(data) - 1U);
+    data[sizeof(data) - 1U] = 0U;
+    TelemetryDecoder_receive(&decoder, data, sizeof(data));
+
+    /* The target restarts */
+    length = encodeText(0x0003U, "restart", false, data);
+    TelemetryDecoder_receive(&decoder, data, length);
+    length = encodeText(0x0004U, "last", false, data);
+    TelemetryDecoder_receive(&decoder, data, length);
+
+    HostTest_checkEqual(recordCnt, 5U);
+    HostTest_checkEqual(decoder.stats.recordCnt, 5U);
+    HostTest_checkEqual(decoder.stats.badFrameCnt, 2U);
+    HostTest_checkEqual(decoder.stats.lostCnt, 3U);
+    HostTest_checkEqual(decoder.stats.restartCnt, 1U);
+
+    HostTest_checkEqual(records[0].type, Telemetry_TYPE_TEXT);
+    HostTest_checkEqual(records[0].id, 0U);
+    HostTest_checkEqual(records[0].seq, 0x0010U);
+    HostTest_checkEqual(records[0].length, 5U);
+    HostTest_check(memcmp(records[0].payload, "first", 5U) == 0);
+    HostTest_checkEqual(records[1].seq, 0x0012U);
+    HostTest_checkEqual(records[2].seq, 0x0015U);
+    HostTest_checkEqual(records[3].seq, 0x0003U);
+    HostTest_checkEqual(records[4].length, 4U);
+}
+
+/*
+ *  ======== checkLengths ========
+ *  Text records of all payload lengths, with few, many or no zero bytes.
+ */
+static void checkLengths(void)
+{
+    static const uint32_t zeroRatios[] = {0U, 2U, 4U, 1U};
+    char text[Telemetry_PAYLOAD_MAX];
+    uint32_t errorCnt = 0U;
+    size_t expectedCnt = 0U;
+    size_t length;
+    size_t i;
+    size_t j;
+    uint32_t ratio;
+    uint32_t seed = randomState;
+
+    setup(0U, SIZE_MAX, false);
+
+    for (ratio = 0U; ratio < (sizeof(zeroRatios) / sizeof(zeroRatios[0])); ratio++)
+    {
+        for (length = 0U; length <= Telemetry_PAYLOAD_MAX; length++)
+        {
+            for (i = 0U; i < length; i++)
+            {
+                text[i] = (char)(1U + (nextRandom() % 255U));
+                if ((zeroRatios[ratio] != 0U) && ((nextRandom() % zeroRatios[ratio]) == 0U))
+                {
+                    text[i] = 0;
+                }
+            }
+
+            HostTest_check(Telemetry_writeText(&telemetry, 7U, text, length));
+            expectedCnt++;
+        }
+    }
+
+    HostTest_checkEqual(Telemetry_getPending(&telemetry), 0U);
+    decodeStream();
+    HostTest_checkEqual(badFrameCnt, 0U);
+    HostTest_checkEqual(recordCnt, expectedCnt);
+
+    /* Only the frame delimiters are zero */
+    for (i = 0U, length = 0U; i < streamLength; i++)
+    {
+        length += (stream[i] == 0U) ? 1U : 0U;
+    }
+
+    HostTest_checkEqual(length, expectedCnt);
+
+    /* Replay the payloads */
+    randomState = seed;
+
+    for (i = 0U; i < recordCnt; i++)
+    {
+        ratio  = (uint32_t)(i / (Telemetry_PAYLOAD_MAX + 1U));
+        length = i % (Telemetry_PAYLOAD_MAX + 1U);
+
+        for (j = 0U; j < length; j++)
+        {
+            text[j] = (char)(1U + (nextRandom() % 255U));
+            if ((zeroRatios[ratio] != 0U) && ((nextRandom() % zeroRatios[ratio]) == 0U))
+            {
+                text[j] = 0;
+            }
+        }
+
+        if ((records[i].type != Telemetry_TYPE_TEXT) || (records[i].id != 7U) || (records[i].seq != (uint16_t)i) ||
+            (records[i].length != length) || (memcmp(records[i].payload, text, length) != 0))
+        {
+            errorCnt++;
+        }
+    }
+
+    HostTest_checkEqual(errorCnt, 0U);
+    HostTest_checkEqual(telemetry.stats.recordCnt, expectedCnt);
+    HostTest_checkEqual(telemetry.stats.bytesQueued, streamLength);
+    HostTest_checkEqual(telemetry.stats.bytesWritten, streamLength);
+    /* Frames across the ring wrap are written in two parts */
+    HostTest_check(telemetry.stats.writeCnt >= expectedCnt);
+}
+
+/*
+ *  ======== checkRecordTypes ========
+ *  Payload layout of each record type, and the splitting of long text and
+ *  histograms.
+ */
+static void checkRecordTypes(void)
+{
+    static const uint32_t counters[] = {0U, 1U, 0x12345678U, 0xFFFFFFFFU};
+    static const int32_t values[]    = {-1, 0, 1000, -2000000};
+    uint32_t bins[150];
+    char text[600];
+    uint32_t big[Telemetry_COUNTERS_MAX + 1U];
+    size_t i;
+
+    for (i = 0U; i < (sizeof(bins) / sizeof(bins[0])); i++)
+    {
+        bins[i] = (uint32_t)(i * 1000U);
+    }
+
+    (void)memset(text, 'x', sizeof(text));
+    (void)memset(big, 0, sizeof(big));
+
+    setup(0U, SIZE_MAX, false);
+
+    HostTest_check(Telemetry_writeCounters(&telemetry, 1U, counters, 4U));
+    HostTest_check(Telemetry_writeSample(&telemetry, 2U, 0xDEADBEEFU, values, 4U));
+    HostTest_check(Telemetry_writeHistogram(&telemetry, 3U, bins, 150U, 25U));
+    HostTest_check(Telemetry_writeText(&telemetry, 4U, text, sizeof(text)));
+
+    /* Too many values: refused without using a sequence number */
+    HostTest_check(!Telemetry_writeCounters(&telemetry, 5U, big, Telemetry_COUNTERS_MAX + 1U));
+    HostTest_check(!Telemetry_writeSample(&telemetry, 5U, 0U, (const int32_t *)big, Telemetry_SAMPLE_MAX + 1U));
+    HostTest_check(Telemetry_writeCounters(&telemetry, 6U, big, Telemetry_COUNTERS_MAX));
+
+    decodeStream();
+    HostTest_checkEqual(badFrameCnt, 0U);
+    HostTest_checkEqual(recordCnt, 9U);
+
+    for (i = 0U; i < recordCnt; i++)
+    {
+        HostTest_checkEqual(records[i].seq, i);
+    }
+
+    HostTest_checkEqual(records[0].type, Telemetry_TYPE_COUNTERS);
+    HostTest_checkEqual(records[0].id, 1U);
+    HostTest_checkEqual(records[0].length, 16U);
+    HostTest_checkEqual(getUint32(&records[0].payload[8]), 0x12345678U);
+    HostTest_checkEqual(getUint32(&records[0].payload[12]), 0xFFFFFFFFU);
+
+    HostTest_checkEqual(records[1].type, Telemetry_TYPE_SAMPLE);
+    HostTest_checkEqual(records[1].length, 20U);
+    HostTest_checkEqual(getUint32(&records[1].payload[0]), 0xDEADBEEFU);
+    HostTest_checkEqual((int32_t)getUint32(&records[1].payload[4]), -1);
+    HostTest_checkEqual((int32_t)getUint32(&records[1].payload[16]), -2000000);
+
+    /* 150 bins in records of 60, 60 and 30 */
+    for (i = 0U; i < 3U; i++)
+    {
+        HostTest_checkEqual(records[2U + i].type, Telemetry_TYPE_HISTOGRAM);
+        HostTest_checkEqual(records[2U + i].id, 3U);
+        HostTest_checkEqual(records[2U + i].payload[0] | (records[2U + i].payload[1] << 8),
+                            i * Telemetry_HISTOGRAM_BINS_MAX);
+        HostTest_checkEqual(records[2U + i].payload[2] | (records[2U + i].payload[3] << 8), 150U);
+        HostTest_checkEqual(getUint32(&records[2U + i].payload[4]), 25U);
+        HostTest_checkEqual(getUint32(&records[2U + i].payload[8]), i * Telemetry_HISTOGRAM_BINS_MAX * 1000U);
+    }
+
+    HostTest_checkEqual(records[2].length, 8U + (Telemetry_HISTOGRAM_BINS_MAX * 4U));
+    HostTest_checkEqual(records[4].length, 8U + ((150U - (2U * Telemetry_HISTOGRAM_BINS_MAX)) * 4U));
+
+    /* 600 characters in records of 248, 248 and 104 */
+    HostTest_checkEqual(records[5].type, Telemetry_TYPE_TEXT);
+    HostTest_checkEqual(records[5].length, Telemetry_PAYLOAD_MAX);
+    HostTest_checkEqual(records[6].length, Telemetry_PAYLOAD_MAX);
+    HostTest_checkEqual(records[7].length, 600U - (2U * Telemetry_PAYLOAD_MAX));
+
+    HostTest_checkEqual(records[8].id, 6U);
+    HostTest_checkEqual(records[8].length, Telemetry_PAYLOAD_MAX);
+}
+
+/*
+ *  ======== checkPartialWrites ========
+ *  Records queued while the writer takes random amounts, so records are
+ *  dropped when the ring is full and the ring wraps many times. The records
+ *  received are the ones queued, and the dropped ones are missing from the
+ *  sequence numbers.
+ */
+static void checkPartialWrites(void)
+{
+    static bool queued[2000];
+    uint32_t values[Telemetry_COUNTERS_MAX];
+    uint32_t droppedCnt = 0U;
+    uint32_t errorCnt   = 0U;
+    size_t count;
+    size_t i;
+    size_t j;
+
+    setup(100U, 40U, true);
+
+    for (i = 0U; i < (sizeof(queued) / sizeof(queued[0])); i++)
+    {
+        count = nextRandom() % (Telemetry_COUNTERS_MAX + 1U);
+
+        for (j = 0U; j < count; j++)
+        {
+            values[j] = (uint32_t)((i << 16) + j);
+        }
+
+        queued[i] = Telemetry_writeCounters(&telemetry, (uint8_t)count, values, count);
+        droppedCnt += queued[i] ? 0U : 1U;
+
+        HostTest_check(Telemetry_getPending(&telemetry) <= Telemetry_RING_SIZE);
+    }
+
+    HostTest_check(droppedCnt > 0U);
+    HostTest_checkEqual(telemetry.stats.droppedCnt, droppedCnt);
+    HostTest_check(telemetry.stats.maxPending > (Telemetry_RING_SIZE - FRAME_MAX - 3U));
+
+    /* The remaining bytes */
+    writeLimit   = SIZE_MAX;
+    randomWrites = false;
+    Telemetry_flush(&telemetry);
+    HostTest_checkEqual(Telemetry_getPending(&telemetry), 0U);
+
+    decodeStream();
+    HostTest_checkEqual(badFrameCnt, 0U);
+    HostTest_checkEqual(recordCnt, (sizeof(queued) / sizeof(queued[0])) - droppedCnt);
+
+    /* The decoder counts the dropped records between the first and the last
+     * record received as lost
+     */
+    HostTest_checkEqual(decoder.stats.lostCnt + records[0].seq +
+                            ((sizeof(queued) / sizeof(queued[0])) - 1U - records[recordCnt - 1U].seq),
+                        droppedCnt);
+    HostTest_checkEqual(decoder.stats.restartCnt, 0U);
+
+    for (i = 0U, j = 0U; i < (sizeof(queued) / sizeof(queued[0])); i++)
+    {
+        if (!queued[i])
+        {
+            continue;
+        }
+
+        count = records[j].id;
+
+        if ((records[j].seq != i) || (records[j].length != (count * 4U)) ||
+            ((count > 0U) && (getUint32(&records[j].payload[(count - 1U) * 4U]) != (uint32_t)((i << 16) + count - 1U))))
+        {
+            errorCnt++;
+        }
+
+        j++;
+    }
+
+    HostTest_checkEqual(errorCnt, 0U);
+    HostTest_checkEqual(telemetry.stats.bytesWritten, streamLength);
+    HostTest_checkEqual(telemetry.stats.bytesQueued, streamLength);
+}
+
+/*
+ *  ======== checkFlushThreshold ========
+ *  Records are only written once more than the threshold is pending.
+ */
+static void checkFlushThreshold(void)
+{
+    static const uint32_t value = 0x01020304U;
+    size_t frameSize;
+    size_t count;
+
+    setup(50U, SIZE_MAX, false);
+
+    HostTest_check(Telemetry_writeCounters(&telemetry, 1U, &value, 1U));
+    frameSize = Telemetry_getPending(&telemetry);
+    count     = 1U;
+
+    while (streamLength == 0U)
+    {
+        HostTest_check(Telemetry_writeCounters(&telemetry, 1U, &value, 1U));
+        count++;
+    }
+
+    HostTest_checkEqual(Telemetry_getPending(&telemetry), 0U);
+    HostTest_checkEqual(streamLength, count * frameSize);
+    HostTest_checkEqual(count, (50U / frameSize) + 1U);
+
+    /* A writer that takes nothing: records are kept until the ring is full */
+    writeLimit = 0U;
+    while (Telemetry_writeCounters(&telemetry, 1U, &value, 1U))
+    {
+    }
+
+    HostTest_checkEqual(telemetry.stats.writeCnt, 1U);
+    HostTest_check(Telemetry_getPending(&telemetry) > (Telemetry_RING_SIZE - frameSize - 3U));
+    HostTest_checkEqual(telemetry.stats.droppedCnt, 1U);
+}
+
+/*
+ *  ======== checkCorruption ========
+ *  A corrupted byte loses at most the frames it touches.
+ */
+static void checkCorruption(void)
+{
+    static const char text[] = "telemetry record";
+    size_t frameSize;
+    size_t i;
+    uint32_t lostCnt;
+
+    setup(0U, SIZE_MAX, false);
+
+    for (i = 0U; i < 100U; i++)
+    {
+        HostTest_check(Telemetry_writeText(&telemetry, 0U, text, sizeof(text) - 1U));
+    }
+
+    frameSize = streamLength / 100U;
+
+    /* Flip one bit in every fifth frame, including delimiters */
+    for (i = 0U; i < 100U; i += 5U)
+    {
+        stream[(i * frameSize) + ((i / 5U) % frameSize)] ^= (uint8_t)(1U << (i % 8U));
+    }
+
+    decodeStream();
+
+    for (i = 0U; i < recordCnt; i++)
+    {
+        HostTest_check(memcmp(records[i].payload, text, sizeof(text) - 1U) == 0);
+    }
+
+    /* Records lost before the first and after the last one received are not
+     * seen by the decoder
+     */
+    lostCnt = decoder.stats.lostCnt + records[0].seq + (99U - records[recordCnt - 1U].seq);
+    HostTest_checkEqual(decoder.stats.restartCnt, 0U);
+
+    HostTest_check(lostCnt >= 20U);
+    HostTest_check(lostCnt <= 40U);
+    HostTest_checkEqual(recordCnt, 100U - lostCnt);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkDecoder();
+    checkLengths();
+    checkRecordTypes();
+    checkPartialWrites();
+    checkFlushThreshold();
+    checkCorruption();
+
+    return HostTest_exit("Telemetry");
+}
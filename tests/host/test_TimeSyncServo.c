@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_TimeSyncServo.c ========
+ *  Host checks of the time sync clock servo against a simulated master clock
+ *  with a frequency error and timestamp jitter, across a SYSTIM wrap and an
+ *  offset step, and of several followers synchronized to the same master.
+ */
+#include <stdint.h>
+
+#include "HostTest.h"
+#include "TimeSyncServo.h"
+
+/* Time sync interval in 250ns ticks: 100ms */
+#define SYNC_INTERVAL 400000U
+
+/* Master frequency relative to the local clock, in ppb */
+#define MASTER_FREQ_PPB 50000
+
+/* Largest timestamp error of a sample in 250ns ticks */
+#define JITTER 4
+
+/* Samples until the servo is expected to have settled, and samples checked */
+#define SETTLE_SAMPLES 50U
+#define CHECK_SAMPLES  200U
+
+/* Followers simulated by checkFollowers() */
+#define FOLLOWER_COUNT 4U
+
+static uint32_t randomState = 1U;
+
+/*
+ *  ======== jitter ========
+ *  Pseudo-random timestamp error from -JITTER to JITTER.
+ */
+static int32_t jitter(void)
+{
+    randomState = (randomState * 1103515245U) + 12345U;
+
+    return (int32_t)((randomState >> 16) % ((2U * JITTER) + 1U)) - JITTER;
+}
+
+/*
+ *  ======== scaleTime ========
+ *  Scales an elapsed time by a frequency offset in ppb.
+ */
+static uint32_t scaleTime(uint32_t elapsed, int32_t freqPpb)
+{
+    return elapsed + (uint32_t)(((int64_t)elapsed * freqPpb) / 1000000000LL);
+}
+
+/*
+ *  ======== masterTimeAt ========
+ *  Master time for a local time, with the master running MASTER_FREQ_PPB
+ *  faster and starting at masterStart.
+ */
+static uint32_t masterTimeAt(uint32_t localStart, uint32_t masterStart, uint32_t localTime)
+{
+    return masterStart + scaleTime(localTime - localStart, MASTER_FREQ_PPB);
+}
+
+/*
+ *  ======== absDiff ========
+ */
+static uint32_t absDiff(uint32_t a, uint32_t b)
+{
+    int32_t diff = (int32_t)(a - b);
+
+    return (diff < 0) ? (uint32_t)-diff : (uint32_t)diff;
+}
+
+/*
+ *  ======== checkUnlocked ========
+ */
+static void checkUnlocked(void)
+{
+    TimeSyncServo_Object servo;
+    TimeSyncServo_Stats stats;
+
+    TimeSyncServo_construct(&servo);
+
+    HostTest_checkEqual(TimeSyncServo_getState(&servo), TimeSyncServo_State_UNLOCKED);
+    HostTest_checkEqual(TimeSyncServo_getNetworkTime(&servo, 1234U), 1234U);
+
+    TimeSyncServo_getStats(&servo, &stats);
+    HostTest_checkEqual(stats.samples, 0U);
+    HostTest_checkEqual(stats.resets, 0U);
+}
+
+/*
+ *  ======== checkTracking ========
+ *  The local time starts shortly before the 32-bit SYSTIM wraps.
+ */
+static void checkTracking(void)
+{
+    TimeSyncServo_Object servo;
+    TimeSyncServo_Stats stats;
+    uint32_t localStart  = 0xFFF00000U;
+    uint32_t masterStart = 0x12345678U;
+    uint32_t maxError    = 0U;
+    uint32_t localTime;
+    uint32_t masterTime;
+    uint32_t error;
+    uint32_t i;
+    int32_t offset;
+
+    TimeSyncServo_construct(&servo);
+
+    for (i = 0U; i < (SETTLE_SAMPLES + CHECK_SAMPLES); i++)
+    {
+        localTime  = localStart + (i * SYNC_INTERVAL);
+        masterTime = masterTimeAt(localStart, masterStart, localTime);
+        offset     = TimeSyncServo_update(&servo, localTime + (uint32_t)jitter(), masterTime);
+
+        if (i == 0U)
+        {
+            HostTest_checkEqual(TimeSyncServo_getState(&servo), TimeSyncServo_State_LOCKING);
+            HostTest_checkEqual(offset, 0);
+        }
+
+        /* Once settled, the network time predicted halfway to the next sample
+         * stays within a few jitters of the master time.
+         */
+        if (i >= SETTLE_SAMPLES)
+        {
+            localTime += SYNC_INTERVAL / 2U;
+            error = absDiff(TimeSyncServo_getNetworkTime(&servo, localTime),
+                            masterTimeAt(localStart, masterStart, localTime));
+
+            if (error > maxError)
+            {
+                maxError = error;
+            }
+        }
+    }
+
+    HostTest_checkEqual(TimeSyncServo_getState(&servo), TimeSyncServo_State_LOCKED);
+    HostTest_check(maxError <= (3U * JITTER));
+
+    TimeSyncServo_getStats(&servo, &stats);
+    HostTest_checkEqual(stats.samples, SETTLE_SAMPLES + CHECK_SAMPLES - 2U);
+    HostTest_checkEqual(stats.resets, 0U);
+    HostTest_check(stats.maxOffsetNs <= (4U * JITTER * 250U));
+    HostTest_check(stats.stddevOffsetNs <= (2U * JITTER * 250U));
+    HostTest_check((stats.freqPpb > MASTER_FREQ_PPB - 500) && (stats.freqPpb < MASTER_FREQ_PPB + 500));
+}
+
+/*
+ *  ======== checkStep ========
+ *  An offset above TimeSyncServo_STEP_THRESHOLD restarts the servo from the
+ *  new sample.
+ */
+static void checkStep(void)
+{
+    TimeSyncServo_Object servo;
+    TimeSyncServo_Stats stats;
+    uint32_t localTime = 1000000U;
+    uint32_t i;
+
+    TimeSyncServo_construct(&servo);
+
+    for (i = 0U; i < 5U; i++)
+    {
+        (void)TimeSyncServo_update(&servo, localTime, localTime);
+        localTime += SYNC_INTERVAL;
+    }
+
+    TimeSyncServo_getStats(&servo, &stats);
+
+    HostTest_checkEqual(TimeSyncServo_update(&servo, localTime, localTime + TimeSyncServo_STEP_THRESHOLD + 1U), 0);
+    HostTest_checkEqual(TimeSyncServo_getState(&servo), TimeSyncServo_State_LOCKING);
+    HostTest_checkEqual(TimeSyncServo_getNetworkTime(&servo, localTime), localTime + TimeSyncServo_STEP_THRESHOLD + 1U);
+
+    TimeSyncServo_getStats(&servo, &stats);
+    HostTest_checkEqual(stats.resets, 1U);
+    HostTest_checkEqual(stats.samples, 0U);
+}
+
+/*
+ *  ======== checkFollowers ========
+ *  Followers with different clock frequencies and start times each track the
+ *  same master, and agree on the network time once settled.
+ */
+static void checkFollowers(void)
+{
+    static const int32_t localFreqPpb[FOLLOWER_COUNT] = {0, -20000, 35000, 100000};
+    TimeSyncServo_Object servos[FOLLOWER_COUNT];
+    TimeSyncServo_Stats stats;
+    uint32_t localStart[FOLLOWER_COUNT];
+    uint32_t masterStart = 0x80000000U;
+    uint32_t masterTime;
+    uint32_t localTime;
+    uint32_t networkTime[FOLLOWER_COUNT];
+    uint32_t maxSpread = 0U;
+    uint32_t spread;
+    uint32_t i;
+    uint32_t f;
+
+    for (f = 0U; f < FOLLOWER_COUNT; f++)
+    {
+        TimeSyncServo_construct(&servos[f]);
+        localStart[f] = 0xFFFF0000U * f;
+    }
+
+    for (i = 0U; i < (SETTLE_SAMPLES + CHECK_SAMPLES); i++)
+    {
+        /* Every follower timestamps the same time sync message */
+        masterTime = masterStart + (i * SYNC_INTERVAL);
+
+        for (f = 0U; f < FOLLOWER_COUNT; f++)
+        {
+            localTime = localStart[f] + scaleTime(i * SYNC_INTERVAL, localFreqPpb[f]);
+            (void)TimeSyncServo_update(&servos[f], localTime + (uint32_t)jitter(), masterTime);
+        }
+
+        /* Halfway to the next sample, the followers convert their own local
+         * time of the same instant to nearly the same network time.
+         */
+        if (i >= SETTLE_SAMPLES)
+        {
+            for (f = 0U; f < FOLLOWER_COUNT; f++)
+            {
+                localTime      = localStart[f] + scaleTime((i * SYNC_INTERVAL) + (SYNC_INTERVAL / 2U), localFreqPpb[f]);
+                networkTime[f] = TimeSyncServo_getNetworkTime(&servos[f], localTime);
+
+                spread = absDiff(networkTime[f], networkTime[0]);
+                if (spread > maxSpread)
+                {
+                    maxSpread = spread;
+                }
+            }
+        }
+    }
+
+    HostTest_check(maxSpread <= (6U * JITTER));
+
+    for (f = 0U; f < FOLLOWER_COUNT; f++)
+    {
+        HostTest_checkEqual(TimeSyncServo_getState(&servos[f]), TimeSyncServo_State_LOCKED);
+
+        /* The master runs at the nominal rate, so each follower estimates the
+         * inverse of its own frequency offset. The jitter moves the estimate by
+         * a few ppm from sample to sample.
+         */
+        TimeSyncServo_getStats(&servos[f], &stats);
+        HostTest_checkEqual(stats.resets, 0U);
+        HostTest_check((stats.freqPpb > -localFreqPpb[f] - 5000) && (stats.freqPpb < -localFreqPpb[f] + 5000));
+    }
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    checkUnlocked();
+    checkTracking();
+    checkStep();
+    checkFollowers();
+
+    return HostTest_exit("TimeSyncServo");
+}
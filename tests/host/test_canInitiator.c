@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_canInitiator.c ========
+ *  Host check of the canInitiator and canResponder examples on the virtual
+ *  CAN bus. A classic CAN and a CAN FD test message are sent by clicking the
+ *  buttons of the initiator, and the frames on the bus and the result the
+ *  initiator prints are checked. Pass -v to print the UART output of the
+ *  nodes.
+ */
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "HostTest.h"
+#include "VirtualCAN.h"
+
+/* Test message IDs of the examples */
+#define TEST_MSG_ID         0x5AAU
+#define TEST_FD_MSG_ID      0x12345678U
+#define TEST_RESPONSE_ID    (~TEST_MSG_ID & 0x7FFU)
+#define TEST_FD_RESPONSE_ID (~TEST_FD_MSG_ID & 0x1FFFFFFFU)
+
+/* Button of each test message */
+#define BUTTON_FD      0U
+#define BUTTON_CLASSIC 1U
+
+/* Time to wait for the output of a node */
+#define OUTPUT_TIMEOUT_MS 2000U
+
+/* Maximum number of frames recorded */
+#define FRAME_MAX 16U
+
+#define READY_TEXT "Waiting for button press"
+#define PASS_TEXT  "=> PASS: Received message matches expected."
+#define FAIL_TEXT  "=> FAIL"
+
+extern void *initiator_mainThread(void *arg0);
+extern void *responder_mainThread(void *arg0);
+
+static pthread_mutex_t frameLock = PTHREAD_MUTEX_INITIALIZER;
+static VirtualCAN_Frame frames[FRAME_MAX];
+static uint32_t frameCnt;
+
+/*
+ *  ======== monitorFxn ========
+ */
+static void monitorFxn(const VirtualCAN_Frame *frame, void *arg)
+{
+    pthread_mutex_lock(&frameLock);
+
+    if (frameCnt < FRAME_MAX)
+    {
+        frames[frameCnt] = *frame;
+    }
+
+    frameCnt++;
+
+    pthread_mutex_unlock(&frameLock);
+}
+
+/*
+ *  ======== checkExchange ========
+ *  Checks the request and the response of the last exchange, which are the
+ *  frames at index first.
+ */
+static void checkExchange(uint32_t first, uint32_t requestId, uint32_t responseId, bool fd)
+{
+    const CAN_TxBufElement *request;
+    const CAN_TxBufElement *response;
+    uint32_t length = fd ? 64U : 8U;
+    uint32_t i;
+
+    pthread_mutex_lock(&frameLock);
+
+    HostTest_checkEqual(frameCnt, first + 2U);
+
+    if (frameCnt == (first + 2U))
+    {
+        request  = &frames[first].elem;
+        response = &frames[first + 1U].elem;
+
+        HostTest_check(strcmp(frames[first].source, "initiator") == 0);
+        HostTest_check(strcmp(frames[first + 1U].source, "responder") == 0);
+
+        HostTest_checkEqual(request->id, requestId);
+        HostTest_checkEqual(request->xtd, fd ? 1U : 0U);
+        HostTest_checkEqual(request->fdf, fd ? 1U : 0U);
+        HostTest_checkEqual(request->brs, fd ? 1U : 0U);
+        HostTest_checkEqual(request->dlc, fd ? CAN_DLC_64B : CAN_DLC_8B);
+
+        /* The responder returns the inverted payload with the inverted ID */
+        HostTest_checkEqual(response->id, responseId);
+        HostTest_checkEqual(response->xtd, request->xtd);
+        HostTest_checkEqual(response->fdf, request->fdf);
+        HostTest_checkEqual(response->dlc, request->dlc);
+
+        for (i = 0U; i < length; i++)
+        {
+            if (response->data[i] != (uint8_t)~request->data[i])
+            {
+                break;
+            }
+        }
+
+        HostTest_checkEqual(i, length);
+
+        /* The response is sent after the request */
+        HostTest_check(frames[first + 1U].sofTimeNs >= (frames[first].sofTimeNs + frames[first].durationNs));
+    }
+
+    pthread_mutex_unlock(&frameLock);
+}
+
+/*
+ *  ======== clickButton ========
+ *  Clicks a button of the initiator, which opens its buttons after it prints
+ *  that it is ready.
+ */
+static bool clickButton(VirtualCAN_Node *initiator, uint32_t index)
+{
+    const struct timespec retryTime = {0, 1000000L};
+    uint32_t retries;
+
+    for (retries = 0U; retries < OUTPUT_TIMEOUT_MS; retries++)
+    {
+        if (VirtualCAN_clickButton(initiator, index))
+        {
+            return true;
+        }
+
+        nanosleep(&retryTime, NULL);
+    }
+
+    return false;
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    VirtualCAN_Node *initiator;
+    VirtualCAN_Node *responder;
+
+    VirtualCAN_trace = (argc > 1) && (strcmp(argv[1], "-v") == 0);
+
+    VirtualCAN_init(monitorFxn, NULL);
+
+    initiator = VirtualCAN_addNode("initiator", initiator_mainThread, 0, 0U);
+    responder = VirtualCAN_addNode("responder", responder_mainThread, 0, 0U);
+
+    VirtualCAN_startNode(responder);
+    VirtualCAN_startNode(initiator);
+
+    HostTest_check(VirtualCAN_waitForOutput(initiator, READY_TEXT, 1U, OUTPUT_TIMEOUT_MS));
+
+    HostTest_check(clickButton(initiator, BUTTON_CLASSIC));
+    HostTest_check(VirtualCAN_waitForOutput(initiator, PASS_TEXT, 1U, OUTPUT_TIMEOUT_MS));
+    checkExchange(0U, TEST_MSG_ID, TEST_RESPONSE_ID, false);
+
+    HostTest_check(clickButton(initiator, BUTTON_FD));
+    HostTest_check(VirtualCAN_waitForOutput(initiator, PASS_TEXT, 2U, OUTPUT_TIMEOUT_MS));
+    checkExchange(2U, TEST_FD_MSG_ID, TEST_FD_RESPONSE_ID, true);
+
+    HostTest_checkEqual(VirtualCAN_countOutput(initiator, FAIL_TEXT), 0U);
+
+    return HostTest_exit("canInitiator");
+}
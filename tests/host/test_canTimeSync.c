@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_canTimeSync.c ========
+ *  Host check of the canTimeSync example on the virtual CAN bus. A master and
+ *  two followers whose clocks run at other frequencies and start at other
+ *  times exchange time sync and follow-up messages, sent by clicking BTN-1 of
+ *  the master. The servo samples the followers print must lock to the master
+ *  time, and the LED toggles scheduled at the SOF of each time sync message
+ *  must happen together on all nodes. Pass -v to print the UART output of the
+ *  nodes.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <ti/drivers/CAN.h>
+
+#include "HostTest.h"
+#include "VirtualCAN.h"
+
+/* Time sync messages sent by the master */
+#define SYNC_COUNT 40U
+
+/* Time between time sync messages */
+#define SYNC_INTERVAL_MS 50U
+
+/* Samples of each follower skipped while the servo locks */
+#define LOCK_SAMPLES 10U
+
+/* Largest offset of a locked follower. It covers the jitter of the host
+ * threads between the SYSTIM and the timestamp counter reads of a node.
+ */
+#define MAX_LOCKED_OFFSET_NS 2000
+
+/* Largest error of the frequency correction of a locked follower. The
+ * frequency estimate follows the offset jitter.
+ */
+#define MAX_FREQ_ERROR_PPB 10000
+
+/* Largest difference of the LED toggles of two nodes. The compare events of
+ * the nodes are polled by host threads.
+ */
+#define MAX_TOGGLE_SKEW_NS 500000U
+
+/* Time to wait for the output of a node */
+#define OUTPUT_TIMEOUT_MS 2000U
+
+/* Output buffer size of a node */
+#define OUTPUT_SIZE (1024U * 1024U)
+
+/* BTN-1 sends a time sync message */
+#define BUTTON_TIME_SYNC 0U
+
+/* LED toggled at the time sync messages */
+#define LED_TIME_SYNC 1U
+
+#define FOLLOWER_COUNT 2U
+
+/* Printed value of TimeSyncServo_State_LOCKED */
+#define SERVO_STATE_LOCKED 2U
+
+#define READY_TEXT "CAN Time Sync ready."
+#define SERVO_TEXT "> Servo: "
+#define SERVO_LINE "> Servo: offset = %d ns, freq = %d ppb, state = %u"
+
+extern void *master_mainThread(void *arg0);
+extern void *follower1_mainThread(void *arg0);
+extern void *follower2_mainThread(void *arg0);
+
+/* Clock frequency errors of the followers, in ppb */
+static const int32_t followerPpb[FOLLOWER_COUNT] = {50000, -30000};
+
+/*
+ *  ======== checkServo ========
+ *  Checks the servo samples in the output of a follower whose clock runs
+ *  freqPpb faster than the master clock.
+ */
+static void checkServo(VirtualCAN_Node *follower, int32_t freqPpb)
+{
+    char *output;
+    const char *line;
+    size_t length;
+    uint32_t sampleCnt = 0U;
+    uint32_t lockedCnt = 0U;
+    int32_t maxOffset    = 0;
+    int32_t maxFreqError = 0;
+    int32_t offset;
+    int32_t freq;
+    unsigned int state;
+
+    output = malloc(OUTPUT_SIZE + 1U);
+    if (output == NULL)
+    {
+        HostTest_check(false);
+        return;
+    }
+
+    length         = VirtualCAN_readOutput(follower, 0U, output, OUTPUT_SIZE);
+    output[length] = '\0';
+
+    for (line = strstr(output, SERVO_TEXT); line != NULL; line = strstr(line + 1, SERVO_TEXT))
+    {
+        if (sscanf(line, SERVO_LINE, &offset, &freq, &state) != 3)
+        {
+            HostTest_check(false);
+            continue;
+        }
+
+        sampleCnt++;
+
+        if (sampleCnt > LOCK_SAMPLES)
+        {
+            lockedCnt += (state == SERVO_STATE_LOCKED);
+
+            if (abs(offset) > maxOffset)
+            {
+                maxOffset = abs(offset);
+            }
+
+            /* The servo corrects the frequency error of the follower */
+            if (abs(freq + freqPpb) > maxFreqError)
+            {
+                maxFreqError = abs(freq + freqPpb);
+            }
+        }
+    }
+
+    HostTest_checkEqual(sampleCnt, SYNC_COUNT);
+    HostTest_checkEqual(lockedCnt, SYNC_COUNT - LOCK_SAMPLES);
+    HostTest_check(maxOffset <= MAX_LOCKED_OFFSET_NS);
+    HostTest_check(maxFreqError <= MAX_FREQ_ERROR_PPB);
+
+    free(output);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(int argc, char *argv[])
+{
+    const struct timespec interval = {0, SYNC_INTERVAL_MS * 1000000L};
+    VirtualCAN_Node *master;
+    VirtualCAN_Node *followers[FOLLOWER_COUNT];
+    uint64_t masterToggleNs;
+    uint64_t toggleNs;
+    uint32_t i;
+
+    VirtualCAN_trace = (argc > 1) && (strcmp(argv[1], "-v") == 0);
+
+    VirtualCAN_init(NULL, NULL);
+
+    master       = VirtualCAN_addNode("master", master_mainThread, 0, 0U);
+    followers[0] = VirtualCAN_addNode("follower1", follower1_mainThread, followerPpb[0], 0x12345678U);
+    followers[1] = VirtualCAN_addNode("follower2", follower2_mainThread, followerPpb[1], 0xFFF00000U);
+
+    VirtualCAN_startNode(master);
+
+    for (i = 0U; i < FOLLOWER_COUNT; i++)
+    {
+        VirtualCAN_startNode(followers[i]);
+    }
+
+    HostTest_check(VirtualCAN_waitForOutput(master, READY_TEXT, 1U, OUTPUT_TIMEOUT_MS));
+
+    for (i = 0U; i < FOLLOWER_COUNT; i++)
+    {
+        HostTest_check(VirtualCAN_waitForOutput(followers[i], READY_TEXT, 1U, OUTPUT_TIMEOUT_MS));
+    }
+
+    for (i = 0U; i < SYNC_COUNT; i++)
+    {
+        HostTest_check(VirtualCAN_clickButton(master, BUTTON_TIME_SYNC));
+        nanosleep(&interval, NULL);
+    }
+
+    for (i = 0U; i < FOLLOWER_COUNT; i++)
+    {
+        HostTest_check(VirtualCAN_waitForOutput(followers[i], SERVO_TEXT, SYNC_COUNT, OUTPUT_TIMEOUT_MS));
+        checkServo(followers[i], followerPpb[i]);
+    }
+
+    /* Each node toggles its LED at the same time after the SOF of each time
+     * sync message
+     */
+    HostTest_checkEqual(VirtualCAN_getLedToggles(master, LED_TIME_SYNC, &masterToggleNs), SYNC_COUNT);
+
+    for (i = 0U; i < FOLLOWER_COUNT; i++)
+    {
+        HostTest_checkEqual(VirtualCAN_getLedToggles(followers[i], LED_TIME_SYNC, &toggleNs), SYNC_COUNT);
+        HostTest_check(llabs((long long)(toggleNs - masterToggleNs)) <= MAX_TOGGLE_SKEW_NS);
+    }
+
+    return HostTest_exit("canTimeSync");
+}
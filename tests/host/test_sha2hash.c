@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== test_sha2hash.c ========
+ *  Host checks of the stream mode of the sha2hash example: the digest of
+ *  streams received in partial reads of random size, the double buffering,
+ *  read errors, and the stream length prompt. The example source is
+ *  included, so its static functions can be called. The UART2 and SHA2
+ *  drivers are simulated, with a reference SHA-256.
+ */
+#include <semaphore.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <ti/drivers/SHA2.h>
+#include <ti/drivers/UART2.h>
+
+#include "HostTest.h"
+
+/* Reference SHA-256 */
+typedef struct
+{
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t block[64];
+    size_t blockLength;
+} Sha256;
+
+static const uint32_t sha256K[64] = {
+    0x428A2F98U, 0x71374491U, 0xB5C0FBCFU, 0xE9B5DBA5U, 0x3956C25BU, 0x59F111F1U, 0x923F82A4U, 0xAB1C5ED5U,
+    0xD807AA98U, 0x12835B01U, 0x243185BEU, 0x550C7DC3U, 0x72BE5D74U, 0x80DEB1FEU, 0x9BDC06A7U, 0xC19BF174U,
+    0xE49B69C1U, 0xEFBE4786U, 0x0FC19DC6U, 0x240CA1CCU, 0x2DE92C6FU, 0x4A7484AAU, 0x5CB0A9DCU, 0x76F988DAU,
+    0x983E5152U, 0xA831C66DU, 0xB00327C8U, 0xBF597FC7U, 0xC6E00BF3U, 0xD5A79147U, 0x06CA6351U, 0x14292967U,
+    0x27B70A85U, 0x2E1B2138U, 0x4D2C6DFCU, 0x53380D13U, 0x650A7354U, 0x766A0ABBU, 0x81C2C92EU, 0x92722C85U,
+    0xA2BFE8A1U, 0xA81A664BU, 0xC24B8B70U, 0xC76C51A3U, 0xD192E819U, 0xD6990624U, 0xF40E3585U, 0x106AA070U,
+    0x19A4C116U, 0x1E376C08U, 0x2748774CU, 0x34B0BCB5U, 0x391C0CB3U, 0x4ED8AA4AU, 0x5B9CCA4FU, 0x682E6FF3U,
+    0x748F82EEU, 0x78A5636FU, 0x84C87814U, 0x8CC70208U, 0x90BEFFFAU, 0xA4506CEBU, 0xBEF9A3F7U, 0xC67178F2U,
+};
+
+/* Simulated UART */
+static const uint8_t *feedData;
+static size_t feedLength;
+static size_t feedPos;
+static size_t errorPos;
+static uint8_t *readBuf;
+static size_t readSize;
+static bool readPending;
+static UART2_Callback readCallbackFxn;
+static char echo[64];
+static size_t echoLength;
+
+/* Simulated SHA2 accelerator */
+static Sha256 sha2Context;
+static uint32_t addDataCnt;
+static uint32_t overlapCnt;
+
+static uint32_t randomState = 1U;
+
+/*
+ *  ======== nextRandom ========
+ */
+static uint32_t nextRandom(void)
+{
+    randomState = (randomState * 1103515245U) + 12345U;
+
+    return randomState >> 8;
+}
+
+/*
+ *  ======== rotr ========
+ */
+static uint32_t rotr(uint32_t value, uint32_t count)
+{
+    return (value >> count) | (value << (32U - count));
+}
+
+/*
+ *  ======== sha256Block ========
+ */
+static void sha256Block(Sha256 *ctx, const uint8_t *block)
+{
+    uint32_t w[64];
+    uint32_t v[8];
+    uint32_t t1;
+    uint32_t t2;
+    uint32_t i;
+
+    for (i = 0U; i < 16U; i++)
+    {
+        w[i] = ((uint32_t)block[4U * i] << 24) | ((uint32_t)block[(4U * i) + 1U] << 16) |
+               ((uint32_t)block[(4U * i) + 2U] << 8) | block[(4U * i) + 3U];
+    }
+
+    for (i = 16U; i < 64U; i++)
+    {
+        w[i] = w[i - 16U] + (rotr(w[i - 15U], 7U) ^ rotr(w[i - 15U], 18U) ^ (w[i - 15U] >> 3)) + w[i - 7U] +
+               (rotr(w[i - 2U], 17U) ^ rotr(w[i - 2U], 19U) ^ (w[i - 2U] >> 10));
+    }
+
+    (void)memcpy(v, ctx->state, sizeof(v));
+
+    for (i = 0U; i < 64U; i++)
+    {
+        t1 = v[7] + (rotr(v[4], 6U) ^ rotr(v[4], 11U) ^ rotr(v[4], 25U)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) +
+             sha256K[i] + w[i];
+        t2 = (rotr(v[0], 2U) ^ rotr(v[0], 13U) ^ rotr(v[0], 22U)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+
+        v[7] = v[6];
+        v[6] = v[5];
+        v[5] = v[4];
+        v[4] = v[3] + t1;
+        v[3] = v[2];
+        v[2] = v[1];
+        v[1] = v[0];
+        v[0] = t1 + t2;
+    }
+
+    for (i = 0U; i < 8U; i++)
+    {
+        ctx->state[i] += v[i];
+    }
+}
+
+/*
+ *  ======== sha256Reset ========
+ */
+static void sha256Reset(Sha256 *ctx)
+{
+    static const uint32_t init[8] =
+        {0x6A09E667U, 0xBB67AE85U, 0x3C6EF372U, 0xA54FF53AU, 0x510E527FU, 0x9B05688CU, 0x1F83D9ABU, 0x5BE0CD19U};
+
+    (void)memcpy(ctx->state, init, sizeof(init));
+    ctx->length      = 0U;
+    ctx->blockLength = 0U;
+}
+
+/*
+ *  ======== sha256Add ========
+ */
+static void sha256Add(Sha256 *ctx, const uint8_t *data, size_t length)
+{
+    ctx->length += length;
+
+    while (length-- > 0U)
+    {
+        ctx->block[ctx->blockLength++] = *data++;
+
+        if (ctx->blockLength == 64U)
+        {
+            sha256Block(ctx, ctx->block);
+            ctx->blockLength = 0U;
+        }
+    }
+}
+
+/*
+ *  ======== sha256Finalize ========
+ */
+static void sha256Finalize(Sha256 *ctx, uint8_t *digest)
+{
+    uint64_t bits = ctx->length * 8U;
+    uint8_t pad   = 0x80U;
+    uint8_t size[8];
+    uint32_t i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        size[i] = (uint8_t)(bits >> (56U - (8U * i)));
+    }
+
+    sha256Add(ctx, &pad, 1U);
+    pad = 0U;
+
+    while (ctx->blockLength != 56U)
+    {
+        sha256Add(ctx, &pad, 1U);
+    }
+
+    sha256Add(ctx, size, sizeof(size));
+
+    for (i = 0U; i < 32U; i++)
+    {
+        digest[i] = (uint8_t)(ctx->state[i / 4U] >> (24U - (8U * (i % 4U))));
+    }
+}
+
+/*
+ *  ======== sha256 ========
+ */
+static void sha256(const uint8_t *data, size_t length, uint8_t *digest)
+{
+    Sha256 ctx;
+
+    sha256Reset(&ctx);
+    sha256Add(&ctx, data, length);
+    sha256Finalize(&ctx, digest);
+}
+
+/*
+ *  ======== completeRead ========
+ *  Completes the read in flight with a random number of bytes of the feed,
+ *  or with an overrun error at errorPos.
+ */
+static void completeRead(void)
+{
+    size_t count = 1U + (nextRandom() % readSize);
+    int_fast16_t status = UART2_STATUS_SUCCESS;
+
+    if (count > (feedLength - feedPos))
+    {
+        count = feedLength - feedPos;
+    }
+
+    if (feedPos >= errorPos)
+    {
+        count  = 0U;
+        status = UART2_STATUS_EOVERRUN;
+    }
+    else if (count > (errorPos - feedPos))
+    {
+        count = errorPos - feedPos;
+    }
+
+    (void)memcpy(readBuf, &feedData[feedPos], count);
+    feedPos += count;
+    readPending = false;
+
+    readCallbackFxn(NULL, readBuf, count, NULL, status);
+}
+
+/*
+ *  ======== testSemWait ========
+ *  Completes the read in flight before waiting for its completion, as the
+ *  examples only wait for reads.
+ */
+static int testSemWait(sem_t *sem)
+{
+    if (readPending)
+    {
+        completeRead();
+    }
+
+    return sem_wait(sem);
+}
+
+/*
+ *  ======== UART2_Params_init ========
+ */
+void UART2_Params_init(UART2_Params *params)
+{
+    (void)memset(params, 0, sizeof(*params));
+}
+
+/*
+ *  ======== UART2_open ========
+ */
+UART2_Handle UART2_open(uint_least8_t index, UART2_Params *params)
+{
+    (void)index;
+
+    readCallbackFxn = params->readCallback;
+
+    return (UART2_Handle)&readCallbackFxn;
+}
+
+/*
+ *  ======== UART2_read ========
+ */
+int_fast16_t UART2_read(UART2_Handle handle, void *buffer, size_t size, size_t *bytesRead)
+{
+    (void)handle;
+    (void)bytesRead;
+
+    HostTest_check(!readPending);
+    HostTest_check(size > 0U);
+
+    readBuf     = buffer;
+    readSize    = size;
+    readPending = true;
+
+    return UART2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== UART2_write ========
+ */
+int_fast16_t UART2_write(UART2_Handle handle, const void *buffer, size_t size, size_t *bytesWritten)
+{
+    (void)handle;
+    (void)bytesWritten;
+
+    if ((echoLength + size) <= sizeof(echo))
+    {
+        (void)memcpy(&echo[echoLength], buffer, size);
+        echoLength += size;
+    }
+
+    return UART2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== SHA2_init ========
+ */
+void SHA2_init(void)
+{
+}
+
+/*
+ *  ======== SHA2_open ========
+ */
+SHA2_Handle SHA2_open(uint_least8_t index, const SHA2_Params *params)
+{
+    (void)index;
+    (void)params;
+
+    return (SHA2_Handle)&sha2Context;
+}
+
+/*
+ *  ======== SHA2_reset ========
+ */
+void SHA2_reset(SHA2_Handle handle)
+{
+    (void)handle;
+
+    sha256Reset(&sha2Context);
+}
+
+/*
+ *  ======== SHA2_addData ========
+ *  Hashes the data. The read in flight may complete first, as it would
+ *  while the accelerator is busy, so a read into the buffer being hashed
+ *  changes the digest.
+ */
+int_fast16_t SHA2_addData(SHA2_Handle handle, const void *data, size_t length)
+{
+    (void)handle;
+
+    if (readPending && (readBuf == data))
+    {
+        overlapCnt++;
+    }
+
+    if (readPending && ((nextRandom() % 2U) == 0U))
+    {
+        completeRead();
+    }
+
+    sha256Add(&sha2Context, data, length);
+    addDataCnt++;
+
+    return SHA2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== SHA2_finalize ========
+ */
+int_fast16_t SHA2_finalize(SHA2_Handle handle, void *digest)
+{
+    (void)handle;
+
+    sha256Finalize(&sha2Context, digest);
+
+    return SHA2_STATUS_SUCCESS;
+}
+
+/*
+ *  ======== SHA2_hashData ========
+ */
+int_fast16_t SHA2_hashData(SHA2_Handle handle, const void *data, size_t length, void *digest)
+{
+    (void)handle;
+
+    sha256(data, length, digest);
+
+    return SHA2_STATUS_SUCCESS;
+}
+
+/* The example in stream mode, waiting through testSemWait() */
+#define SHA2HASH_STREAM_MODE 1
+#define sem_wait             testSemWait
+#include "sha2hash.c"
+#undef sem_wait
+
+/*
+ *  ======== setup ========
+ *  Opens the simulated UART with a feed of length bytes.
+ */
+static void setup(const uint8_t *data, size_t length)
+{
+    UART2_Params params;
+
+    feedData    = data;
+    feedLength  = length;
+    feedPos     = 0U;
+    errorPos    = SIZE_MAX;
+    readPending = false;
+    echoLength  = 0U;
+    addDataCnt  = 0U;
+    overlapCnt  = 0U;
+
+    UART2_Params_init(&params);
+    params.readMode       = UART2_Mode_CALLBACK;
+    params.readCallback   = readCallback;
+    params.readReturnMode = UART2_ReadReturnMode_PARTIAL;
+    (void)UART2_open(CONFIG_UART2_0, &params);
+}
+
+/*
+ *  ======== checkReference ========
+ *  The reference SHA-256 against the FIPS 180-2 examples.
+ */
+static void checkReference(void)
+{
+    static const uint8_t abcDigest[32] = {0xBAU, 0x78U, 0x16U, 0xBFU, 0x8FU, 0x01U, 0xCFU, 0xEAU,
+                                          0x41U, 0x41U, 0x40U, 0xDEU, 0x5DU, 0xAEU, 0x22U, 0x23U,
+                                          0xB0U, 0x03U, 0x61U, 0xA3U, 0x96U, 0x17U, 0x7AU, 0x9CU,
+                                          0xB4U, 0x10U, 0xFFU, 0x61U, 0xF2U, 0x00U, 0x15U, 0xADU};
+    static const uint8_t twoBlockDigest[32] = {0x24U, 0x8DU, 0x6AU, 0x61U, 0xD2U, 0x06U, 0x38U, 0xB8U,
+                                               0xE5U, 0xC0U, 0x26U, 0x93U, 0x0CU, 0x3EU, 0x60U, 0x39U,
+                                               0xA3U, 0x3CU, 0xE4U, 0x59U, 0x64U, 0xFFU, 0x21U, 0x67U,
+                                               0xF6U, 0xECU, 0xEDU, 0xD4U, 0x19U, 0xDBU, 0x06U, 0xC1U};
+    static const char twoBlock[] = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+    uint8_t digest[32];
+
+    sha256((const uint8_t *)"abc", 3U, digest);
+    HostTest_check(memcmp(digest, abcDigest, sizeof(digest)) == 0);
+
+    sha256((const uint8_t *)twoBlock, sizeof(twoBlock) - 1U, digest);
+    HostTest_check(memcmp(digest, twoBlockDigest, sizeof(digest)) == 0);
+}
+
+/*
+ *  ======== checkStream ========
+ *  Streams of lengths around the block size, received in random partial
+ *  reads, hash to the digest of the whole stream.
+ */
+static void checkStream(void)
+{
+    static const uint32_t lengths[] = {0U, 1U, 63U, 64U, 1023U, 1024U, 1025U, 2048U, 100000U};
+    static uint8_t data[100000];
+    uint8_t expected[SHA2_DIGEST_LENGTH_BYTES_256];
+    uint8_t digest[SHA2_DIGEST_LENGTH_BYTES_256];
+    uint32_t i;
+
+    for (i = 0U; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)nextRandom();
+    }
+
+    for (i = 0U; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+    {
+        setup(data, sizeof(data));
+
+        HostTest_checkEqual(hashStream(NULL, NULL, lengths[i], digest), lengths[i]);
+        sha256(data, lengths[i], expected);
+        HostTest_check(memcmp(digest, expected, sizeof(digest)) == 0);
+
+        /* Nothing beyond the stream is read */
+        HostTest_checkEqual(feedPos, lengths[i]);
+        HostTest_check(!readPending);
+        HostTest_checkEqual(overlapCnt, 0U);
+    }
+
+    /* A long stream is hashed in many partial blocks */
+    HostTest_check(addDataCnt > (100000U / STREAM_BLOCK_SIZE));
+}
+
+/*
+ *  ======== checkReadError ========
+ *  An overrun ends the stream. The bytes received before it are hashed.
+ */
+static void checkReadError(void)
+{
+    static uint8_t data[5000];
+    uint8_t expected[SHA2_DIGEST_LENGTH_BYTES_256];
+    uint8_t digest[SHA2_DIGEST_LENGTH_BYTES_256];
+
+    (void)memset(data, 0x5A, sizeof(data));
+
+    setup(data, sizeof(data));
+    errorPos = 3000U;
+
+    HostTest_checkEqual(hashStream(NULL, NULL, sizeof(data), digest), 3000U);
+    sha256(data, 3000U, expected);
+    HostTest_check(memcmp(digest, expected, sizeof(digest)) == 0);
+    HostTest_check(!readPending);
+}
+
+/*
+ *  ======== checkReadLength ========
+ *  The length prompt echoes digits only, ignores other characters and a
+ *  carriage-return before the first digit, and limits the digits.
+ */
+static void checkReadLength(void)
+{
+    static const char input[]     = "\r1x2 3\r";
+    static const char longInput[] = "12345678901234\r";
+
+    setup((const uint8_t *)input, sizeof(input) - 1U);
+    HostTest_checkEqual(readLength(NULL), 123U);
+    HostTest_checkEqual(feedPos, sizeof(input) - 1U);
+    HostTest_checkEqual(echoLength, 3U);
+    HostTest_check(memcmp(echo, "123", 3U) == 0);
+
+    setup((const uint8_t *)longInput, sizeof(longInput) - 1U);
+    HostTest_checkEqual(readLength(NULL), 123456789U);
+    HostTest_checkEqual(echoLength, STREAM_LENGTH_DIGITS);
+}
+
+/*
+ *  ======== main ========
+ */
+int main(void)
+{
+    HostTest_check(sem_init(&readSem, 0, 0) == 0);
+
+    checkReference();
+    checkStream();
+    checkReadError();
+    checkReadLength();
+
+    return HostTest_exit("sha2hash");
+}
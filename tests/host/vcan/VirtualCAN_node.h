@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Texas Instruments Incorporated
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * *  Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * *  Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * *  Neither the name of Texas Instruments Incorporated nor the names of
+ *    its contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *  ======== VirtualCAN_node.h ========
+ *  Included ahead of each source of the example nodes on the virtual CAN bus.
+ *  The threads created by a node belong to the node, and the stack size and
+ *  priority of the target are ignored, as the host needs larger stacks and
+ *  has no fixed priorities. The DWT cycle counter counts 96 MHz cycles of
+ *  the host clock.
+ */
+
+#ifndef VirtualCAN_node__include
+#define VirtualCAN_node__include
+
+#include <pthread.h>
+#include <stdint.h>
+
+extern int VirtualCAN_pthreadCreate(pthread_t *thread,
+                                    const pthread_attr_t *attr,
+                                    void *(*startFxn)(void *),
+                                    void *arg);
+extern int VirtualCAN_pthreadAttrSetStackSize(pthread_attr_t *attr, size_t size);
+extern int VirtualCAN_pthreadAttrSetSchedParam(pthread_attr_t *attr, const struct sched_param *param);
+extern uint32_t VirtualCAN_getCycles(void);
+extern volatile uint32_t VirtualCAN_dwtCtrl;
+extern volatile uint32_t VirtualCAN_demcr;
+
+#define pthread_create             VirtualCAN_pthreadCreate
+#define pthread_attr_setstacksize  VirtualCAN_pthreadAttrSetStackSize
+#define pthread_attr_setschedparam VirtualCAN_pthreadAttrSetSchedParam
+
+#define DWT_CTRL           VirtualCAN_dwtCtrl
+#define DWT_CYCCNT         VirtualCAN_getCycles()
+#define DWT_CTRL_CYCCNTENA 0x00000001U
+#define DEMCR              VirtualCAN_demcr
+#define DEMCR_TRCENA       0x01000000U
+
+#endif /* VirtualCAN_node__include */